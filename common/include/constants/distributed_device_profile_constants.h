@@ -99,6 +99,9 @@ extern const std::string SPEC_NAME;
 extern const std::string DEVICE_ICON;
 extern const std::string DEVICE_ICON_VERSION;
 extern const std::string DEVICE_ICON_URL;
+extern const std::string DEVICE_ICON_HASH;
+extern const std::string DEVICE_ICON_REF_COUNT;
+extern const std::string DEVICE_ICON_BLOB_TABLE;
  /* ServiceInfo Attribute */
 extern const std::string SRNETWORK_ID;
 extern const std::string SISERVICE_ID;
@@ -244,6 +247,7 @@ constexpr uint32_t MAX_PROFILE_SIZE = 10000;
 constexpr int32_t MAX_DEVICE_SIZE = 1000;
 constexpr uint32_t MAX_SERVICE_SIZE = 5000;
 constexpr int32_t MAX_CHAR_SIZE = 1000;
+constexpr uint32_t MAX_BATCH_QUERY_SIZE = 100;
 constexpr int32_t MAX_DB_SIZE = 5000;
 constexpr int32_t MAX_DUMP_ARGS_SIZE = 1000;
 constexpr int32_t MAX_LISTENER_SIZE = 100;
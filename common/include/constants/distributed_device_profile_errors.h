@@ -222,6 +222,9 @@ constexpr int32_t DP_PRE_MIGRATION_DB_AVAILABLE = 98566339;
 constexpr int32_t DP_PRE_MIGRATION_DB_UNAVAILABLE = 98566340;
 constexpr int32_t DP_NOT_NEED_MIGRATION = 98566341;
 constexpr int32_t DP_NOT_SUPPORT = 98566342;
+constexpr int32_t DP_ASYNC_REQUEST_TIMEOUT = 98566343;
+constexpr int32_t DP_ASYNC_REQUEST_CANCELED = 98566344;
+constexpr int32_t DP_RDBADAPTER_TRANSACTION_FAIL = 98566345;
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
 #endif // OHOS_DP_DISTRIBUTED_DEVICE_PROFILE_ERRORS_H
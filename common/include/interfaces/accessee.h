@@ -31,15 +31,15 @@ public:
 public:
     int64_t GetAccesseeId();
     void SetAccesseeId(int64_t accesseeId);
-    std::string GetAccesseeDeviceId() const;
+    const std::string& GetAccesseeDeviceId() const;
     void SetAccesseeDeviceId(const std::string& accesseeDeviceId);
     int32_t GetAccesseeUserId() const;
     void SetAccesseeUserId(int32_t accesseeUserId);
-    std::string GetAccesseeAccountId() const;
+    const std::string& GetAccesseeAccountId() const;
     void SetAccesseeAccountId(const std::string& accesseeAccountId);
     int64_t GetAccesseeTokenId() const;
     void SetAccesseeTokenId(int64_t accesseeTokenId);
-    std::string GetAccesseeBundleName() const;
+    const std::string& GetAccesseeBundleName() const;
     void SetAccesseeBundleName(const std::string& accesseeBundleName);
     std::string GetAccesseeHapSignature() const;
     void SetAccesseeHapSignature(const std::string& accesseeHapSignature);
@@ -30,15 +30,15 @@ public:
 
     int64_t GetAccesserId();
     void SetAccesserId(int64_t accesserId);
-    std::string GetAccesserDeviceId() const;
+    const std::string& GetAccesserDeviceId() const;
     void SetAccesserDeviceId(const std::string& accesserDeviceId);
     int32_t GetAccesserUserId() const;
     void SetAccesserUserId(int32_t accesserUserId);
-    std::string GetAccesserAccountId() const;
+    const std::string& GetAccesserAccountId() const;
     void SetAccesserAccountId(const std::string& accesserAccountId);
     int64_t GetAccesserTokenId() const;
     void SetAccesserTokenId(int64_t accesserTokenId);
-    std::string GetAccesserBundleName() const;
+    const std::string& GetAccesserBundleName() const;
     void SetAccesserBundleName(const std::string& accesserBundleName);
     std::string GetAccesserHapSignature() const;
     void SetAccesserHapSignature(const std::string& accesserHapSignature);
@@ -17,6 +17,7 @@
 #define OHOS_DP_CHARACTERISTIC_PROFILE_H
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include "distributed_device_profile_constants.h"
 #include "dp_parcel.h"
@@ -26,32 +27,20 @@ namespace DistributedDeviceProfile {
 class CharacteristicProfile : public DpParcel {
 public:
     CharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
-        const std::string& characteristicKey, const std::string& characteristicValue)
-        : deviceId_(deviceId),
-        serviceName_(serviceName),
-        characteristicKey_(characteristicKey),
-        characteristicValue_(characteristicValue)
-    {}
+        const std::string& characteristicKey, const std::string& characteristicValue);
     CharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
         const std::string& characteristicKey, const std::string& characteristicValue, const bool isMultiUser,
-        const int32_t userId)
-        : deviceId_(deviceId),
-        serviceName_(serviceName),
-        characteristicKey_(characteristicKey),
-        characteristicValue_(characteristicValue),
-        isMultiUser_(isMultiUser),
-        userId_(userId)
-    {}
+        const int32_t userId);
     CharacteristicProfile() = default;
     ~CharacteristicProfile() = default;
 
-    std::string GetDeviceId() const;
+    const std::string& GetDeviceId() const;
     void SetDeviceId(const std::string& deviceId);
-    std::string GetServiceName() const;
+    const std::string& GetServiceName() const;
     void SetServiceName(const std::string& serviceName);
-    std::string GetCharacteristicKey() const;
+    const std::string& GetCharacteristicKey() const;
     void SetCharacteristicKey(const std::string& characteristicId);
-    std::string GetCharacteristicValue() const;
+    const std::string& GetCharacteristicValue() const;
     void SetCharacteristicValue(const std::string& characteristicValue);
     bool IsMultiUser() const;
     void SetIsMultiUser(bool isMultiUser);
@@ -61,11 +50,13 @@ public:
     bool UnMarshalling(MessageParcel& parcel) override;
     bool operator!=(const CharacteristicProfile& charProfile) const;
     std::string dump() const override;
+    // swaps deviceId, serviceName and characteristicKey for the pooled copies other profiles share
+    void InternStrings();
 
 private:
-    std::string deviceId_ = "";
-    std::string serviceName_ = "";
-    std::string characteristicKey_ = "";
+    std::shared_ptr<const std::string> deviceId_ = nullptr;
+    std::shared_ptr<const std::string> serviceName_ = nullptr;
+    std::shared_ptr<const std::string> characteristicKey_ = nullptr;
     std::string characteristicValue_ = "";
     bool isMultiUser_ = false;
     int32_t userId_ = DEFAULT_USER_ID;
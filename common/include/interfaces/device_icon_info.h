@@ -57,6 +57,9 @@ public:
     void SetIcon(const std::vector<uint8_t>& icon);
     bool Marshalling(MessageParcel& parcel) const override;
     bool UnMarshalling(MessageParcel& parcel) override;
+    // everything but the icon, for IpcUtils which sends each distinct icon of a list once
+    bool MarshallingWithoutIcon(MessageParcel& parcel) const;
+    bool UnMarshallingWithoutIcon(MessageParcel& parcel);
     bool operator!=(const DeviceIconInfo& other) const;
     std::string dump() const override;
     std::string GetUniqueKey() const;
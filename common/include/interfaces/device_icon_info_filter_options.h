@@ -25,7 +25,8 @@ namespace OHOS {
 namespace DistributedDeviceProfile {
 class DeviceIconInfoFilterOptions : public DpParcel {
 public:
-    DeviceIconInfoFilterOptions() : internalModel_(""), subProductId_(""), imageType_(""), specName_("")
+    DeviceIconInfoFilterOptions() : internalModel_(""), subProductId_(""), imageType_(""), specName_(""),
+        knownVersion_("")
     {}
     ~DeviceIconInfoFilterOptions() = default;
 
@@ -39,6 +40,9 @@ public:
     void SetImageType(const std::string& imageType);
     std::string GetSpecName() const;
     void SetSpecName(const std::string& specName);
+    std::string GetKnownVersion() const;
+    // the version the caller already holds, a matching icon comes back without its icon bytes
+    void SetKnownVersion(const std::string& knownVersion);
 
     bool Marshalling(MessageParcel& parcel) const override;
     bool UnMarshalling(MessageParcel& parcel) override;
@@ -50,6 +54,7 @@ private:
     std::string subProductId_;
     std::string imageType_;
     std::string specName_;
+    std::string knownVersion_;
 };
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
@@ -64,7 +64,7 @@ public:
     {}
     ~DeviceProfile() = default;
 
-    std::string GetDeviceId() const;
+    const std::string& GetDeviceId() const;
     void SetDeviceId(const std::string& deviceId);
     std::string GetDeviceName() const;
     void SetDeviceName(const std::string& deviceName);
@@ -122,7 +122,7 @@ public:
     void SetModifyTime(std::string modifyTime);
     std::string GetShareTime() const;
     void SetShareTime(const std::string& shareTime);
-    std::string GetAccountId() const;
+    const std::string& GetAccountId() const;
     void SetAccountId(const std::string& accountId);
     std::string GetInternalModel() const;
     void SetInternalModel(const std::string& internalModel);
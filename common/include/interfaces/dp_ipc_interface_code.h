@@ -101,7 +101,9 @@ enum class DpIpcInterfaceCode : uint32_t {
 	ON_ACCOUNT_ACL_INACTIVE = 82,
 	ON_ACCOUNT_ACL_ADD = 83,
 	ON_ACCOUNT_ACL_ACTIVE = 84,
-    MAX = 85
+    GET_CHAR_PROFILE_BATCH = 85,
+    GET_ACL_PROFILE_BATCH = 86,
+    MAX = 87
 };
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
@@ -52,6 +52,8 @@ public:
     virtual int32_t GetAllTrustDeviceProfile(std::vector<TrustDeviceProfile>& trustDeviceProfiles) = 0;
     virtual int32_t GetAccessControlProfile(std::map<std::string, std::string> queryParams,
         std::vector<AccessControlProfile>& accessControlProfiles) = 0;
+    virtual int32_t GetAccessControlProfileBatch(const std::vector<std::map<std::string, std::string>>& queryParamsList,
+        std::vector<std::vector<AccessControlProfile>>& aclProfilesList, std::vector<int32_t>& results) = 0;
     virtual int32_t GetAllAccessControlProfile(std::vector<AccessControlProfile>& accessControlProfiles) = 0;
     virtual int32_t GetAllAclIncludeLnnAcl(std::vector<AccessControlProfile>& accessControlProfiles) = 0;
     virtual int32_t DeleteAccessControlProfile(int32_t accessControlId) = 0;
@@ -73,6 +75,8 @@ public:
         ServiceProfile& serviceProfile) = 0;
     virtual int32_t GetCharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
         const std::string& characteristicId, CharacteristicProfile& charProfile) = 0;
+    virtual int32_t GetCharacteristicProfileBatch(const std::vector<CharacteristicProfile>& queries,
+        std::vector<CharacteristicProfile>& charProfiles, std::vector<int32_t>& results) = 0;
     virtual int32_t DeleteServiceProfile(const std::string& deviceId, const std::string& serviceName,
         bool isMultiUser = false, int32_t userId = DEFAULT_USER_ID) = 0;
     virtual int32_t DeleteCharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
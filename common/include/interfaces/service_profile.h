@@ -17,6 +17,7 @@
 #define OHOS_DP_SERVICE_PROFILE_H
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include "distributed_device_profile_constants.h"
 #include "dp_parcel.h"
@@ -31,11 +32,11 @@ public:
     ServiceProfile();
     ~ServiceProfile();
 
-    std::string GetDeviceId() const;
+    const std::string& GetDeviceId() const;
     void SetDeviceId(const std::string& deviceId);
-    std::string GetServiceName() const;
+    const std::string& GetServiceName() const;
     void SetServiceName(const std::string& serviceName);
-    std::string GetServiceType() const;
+    const std::string& GetServiceType() const;
     void SetServiceType(const std::string& serviceType);
     bool IsMultiUser() const;
     void SetIsMultiUser(bool isMultiUser);
@@ -45,11 +46,13 @@ public:
     bool UnMarshalling(MessageParcel& parcel) override;
     bool operator!=(const ServiceProfile& serviceProfile) const;
     std::string dump() const override;
+    // swaps deviceId, serviceName and serviceType for the pooled copies other profiles share
+    void InternStrings();
 
 private:
-    std::string deviceId_ = "";
-    std::string serviceName_ = "";
-    std::string serviceType_ = "";
+    std::shared_ptr<const std::string> deviceId_ = nullptr;
+    std::shared_ptr<const std::string> serviceName_ = nullptr;
+    std::shared_ptr<const std::string> serviceType_ = nullptr;
     bool isMultiUser_ = false;
     int32_t userId_ = DEFAULT_USER_ID;
 };
@@ -23,6 +23,8 @@
 #endif
 #include "hilog/log.h"
 
+#include "dp_log_rate_limiter.h"
+
 namespace OHOS {
 namespace DistributedDeviceProfile {
 
@@ -41,12 +43,47 @@ namespace DistributedDeviceProfile {
 #ifdef HILOGD
 #undef HILOGD
 #endif
+#ifdef HILOGI_LIMIT
+#undef HILOGI_LIMIT
+#endif
 
 #define HILOGF(fmt, ...) HILOG_FATAL(LOG_CORE, "%{public}s::%{public}s " fmt, TAG.c_str(), __FUNCTION__, ##__VA_ARGS__)
 #define HILOGE(fmt, ...) HILOG_ERROR(LOG_CORE, "%{public}s::%{public}s " fmt, TAG.c_str(), __FUNCTION__, ##__VA_ARGS__)
 #define HILOGW(fmt, ...) HILOG_WARN(LOG_CORE, "%{public}s::%{public}s " fmt, TAG.c_str(), __FUNCTION__, ##__VA_ARGS__)
-#define HILOGI(fmt, ...) HILOG_INFO(LOG_CORE, "%{public}s::%{public}s " fmt, TAG.c_str(), __FUNCTION__, ##__VA_ARGS__)
-#define HILOGD(fmt, ...) HILOG_DEBUG(LOG_CORE, "%{public}s::%{public}s " fmt, TAG.c_str(), __FUNCTION__, ##__VA_ARGS__)
+// INFO and DEBUG arguments, dump() and GetAnonyString() included, are only evaluated when the level is loggable.
+#define HILOGI(fmt, ...)                                                                                       \
+    do {                                                                                                       \
+        if (HiLogIsLoggable(LOG_DOMAIN, LOG_TAG, LOG_INFO)) {                                                  \
+            HILOG_INFO(LOG_CORE, "%{public}s::%{public}s " fmt, TAG.c_str(), __FUNCTION__, ##__VA_ARGS__);     \
+        }                                                                                                      \
+    } while (0)
+
+// DEBUG lines are compiled out unless the build sets device_info_manager_debug_log.
+#ifdef DP_DEBUG_LOG_ENABLE
+#define DP_DEBUG_LOG_ENABLED true
+#else
+#define DP_DEBUG_LOG_ENABLED false
+#endif
+#define HILOGD(fmt, ...)                                                                                       \
+    do {                                                                                                       \
+        if (DP_DEBUG_LOG_ENABLED && HiLogIsLoggable(LOG_DOMAIN, LOG_TAG, LOG_DEBUG)) {                         \
+            HILOG_DEBUG(LOG_CORE, "%{public}s::%{public}s " fmt, TAG.c_str(), __FUNCTION__, ##__VA_ARGS__);    \
+        }                                                                                                      \
+    } while (0)
+
+// For INFO lines on per-IPC paths: each call site writes at most DP_LOG_LIMIT_BURST lines per
+// DP_LOG_LIMIT_WINDOW_MS and reports how many it dropped in between.
+#define HILOGI_LIMIT(fmt, ...)                                                                                 \
+    do {                                                                                                       \
+        if (HiLogIsLoggable(LOG_DOMAIN, LOG_TAG, LOG_INFO)) {                                                  \
+            static OHOS::DistributedDeviceProfile::DpLogRateLimiter dpLogRateLimiter;                          \
+            uint32_t dpLogSuppressed = 0;                                                                      \
+            if (dpLogRateLimiter.TryAcquire(dpLogSuppressed)) {                                                \
+                HILOG_INFO(LOG_CORE, "%{public}s::%{public}s " fmt " suppressed: %{public}u", TAG.c_str(),     \
+                    __FUNCTION__, ##__VA_ARGS__, dpLogSuppressed);                                             \
+            }                                                                                                  \
+        }                                                                                                      \
+    } while (0)
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
 #endif // OHOS_DP_DEVICE_PROFILE_LOG_H
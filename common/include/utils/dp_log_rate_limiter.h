@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DP_LOG_RATE_LIMITER_H
+#define OHOS_DP_LOG_RATE_LIMITER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+constexpr int64_t DP_LOG_LIMIT_WINDOW_MS = 1000;
+constexpr uint32_t DP_LOG_LIMIT_BURST = 10;
+
+// One instance per call site, see HILOGI_LIMIT. Lets DP_LOG_LIMIT_BURST lines through per window and counts
+// the rest, the next line that gets through reports how many were dropped. Lock free, a line more or less
+// at a window edge is acceptable.
+class DpLogRateLimiter {
+public:
+    bool TryAcquire(uint32_t& suppressed)
+    {
+        int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        int64_t windowStartMs = windowStartMs_.load(std::memory_order_relaxed);
+        if (nowMs - windowStartMs >= DP_LOG_LIMIT_WINDOW_MS &&
+            windowStartMs_.compare_exchange_strong(windowStartMs, nowMs, std::memory_order_relaxed)) {
+            count_.store(0, std::memory_order_relaxed);
+        }
+        if (count_.fetch_add(1, std::memory_order_relaxed) < DP_LOG_LIMIT_BURST) {
+            suppressed = suppressed_.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+        suppressed_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+private:
+    std::atomic<int64_t> windowStartMs_ {0};
+    std::atomic<uint32_t> count_ {0};
+    std::atomic<uint32_t> suppressed_ {0};
+};
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
+#endif // OHOS_DP_LOG_RATE_LIMITER_H
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DP_STRING_POOL_H
+#define OHOS_DP_STRING_POOL_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "single_instance.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+using DpSharedString = std::shared_ptr<const std::string>;
+
+// an unpooled copy, nullptr stands for the empty string
+inline DpSharedString MakeSharedString(const std::string& str)
+{
+    return str.empty() ? nullptr : std::make_shared<const std::string>(str);
+}
+
+inline const std::string& GetSharedString(const DpSharedString& str)
+{
+    static const std::string emptyString;
+    return str == nullptr ? emptyString : *str;
+}
+
+// Interns the identity strings many cached profiles repeat, the deviceIds and serviceNames of a few devices
+// and services. Every profile holding the same value shares one immutable copy. A string no profile refers
+// to any more is dropped once the pool has grown to twice its size after the last purge.
+class DpStringPool {
+    DECLARE_SINGLE_INSTANCE(DpStringPool);
+
+public:
+    DpSharedString Intern(const std::string& str);
+    // returns the number of strings dropped
+    size_t Purge();
+    size_t GetCount();
+    // the pooled strings with their control blocks
+    size_t GetBytes();
+
+private:
+    size_t PurgeLocked();
+
+private:
+    std::mutex poolMutex_;
+    // the key views the string the value owns
+    std::unordered_map<std::string_view, DpSharedString> pool_;
+    size_t purgeThreshold_ = 0;
+};
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
+#endif // OHOS_DP_STRING_POOL_H
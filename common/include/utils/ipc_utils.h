@@ -75,6 +75,11 @@ public:
     static bool UnMarshalling(MessageParcel& parcel, std::vector<TrustedDeviceInfo>& deviceInfos);
     static bool Marshalling(MessageParcel& parcel, const std::vector<ServiceInfo>& serviceInfos);
     static bool UnMarshalling(MessageParcel& parcel, std::vector<ServiceInfo>& serviceInfos);
+    static bool Marshalling(MessageParcel& parcel, const std::vector<std::map<std::string, std::string>>& paramsList);
+    static bool UnMarshalling(MessageParcel& parcel, std::vector<std::map<std::string, std::string>>& paramsList);
+    static bool Marshalling(MessageParcel& parcel,
+        const std::vector<std::vector<AccessControlProfile>>& aclProfilesList);
+    static bool UnMarshalling(MessageParcel& parcel, std::vector<std::vector<AccessControlProfile>>& aclProfilesList);
 };
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
@@ -89,6 +89,9 @@ const std::string SPEC_NAME = "specName";
 const std::string DEVICE_ICON = "icon";
 const std::string DEVICE_ICON_VERSION = "version";
 const std::string DEVICE_ICON_URL = "url";
+const std::string DEVICE_ICON_HASH = "iconHash";
+const std::string DEVICE_ICON_REF_COUNT = "refCount";
+const std::string DEVICE_ICON_BLOB_TABLE = "device_icon_blob";
 /* TrustDeviceProfile Attribute */
 const std::string SUBSCRIBE_TRUST_DEVICE_PROFILE = "trust_device_profile";
 const std::string DEVICE_ID_TYPE = "deviceIdType";
@@ -53,7 +53,7 @@ void Accessee::SetAccesseeId(int64_t accesseeId)
     accesseeId_ = accesseeId;
 }
 
-std::string Accessee::GetAccesseeDeviceId() const
+const std::string& Accessee::GetAccesseeDeviceId() const
 {
     return accesseeDeviceId_;
 }
@@ -73,7 +73,7 @@ void Accessee::SetAccesseeUserId(int32_t accesseeUserId)
     accesseeUserId_ = accesseeUserId;
 }
 
-std::string Accessee::GetAccesseeAccountId() const
+const std::string& Accessee::GetAccesseeAccountId() const
 {
     return accesseeAccountId_;
 }
@@ -93,7 +93,7 @@ void Accessee::SetAccesseeTokenId(int64_t accesseeTokenId)
     accesseeTokenId_ = accesseeTokenId;
 }
 
-std::string Accessee::GetAccesseeBundleName() const
+const std::string& Accessee::GetAccesseeBundleName() const
 {
     return accesseeBundleName_;
 }
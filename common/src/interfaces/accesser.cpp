@@ -52,7 +52,7 @@ void Accesser::SetAccesserId(int64_t accesserId)
     accesserId_ = accesserId;
 }
 
-std::string Accesser::GetAccesserDeviceId() const
+const std::string& Accesser::GetAccesserDeviceId() const
 {
     return accesserDeviceId_;
 }
@@ -72,7 +72,7 @@ void Accesser::SetAccesserUserId(int32_t accesserUserId)
     accesserUserId_ = accesserUserId;
 }
 
-std::string Accesser::GetAccesserAccountId() const
+const std::string& Accesser::GetAccesserAccountId() const
 {
     return accesserAccountId_;
 }
@@ -92,7 +92,7 @@ void Accesser::SetAccesserTokenId(int64_t accesserTokenId)
     accesserTokenId_ = accesserTokenId;
 }
 
-std::string Accesser::GetAccesserBundleName() const
+const std::string& Accesser::GetAccesserBundleName() const
 {
     return accesserBundleName_;
 }
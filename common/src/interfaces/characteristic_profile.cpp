@@ -16,6 +16,7 @@
 #include "characteristic_profile.h"
 #include "cJSON.h"
 #include "distributed_device_profile_constants.h"
+#include "dp_string_pool.h"
 #include "macro_utils.h"
 #include "profile_utils.h"
 
@@ -24,37 +25,53 @@ namespace DistributedDeviceProfile {
 namespace {
     const std::string TAG = "CharacteristicProfile";
 }
-std::string  CharacteristicProfile::GetDeviceId() const
+CharacteristicProfile::CharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
+    const std::string& characteristicKey, const std::string& characteristicValue)
+    : deviceId_(MakeSharedString(deviceId)), serviceName_(MakeSharedString(serviceName)),
+    characteristicKey_(MakeSharedString(characteristicKey)), characteristicValue_(characteristicValue)
 {
-    return deviceId_;
+}
+
+CharacteristicProfile::CharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
+    const std::string& characteristicKey, const std::string& characteristicValue, const bool isMultiUser,
+    const int32_t userId)
+    : deviceId_(MakeSharedString(deviceId)), serviceName_(MakeSharedString(serviceName)),
+    characteristicKey_(MakeSharedString(characteristicKey)), characteristicValue_(characteristicValue),
+    isMultiUser_(isMultiUser), userId_(userId)
+{
+}
+
+const std::string& CharacteristicProfile::GetDeviceId() const
+{
+    return GetSharedString(deviceId_);
 }
 
 void CharacteristicProfile::SetDeviceId(const std::string& deviceId)
 {
-    deviceId_ = deviceId;
+    deviceId_ = MakeSharedString(deviceId);
 }
 
-std::string  CharacteristicProfile::GetServiceName() const
+const std::string& CharacteristicProfile::GetServiceName() const
 {
-    return serviceName_;
+    return GetSharedString(serviceName_);
 }
 
 void CharacteristicProfile::SetServiceName(const std::string& serviceName)
 {
-    serviceName_ = serviceName;
+    serviceName_ = MakeSharedString(serviceName);
 }
 
-std::string  CharacteristicProfile::GetCharacteristicKey() const
+const std::string& CharacteristicProfile::GetCharacteristicKey() const
 {
-    return characteristicKey_;
+    return GetSharedString(characteristicKey_);
 }
 
 void CharacteristicProfile::SetCharacteristicKey(const std::string& characteristicId)
 {
-    characteristicKey_ = characteristicId;
+    characteristicKey_ = MakeSharedString(characteristicId);
 }
 
-std::string  CharacteristicProfile::GetCharacteristicValue() const
+const std::string& CharacteristicProfile::GetCharacteristicValue() const
 {
     return characteristicValue_;
 }
@@ -86,9 +103,9 @@ void CharacteristicProfile::SetUserId(int32_t userId)
 
 bool CharacteristicProfile::Marshalling(MessageParcel& parcel) const
 {
-    WRITE_HELPER_RET(parcel, String, deviceId_, false);
-    WRITE_HELPER_RET(parcel, String, serviceName_, false);
-    WRITE_HELPER_RET(parcel, String, characteristicKey_, false);
+    WRITE_HELPER_RET(parcel, String, GetDeviceId(), false);
+    WRITE_HELPER_RET(parcel, String, GetServiceName(), false);
+    WRITE_HELPER_RET(parcel, String, GetCharacteristicKey(), false);
     WRITE_HELPER_RET(parcel, String, characteristicValue_, false);
     WRITE_HELPER_RET(parcel, Bool, isMultiUser_, false);
     WRITE_HELPER_RET(parcel, Int32, userId_, false);
@@ -97,19 +114,26 @@ bool CharacteristicProfile::Marshalling(MessageParcel& parcel) const
 
 bool CharacteristicProfile::UnMarshalling(MessageParcel& parcel)
 {
-    READ_HELPER_RET(parcel, String, deviceId_, false);
-    READ_HELPER_RET(parcel, String, serviceName_, false);
-    READ_HELPER_RET(parcel, String, characteristicKey_, false);
+    std::string deviceId;
+    std::string serviceName;
+    std::string characteristicKey;
+    READ_HELPER_RET(parcel, String, deviceId, false);
+    READ_HELPER_RET(parcel, String, serviceName, false);
+    READ_HELPER_RET(parcel, String, characteristicKey, false);
     READ_HELPER_RET(parcel, String, characteristicValue_, false);
     READ_HELPER_RET(parcel, Bool, isMultiUser_, false);
     READ_HELPER_RET(parcel, Int32, userId_, false);
+    deviceId_ = MakeSharedString(deviceId);
+    serviceName_ = MakeSharedString(serviceName);
+    characteristicKey_ = MakeSharedString(characteristicKey);
     return true;
 }
 
 bool CharacteristicProfile::operator!=(const CharacteristicProfile& charProfile) const
 {
-    bool isNotEqual = (deviceId_ != charProfile.GetDeviceId() || serviceName_ != charProfile.GetServiceName() ||
-        characteristicKey_ != charProfile.GetCharacteristicKey() ||
+    bool isNotEqual = (GetDeviceId() != charProfile.GetDeviceId() ||
+        GetServiceName() != charProfile.GetServiceName() ||
+        GetCharacteristicKey() != charProfile.GetCharacteristicKey() ||
         characteristicValue_ != charProfile.GetCharacteristicValue() || isMultiUser_ != charProfile.IsMultiUser() ||
         userId_ != charProfile.GetUserId());
     if (isNotEqual) {
@@ -126,12 +150,12 @@ std::string CharacteristicProfile::dump() const
         cJSON_Delete(json);
         return EMPTY_STRING;
     }
-    cJSON_AddStringToObject(json, DEVICE_ID.c_str(), ProfileUtils::GetAnonyString(deviceId_).c_str());
-    cJSON_AddStringToObject(json, SERVICE_NAME.c_str(), serviceName_.c_str());
-    cJSON_AddStringToObject(json, CHARACTERISTIC_KEY.c_str(), characteristicKey_.c_str());
+    cJSON_AddStringToObject(json, DEVICE_ID.c_str(), ProfileUtils::GetAnonyString(GetDeviceId()).c_str());
+    cJSON_AddStringToObject(json, SERVICE_NAME.c_str(), GetServiceName().c_str());
+    cJSON_AddStringToObject(json, CHARACTERISTIC_KEY.c_str(), GetCharacteristicKey().c_str());
     cJSON_AddBoolToObject(json, IS_MULTI_USER.c_str(), isMultiUser_);
     cJSON_AddNumberToObject(json, USER_ID.c_str(), userId_);
-    if (characteristicKey_ == SWITCH_STATUS) {
+    if (GetCharacteristicKey() == SWITCH_STATUS) {
         cJSON_AddStringToObject(json, CHARACTERISTIC_VALUE.c_str(), characteristicValue_.c_str());
     } else {
         cJSON_AddStringToObject(json, CHARACTERISTIC_VALUE.c_str(),
@@ -148,5 +172,12 @@ std::string CharacteristicProfile::dump() const
     cJSON_free(jsonChars);
     return jsonStr;
 }
+
+void CharacteristicProfile::InternStrings()
+{
+    deviceId_ = DpStringPool::GetInstance().Intern(GetDeviceId());
+    serviceName_ = DpStringPool::GetInstance().Intern(GetServiceName());
+    characteristicKey_ = DpStringPool::GetInstance().Intern(GetCharacteristicKey());
+}
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
@@ -131,6 +131,24 @@ void DeviceIconInfo::SetIcon(const std::vector<uint8_t>& icon)
 }
 
 bool DeviceIconInfo::Marshalling(MessageParcel& parcel) const
+{
+    if (!MarshallingWithoutIcon(parcel)) {
+        return false;
+    }
+    IpcUtils::Marshalling(parcel, icon_);
+    return true;
+}
+
+bool DeviceIconInfo::UnMarshalling(MessageParcel& parcel)
+{
+    if (!UnMarshallingWithoutIcon(parcel)) {
+        return false;
+    }
+    IpcUtils::UnMarshalling(parcel, icon_);
+    return true;
+}
+
+bool DeviceIconInfo::MarshallingWithoutIcon(MessageParcel& parcel) const
 {
     WRITE_HELPER_RET(parcel, String, productId_, false);
     WRITE_HELPER_RET(parcel, String, internalModel_, false);
@@ -141,11 +159,10 @@ bool DeviceIconInfo::Marshalling(MessageParcel& parcel) const
     WRITE_HELPER_RET(parcel, String, wiseVersion_, false);
     WRITE_HELPER_RET(parcel, String, url_, false);
     WRITE_HELPER_RET(parcel, Int64, modifyTime_, false);
-    IpcUtils::Marshalling(parcel, icon_);
     return true;
 }
 
-bool DeviceIconInfo::UnMarshalling(MessageParcel& parcel)
+bool DeviceIconInfo::UnMarshallingWithoutIcon(MessageParcel& parcel)
 {
     READ_HELPER_RET(parcel, String, productId_, false);
     READ_HELPER_RET(parcel, String, internalModel_, false);
@@ -156,7 +173,6 @@ bool DeviceIconInfo::UnMarshalling(MessageParcel& parcel)
     READ_HELPER_RET(parcel, String, wiseVersion_, false);
     READ_HELPER_RET(parcel, String, url_, false);
     READ_HELPER_RET(parcel, Int64, modifyTime_, false);
-    IpcUtils::UnMarshalling(parcel, icon_);
     return true;
 }
 
@@ -26,6 +26,7 @@ namespace DistributedDeviceProfile {
 namespace {
     const std::string TAG = "DeviceIconInfoFilterOptions";
     const std::string PRODUCT_IDS = "productIds";
+    const std::string KNOWN_VERSION = "knownVersion";
 }
 
 std::vector<std::string> DeviceIconInfoFilterOptions::GetProductIds() const
@@ -78,6 +79,16 @@ void DeviceIconInfoFilterOptions::SetSpecName(const std::string& specName)
     specName_ = specName;
 }
 
+std::string DeviceIconInfoFilterOptions::GetKnownVersion() const
+{
+    return knownVersion_;
+}
+
+void DeviceIconInfoFilterOptions::SetKnownVersion(const std::string& knownVersion)
+{
+    knownVersion_ = knownVersion;
+}
+
 bool DeviceIconInfoFilterOptions::Marshalling(MessageParcel& parcel) const
 {
     IpcUtils::Marshalling(parcel, productIds_);
@@ -85,6 +96,7 @@ bool DeviceIconInfoFilterOptions::Marshalling(MessageParcel& parcel) const
     WRITE_HELPER_RET(parcel, String, subProductId_, false);
     WRITE_HELPER_RET(parcel, String, imageType_, false);
     WRITE_HELPER_RET(parcel, String, specName_, false);
+    WRITE_HELPER_RET(parcel, String, knownVersion_, false);
     return true;
 }
 
@@ -95,6 +107,7 @@ bool DeviceIconInfoFilterOptions::UnMarshalling(MessageParcel& parcel)
     READ_HELPER_RET(parcel, String, subProductId_, false);
     READ_HELPER_RET(parcel, String, imageType_, false);
     READ_HELPER_RET(parcel, String, specName_, false);
+    READ_HELPER_RET(parcel, String, knownVersion_, false);
     return true;
 }
 
@@ -131,6 +144,7 @@ std::string DeviceIconInfoFilterOptions::dump() const
     cJSON_AddStringToObject(json, SUB_PRODUCT_ID.c_str(), subProductId_.c_str());
     cJSON_AddStringToObject(json, IMAGE_TYPE.c_str(), imageType_.c_str());
     cJSON_AddStringToObject(json, SPEC_NAME.c_str(), specName_.c_str());
+    cJSON_AddStringToObject(json, KNOWN_VERSION.c_str(), knownVersion_.c_str());
     char* jsonChars = cJSON_PrintUnformatted(json);
     if (jsonChars == NULL) {
         cJSON_Delete(json);
@@ -24,7 +24,7 @@ namespace DistributedDeviceProfile {
 namespace {
     const std::string TAG = "DeviceProfile";
 }
-std::string DeviceProfile::GetDeviceId() const
+const std::string& DeviceProfile::GetDeviceId() const
 {
     return deviceId_;
 }
@@ -314,7 +314,7 @@ void DeviceProfile::SetShareTime(const std::string& shareTime)
     shareTime_ = shareTime;
 }
 
-std::string DeviceProfile::GetAccountId() const
+const std::string& DeviceProfile::GetAccountId() const
 {
     return accountId_;
 }
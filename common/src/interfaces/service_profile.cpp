@@ -16,6 +16,7 @@
 #include "service_profile.h"
 #include "cJSON.h"
 #include "distributed_device_profile_constants.h"
+#include "dp_string_pool.h"
 #include "macro_utils.h"
 #include "profile_utils.h"
 
@@ -26,13 +27,14 @@ namespace {
 }
 
 ServiceProfile::ServiceProfile(const std::string& deviceId, const std::string& serviceName,
-    const std::string& serviceType) : deviceId_(deviceId), serviceName_(serviceName), serviceType_(serviceType)
+    const std::string& serviceType) : deviceId_(MakeSharedString(deviceId)),
+    serviceName_(MakeSharedString(serviceName)), serviceType_(MakeSharedString(serviceType))
 {
 }
 ServiceProfile::ServiceProfile(const std::string& deviceId, const std::string& serviceName,
     const std::string& serviceType, const bool isMultiUser, const int32_t userId)
-    : deviceId_(deviceId), serviceName_(serviceName), serviceType_(serviceType), isMultiUser_(isMultiUser),
-    userId_(userId)
+    : deviceId_(MakeSharedString(deviceId)), serviceName_(MakeSharedString(serviceName)),
+    serviceType_(MakeSharedString(serviceType)), isMultiUser_(isMultiUser), userId_(userId)
 {
 }
 ServiceProfile::ServiceProfile()
@@ -43,34 +45,34 @@ ServiceProfile::~ServiceProfile()
 {
 }
 
-std::string ServiceProfile::GetDeviceId() const
+const std::string& ServiceProfile::GetDeviceId() const
 {
-    return deviceId_;
+    return GetSharedString(deviceId_);
 }
 
 void ServiceProfile::SetDeviceId(const std::string& deviceId)
 {
-    deviceId_ = deviceId;
+    deviceId_ = MakeSharedString(deviceId);
 }
 
-std::string ServiceProfile::GetServiceName() const
+const std::string& ServiceProfile::GetServiceName() const
 {
-    return serviceName_;
+    return GetSharedString(serviceName_);
 }
 
 void ServiceProfile::SetServiceName(const std::string& serviceName)
 {
-    serviceName_ = serviceName;
+    serviceName_ = MakeSharedString(serviceName);
 }
 
-std::string ServiceProfile::GetServiceType() const
+const std::string& ServiceProfile::GetServiceType() const
 {
-    return serviceType_;
+    return GetSharedString(serviceType_);
 }
 
 void ServiceProfile::SetServiceType(const std::string& serviceType)
 {
-    serviceType_ = serviceType;
+    serviceType_ = MakeSharedString(serviceType);
 }
 
 bool ServiceProfile::IsMultiUser() const
@@ -95,9 +97,9 @@ void ServiceProfile::SetUserId(int32_t userId)
 
 bool ServiceProfile::Marshalling(MessageParcel& parcel) const
 {
-    WRITE_HELPER_RET(parcel, String, deviceId_, false);
-    WRITE_HELPER_RET(parcel, String, serviceName_, false);
-    WRITE_HELPER_RET(parcel, String, serviceType_, false);
+    WRITE_HELPER_RET(parcel, String, GetDeviceId(), false);
+    WRITE_HELPER_RET(parcel, String, GetServiceName(), false);
+    WRITE_HELPER_RET(parcel, String, GetServiceType(), false);
     WRITE_HELPER_RET(parcel, Bool, isMultiUser_, false);
     WRITE_HELPER_RET(parcel, Int32, userId_, false);
     return true;
@@ -105,19 +107,25 @@ bool ServiceProfile::Marshalling(MessageParcel& parcel) const
 
 bool ServiceProfile::UnMarshalling(MessageParcel& parcel)
 {
-    READ_HELPER_RET(parcel, String, deviceId_, false);
-    READ_HELPER_RET(parcel, String, serviceName_, false);
-    READ_HELPER_RET(parcel, String, serviceType_, false);
+    std::string deviceId;
+    std::string serviceName;
+    std::string serviceType;
+    READ_HELPER_RET(parcel, String, deviceId, false);
+    READ_HELPER_RET(parcel, String, serviceName, false);
+    READ_HELPER_RET(parcel, String, serviceType, false);
     READ_HELPER_RET(parcel, Bool, isMultiUser_, false);
     READ_HELPER_RET(parcel, Int32, userId_, false);
+    deviceId_ = MakeSharedString(deviceId);
+    serviceName_ = MakeSharedString(serviceName);
+    serviceType_ = MakeSharedString(serviceType);
     return true;
 }
 
 bool ServiceProfile::operator!=(const ServiceProfile& serviceProfile) const
 {
-    bool isNotEqual = (deviceId_ != serviceProfile.GetDeviceId() || serviceName_ != serviceProfile.GetServiceName() ||
-        serviceType_ != serviceProfile.GetServiceType() || isMultiUser_ != serviceProfile.IsMultiUser() ||
-        userId_ != serviceProfile.GetUserId());
+    bool isNotEqual = (GetDeviceId() != serviceProfile.GetDeviceId() ||
+        GetServiceName() != serviceProfile.GetServiceName() || GetServiceType() != serviceProfile.GetServiceType() ||
+        isMultiUser_ != serviceProfile.IsMultiUser() || userId_ != serviceProfile.GetUserId());
     if (isNotEqual) {
         return true;
     } else {
@@ -132,9 +140,9 @@ std::string ServiceProfile::dump() const
         cJSON_Delete(json);
         return EMPTY_STRING;
     }
-    cJSON_AddStringToObject(json, DEVICE_ID.c_str(), ProfileUtils::GetAnonyString(deviceId_).c_str());
-    cJSON_AddStringToObject(json, SERVICE_NAME.c_str(), serviceName_.c_str());
-    cJSON_AddStringToObject(json, SERVICE_TYPE.c_str(), serviceType_.c_str());
+    cJSON_AddStringToObject(json, DEVICE_ID.c_str(), ProfileUtils::GetAnonyString(GetDeviceId()).c_str());
+    cJSON_AddStringToObject(json, SERVICE_NAME.c_str(), GetServiceName().c_str());
+    cJSON_AddStringToObject(json, SERVICE_TYPE.c_str(), GetServiceType().c_str());
     cJSON_AddBoolToObject(json, IS_MULTI_USER.c_str(), isMultiUser_);
     cJSON_AddNumberToObject(json, USER_ID.c_str(), userId_);
     char* jsonChars = cJSON_PrintUnformatted(json);
@@ -148,5 +156,12 @@ std::string ServiceProfile::dump() const
     cJSON_free(jsonChars);
     return jsonStr;
 }
+
+void ServiceProfile::InternStrings()
+{
+    deviceId_ = DpStringPool::GetInstance().Intern(GetDeviceId());
+    serviceName_ = DpStringPool::GetInstance().Intern(GetServiceName());
+    serviceType_ = DpStringPool::GetInstance().Intern(GetServiceType());
+}
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dp_string_pool.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+IMPLEMENT_SINGLE_INSTANCE(DpStringPool);
+
+namespace {
+    constexpr size_t MIN_PURGE_THRESHOLD = 256;
+    // rough cost of the shared_ptr control block and the map node around each string
+    constexpr size_t POOL_ENTRY_OVERHEAD_BYTES = 8 * sizeof(void*);
+}
+
+DpSharedString DpStringPool::Intern(const std::string& str)
+{
+    if (str.empty()) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    auto iter = pool_.find(std::string_view(str));
+    if (iter != pool_.end()) {
+        return iter->second;
+    }
+    if (pool_.size() >= std::max(purgeThreshold_, MIN_PURGE_THRESHOLD)) {
+        PurgeLocked();
+        purgeThreshold_ = pool_.size() * 2;
+    }
+    auto shared = std::make_shared<const std::string>(str);
+    pool_.emplace(std::string_view(*shared), shared);
+    return shared;
+}
+
+size_t DpStringPool::Purge()
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    return PurgeLocked();
+}
+
+size_t DpStringPool::GetCount()
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    return pool_.size();
+}
+
+size_t DpStringPool::GetBytes()
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    static const size_t inlineCapacity = std::string().capacity();
+    size_t bytes = 0;
+    for (const auto& [key, value] : pool_) {
+        bytes += POOL_ENTRY_OVERHEAD_BYTES + sizeof(std::string) +
+            (value->size() > inlineCapacity ? value->size() + 1 : 0);
+    }
+    return bytes;
+}
+
+size_t DpStringPool::PurgeLocked()
+{
+    size_t count = 0;
+    for (auto iter = pool_.begin(); iter != pool_.end();) {
+        // the pool holds the only reference
+        if (iter->second.use_count() == 1) {
+            iter = pool_.erase(iter);
+            count++;
+        } else {
+            ++iter;
+        }
+    }
+    return count;
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
@@ -21,6 +21,7 @@ namespace OHOS {
 namespace DistributedDeviceProfile {
 namespace {
     const std::string TAG = "IpcUtils";
+    constexpr int32_t INVALID_ICON_INDEX = -1;
 }
 bool IpcUtils::Marshalling(MessageParcel& parcel, const std::vector<TrustDeviceProfile>& trustDeviceProfiles)
 {
@@ -247,9 +248,48 @@ bool IpcUtils::Marshalling(MessageParcel& parcel, const std::vector<DeviceIconIn
         HILOGE("deviceInfos size is invalid!size : %{public}zu", deviceIconInfos.size());
         return false;
     }
+    // every info refers to its icon by index, each distinct icon is sent once
+    std::map<std::vector<uint8_t>, int32_t> iconIndexes;
+    std::vector<const std::vector<uint8_t>*> icons;
+    size_t totalIconSize = 0;
     for (const auto& item : deviceIconInfos) {
-        // The same IPC can only call WriteRawData once.
-        item.Marshalling(parcel);
+        if (!item.MarshallingWithoutIcon(parcel)) {
+            return false;
+        }
+        std::vector<uint8_t> icon = item.GetIcon();
+        if (icon.empty()) {
+            WRITE_HELPER_RET(parcel, Int32, INVALID_ICON_INDEX, false);
+            continue;
+        }
+        if (icon.size() > MAX_ICON_SIZE) {
+            HILOGE("icon size is invalid! size : %{public}zu", icon.size());
+            return false;
+        }
+        auto [iter, isNew] = iconIndexes.emplace(std::move(icon), static_cast<int32_t>(icons.size()));
+        if (isNew) {
+            icons.emplace_back(&iter->first);
+            totalIconSize += iter->first.size();
+        }
+        WRITE_HELPER_RET(parcel, Int32, iter->second, false);
+    }
+    uint32_t iconCount = icons.size();
+    WRITE_HELPER_RET(parcel, Uint32, iconCount, false);
+    for (const auto* icon : icons) {
+        uint32_t iconSize = icon->size();
+        WRITE_HELPER_RET(parcel, Uint32, iconSize, false);
+    }
+    if (icons.empty()) {
+        return true;
+    }
+    // The same IPC can only call WriteRawData once.
+    std::vector<uint8_t> iconData;
+    iconData.reserve(totalIconSize);
+    for (const auto* icon : icons) {
+        iconData.insert(iconData.end(), icon->begin(), icon->end());
+    }
+    if (!parcel.WriteRawData(iconData.data(), iconData.size())) {
+        HILOGE("WriteRawData failed! size : %{public}zu", iconData.size());
+        return false;
     }
     return true;
 }
@@ -261,14 +301,54 @@ bool IpcUtils::UnMarshalling(MessageParcel& parcel, std::vector<DeviceIconInfo>&
         HILOGE("Profile size is invalid!size : %{public}u", size);
         return false;
     }
+    std::vector<DeviceIconInfo> infos(size);
+    std::vector<int32_t> iconIndexes(size, INVALID_ICON_INDEX);
     for (uint32_t i = 0; i < size; i++) {
-        DeviceIconInfo deviceIconInfo;
-        if (!deviceIconInfo.UnMarshalling(parcel)) {
+        if (!infos[i].UnMarshallingWithoutIcon(parcel)) {
             HILOGE("Profile UnMarshalling fail!");
             return false;
         }
-        deviceIconInfos.emplace_back(deviceIconInfo);
+        READ_HELPER_RET(parcel, Int32, iconIndexes[i], false);
+    }
+    uint32_t iconCount = parcel.ReadUint32();
+    if (iconCount > size) {
+        HILOGE("icon count is invalid! count : %{public}u", iconCount);
+        return false;
+    }
+    std::vector<uint32_t> iconSizes(iconCount);
+    size_t totalIconSize = 0;
+    for (uint32_t i = 0; i < iconCount; i++) {
+        iconSizes[i] = parcel.ReadUint32();
+        if (iconSizes[i] == 0 || iconSizes[i] > MAX_ICON_SIZE) {
+            HILOGE("icon size is invalid! size : %{public}u", iconSizes[i]);
+            return false;
+        }
+        totalIconSize += iconSizes[i];
+    }
+    std::vector<std::vector<uint8_t>> icons;
+    if (iconCount > 0) {
+        const uint8_t* buffer = reinterpret_cast<const uint8_t*>(parcel.ReadRawData(totalIconSize));
+        if (buffer == nullptr) {
+            HILOGE("read raw data failed, size = %{public}zu", totalIconSize);
+            return false;
+        }
+        for (uint32_t iconSize : iconSizes) {
+            icons.emplace_back(buffer, buffer + iconSize);
+            buffer += iconSize;
+        }
     }
+    for (uint32_t i = 0; i < size; i++) {
+        if (iconIndexes[i] == INVALID_ICON_INDEX) {
+            continue;
+        }
+        if (iconIndexes[i] < 0 || static_cast<uint32_t>(iconIndexes[i]) >= iconCount) {
+            HILOGE("icon index is invalid! index : %{public}d", iconIndexes[i]);
+            return false;
+        }
+        infos[i].SetIcon(icons[iconIndexes[i]]);
+    }
+    deviceIconInfos.insert(deviceIconInfos.end(), std::make_move_iterator(infos.begin()),
+        std::make_move_iterator(infos.end()));
     return true;
 }
 
@@ -554,5 +634,91 @@ bool IpcUtils::UnMarshalling(MessageParcel& parcel, std::vector<ServiceInfo>& se
     return true;
 }
 //LCOV_EXCL_STOP
+
+bool IpcUtils::Marshalling(MessageParcel& parcel, const std::vector<std::map<std::string, std::string>>& paramsList)
+{
+    uint32_t size = static_cast<uint32_t>(paramsList.size());
+    if (size == 0 || size > MAX_BATCH_QUERY_SIZE) {
+        HILOGE("paramsList size is invalid!size : %{public}u", size);
+        return false;
+    }
+    WRITE_HELPER_RET(parcel, Uint32, size, false);
+    for (const auto& params : paramsList) {
+        if (!Marshalling(parcel, params)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool IpcUtils::UnMarshalling(MessageParcel& parcel, std::vector<std::map<std::string, std::string>>& paramsList)
+{
+    uint32_t size = parcel.ReadUint32();
+    if (size == 0 || size > MAX_BATCH_QUERY_SIZE) {
+        HILOGE("paramsList size is invalid!size : %{public}u", size);
+        return false;
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        std::map<std::string, std::string> params;
+        if (!UnMarshalling(parcel, params)) {
+            return false;
+        }
+        paramsList.emplace_back(std::move(params));
+    }
+    return true;
+}
+
+bool IpcUtils::Marshalling(MessageParcel& parcel,
+    const std::vector<std::vector<AccessControlProfile>>& aclProfilesList)
+{
+    uint32_t size = static_cast<uint32_t>(aclProfilesList.size());
+    if (size > MAX_BATCH_QUERY_SIZE) {
+        HILOGE("aclProfilesList size is invalid!size : %{public}u", size);
+        return false;
+    }
+    WRITE_HELPER_RET(parcel, Uint32, size, false);
+    uint32_t total = 0;
+    for (const auto& aclProfiles : aclProfilesList) {
+        // an item that failed or matched nothing is written as an empty list
+        total += static_cast<uint32_t>(aclProfiles.size());
+        if (total > MAX_PROFILE_SIZE) {
+            HILOGE("profile size is invalid!total : %{public}u", total);
+            return false;
+        }
+        if (!Marshalling(parcel, aclProfiles)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool IpcUtils::UnMarshalling(MessageParcel& parcel, std::vector<std::vector<AccessControlProfile>>& aclProfilesList)
+{
+    uint32_t size = parcel.ReadUint32();
+    if (size > MAX_BATCH_QUERY_SIZE) {
+        HILOGE("aclProfilesList size is invalid!size : %{public}u", size);
+        return false;
+    }
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < size; i++) {
+        uint32_t profileSize = parcel.ReadUint32();
+        total += profileSize;
+        if (profileSize > MAX_PROFILE_SIZE || total > MAX_PROFILE_SIZE) {
+            HILOGE("profile size is invalid!size : %{public}u", profileSize);
+            return false;
+        }
+        std::vector<AccessControlProfile> aclProfiles;
+        for (uint32_t j = 0; j < profileSize; j++) {
+            AccessControlProfile aclProfile;
+            if (!aclProfile.UnMarshalling(parcel)) {
+                HILOGE("Profile UnMarshalling fail!");
+                return false;
+            }
+            aclProfiles.emplace_back(aclProfile);
+        }
+        aclProfilesList.emplace_back(std::move(aclProfiles));
+    }
+    return true;
+}
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
\ No newline at end of file
@@ -781,6 +781,7 @@ int32_t ProfileUtils::EntriesToServiceProfile(std::map<std::string, std::string>
         propertiesMap[SERVICE_TYPE].length() < MAX_STRING_LEN) {
         profile.SetServiceType(propertiesMap[SERVICE_TYPE]);
     }
+    profile.InternStrings();
     return DP_SUCCESS;
 }
 
@@ -802,6 +803,8 @@ int32_t ProfileUtils::EntriesToCharProfile(std::map<std::string, std::string> va
         propertiesMap[CHARACTERISTIC_VALUE].length() < MAX_STRING_LEN) {
         profile.SetCharacteristicValue(propertiesMap[CHARACTERISTIC_VALUE]);
     }
+    // a full load converts thousands of profiles of a few devices and services
+    profile.InternStrings();
     return DP_SUCCESS;
 }
 
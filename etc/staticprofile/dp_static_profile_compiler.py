@@ -0,0 +1,273 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# Copyright (c) 2026 Huawei Device Co., Ltd.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Compiles dp_static_capability_cfg.json / dp_static_info_cfg.json into the
+binary table read by StaticProfileTable (static_profile_table.h).
+
+Layout, little endian, every offset is from the start of the file:
+  header       magic, format version, kind, fnv-1a of the source json, total size,
+               fnv-1a checksum of everything after the header, then
+               (offset, count) of the primary table, the secondary table and
+               the string pool
+  primary      capability: (handler_name, handler_loc) per array item
+               info: (DPVersion, flags, ability start, ability count) per item
+  secondary    info only: (abilityKey, abilityValue) of the valid abilities
+  string pool  utf-8 bytes, each string is referenced by (offset, length)
+
+abilityValue is stored exactly as cJSON_Print would render it, so the runtime
+produces the same characteristic value as the json path.
+"""
+
+import argparse
+import json
+import math
+import os
+import struct
+import sys
+
+MAGIC = 0x54535044  # "DPST"
+FORMAT_VERSION = 2
+KIND_CAPABILITY = 1
+KIND_INFO = 2
+HEADER_FORMAT = "<IHHIIIIIIIII"
+STRING_FORMAT = "II"
+CAPABILITY_RECORD_FORMAT = "<" + STRING_FORMAT * 2
+INFO_RECORD_FORMAT = "<" + STRING_FORMAT + "III"
+ABILITY_RECORD_FORMAT = "<" + STRING_FORMAT * 2
+FLAG_IS_OBJECT = 0x1
+FLAG_HAS_VERSION = 0x2
+FLAG_HAS_ABILITIES = 0x4
+ALIGNMENT = 4
+INT_MAX = 2147483647
+INT_MIN = -2147483648
+
+STATIC_CAPABILITY_ATTRIBUTE = "static_capability"
+STATIC_CAP_HANDLER_NAME = "service_name"
+STATIC_CAP_HANDLER_LOC = "handler_loc"
+STATIC_INFO = "static_info"
+DP_VERSION = "DPVersion"
+ABILITIES = "abilities"
+ABILITY_KEY = "abilityKey"
+ABILITY_VALUE = "abilityValue"
+
+
+class JsonObject(list):
+    """Keeps member order and duplicated keys like cJSON does."""
+
+    def get_first(self, key):
+        for name, value in self:
+            if name == key:
+                return value
+        return None
+
+
+def fnv1a(data):
+    value = 0x811c9dc5
+    for byte in data:
+        value ^= byte
+        value = (value * 0x01000193) & 0xffffffff
+    return value
+
+
+def print_string(value):
+    out = ['"']
+    for char in value:
+        code = ord(char)
+        if char == '"':
+            out.append('\\"')
+        elif char == '\\':
+            out.append('\\\\')
+        elif char == '\b':
+            out.append('\\b')
+        elif char == '\f':
+            out.append('\\f')
+        elif char == '\n':
+            out.append('\\n')
+        elif char == '\r':
+            out.append('\\r')
+        elif char == '\t':
+            out.append('\\t')
+        elif code < 32:
+            out.append('\\u%04x' % code)
+        else:
+            out.append(char)
+    out.append('"')
+    return ''.join(out)
+
+
+def print_number(value):
+    number = float(value)
+    if math.isnan(number) or math.isinf(number):
+        return "null"
+    if number >= INT_MAX:
+        value_int = INT_MAX
+    elif number <= INT_MIN:
+        value_int = INT_MIN
+    else:
+        value_int = int(number)
+    if number == float(value_int):
+        return "%d" % value_int
+    text = "%1.15g" % number
+    if float(text) != number:
+        text = "%1.17g" % number
+    return text
+
+
+def print_value(value, depth):
+    """Mirrors cJSON_Print (formatted) output."""
+    if value is None:
+        return "null"
+    if value is True:
+        return "true"
+    if value is False:
+        return "false"
+    if isinstance(value, (int, float)):
+        return print_number(value)
+    if isinstance(value, str):
+        return print_string(value)
+    if isinstance(value, JsonObject):
+        out = ["{\n"]
+        for index, (name, item) in enumerate(value):
+            out.append("\t" * (depth + 1))
+            out.append(print_string(name))
+            out.append(":\t")
+            out.append(print_value(item, depth + 1))
+            if index != len(value) - 1:
+                out.append(",")
+            out.append("\n")
+        out.append("\t" * depth)
+        out.append("}")
+        return ''.join(out)
+    if isinstance(value, list):
+        return "[" + ", ".join(print_value(item, depth + 1) for item in value) + "]"
+    raise ValueError("unsupported json value")
+
+
+class TableWriter:
+    def __init__(self):
+        self.pool = bytearray()
+        self.pool_index = {}
+
+    def add_string(self, value):
+        if value is None:
+            return (0, 0)
+        data = value.encode("utf-8")
+        if data not in self.pool_index:
+            self.pool_index[data] = len(self.pool)
+            self.pool.extend(data)
+        return (self.pool_index[data], len(data))
+
+    def build(self, kind, source_hash, primary, primary_count, secondary, secondary_count):
+        header_size = struct.calcsize(HEADER_FORMAT)
+        primary_offset = header_size
+        secondary_offset = primary_offset + len(primary)
+        pool_offset = secondary_offset + len(secondary)
+        body = bytearray()
+        body.extend(primary)
+        body.extend(secondary)
+        string_base = pool_offset
+        body.extend(self.pool)
+        while (header_size + len(body)) % ALIGNMENT != 0:
+            body.append(0)
+        total_size = header_size + len(body)
+        header = struct.pack(HEADER_FORMAT, MAGIC, FORMAT_VERSION, kind, source_hash, total_size, fnv1a(body),
+            primary_offset, primary_count, secondary_offset, secondary_count, string_base, len(self.pool))
+        return bytes(header) + bytes(body)
+
+
+def is_string(value):
+    return isinstance(value, str)
+
+
+def compile_capability(root, writer):
+    items = root.get_first(STATIC_CAPABILITY_ATTRIBUTE) if isinstance(root, JsonObject) else None
+    if not isinstance(items, list) or isinstance(items, JsonObject):
+        raise ValueError("%s is not an array" % STATIC_CAPABILITY_ATTRIBUTE)
+    primary = bytearray()
+    for item in items:
+        name = loc = None
+        if isinstance(item, JsonObject):
+            name = item.get_first(STATIC_CAP_HANDLER_NAME)
+            loc = item.get_first(STATIC_CAP_HANDLER_LOC)
+        # invalid items keep their slot so the capability string has the same length
+        if not is_string(name) or not is_string(loc):
+            name = loc = None
+        primary.extend(struct.pack(CAPABILITY_RECORD_FORMAT, *writer.add_string(name), *writer.add_string(loc)))
+    return primary, len(items), bytearray(), 0
+
+
+def compile_info(root, writer):
+    items = root.get_first(STATIC_INFO) if isinstance(root, JsonObject) else None
+    if not isinstance(items, list) or isinstance(items, JsonObject):
+        raise ValueError("%s is not an array" % STATIC_INFO)
+    primary = bytearray()
+    secondary = bytearray()
+    ability_count = 0
+    for item in items:
+        flags = 0
+        version = None
+        start = ability_count
+        if isinstance(item, JsonObject):
+            flags |= FLAG_IS_OBJECT
+            version = item.get_first(DP_VERSION)
+            if is_string(version):
+                flags |= FLAG_HAS_VERSION
+            else:
+                version = None
+            abilities = item.get_first(ABILITIES)
+            if isinstance(abilities, list) and not isinstance(abilities, JsonObject):
+                flags |= FLAG_HAS_ABILITIES
+                for ability in abilities:
+                    if not isinstance(ability, JsonObject):
+                        continue
+                    key = ability.get_first(ABILITY_KEY)
+                    value = ability.get_first(ABILITY_VALUE)
+                    if not is_string(key) or not isinstance(value, JsonObject):
+                        continue
+                    secondary.extend(struct.pack(ABILITY_RECORD_FORMAT, *writer.add_string(key),
+                        *writer.add_string(print_value(value, 0))))
+                    ability_count += 1
+        primary.extend(struct.pack(INFO_RECORD_FORMAT, *writer.add_string(version), flags, start,
+            ability_count - start))
+    return primary, len(items), secondary, ability_count
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--kind", choices=["capability", "info"], required=True)
+    parser.add_argument("--input", required=True)
+    parser.add_argument("--output", required=True)
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as source:
+        content = source.read()
+    root = json.loads(content.decode("utf-8"), object_pairs_hook=JsonObject)
+    writer = TableWriter()
+    if args.kind == "capability":
+        kind = KIND_CAPABILITY
+        tables = compile_capability(root, writer)
+    else:
+        kind = KIND_INFO
+        tables = compile_info(root, writer)
+    data = writer.build(kind, fnv1a(content), *tables)
+    output_dir = os.path.dirname(os.path.abspath(args.output))
+    os.makedirs(output_dir, exist_ok=True)
+    with open(args.output, "wb") as output:
+        output.write(data)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
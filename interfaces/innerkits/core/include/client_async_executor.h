@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DP_CLIENT_ASYNC_EXECUTOR_H
+#define OHOS_DP_CLIENT_ASYNC_EXECUTOR_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "event_handler.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+constexpr int64_t DEFAULT_ASYNC_REQUEST_TIMEOUT_MS = 5000;
+constexpr size_t MAX_ASYNC_REQUEST_SIZE = 256;
+
+// Runs blocking client calls off the caller thread. Every accepted request completes exactly once:
+// with the result of its work, with DP_ASYNC_REQUEST_TIMEOUT when the work outlives timeoutMs, or
+// with DP_ASYNC_REQUEST_CANCELED when it is cancelled first. A late result is dropped.
+class ClientAsyncExecutor {
+public:
+    using Work = std::function<int32_t()>;
+    using Complete = std::function<void(int32_t errCode)>;
+
+    explicit ClientAsyncExecutor(const std::string& name);
+    ~ClientAsyncExecutor();
+
+    int32_t Submit(Work work, Complete complete, int64_t timeoutMs, uint64_t& requestId);
+    // complete runs on the calling thread with DP_ASYNC_REQUEST_CANCELED.
+    int32_t Cancel(uint64_t requestId);
+    void CancelAll();
+    size_t GetPendingCount();
+
+private:
+    // Shared with the posted tasks so they never keep the executor, and its runners, alive.
+    struct PendingRequests {
+        std::mutex requestMutex;
+        std::map<uint64_t, Complete> completes;
+        uint64_t nextRequestId = 1;
+    };
+
+    static bool Finish(const std::shared_ptr<PendingRequests>& pending, uint64_t requestId, int32_t errCode);
+    static std::string GetTimeoutTaskName(uint64_t requestId);
+
+private:
+    std::string name_;
+    std::shared_ptr<AppExecFwk::EventHandler> workHandler_ = nullptr;
+    // timeouts fire on their own thread so a stuck call cannot hold them back
+    std::shared_ptr<AppExecFwk::EventHandler> timerHandler_ = nullptr;
+    std::shared_ptr<PendingRequests> pending_ = nullptr;
+};
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
+#endif // OHOS_DP_CLIENT_ASYNC_EXECUTOR_H
@@ -25,6 +25,7 @@
 #include <stdint.h>
 #include <set>
 #include <condition_variable>
+#include "client_async_executor.h"
 #include "i_pincode_invalid_callback.h"
 #include "i_profile_change_listener.h"
 #include "i_distributed_device_profile.h"
@@ -38,6 +39,8 @@
 #include "sync_completed_callback_stub.h"
 #include "system_ability_status_change_stub.h"
 #include "profile_change_listener_stub.h"
+#include "profile_client_cache.h"
+#include "service_availability.h"
 #include "trusted_device_info.h"
 #include "local_service_info.h"
 #include "iremote_broker.h"
@@ -46,6 +49,10 @@
 
 namespace OHOS {
 namespace DistributedDeviceProfile {
+template <typename T>
+using DpAsyncCallback = std::function<void(int32_t errCode, const T& result)>;
+using DpAsyncResultCallback = std::function<void(int32_t errCode)>;
+
 class DistributedDeviceProfileClient {
 DECLARE_SINGLE_INSTANCE(DistributedDeviceProfileClient);
 
@@ -56,6 +63,9 @@ public:
     int32_t GetAllTrustDeviceProfile(std::vector<TrustDeviceProfile>& trustDeviceProfiles);
     int32_t GetAccessControlProfile(std::map<std::string, std::string> params,
         std::vector<AccessControlProfile>& accessControlProfiles);
+    // One IPC for up to MAX_BATCH_QUERY_SIZE queries, results[i] is the status of paramsList[i].
+    int32_t GetAccessControlProfileBatch(const std::vector<std::map<std::string, std::string>>& paramsList,
+        std::vector<std::vector<AccessControlProfile>>& aclProfilesList, std::vector<int32_t>& results);
     int32_t GetAllAccessControlProfile(std::vector<AccessControlProfile>& accessControlProfiles);
     int32_t GetAllAclIncludeLnnAcl(std::vector<AccessControlProfile>& accessControlProfiles);
     int32_t DeleteAccessControlProfile(int32_t accessControlId);
@@ -76,6 +86,9 @@ public:
         ServiceProfile& serviceProfile);
     int32_t GetCharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
         const std::string& characteristicId, CharacteristicProfile& characteristicProfile);
+    // queries carry deviceId, serviceName, characteristicKey and the multi-user fields of each wanted profile.
+    int32_t GetCharacteristicProfileBatch(const std::vector<CharacteristicProfile>& queries,
+        std::vector<CharacteristicProfile>& characteristicProfiles, std::vector<int32_t>& results);
     int32_t DeleteServiceProfile(const std::string& deviceId, const std::string& serviceName,
         bool isMultiUser = false, int32_t userId = DEFAULT_USER_ID);
     int32_t DeleteCharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
@@ -109,6 +122,31 @@ public:
     int32_t GetAllServiceInfoList(std::vector<ServiceInfo>& serviceInfos);
     int32_t GetServiceInfosByUserInfo(const UserInfo& userInfo, std::vector<ServiceInfo>& serviceInfos);
     int32_t SubscribeAllServiceInfo(int32_t saId, sptr<IRemoteObject> listener);
+    // Opt-in read cache for Get{Device,Service,Characteristic,AccessControl}Profile, kept coherent by
+    // subscribing profile changes under saId, so saId must be the caller's own.
+    int32_t EnableProfileCache(int32_t saId, size_t capacity = DEFAULT_PROFILE_CACHE_SIZE,
+        int64_t maxAgeMs = DEFAULT_PROFILE_CACHE_MAX_AGE_MS);
+    void DisableProfileCache();
+    ProfileClientCacheStats GetProfileCacheStats();
+    // Non-blocking variants: the call runs on a client worker thread and callback runs exactly once with
+    // the result, DP_ASYNC_REQUEST_TIMEOUT or DP_ASYNC_REQUEST_CANCELED. It never runs on the caller thread
+    // except from CancelAsyncRequest.
+    int32_t GetAllAccessControlProfileAsync(DpAsyncCallback<std::vector<AccessControlProfile>> callback,
+        uint64_t& requestId, int64_t timeoutMs = DEFAULT_ASYNC_REQUEST_TIMEOUT_MS);
+    int32_t GetDeviceProfilesAsync(const DeviceProfileFilterOptions& options,
+        DpAsyncCallback<std::vector<DeviceProfile>> callback, uint64_t& requestId,
+        int64_t timeoutMs = DEFAULT_ASYNC_REQUEST_TIMEOUT_MS);
+    int32_t PutDeviceProfileBatchAsync(const std::vector<DeviceProfile>& deviceProfiles,
+        DpAsyncResultCallback callback, uint64_t& requestId, int64_t timeoutMs = DEFAULT_ASYNC_REQUEST_TIMEOUT_MS);
+    int32_t PutServiceProfileBatchAsync(const std::vector<ServiceProfile>& serviceProfiles,
+        DpAsyncResultCallback callback, uint64_t& requestId, int64_t timeoutMs = DEFAULT_ASYNC_REQUEST_TIMEOUT_MS);
+    int32_t PutCharacteristicProfileBatchAsync(const std::vector<CharacteristicProfile>& characteristicProfiles,
+        DpAsyncResultCallback callback, uint64_t& requestId, int64_t timeoutMs = DEFAULT_ASYNC_REQUEST_TIMEOUT_MS);
+    int32_t SyncDeviceProfileAsync(const DpSyncOptions& syncOptions, sptr<ISyncCompletedCallback> syncCb,
+        DpAsyncResultCallback callback, uint64_t& requestId, int64_t timeoutMs = DEFAULT_ASYNC_REQUEST_TIMEOUT_MS);
+    int32_t SyncStaticProfileAsync(const DpSyncOptions& syncOptions, sptr<ISyncCompletedCallback> syncCb,
+        DpAsyncResultCallback callback, uint64_t& requestId, int64_t timeoutMs = DEFAULT_ASYNC_REQUEST_TIMEOUT_MS);
+    int32_t CancelAsyncRequest(uint64_t requestId);
 
     void LoadSystemAbilitySuccess(const sptr<IRemoteObject> &remoteObject);
     void LoadSystemAbilityFail();
@@ -141,6 +179,12 @@ private:
     void ReRegisterBusinessCallback();
     void ReleaseRegisterBusinessCallback();
     void StartThreadReRegisterBusinessCallback();
+    std::shared_ptr<ClientAsyncExecutor> GetAsyncExecutor();
+    template <typename T>
+    int32_t SubmitAsyncRequest(std::function<int32_t(T&)> call, DpAsyncCallback<T> callback, int64_t timeoutMs,
+        uint64_t& requestId);
+    int32_t SubmitAsyncRequest(std::function<int32_t()> call, DpAsyncResultCallback callback, int64_t timeoutMs,
+        uint64_t& requestId);
 
     class DeviceProfileDeathRecipient : public IRemoteObject::DeathRecipient {
     public:
@@ -156,7 +200,6 @@ private:
     int32_t pinExchangeType_ = DEFAULT_PIN_EXCHANGE_TYPE;
 
     std::mutex serviceLock_;
-    std::condition_variable proxyConVar_;
     sptr<IDistributedDeviceProfile> dpProxy_ = nullptr;
     sptr<IRemoteObject::DeathRecipient> dpDeathRecipient_ = nullptr;
 
@@ -181,7 +224,10 @@ private:
     std::mutex serInfolistenerLock_;
     sptr<IRemoteObject> serviceInfolistener_ = nullptr;
 
-    bool loadSystemAbilityFinish_ = false;
+    ServiceAvailability serviceAvailability_;
+
+    std::mutex asyncLock_;
+    std::shared_ptr<ClientAsyncExecutor> asyncExecutor_ = nullptr;
 };
 } // namespace DeviceProfile
 } // namespace OHOS
@@ -45,6 +45,8 @@ public:
     int32_t GetAllTrustDeviceProfile(std::vector<TrustDeviceProfile>& trustDeviceProfiles) override;
     int32_t GetAccessControlProfile(std::map<std::string, std::string> queryParams,
         std::vector<AccessControlProfile>& accessControlProfiles) override;
+    int32_t GetAccessControlProfileBatch(const std::vector<std::map<std::string, std::string>>& queryParamsList,
+        std::vector<std::vector<AccessControlProfile>>& aclProfilesList, std::vector<int32_t>& results) override;
     int32_t GetAllAccessControlProfile(std::vector<AccessControlProfile>& accessControlProfiles) override;
     int32_t GetAllAclIncludeLnnAcl(std::vector<AccessControlProfile>& accessControlProfiles) override;
     int32_t DeleteAccessControlProfile(int32_t accessControlId) override;
@@ -66,6 +68,8 @@ public:
         ServiceProfile& serviceProfile) override;
     int32_t GetCharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
         const std::string& characteristicId, CharacteristicProfile& charProfile) override;
+    int32_t GetCharacteristicProfileBatch(const std::vector<CharacteristicProfile>& queries,
+        std::vector<CharacteristicProfile>& charProfiles, std::vector<int32_t>& results) override;
     int32_t DeleteServiceProfile(const std::string& deviceId, const std::string& serviceName, bool isMultiUser = false,
         int32_t userId = DEFAULT_USER_ID) override;
     int32_t DeleteCharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
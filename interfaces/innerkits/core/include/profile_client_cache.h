@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DP_PROFILE_CLIENT_CACHE_H
+#define OHOS_DP_PROFILE_CLIENT_CACHE_H
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "access_control_profile.h"
+#include "characteristic_profile.h"
+#include "device_profile.h"
+#include "dp_subscribe_info.h"
+#include "i_distributed_device_profile.h"
+#include "profile_change_listener_stub.h"
+#include "service_profile.h"
+#include "single_instance.h"
+
+namespace OHOS {
+namespace EventFwk {
+class CommonEventSubscriber;
+} // namespace EventFwk
+namespace DistributedDeviceProfile {
+constexpr size_t DEFAULT_PROFILE_CACHE_SIZE = 16;
+constexpr int64_t DEFAULT_PROFILE_CACHE_MAX_AGE_MS = 30000;
+
+struct ProfileClientCacheStats {
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    // entries dropped because a change notification arrived
+    uint64_t invalidateCount = 0;
+    // fills discarded because a change was notified while the IPC was in flight
+    uint64_t staleFillCount = 0;
+    // entries dropped because they outlived the max age
+    uint64_t expiredCount = 0;
+    uint64_t evictCount = 0;
+    // the oldest entry ever served, in milliseconds
+    int64_t maxServedAgeMs = 0;
+    size_t entryCount = 0;
+};
+
+class ProfileClientCache {
+    DECLARE_SINGLE_INSTANCE(ProfileClientCache);
+
+public:
+    int32_t Enable(int32_t saId, size_t capacity, int64_t maxAgeMs);
+    void Disable(const sptr<IDistributedDeviceProfile>& dpService);
+    bool IsEnabled();
+    // Drop all entries and forget subscriptions, e.g. after the service died.
+    void Reset();
+    uint64_t GetVersion();
+
+    int32_t GetDeviceProfile(const std::string& deviceId, DeviceProfile& deviceProfile);
+    int32_t GetServiceProfile(const std::string& deviceId, const std::string& serviceName,
+        ServiceProfile& serviceProfile);
+    int32_t GetCharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
+        const std::string& charKey, CharacteristicProfile& charProfile);
+    int32_t GetAccessControlProfile(const std::map<std::string, std::string>& params,
+        std::vector<AccessControlProfile>& aclProfiles);
+
+    // Must be called before the IPC read so that no change can slip between the read and the subscription.
+    bool PrepareDeviceProfile(const sptr<IDistributedDeviceProfile>& dpService, const std::string& deviceId);
+    bool PrepareServiceProfile(const sptr<IDistributedDeviceProfile>& dpService, const std::string& deviceId,
+        const std::string& serviceName);
+    bool PrepareCharacteristicProfile(const sptr<IDistributedDeviceProfile>& dpService, const std::string& deviceId,
+        const std::string& serviceName, const std::string& charKey);
+    bool PrepareAccessControlProfile(const sptr<IDistributedDeviceProfile>& dpService);
+
+    void PutDeviceProfile(const sptr<IDistributedDeviceProfile>& dpService, uint64_t version,
+        const std::string& deviceId, const DeviceProfile& deviceProfile);
+    void PutServiceProfile(const sptr<IDistributedDeviceProfile>& dpService, uint64_t version,
+        const std::string& deviceId, const std::string& serviceName, const ServiceProfile& serviceProfile);
+    void PutCharacteristicProfile(const sptr<IDistributedDeviceProfile>& dpService, uint64_t version,
+        const std::string& deviceId, const std::string& serviceName, const std::string& charKey,
+        const CharacteristicProfile& charProfile);
+    void PutAccessControlProfile(const sptr<IDistributedDeviceProfile>& dpService, uint64_t version,
+        const std::map<std::string, std::string>& params, const std::vector<AccessControlProfile>& aclProfiles);
+
+    void InvalidateDeviceProfile(const std::string& deviceId);
+    void InvalidateServiceProfile(const std::string& deviceId, const std::string& serviceName);
+    void InvalidateCharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
+        const std::string& charKey);
+    void InvalidateAccessControlProfile();
+
+    // The app's own subscriptions go through here. The service keeps one listener per saId and subscribeKey,
+    // so a key the cache subscribes too is registered once with a listener that serves both.
+    int32_t SubscribeForApp(const sptr<IDistributedDeviceProfile>& dpService, const SubscribeInfo& subscribeInfo);
+    int32_t UnSubscribeForApp(const sptr<IDistributedDeviceProfile>& dpService, const SubscribeInfo& subscribeInfo);
+
+    ProfileClientCacheStats GetStats();
+    void ResetStats();
+
+private:
+    class CacheChangeListener : public ProfileChangeListenerStub {
+    public:
+        void SetAppSubscribe(const SubscribeInfo& subscribeInfo);
+        int32_t OnTrustDeviceProfileAdd(const TrustDeviceProfile& profile) override;
+        int32_t OnTrustDeviceProfileDelete(const TrustDeviceProfile& profile) override;
+        int32_t OnTrustDeviceProfileUpdate(const TrustDeviceProfile& oldProfile,
+            const TrustDeviceProfile& newProfile) override;
+        int32_t OnTrustDeviceProfileActive(const TrustDeviceProfile& profile) override;
+        int32_t OnTrustDeviceProfileInactive(const TrustDeviceProfile& profile) override;
+        int32_t OnDeviceAclInactiveByDelete(const TrustDeviceProfile& profile) override;
+        int32_t OnDeviceAclInactiveByUpdate(const TrustDeviceProfile& profile) override;
+        int32_t OnAccountAclDelete(const TrustDeviceProfile& profile) override;
+        int32_t OnAccountAclInactive(const TrustDeviceProfile& profile) override;
+        int32_t OnAccountAclAdd(const TrustDeviceProfile& profile) override;
+        int32_t OnAccountAclActive(const TrustDeviceProfile& profile) override;
+        int32_t OnDeviceProfileAdd(const DeviceProfile& profile) override;
+        int32_t OnDeviceProfileDelete(const DeviceProfile& profile) override;
+        int32_t OnDeviceProfileUpdate(const DeviceProfile& oldProfile, const DeviceProfile& newProfile) override;
+        int32_t OnServiceProfileAdd(const ServiceProfile& profile) override;
+        int32_t OnServiceProfileDelete(const ServiceProfile& profile) override;
+        int32_t OnServiceProfileUpdate(const ServiceProfile& oldProfile, const ServiceProfile& newProfile) override;
+        int32_t OnCharacteristicProfileAdd(const CharacteristicProfile& profile) override;
+        int32_t OnCharacteristicProfileDelete(const CharacteristicProfile& profile) override;
+        int32_t OnCharacteristicProfileUpdate(const CharacteristicProfile& oldProfile,
+            const CharacteristicProfile& newProfile) override;
+
+    private:
+        template <typename Func>
+        void Forward(ProfileChangeType changeType, Func func);
+
+    private:
+        std::mutex appMutex_;
+        // set when the app subscribed the same key, it gets the changes it asked for
+        sptr<IProfileChangeListener> appListener_ = nullptr;
+        std::unordered_set<ProfileChangeType> appChangeTypes_;
+    };
+
+    template <typename T>
+    struct CacheItem {
+        T value;
+        int64_t cachedTimeMs = 0;
+        std::list<std::string>::iterator lruIter;
+    };
+
+    template <typename T>
+    int32_t GetItem(std::unordered_map<std::string, CacheItem<T>>& items, const std::string& cacheKey, T& value);
+    template <typename T>
+    void PutItem(std::unordered_map<std::string, CacheItem<T>>& items, const std::string& cacheKey,
+        uint64_t version, const T& value, std::vector<std::string>& evictedKeys);
+    template <typename T>
+    bool EraseItem(std::unordered_map<std::string, CacheItem<T>>& items, const std::string& cacheKey);
+    bool Prepare(const sptr<IDistributedDeviceProfile>& dpService, const std::string& cacheKey,
+        const std::vector<std::string>& subscribeKeys, const std::unordered_set<ProfileChangeType>& changeTypes);
+    void EvictLruLocked(std::vector<std::string>& evictedKeys);
+    void EraseLocked(const std::string& cacheKey);
+    bool HasItemLocked(const std::string& cacheKey);
+    void ReclaimOrphanSubscribeLocked(std::vector<std::string>& releasedKeys);
+    void Invalidate(const std::string& cacheKey);
+    void MarkChangedLocked(const std::string& cacheKey);
+    void ReleaseSubscribes(const sptr<IDistributedDeviceProfile>& dpService,
+        const std::vector<std::string>& subscribeKeys);
+    SubscribeInfo MakeCacheSubscribeLocked(int32_t saId, const std::string& subscribeKey,
+        const std::unordered_set<ProfileChangeType>& changeTypes);
+    void SubscribeUserSwitch();
+    void UnSubscribeUserSwitch();
+    std::string GenerateAclCacheKey(const std::map<std::string, std::string>& params);
+
+private:
+    std::mutex cacheMutex_;
+    bool enabled_ = false;
+    int32_t saId_ = 0;
+    size_t capacity_ = 0;
+    int64_t maxAgeMs_ = 0;
+    // Bumped on every invalidation, a fill started before the bump of its key is stale.
+    uint64_t version_ = 0;
+    // The key is cacheKey, the value is the version at which it was last invalidated
+    std::unordered_map<std::string, uint64_t> changedVersions_;
+    // Fills started before this version are rejected, changedVersions_ was trimmed at that point
+    uint64_t changedFloorVersion_ = 0;
+    // front is the most recently used cacheKey
+    std::list<std::string> lruList_;
+    std::unordered_map<std::string, CacheItem<DeviceProfile>> deviceProfileMap_;
+    std::unordered_map<std::string, CacheItem<ServiceProfile>> serviceProfileMap_;
+    std::unordered_map<std::string, CacheItem<CharacteristicProfile>> charProfileMap_;
+    std::unordered_map<std::string, CacheItem<std::vector<AccessControlProfile>>> aclProfileMap_;
+    // The key is cacheKey, the value is the subscribeKeys that keep it coherent
+    std::unordered_map<std::string, std::vector<std::string>> subscribedKeys_;
+    sptr<CacheChangeListener> listener_ = nullptr;
+    ProfileClientCacheStats stats_;
+
+    // Orders the subscribe IPCs, taken before cacheMutex_ and guards the members below.
+    std::mutex subscribeMutex_;
+    // The key is subscribeKey + SEPARATOR + saId, the value is the app's own subscription
+    std::unordered_map<std::string, SubscribeInfo> appSubscribes_;
+    // The key is a subscribeKey the cache holds, the value is the change types it needs
+    std::unordered_map<std::string, std::unordered_set<ProfileChangeType>> heldChangeTypes_;
+    // The key is a subscribeKey the app subscribed too, the value is the listener serving both
+    std::unordered_map<std::string, sptr<CacheChangeListener>> sharedListeners_;
+    // Acl results depend on the foreground user, they are only cached while the switch is observed.
+    std::shared_ptr<EventFwk::CommonEventSubscriber> userSwitchSubscriber_ = nullptr;
+    bool userSwitchSubscribed_ = false;
+};
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
+#endif // OHOS_DP_PROFILE_CLIENT_CACHE_H
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DP_SERVICE_AVAILABILITY_H
+#define OHOS_DP_SERVICE_AVAILABILITY_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <random>
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+constexpr int64_t DEFAULT_SA_LOAD_TIMEOUT_MS = 10000;
+constexpr uint32_t DEFAULT_CIRCUIT_FAILURE_THRESHOLD = 3;
+constexpr int64_t DEFAULT_CIRCUIT_OPEN_MS = 1000;
+constexpr int64_t MAX_CIRCUIT_OPEN_MS = 30000;
+constexpr int64_t DEFAULT_RETRY_BASE_DELAY_MS = 50;
+constexpr int64_t MAX_RETRY_DELAY_MS = 800;
+
+enum class ServiceState : int32_t {
+    UNKNOWN = 0,
+    LOADING = 1,
+    AVAILABLE = 2,
+    DOWN = 3
+};
+
+// Client side view of the dp sa. Only one sa load is in flight per process, every thread that
+// needs the sa while it loads waits for that load. After failureThreshold failed loads in a row
+// the circuit opens and callers fail fast; once the open window passes a single caller probes
+// the sa again and the window doubles on every failed probe.
+class ServiceAvailability {
+public:
+    // Asks samgr to load the sa, returns 0 when the request was accepted. The result arrives via OnLoadFinished.
+    using LoadFunc = std::function<int32_t()>;
+
+    ServiceAvailability(int64_t loadTimeoutMs = DEFAULT_SA_LOAD_TIMEOUT_MS,
+        uint32_t failureThreshold = DEFAULT_CIRCUIT_FAILURE_THRESHOLD, int64_t openMs = DEFAULT_CIRCUIT_OPEN_MS);
+    ~ServiceAvailability() = default;
+
+    bool WaitLoad(const LoadFunc& loadFunc);
+    void OnLoadFinished(bool success);
+    void OnServiceAvailable();
+    void OnServiceDied();
+    // True while the circuit is open, the caller should fail without touching samgr.
+    bool IsCircuitOpen();
+    // Jittered exponential backoff for the given retry attempt, starting at 0.
+    int64_t GetRetryDelayMs(uint32_t attempt);
+    ServiceState GetState();
+
+private:
+    bool IsCircuitOpenLocked(int64_t nowMs);
+    void FinishLoadLocked(bool success);
+
+private:
+    int64_t loadTimeoutMs_ = DEFAULT_SA_LOAD_TIMEOUT_MS;
+    uint32_t failureThreshold_ = DEFAULT_CIRCUIT_FAILURE_THRESHOLD;
+    int64_t openMs_ = DEFAULT_CIRCUIT_OPEN_MS;
+    std::mutex stateMutex_;
+    std::condition_variable loadCondVar_;
+    ServiceState state_ = ServiceState::UNKNOWN;
+    bool loading_ = false;
+    bool lastLoadSucceeded_ = false;
+    uint64_t loadGeneration_ = 0;
+    uint32_t consecutiveFailures_ = 0;
+    int64_t currentOpenMs_ = DEFAULT_CIRCUIT_OPEN_MS;
+    int64_t openUntilMs_ = 0;
+    std::mt19937 randomEngine_;
+};
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
+#endif // OHOS_DP_SERVICE_AVAILABILITY_H
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "client_async_executor.h"
+
+#include <cinttypes>
+#include <vector>
+
+#include "event_runner.h"
+
+#include "distributed_device_profile_errors.h"
+#include "distributed_device_profile_log.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+namespace {
+    const std::string TAG = "ClientAsyncExecutor";
+    const std::string WORK_RUNNER_SUFFIX = "_work";
+    const std::string TIMER_RUNNER_SUFFIX = "_timer";
+    const std::string TIMEOUT_TASK_PREFIX = "async_timeout_";
+}
+
+ClientAsyncExecutor::ClientAsyncExecutor(const std::string& name)
+    : name_(name), pending_(std::make_shared<PendingRequests>())
+{
+    workHandler_ = std::make_shared<AppExecFwk::EventHandler>(
+        AppExecFwk::EventRunner::Create(name_ + WORK_RUNNER_SUFFIX));
+    timerHandler_ = std::make_shared<AppExecFwk::EventHandler>(
+        AppExecFwk::EventRunner::Create(name_ + TIMER_RUNNER_SUFFIX));
+}
+
+ClientAsyncExecutor::~ClientAsyncExecutor()
+{
+    if (workHandler_ != nullptr) {
+        workHandler_->RemoveAllEvents();
+    }
+    if (timerHandler_ != nullptr) {
+        timerHandler_->RemoveAllEvents();
+    }
+}
+
+int32_t ClientAsyncExecutor::Submit(Work work, Complete complete, int64_t timeoutMs, uint64_t& requestId)
+{
+    if (work == nullptr || complete == nullptr || timeoutMs <= 0) {
+        HILOGE("params is invalid!");
+        return DP_INVALID_PARAMS;
+    }
+    if (workHandler_ == nullptr || timerHandler_ == nullptr) {
+        HILOGE("handler is nullptr!");
+        return DP_NULLPTR;
+    }
+    uint64_t id = 0;
+    {
+        std::lock_guard<std::mutex> lock(pending_->requestMutex);
+        if (pending_->completes.size() >= MAX_ASYNC_REQUEST_SIZE) {
+            HILOGE("%{public}s too many pending requests!", name_.c_str());
+            return DP_EXCEED_MAX_SIZE_FAIL;
+        }
+        id = pending_->nextRequestId++;
+        pending_->completes[id] = std::move(complete);
+    }
+    std::shared_ptr<PendingRequests> pending = pending_;
+    std::weak_ptr<AppExecFwk::EventHandler> weakTimerHandler = timerHandler_;
+    auto workTask = [pending, weakTimerHandler, id, work]() {
+        {
+            // a request that timed out or was cancelled while queued never reaches the service
+            std::lock_guard<std::mutex> lock(pending->requestMutex);
+            if (pending->completes.count(id) == 0) {
+                return;
+            }
+        }
+        int32_t ret = work();
+        if (Finish(pending, id, ret)) {
+            auto timerHandler = weakTimerHandler.lock();
+            if (timerHandler != nullptr) {
+                timerHandler->RemoveTask(GetTimeoutTaskName(id));
+            }
+        }
+    };
+    auto timeoutTask = [pending, id]() {
+        if (Finish(pending, id, DP_ASYNC_REQUEST_TIMEOUT)) {
+            HILOGW("request %{public}" PRIu64 " timeout", id);
+        }
+    };
+    if (!timerHandler_->PostTask(timeoutTask, GetTimeoutTaskName(id), timeoutMs) ||
+        !workHandler_->PostTask(workTask)) {
+        HILOGE("%{public}s post task fail!", name_.c_str());
+        timerHandler_->RemoveTask(GetTimeoutTaskName(id));
+        std::lock_guard<std::mutex> lock(pending_->requestMutex);
+        pending_->completes.erase(id);
+        return DP_POST_TASK_FAILED;
+    }
+    requestId = id;
+    return DP_SUCCESS;
+}
+
+int32_t ClientAsyncExecutor::Cancel(uint64_t requestId)
+{
+    if (!Finish(pending_, requestId, DP_ASYNC_REQUEST_CANCELED)) {
+        HILOGW("request %{public}" PRIu64 " is not pending", requestId);
+        return DP_NOT_FOUND_FAIL;
+    }
+    if (timerHandler_ != nullptr) {
+        timerHandler_->RemoveTask(GetTimeoutTaskName(requestId));
+    }
+    return DP_SUCCESS;
+}
+
+void ClientAsyncExecutor::CancelAll()
+{
+    std::vector<uint64_t> requestIds;
+    {
+        std::lock_guard<std::mutex> lock(pending_->requestMutex);
+        for (const auto& [requestId, _] : pending_->completes) {
+            requestIds.emplace_back(requestId);
+        }
+    }
+    for (auto requestId : requestIds) {
+        Cancel(requestId);
+    }
+}
+
+size_t ClientAsyncExecutor::GetPendingCount()
+{
+    std::lock_guard<std::mutex> lock(pending_->requestMutex);
+    return pending_->completes.size();
+}
+
+bool ClientAsyncExecutor::Finish(const std::shared_ptr<PendingRequests>& pending, uint64_t requestId,
+    int32_t errCode)
+{
+    Complete complete = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(pending->requestMutex);
+        auto iter = pending->completes.find(requestId);
+        if (iter == pending->completes.end()) {
+            return false;
+        }
+        complete = std::move(iter->second);
+        pending->completes.erase(iter);
+    }
+    complete(errCode);
+    return true;
+}
+
+std::string ClientAsyncExecutor::GetTimeoutTaskName(uint64_t requestId)
+{
+    return TIMEOUT_TASK_PREFIX + std::to_string(requestId);
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
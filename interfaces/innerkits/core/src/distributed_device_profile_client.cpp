@@ -18,15 +18,16 @@
 #include <algorithm>
 #include <bitset>
 #include <chrono>
+#include <cinttypes>
 #include <functional>
 #include <new>
 #include <string>
 #include <thread>
 #include <type_traits>
-#include <unistd.h>
 #include <utility>
 #include <profile_utils.h>
 #include "profile_change_listener_stub.h"
+#include "profile_client_cache.h"
 #include "device_profile_load_callback.h"
 #include "distributed_device_profile_errors.h"
 #include "distributed_device_profile_log.h"
@@ -46,51 +47,44 @@ using namespace std::chrono_literals;
 
 namespace {
     const std::string TAG = "Client";
-    constexpr int32_t LOAD_SA_TIMEOUT_MS = 10000;
-    constexpr int32_t MAX_RETRY_TIMES = 7;
+    const std::string ASYNC_EXECUTOR_NAME = "dp_client_async";
+    constexpr uint32_t MAX_RETRY_TIMES = 7;
 }
 
 IMPLEMENT_SINGLE_INSTANCE(DistributedDeviceProfileClient);
 
 sptr<IDistributedDeviceProfile> DistributedDeviceProfileClient::LoadDeviceProfileService()
 {
-    sptr<DeviceProfileLoadCallback> loadCallback = new DeviceProfileLoadCallback();
-    if (loadCallback == nullptr) {
-        HILOGE("loadCallback is nullptr.");
-        return nullptr;
-    }
-
-    auto samgrProxy = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
-    if (samgrProxy == nullptr) {
-        HILOGE("get samgr failed");
-        return nullptr;
-    }
-
-    HILOGI("start LoadSystemAbility");
-    int32_t ret = samgrProxy->LoadSystemAbility(DISTRIBUTED_DEVICE_PROFILE_SA_ID, loadCallback);
-    int32_t stageRes = (ret == ERR_OK) ?
-        static_cast<int32_t>(StageRes::STAGE_IDLE) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    DpRadarHelper::GetInstance().ReportLoadDpSa(stageRes);
-    if (ret != ERR_OK) {
-        HILOGE("Failed to Load systemAbility");
-        return nullptr;
-    }
-    {
-        std::unique_lock<std::mutex> lock(serviceLock_);
-        if (dpProxy_ != nullptr) {
-            HILOGI("Get profile Service success!");
-            return dpProxy_;
+    auto loadFunc = []() {
+        sptr<DeviceProfileLoadCallback> loadCallback = new DeviceProfileLoadCallback();
+        if (loadCallback == nullptr) {
+            HILOGE("loadCallback is nullptr.");
+            return DP_NULLPTR;
         }
-        proxyConVar_.wait_for(lock, std::chrono::milliseconds(LOAD_SA_TIMEOUT_MS),
-            [this]() { return loadSystemAbilityFinish_; });
-        loadSystemAbilityFinish_ = false;
-        if (dpProxy_ != nullptr) {
-            HILOGI("Get profile Service success!");
-            return dpProxy_;
+        auto samgrProxy = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
+        if (samgrProxy == nullptr) {
+            HILOGE("get samgr failed");
+            return DP_GET_SERVICE_FAILED;
         }
+        HILOGI("start LoadSystemAbility");
+        int32_t ret = samgrProxy->LoadSystemAbility(DISTRIBUTED_DEVICE_PROFILE_SA_ID, loadCallback);
+        int32_t stageRes = (ret == ERR_OK) ?
+            static_cast<int32_t>(StageRes::STAGE_IDLE) : static_cast<int32_t>(StageRes::STAGE_FAIL);
+        DpRadarHelper::GetInstance().ReportLoadDpSa(stageRes);
+        if (ret != ERR_OK) {
+            HILOGE("Failed to Load systemAbility");
+        }
+        return ret;
+    };
+    if (!serviceAvailability_.WaitLoad(loadFunc)) {
+        HILOGE("Get profile Service failed!");
+        return nullptr;
     }
-    HILOGE("Get profile Service failed!");
-    return nullptr;
+    std::lock_guard<std::mutex> lock(serviceLock_);
+    if (dpProxy_ != nullptr) {
+        HILOGI("Get profile Service success!");
+    }
+    return dpProxy_;
 }
 
 void DistributedDeviceProfileClient::LoadSystemAbilitySuccess(const sptr<IRemoteObject> &remoteObject)
@@ -98,27 +92,29 @@ void DistributedDeviceProfileClient::LoadSystemAbilitySuccess(const sptr<IRemote
     HILOGI("FinishStartSA");
     int32_t stageRes = static_cast<int32_t>(StageRes::STAGE_SUCC);
     DpRadarHelper::GetInstance().ReportLoadDpSaCb(stageRes);
-    std::lock_guard<std::mutex> lock(serviceLock_);
-    if (dpDeathRecipient_ == nullptr) {
-        dpDeathRecipient_ = sptr<IRemoteObject::DeathRecipient>(new DeviceProfileDeathRecipient);
-    }
-    if (remoteObject != nullptr) {
-        remoteObject->AddDeathRecipient(dpDeathRecipient_);
-        dpProxy_ = iface_cast<IDistributedDeviceProfile>(remoteObject);
-        loadSystemAbilityFinish_ = true;
-        proxyConVar_.notify_one();
-        DpRadarHelper::GetInstance().SetDeviceProfileInit(true);
+    {
+        std::lock_guard<std::mutex> lock(serviceLock_);
+        if (dpDeathRecipient_ == nullptr) {
+            dpDeathRecipient_ = sptr<IRemoteObject::DeathRecipient>(new DeviceProfileDeathRecipient);
+        }
+        if (remoteObject != nullptr) {
+            remoteObject->AddDeathRecipient(dpDeathRecipient_);
+            dpProxy_ = iface_cast<IDistributedDeviceProfile>(remoteObject);
+            DpRadarHelper::GetInstance().SetDeviceProfileInit(true);
+        }
     }
+    serviceAvailability_.OnLoadFinished(remoteObject != nullptr);
 }
 
 void DistributedDeviceProfileClient::LoadSystemAbilityFail()
 {
     int32_t stageRes = static_cast<int32_t>(StageRes::STAGE_FAIL);
     DpRadarHelper::GetInstance().ReportLoadDpSaCb(stageRes);
-    std::lock_guard<std::mutex> lock(serviceLock_);
-    dpProxy_ = nullptr;
-    loadSystemAbilityFinish_ = true;
-    proxyConVar_.notify_one();
+    {
+        std::lock_guard<std::mutex> lock(serviceLock_);
+        dpProxy_ = nullptr;
+    }
+    serviceAvailability_.OnLoadFinished(false);
 }
 
 void DistributedDeviceProfileClient::SendSubscribeInfosToService()
@@ -149,6 +145,7 @@ int32_t DistributedDeviceProfileClient::PutAccessControlProfile(const AccessCont
     if (retryErrCodes_.count(ret) != 0) {
         ret = RetryClientRequest(ret, &IDistributedDeviceProfile::PutAccessControlProfile, accessControlProfile);
     }
+    ProfileClientCache::GetInstance().InvalidateAccessControlProfile();
     return ret;
 }
 
@@ -163,6 +160,7 @@ int32_t DistributedDeviceProfileClient::UpdateAccessControlProfile(const AccessC
     if (retryErrCodes_.count(ret) != 0) {
         ret = RetryClientRequest(ret, &IDistributedDeviceProfile::UpdateAccessControlProfile, accessControlProfile);
     }
+    ProfileClientCache::GetInstance().InvalidateAccessControlProfile();
     return ret;
 }
 
@@ -207,14 +205,78 @@ int32_t DistributedDeviceProfileClient::GetAccessControlProfile(std::map<std::st
         HILOGE("Params size is invalid! size: %{public}zu!", params.size());
         return DP_INVALID_PARAMS;
     }
+    if (ProfileClientCache::GetInstance().GetAccessControlProfile(params, accessControlProfiles) == DP_SUCCESS) {
+        return DP_SUCCESS;
+    }
+    bool cacheable = ProfileClientCache::GetInstance().PrepareAccessControlProfile(dpService);
+    uint64_t version = ProfileClientCache::GetInstance().GetVersion();
     int32_t ret = dpService->GetAccessControlProfile(params, accessControlProfiles);
     if (retryErrCodes_.count(ret) != 0) {
         ret = RetryClientRequest(ret, &IDistributedDeviceProfile::GetAccessControlProfile, params,
             accessControlProfiles);
     }
+    if (ret == DP_SUCCESS && cacheable) {
+        ProfileClientCache::GetInstance().PutAccessControlProfile(dpService, version, params,
+            accessControlProfiles);
+    }
     return ret;
 }
 
+int32_t DistributedDeviceProfileClient::GetAccessControlProfileBatch(
+    const std::vector<std::map<std::string, std::string>>& paramsList,
+    std::vector<std::vector<AccessControlProfile>>& aclProfilesList, std::vector<int32_t>& results)
+{
+    if (paramsList.empty() || paramsList.size() > MAX_BATCH_QUERY_SIZE) {
+        HILOGE("paramsList size is invalid! size: %{public}zu!", paramsList.size());
+        return DP_INVALID_PARAMS;
+    }
+    aclProfilesList.assign(paramsList.size(), std::vector<AccessControlProfile>());
+    results.assign(paramsList.size(), DP_SUCCESS);
+    std::vector<std::map<std::string, std::string>> missParamsList;
+    std::vector<size_t> missIndexes;
+    for (size_t i = 0; i < paramsList.size(); i++) {
+        if (paramsList[i].empty() || paramsList[i].size() > MAX_PARAM_SIZE) {
+            results[i] = DP_INVALID_PARAMS;
+            continue;
+        }
+        if (ProfileClientCache::GetInstance().GetAccessControlProfile(paramsList[i], aclProfilesList[i]) ==
+            DP_SUCCESS) {
+            continue;
+        }
+        missParamsList.emplace_back(paramsList[i]);
+        missIndexes.emplace_back(i);
+    }
+    if (missParamsList.empty()) {
+        return DP_SUCCESS;
+    }
+    auto dpService = GetDeviceProfileService();
+    if (dpService == nullptr) {
+        HILOGE("Get dp service failed");
+        return DP_GET_SERVICE_FAILED;
+    }
+    bool cacheable = ProfileClientCache::GetInstance().PrepareAccessControlProfile(dpService);
+    uint64_t version = ProfileClientCache::GetInstance().GetVersion();
+    std::vector<std::vector<AccessControlProfile>> missProfilesList;
+    std::vector<int32_t> missResults;
+    int32_t ret = dpService->GetAccessControlProfileBatch(missParamsList, missProfilesList, missResults);
+    if (retryErrCodes_.count(ret) != 0) {
+        ret = RetryClientRequest(ret, &IDistributedDeviceProfile::GetAccessControlProfileBatch, missParamsList,
+            missProfilesList, missResults);
+    }
+    if (ret != DP_SUCCESS) {
+        return ret;
+    }
+    for (size_t i = 0; i < missIndexes.size(); i++) {
+        aclProfilesList[missIndexes[i]] = std::move(missProfilesList[i]);
+        results[missIndexes[i]] = missResults[i];
+        if (missResults[i] == DP_SUCCESS && cacheable) {
+            ProfileClientCache::GetInstance().PutAccessControlProfile(dpService, version, missParamsList[i],
+                aclProfilesList[missIndexes[i]]);
+        }
+    }
+    return DP_SUCCESS;
+}
+
 int32_t DistributedDeviceProfileClient::GetAllAccessControlProfile(
     std::vector<AccessControlProfile>& accessControlProfiles)
 {
@@ -255,6 +317,7 @@ int32_t DistributedDeviceProfileClient::DeleteAccessControlProfile(int32_t acces
     if (retryErrCodes_.count(ret) != 0) {
         ret = RetryClientRequest(ret, &IDistributedDeviceProfile::DeleteAccessControlProfile, accessControlId);
     }
+    ProfileClientCache::GetInstance().InvalidateAccessControlProfile();
     return ret;
 }
 
@@ -265,7 +328,11 @@ int32_t DistributedDeviceProfileClient::PutDeviceProfileBatch(std::vector<Device
         HILOGE("Get dp service failed");
         return DP_GET_SERVICE_FAILED;
     }
-    return dpService->PutDeviceProfileBatch(deviceProfiles);
+    int32_t ret = dpService->PutDeviceProfileBatch(deviceProfiles);
+    for (const auto& deviceProfile : deviceProfiles) {
+        ProfileClientCache::GetInstance().InvalidateDeviceProfile(deviceProfile.GetDeviceId());
+    }
+    return ret;
 }
 
 int32_t DistributedDeviceProfileClient::DeleteDeviceProfileBatch(std::vector<DeviceProfile>& deviceProfiles)
@@ -275,7 +342,11 @@ int32_t DistributedDeviceProfileClient::DeleteDeviceProfileBatch(std::vector<Dev
         HILOGE("Get dp service failed");
         return DP_GET_SERVICE_FAILED;
     }
-    return dpService->DeleteDeviceProfileBatch(deviceProfiles);
+    int32_t ret = dpService->DeleteDeviceProfileBatch(deviceProfiles);
+    for (const auto& deviceProfile : deviceProfiles) {
+        ProfileClientCache::GetInstance().InvalidateDeviceProfile(deviceProfile.GetDeviceId());
+    }
+    return ret;
 }
 
 int32_t DistributedDeviceProfileClient::PutServiceProfile(const ServiceProfile& serviceProfile)
@@ -285,7 +356,10 @@ int32_t DistributedDeviceProfileClient::PutServiceProfile(const ServiceProfile&
         HILOGE("Get dp service failed");
         return DP_GET_SERVICE_FAILED;
     }
-    return dpService->PutServiceProfile(serviceProfile);
+    int32_t ret = dpService->PutServiceProfile(serviceProfile);
+    ProfileClientCache::GetInstance().InvalidateServiceProfile(serviceProfile.GetDeviceId(),
+        serviceProfile.GetServiceName());
+    return ret;
 }
 
 int32_t DistributedDeviceProfileClient::PutServiceProfileBatch(const std::vector<ServiceProfile>& serviceProfiles)
@@ -299,7 +373,12 @@ int32_t DistributedDeviceProfileClient::PutServiceProfileBatch(const std::vector
         HILOGE("ServiceProfiles size is invalid!size: %{public}zu!", serviceProfiles.size());
         return DP_INVALID_PARAMS;
     }
-    return dpService->PutServiceProfileBatch(serviceProfiles);
+    int32_t ret = dpService->PutServiceProfileBatch(serviceProfiles);
+    for (const auto& serviceProfile : serviceProfiles) {
+        ProfileClientCache::GetInstance().InvalidateServiceProfile(serviceProfile.GetDeviceId(),
+            serviceProfile.GetServiceName());
+    }
+    return ret;
 }
 
 int32_t DistributedDeviceProfileClient::PutCharacteristicProfile(const CharacteristicProfile& characteristicProfile)
@@ -309,7 +388,10 @@ int32_t DistributedDeviceProfileClient::PutCharacteristicProfile(const Character
         HILOGE("Get dp service failed");
         return DP_GET_SERVICE_FAILED;
     }
-    return dpService->PutCharacteristicProfile(characteristicProfile);
+    int32_t ret = dpService->PutCharacteristicProfile(characteristicProfile);
+    ProfileClientCache::GetInstance().InvalidateCharacteristicProfile(characteristicProfile.GetDeviceId(),
+        characteristicProfile.GetServiceName(), characteristicProfile.GetCharacteristicKey());
+    return ret;
 }
 
 int32_t DistributedDeviceProfileClient::PutCharacteristicProfileBatch(
@@ -324,17 +406,31 @@ int32_t DistributedDeviceProfileClient::PutCharacteristicProfileBatch(
         HILOGE("ServiceProfiles size is invalid!size: %{public}zu!", characteristicProfiles.size());
         return DP_INVALID_PARAMS;
     }
-    return dpService->PutCharacteristicProfileBatch(characteristicProfiles);
+    int32_t ret = dpService->PutCharacteristicProfileBatch(characteristicProfiles);
+    for (const auto& charProfile : characteristicProfiles) {
+        ProfileClientCache::GetInstance().InvalidateCharacteristicProfile(charProfile.GetDeviceId(),
+            charProfile.GetServiceName(), charProfile.GetCharacteristicKey());
+    }
+    return ret;
 }
 
 int32_t DistributedDeviceProfileClient::GetDeviceProfile(const std::string& deviceId, DeviceProfile& deviceProfile)
 {
+    if (ProfileClientCache::GetInstance().GetDeviceProfile(deviceId, deviceProfile) == DP_SUCCESS) {
+        return DP_SUCCESS;
+    }
     auto dpService = GetDeviceProfileService();
     if (dpService == nullptr) {
         HILOGE("Get dp service failed");
         return DP_GET_SERVICE_FAILED;
     }
-    return dpService->GetDeviceProfile(deviceId, deviceProfile);
+    bool cacheable = ProfileClientCache::GetInstance().PrepareDeviceProfile(dpService, deviceId);
+    uint64_t version = ProfileClientCache::GetInstance().GetVersion();
+    int32_t ret = dpService->GetDeviceProfile(deviceId, deviceProfile);
+    if (ret == DP_SUCCESS && cacheable) {
+        ProfileClientCache::GetInstance().PutDeviceProfile(dpService, version, deviceId, deviceProfile);
+    }
+    return ret;
 }
 
 int32_t DistributedDeviceProfileClient::GetDeviceProfiles(DeviceProfileFilterOptions& options,
@@ -351,12 +447,22 @@ int32_t DistributedDeviceProfileClient::GetDeviceProfiles(DeviceProfileFilterOpt
 int32_t DistributedDeviceProfileClient::GetServiceProfile(const std::string& deviceId, const std::string& serviceName,
     ServiceProfile& serviceProfile)
 {
+    if (ProfileClientCache::GetInstance().GetServiceProfile(deviceId, serviceName, serviceProfile) == DP_SUCCESS) {
+        return DP_SUCCESS;
+    }
     auto dpService = GetDeviceProfileService();
     if (dpService == nullptr) {
         HILOGE("Get dp service failed");
         return DP_GET_SERVICE_FAILED;
     }
-    return dpService->GetServiceProfile(deviceId, serviceName, serviceProfile);
+    bool cacheable = ProfileClientCache::GetInstance().PrepareServiceProfile(dpService, deviceId, serviceName);
+    uint64_t version = ProfileClientCache::GetInstance().GetVersion();
+    int32_t ret = dpService->GetServiceProfile(deviceId, serviceName, serviceProfile);
+    if (ret == DP_SUCCESS && cacheable) {
+        ProfileClientCache::GetInstance().PutServiceProfile(dpService, version, deviceId, serviceName,
+            serviceProfile);
+    }
+    return ret;
 }
 
 
@@ -394,12 +500,83 @@ int32_t DistributedDeviceProfileClient::GetDeviceIconInfos(const DeviceIconInfoF
 int32_t DistributedDeviceProfileClient::GetCharacteristicProfile(const std::string& deviceId,
     const std::string& serviceName, const std::string& characteristicId, CharacteristicProfile& characteristicProfile)
 {
+    if (ProfileClientCache::GetInstance().GetCharacteristicProfile(deviceId, serviceName, characteristicId,
+        characteristicProfile) == DP_SUCCESS) {
+        return DP_SUCCESS;
+    }
+    auto dpService = GetDeviceProfileService();
+    if (dpService == nullptr) {
+        HILOGE("Get dp service failed");
+        return DP_GET_SERVICE_FAILED;
+    }
+    bool cacheable = ProfileClientCache::GetInstance().PrepareCharacteristicProfile(dpService, deviceId,
+        serviceName, characteristicId);
+    uint64_t version = ProfileClientCache::GetInstance().GetVersion();
+    int32_t ret = dpService->GetCharacteristicProfile(deviceId, serviceName, characteristicId,
+        characteristicProfile);
+    if (ret == DP_SUCCESS && cacheable) {
+        ProfileClientCache::GetInstance().PutCharacteristicProfile(dpService, version, deviceId, serviceName,
+            characteristicId, characteristicProfile);
+    }
+    return ret;
+}
+
+int32_t DistributedDeviceProfileClient::GetCharacteristicProfileBatch(
+    const std::vector<CharacteristicProfile>& queries, std::vector<CharacteristicProfile>& characteristicProfiles,
+    std::vector<int32_t>& results)
+{
+    if (queries.empty() || queries.size() > MAX_BATCH_QUERY_SIZE) {
+        HILOGE("queries size is invalid! size: %{public}zu!", queries.size());
+        return DP_INVALID_PARAMS;
+    }
+    characteristicProfiles.assign(queries.size(), CharacteristicProfile());
+    results.assign(queries.size(), DP_SUCCESS);
+    std::vector<CharacteristicProfile> missQueries;
+    std::vector<size_t> missIndexes;
+    for (size_t i = 0; i < queries.size(); i++) {
+        // the cache is keyed without a userId, a multi-user query always goes to the service
+        if (!queries[i].IsMultiUser() && ProfileClientCache::GetInstance().GetCharacteristicProfile(
+            queries[i].GetDeviceId(), queries[i].GetServiceName(), queries[i].GetCharacteristicKey(),
+            characteristicProfiles[i]) == DP_SUCCESS) {
+            continue;
+        }
+        missQueries.emplace_back(queries[i]);
+        missIndexes.emplace_back(i);
+    }
+    if (missQueries.empty()) {
+        return DP_SUCCESS;
+    }
     auto dpService = GetDeviceProfileService();
     if (dpService == nullptr) {
         HILOGE("Get dp service failed");
         return DP_GET_SERVICE_FAILED;
     }
-    return dpService->GetCharacteristicProfile(deviceId, serviceName, characteristicId, characteristicProfile);
+    std::vector<bool> cacheables;
+    for (const auto& query : missQueries) {
+        cacheables.emplace_back(!query.IsMultiUser() && ProfileClientCache::GetInstance().
+            PrepareCharacteristicProfile(dpService, query.GetDeviceId(), query.GetServiceName(),
+            query.GetCharacteristicKey()));
+    }
+    uint64_t version = ProfileClientCache::GetInstance().GetVersion();
+    std::vector<CharacteristicProfile> missProfiles;
+    std::vector<int32_t> missResults;
+    int32_t ret = dpService->GetCharacteristicProfileBatch(missQueries, missProfiles, missResults);
+    if (retryErrCodes_.count(ret) != 0) {
+        ret = RetryClientRequest(ret, &IDistributedDeviceProfile::GetCharacteristicProfileBatch, missQueries,
+            missProfiles, missResults);
+    }
+    if (ret != DP_SUCCESS) {
+        return ret;
+    }
+    for (size_t i = 0; i < missIndexes.size(); i++) {
+        characteristicProfiles[missIndexes[i]] = missProfiles[i];
+        results[missIndexes[i]] = missResults[i];
+        if (missResults[i] == DP_SUCCESS && cacheables[i]) {
+            ProfileClientCache::GetInstance().PutCharacteristicProfile(dpService, version, missQueries[i].GetDeviceId(),
+                missQueries[i].GetServiceName(), missQueries[i].GetCharacteristicKey(), missProfiles[i]);
+        }
+    }
+    return DP_SUCCESS;
 }
 
 int32_t DistributedDeviceProfileClient::DeleteServiceProfile(const std::string& deviceId,
@@ -410,7 +587,9 @@ int32_t DistributedDeviceProfileClient::DeleteServiceProfile(const std::string&
         HILOGE("Get dp service failed");
         return DP_GET_SERVICE_FAILED;
     }
-    return dpService->DeleteServiceProfile(deviceId, serviceName, isMultiUser, userId);
+    int32_t ret = dpService->DeleteServiceProfile(deviceId, serviceName, isMultiUser, userId);
+    ProfileClientCache::GetInstance().InvalidateServiceProfile(deviceId, serviceName);
+    return ret;
 }
 
 int32_t DistributedDeviceProfileClient::DeleteCharacteristicProfile(const std::string& deviceId,
@@ -421,7 +600,10 @@ int32_t DistributedDeviceProfileClient::DeleteCharacteristicProfile(const std::s
         HILOGE("Get dp service failed");
         return DP_GET_SERVICE_FAILED;
     }
-    return dpService->DeleteCharacteristicProfile(deviceId, serviceName, characteristicKey, isMultiUser, userId);
+    int32_t ret = dpService->DeleteCharacteristicProfile(deviceId, serviceName, characteristicKey, isMultiUser,
+        userId);
+    ProfileClientCache::GetInstance().InvalidateCharacteristicProfile(deviceId, serviceName, characteristicKey);
+    return ret;
 }
 
 int32_t DistributedDeviceProfileClient::SubscribeDeviceProfile(const SubscribeInfo& subscribeInfo)
@@ -443,7 +625,7 @@ int32_t DistributedDeviceProfileClient::SubscribeDeviceProfile(const SubscribeIn
         subscribeInfos_[subscribeTag] = subscribeInfo;
         HILOGI("subscribeInfos_.size is %{public}zu", subscribeInfos_.size());
     }
-    return dpService->SubscribeDeviceProfile(subscribeInfo);
+    return ProfileClientCache::GetInstance().SubscribeForApp(dpService, subscribeInfo);
 }
 
 int32_t DistributedDeviceProfileClient::UnSubscribeDeviceProfile(const SubscribeInfo& subscribeInfo)
@@ -459,7 +641,7 @@ int32_t DistributedDeviceProfileClient::UnSubscribeDeviceProfile(const Subscribe
         subscribeInfos_.erase(subscribeInfo.GetSubscribeKey() + SEPARATOR + std::to_string(subscribeInfo.GetSaId()));
         HILOGI("subscribeInfos_.size is %{public}zu", subscribeInfos_.size());
     }
-    return dpService->UnSubscribeDeviceProfile(subscribeInfo);
+    return ProfileClientCache::GetInstance().UnSubscribeForApp(dpService, subscribeInfo);
 }
 
 int32_t DistributedDeviceProfileClient::SyncDeviceProfile(const DpSyncOptions& syncOptions,
@@ -529,6 +711,7 @@ sptr<IDistributedDeviceProfile> DistributedDeviceProfileClient::GetDeviceProfile
             }
             object->AddDeathRecipient(dpDeathRecipient_);
             dpProxy_ = iface_cast<IDistributedDeviceProfile>(object);
+            serviceAvailability_.OnServiceAvailable();
             return dpProxy_;
         }
     }
@@ -552,6 +735,8 @@ void DistributedDeviceProfileClient::OnServiceDied(const sptr<IRemoteObject>& re
 {
     HILOGI("called");
     DpRadarHelper::GetInstance().SetDeviceProfileInit(false);
+    ProfileClientCache::GetInstance().Reset();
+    serviceAvailability_.OnServiceDied();
     std::lock_guard<std::mutex> lock(serviceLock_);
     dpProxy_ = nullptr;
 }
@@ -946,6 +1131,7 @@ void DistributedDeviceProfileClient::SystemAbilityListener::OnAddSystemAbility(i
     const std::string &deviceId)
 {
     HILOGI("dp sa started");
+    DistributedDeviceProfileClient::GetInstance().serviceAvailability_.OnServiceAvailable();
     DistributedDeviceProfileClient::GetInstance().StartThreadSendSubscribeInfos();
     DistributedDeviceProfileClient::GetInstance().StartThreadReSubscribePinCodeInvalid();
     DistributedDeviceProfileClient::GetInstance().ReSubscribeDeviceProfileInited();
@@ -1035,10 +1221,14 @@ int32_t DistributedDeviceProfileClient::RetryClientRequest(int32_t firesRet, Met
         std::lock_guard<std::mutex> lock(serviceLock_);
         dpProxy_ = nullptr;
     }
-    int32_t delays[MAX_RETRY_TIMES] = {US_100000, US_200000, US_300000, US_400000, US_500000, US_500000, US_500000};
-    for (int32_t i = 0; i < MAX_RETRY_TIMES; ++i) {
-        HILOGI("retry times:%{public}d, retry reason:%{public}d", i + 1, ret);
-        usleep(delays[i]);
+    for (uint32_t i = 0; i < MAX_RETRY_TIMES; ++i) {
+        if (serviceAvailability_.IsCircuitOpen()) {
+            HILOGE("dp service is down, stop retry, reason:%{public}d", ret);
+            return DP_GET_SERVICE_FAILED;
+        }
+        int64_t delayMs = serviceAvailability_.GetRetryDelayMs(i);
+        HILOGI("retry times:%{public}u, retry reason:%{public}d, delay:%{public}" PRId64 "ms", i + 1, ret, delayMs);
+        std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
         auto dpService = GetDeviceProfileService();
         if (dpService == nullptr) {
             HILOGE("get dp service failed");
@@ -1055,11 +1245,20 @@ int32_t DistributedDeviceProfileClient::RetryClientRequest(int32_t firesRet, Met
 
 void DistributedDeviceProfileClient::ReleaseResource()
 {
+    DisableProfileCache();
     ReleaseSubscribeDeviceProfileSA();
     ReleaseSubscribePinCodeInvalid();
     ReleaseSubscribeDeviceProfileInited();
     ReleaseDeathRecipient();
     ReleaseRegisterBusinessCallback();
+    std::shared_ptr<ClientAsyncExecutor> asyncExecutor = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(asyncLock_);
+        asyncExecutor = asyncExecutor_;
+    }
+    if (asyncExecutor != nullptr) {
+        asyncExecutor->CancelAll();
+    }
 }
 
 void DistributedDeviceProfileClient::StartThreadReRegisterBusinessCallback()
@@ -1293,5 +1492,147 @@ int32_t DistributedDeviceProfileClient::SubscribeAllServiceInfo(int32_t saId, sp
     HILOGD("Subscribe DP serviceInfo callback succeed!");
     return DP_SUCCESS;
 }
+
+int32_t DistributedDeviceProfileClient::EnableProfileCache(int32_t saId, size_t capacity, int64_t maxAgeMs)
+{
+    HILOGI("enter, saId:%{public}d", saId);
+    return ProfileClientCache::GetInstance().Enable(saId, capacity, maxAgeMs);
+}
+
+void DistributedDeviceProfileClient::DisableProfileCache()
+{
+    if (!ProfileClientCache::GetInstance().IsEnabled()) {
+        return;
+    }
+    sptr<IDistributedDeviceProfile> dpService = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(serviceLock_);
+        dpService = dpProxy_;
+    }
+    ProfileClientCache::GetInstance().Disable(dpService);
+}
+
+ProfileClientCacheStats DistributedDeviceProfileClient::GetProfileCacheStats()
+{
+    return ProfileClientCache::GetInstance().GetStats();
+}
+
+int32_t DistributedDeviceProfileClient::GetAllAccessControlProfileAsync(
+    DpAsyncCallback<std::vector<AccessControlProfile>> callback, uint64_t& requestId, int64_t timeoutMs)
+{
+    std::function<int32_t(std::vector<AccessControlProfile>&)> call =
+        [this](std::vector<AccessControlProfile>& accessControlProfiles) {
+            return GetAllAccessControlProfile(accessControlProfiles);
+        };
+    return SubmitAsyncRequest(call, callback, timeoutMs, requestId);
+}
+
+int32_t DistributedDeviceProfileClient::GetDeviceProfilesAsync(const DeviceProfileFilterOptions& options,
+    DpAsyncCallback<std::vector<DeviceProfile>> callback, uint64_t& requestId, int64_t timeoutMs)
+{
+    std::function<int32_t(std::vector<DeviceProfile>&)> call =
+        [this, options](std::vector<DeviceProfile>& deviceProfiles) mutable {
+            return GetDeviceProfiles(options, deviceProfiles);
+        };
+    return SubmitAsyncRequest(call, callback, timeoutMs, requestId);
+}
+
+int32_t DistributedDeviceProfileClient::PutDeviceProfileBatchAsync(const std::vector<DeviceProfile>& deviceProfiles,
+    DpAsyncResultCallback callback, uint64_t& requestId, int64_t timeoutMs)
+{
+    auto call = [this, deviceProfiles]() mutable { return PutDeviceProfileBatch(deviceProfiles); };
+    return SubmitAsyncRequest(call, callback, timeoutMs, requestId);
+}
+
+int32_t DistributedDeviceProfileClient::PutServiceProfileBatchAsync(const std::vector<ServiceProfile>& serviceProfiles,
+    DpAsyncResultCallback callback, uint64_t& requestId, int64_t timeoutMs)
+{
+    auto call = [this, serviceProfiles]() { return PutServiceProfileBatch(serviceProfiles); };
+    return SubmitAsyncRequest(call, callback, timeoutMs, requestId);
+}
+
+int32_t DistributedDeviceProfileClient::PutCharacteristicProfileBatchAsync(
+    const std::vector<CharacteristicProfile>& characteristicProfiles, DpAsyncResultCallback callback,
+    uint64_t& requestId, int64_t timeoutMs)
+{
+    auto call = [this, characteristicProfiles]() { return PutCharacteristicProfileBatch(characteristicProfiles); };
+    return SubmitAsyncRequest(call, callback, timeoutMs, requestId);
+}
+
+int32_t DistributedDeviceProfileClient::SyncDeviceProfileAsync(const DpSyncOptions& syncOptions,
+    sptr<ISyncCompletedCallback> syncCb, DpAsyncResultCallback callback, uint64_t& requestId, int64_t timeoutMs)
+{
+    if (syncCb == nullptr) {
+        HILOGE("SyncCb is nullptr!");
+        return DP_SYNC_DEVICE_FAIL;
+    }
+    auto call = [this, syncOptions, syncCb]() { return SyncDeviceProfile(syncOptions, syncCb); };
+    return SubmitAsyncRequest(call, callback, timeoutMs, requestId);
+}
+
+int32_t DistributedDeviceProfileClient::SyncStaticProfileAsync(const DpSyncOptions& syncOptions,
+    sptr<ISyncCompletedCallback> syncCb, DpAsyncResultCallback callback, uint64_t& requestId, int64_t timeoutMs)
+{
+    if (syncCb == nullptr) {
+        HILOGE("SyncCb is nullptr!");
+        return DP_SYNC_DEVICE_FAIL;
+    }
+    auto call = [this, syncOptions, syncCb]() { return SyncStaticProfile(syncOptions, syncCb); };
+    return SubmitAsyncRequest(call, callback, timeoutMs, requestId);
+}
+
+int32_t DistributedDeviceProfileClient::CancelAsyncRequest(uint64_t requestId)
+{
+    std::shared_ptr<ClientAsyncExecutor> asyncExecutor = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(asyncLock_);
+        asyncExecutor = asyncExecutor_;
+    }
+    if (asyncExecutor == nullptr) {
+        HILOGE("no async request pending");
+        return DP_NOT_FOUND_FAIL;
+    }
+    return asyncExecutor->Cancel(requestId);
+}
+
+std::shared_ptr<ClientAsyncExecutor> DistributedDeviceProfileClient::GetAsyncExecutor()
+{
+    std::lock_guard<std::mutex> lock(asyncLock_);
+    if (asyncExecutor_ == nullptr) {
+        asyncExecutor_ = std::make_shared<ClientAsyncExecutor>(ASYNC_EXECUTOR_NAME);
+    }
+    return asyncExecutor_;
+}
+
+template <typename T>
+int32_t DistributedDeviceProfileClient::SubmitAsyncRequest(std::function<int32_t(T&)> call,
+    DpAsyncCallback<T> callback, int64_t timeoutMs, uint64_t& requestId)
+{
+    if (call == nullptr || callback == nullptr) {
+        HILOGE("callback is nullptr!");
+        return DP_INVALID_PARAMS;
+    }
+    // the result is only read when the work itself completes the request, never after a timeout
+    auto result = std::make_shared<T>();
+    auto work = [call, result]() { return call(*result); };
+    auto complete = [callback, result](int32_t errCode) {
+        if (errCode == DP_ASYNC_REQUEST_TIMEOUT || errCode == DP_ASYNC_REQUEST_CANCELED) {
+            callback(errCode, T());
+            return;
+        }
+        callback(errCode, *result);
+    };
+    return GetAsyncExecutor()->Submit(work, complete, timeoutMs, requestId);
+}
+
+int32_t DistributedDeviceProfileClient::SubmitAsyncRequest(std::function<int32_t()> call,
+    DpAsyncResultCallback callback, int64_t timeoutMs, uint64_t& requestId)
+{
+    if (call == nullptr || callback == nullptr) {
+        HILOGE("callback is nullptr!");
+        return DP_INVALID_PARAMS;
+    }
+    return GetAsyncExecutor()->Submit(call, callback, timeoutMs, requestId);
+}
 } // namespace DeviceProfile
 } // namespace OHOS
@@ -63,6 +63,14 @@ int32_t DistributedDeviceProfileClient::GetAccessControlProfile(
     return DP_NOT_SUPPORT;
 }
 
+int32_t DistributedDeviceProfileClient::GetAccessControlProfileBatch(
+    const std::vector<std::map<std::string, std::string>>& paramsList,
+    std::vector<std::vector<AccessControlProfile>>& aclProfilesList, std::vector<int32_t>& results)
+{
+    HILOGI("%{public}s no-build, ret=%{public}d", __func__, DP_NOT_SUPPORT);
+    return DP_NOT_SUPPORT;
+}
+
 int32_t DistributedDeviceProfileClient::GetAllAccessControlProfile(
     std::vector<AccessControlProfile>& accessControlProfiles)
 {
@@ -185,6 +193,14 @@ int32_t DistributedDeviceProfileClient::GetCharacteristicProfile(const std::stri
     return DP_NOT_SUPPORT;
 }
 
+int32_t DistributedDeviceProfileClient::GetCharacteristicProfileBatch(
+    const std::vector<CharacteristicProfile>& queries, std::vector<CharacteristicProfile>& characteristicProfiles,
+    std::vector<int32_t>& results)
+{
+    HILOGI("%{public}s no-build, ret=%{public}d", __func__, DP_NOT_SUPPORT);
+    return DP_NOT_SUPPORT;
+}
+
 int32_t DistributedDeviceProfileClient::DeleteServiceProfile(
     const std::string& deviceId, const std::string& serviceName, bool isMultiUser, int32_t userId)
 {
@@ -397,7 +413,6 @@ void DistributedDeviceProfileClient::LoadSystemAbilitySuccess(const sptr<IRemote
     std::lock_guard<std::mutex> lock(serviceLock_);
     dpProxy_ = nullptr;
     dpDeathRecipient_ = nullptr;
-    proxyConVar_.notify_all();
     HILOGI("%{public}s no-build", __func__);
 }
 
@@ -405,7 +420,6 @@ void DistributedDeviceProfileClient::LoadSystemAbilityFail()
 {
     std::lock_guard<std::mutex> lock(serviceLock_);
     dpProxy_ = nullptr;
-    proxyConVar_.notify_all();
     HILOGI("%{public}s no-build", __func__);
 }
 
@@ -417,7 +431,7 @@ void DistributedDeviceProfileClient::ReleaseResource()
     ReleaseDeathRecipient();
     ReleaseRegisterBusinessCallback();
     ReSubscribeAllServiceInfo();
-    (void)loadSystemAbilityFinish_;
+    (void)serviceAvailability_.GetState();
     (void)retryErrCodes_.size();
     HILOGI("%{public}s no-build", __func__);
 }
@@ -469,7 +483,6 @@ void DistributedDeviceProfileClient::OnServiceDied(const sptr<IRemoteObject>& re
     std::lock_guard<std::mutex> lock(serviceLock_);
     dpProxy_ = nullptr;
     dpDeathRecipient_ = nullptr;
-    proxyConVar_.notify_all();
     HILOGI("%{public}s no-build", __func__);
 }
 
@@ -536,7 +549,6 @@ void DistributedDeviceProfileClient::ReleaseDeathRecipient()
     std::lock_guard<std::mutex> lock(serviceLock_);
     dpDeathRecipient_ = nullptr;
     dpProxy_ = nullptr;
-    proxyConVar_.notify_all();
     HILOGI("%{public}s no-build", __func__);
 }
 
@@ -575,6 +587,109 @@ void DistributedDeviceProfileClient::StartThreadReRegisterBusinessCallback()
     HILOGI("%{public}s no-build", __func__);
 }
 
+int32_t DistributedDeviceProfileClient::EnableProfileCache(int32_t saId, size_t capacity, int64_t maxAgeMs)
+{
+    HILOGI("%{public}s no-build, ret=%{public}d", __func__, DP_NOT_SUPPORT);
+    return DP_NOT_SUPPORT;
+}
+
+void DistributedDeviceProfileClient::DisableProfileCache()
+{
+    HILOGI("%{public}s no-build", __func__);
+}
+
+ProfileClientCacheStats DistributedDeviceProfileClient::GetProfileCacheStats()
+{
+    HILOGI("%{public}s no-build", __func__);
+    return ProfileClientCacheStats();
+}
+
+int32_t DistributedDeviceProfileClient::GetAllAccessControlProfileAsync(
+    DpAsyncCallback<std::vector<AccessControlProfile>> callback, uint64_t& requestId, int64_t timeoutMs)
+{
+    (void)callback;
+    (void)requestId;
+    (void)timeoutMs;
+    HILOGI("%{public}s no-build, ret=%{public}d", __func__, DP_NOT_SUPPORT);
+    return DP_NOT_SUPPORT;
+}
+
+int32_t DistributedDeviceProfileClient::GetDeviceProfilesAsync(const DeviceProfileFilterOptions& options,
+    DpAsyncCallback<std::vector<DeviceProfile>> callback, uint64_t& requestId, int64_t timeoutMs)
+{
+    (void)options;
+    (void)callback;
+    (void)requestId;
+    (void)timeoutMs;
+    HILOGI("%{public}s no-build, ret=%{public}d", __func__, DP_NOT_SUPPORT);
+    return DP_NOT_SUPPORT;
+}
+
+int32_t DistributedDeviceProfileClient::PutDeviceProfileBatchAsync(const std::vector<DeviceProfile>& deviceProfiles,
+    DpAsyncResultCallback callback, uint64_t& requestId, int64_t timeoutMs)
+{
+    (void)deviceProfiles;
+    (void)callback;
+    (void)requestId;
+    (void)timeoutMs;
+    HILOGI("%{public}s no-build, ret=%{public}d", __func__, DP_NOT_SUPPORT);
+    return DP_NOT_SUPPORT;
+}
+
+int32_t DistributedDeviceProfileClient::PutServiceProfileBatchAsync(const std::vector<ServiceProfile>& serviceProfiles,
+    DpAsyncResultCallback callback, uint64_t& requestId, int64_t timeoutMs)
+{
+    (void)serviceProfiles;
+    (void)callback;
+    (void)requestId;
+    (void)timeoutMs;
+    HILOGI("%{public}s no-build, ret=%{public}d", __func__, DP_NOT_SUPPORT);
+    return DP_NOT_SUPPORT;
+}
+
+int32_t DistributedDeviceProfileClient::PutCharacteristicProfileBatchAsync(
+    const std::vector<CharacteristicProfile>& characteristicProfiles, DpAsyncResultCallback callback,
+    uint64_t& requestId, int64_t timeoutMs)
+{
+    (void)characteristicProfiles;
+    (void)callback;
+    (void)requestId;
+    (void)timeoutMs;
+    HILOGI("%{public}s no-build, ret=%{public}d", __func__, DP_NOT_SUPPORT);
+    return DP_NOT_SUPPORT;
+}
+
+int32_t DistributedDeviceProfileClient::SyncDeviceProfileAsync(const DpSyncOptions& syncOptions,
+    sptr<ISyncCompletedCallback> syncCb, DpAsyncResultCallback callback, uint64_t& requestId, int64_t timeoutMs)
+{
+    (void)syncOptions;
+    (void)syncCb;
+    (void)callback;
+    (void)requestId;
+    (void)timeoutMs;
+    HILOGI("%{public}s no-build, ret=%{public}d", __func__, DP_NOT_SUPPORT);
+    return DP_NOT_SUPPORT;
+}
+
+int32_t DistributedDeviceProfileClient::SyncStaticProfileAsync(const DpSyncOptions& syncOptions,
+    sptr<ISyncCompletedCallback> syncCb, DpAsyncResultCallback callback, uint64_t& requestId, int64_t timeoutMs)
+{
+    (void)syncOptions;
+    (void)syncCb;
+    (void)callback;
+    (void)requestId;
+    (void)timeoutMs;
+    HILOGI("%{public}s no-build, ret=%{public}d", __func__, DP_NOT_SUPPORT);
+    return DP_NOT_SUPPORT;
+}
+
+int32_t DistributedDeviceProfileClient::CancelAsyncRequest(uint64_t requestId)
+{
+    (void)requestId;
+    HILOGI("%{public}s no-build, ret=%{public}d", __func__, DP_NOT_SUPPORT);
+    return DP_NOT_SUPPORT;
+}
+
 void DistributedDeviceProfileClient::DeviceProfileDeathRecipient::OnRemoteDied(
     const wptr<IRemoteObject>& remote)
 {
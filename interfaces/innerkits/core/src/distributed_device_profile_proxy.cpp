@@ -155,6 +155,28 @@ int32_t DistributedDeviceProfileProxy::GetAccessControlProfile(std::map<std::str
     return DP_SUCCESS;
 }
 
+int32_t DistributedDeviceProfileProxy::GetAccessControlProfileBatch(
+    const std::vector<std::map<std::string, std::string>>& queryParamsList,
+    std::vector<std::vector<AccessControlProfile>>& aclProfilesList, std::vector<int32_t>& results)
+{
+    sptr<IRemoteObject> remote = nullptr;
+    GET_REMOTE_OBJECT(remote);
+    MessageParcel data;
+    WRITE_INTERFACE_TOKEN(data);
+    if (!IpcUtils::Marshalling(data, queryParamsList)) {
+        HILOGE("dp ipc write parcel fail");
+        return DP_WRITE_PARCEL_FAIL;
+    }
+    MessageParcel reply;
+    SEND_REQUEST(remote, static_cast<uint32_t>(DpIpcInterfaceCode::GET_ACL_PROFILE_BATCH), data, reply);
+    if (!IpcUtils::UnMarshalling(reply, results) || !IpcUtils::UnMarshalling(reply, aclProfilesList) ||
+        results.size() != queryParamsList.size() || aclProfilesList.size() != queryParamsList.size()) {
+        HILOGE("dp ipc read parcel fail");
+        return DP_READ_PARCEL_FAIL;
+    }
+    return DP_SUCCESS;
+}
+
 int32_t DistributedDeviceProfileProxy::GetAllAccessControlProfile(
     std::vector<AccessControlProfile>& accessControlProfiles)
 {
@@ -451,6 +473,28 @@ int32_t DistributedDeviceProfileProxy::GetCharacteristicProfile(const std::strin
     return DP_SUCCESS;
 }
 
+int32_t DistributedDeviceProfileProxy::GetCharacteristicProfileBatch(
+    const std::vector<CharacteristicProfile>& queries, std::vector<CharacteristicProfile>& charProfiles,
+    std::vector<int32_t>& results)
+{
+    sptr<IRemoteObject> remote = nullptr;
+    GET_REMOTE_OBJECT(remote);
+    MessageParcel data;
+    WRITE_INTERFACE_TOKEN(data);
+    if (!IpcUtils::Marshalling(data, queries)) {
+        HILOGE("dp ipc write parcel fail");
+        return DP_WRITE_PARCEL_FAIL;
+    }
+    MessageParcel reply;
+    SEND_REQUEST(remote, static_cast<uint32_t>(DpIpcInterfaceCode::GET_CHAR_PROFILE_BATCH), data, reply);
+    if (!IpcUtils::UnMarshalling(reply, results) || !IpcUtils::UnMarshalling(reply, charProfiles) ||
+        results.size() != queries.size() || charProfiles.size() != queries.size()) {
+        HILOGE("dp ipc read parcel fail");
+        return DP_READ_PARCEL_FAIL;
+    }
+    return DP_SUCCESS;
+}
+
 int32_t DistributedDeviceProfileProxy::DeleteServiceProfile(const std::string& deviceId,
     const std::string& serviceName, bool isMultiUser, int32_t userId)
 {
@@ -0,0 +1,852 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "profile_client_cache.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "common_event_manager.h"
+#include "common_event_subscriber.h"
+#include "common_event_support.h"
+#include "matching_skills.h"
+#include "datetime_ex.h"
+
+#include "distributed_device_profile_constants.h"
+#include "distributed_device_profile_errors.h"
+#include "distributed_device_profile_log.h"
+#include "dp_subscribe_info.h"
+#include "profile_utils.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+IMPLEMENT_SINGLE_INSTANCE(ProfileClientCache);
+
+namespace {
+    const std::string TAG = "ProfileClientCache";
+    const std::string ACL_PREFIX = "acl";
+    // Every cached acl query is invalidated together, they share this key for version checks and subscription.
+    const std::string ACL_CACHE_TAG = "acl#all";
+    constexpr size_t MAX_CLIENT_CACHE_SIZE = 32;
+    constexpr size_t MAX_CHANGED_VERSION_SIZE = 256;
+
+    std::string GenerateSubscribeTag(const std::string& subscribeKey, int32_t saId)
+    {
+        return subscribeKey + SEPARATOR + std::to_string(saId);
+    }
+
+    class UserSwitchSubscriber : public EventFwk::CommonEventSubscriber {
+    public:
+        explicit UserSwitchSubscriber(const EventFwk::CommonEventSubscribeInfo& subscribeInfo)
+            : EventFwk::CommonEventSubscriber(subscribeInfo) {}
+        ~UserSwitchSubscriber() override = default;
+        void OnReceiveEvent(const EventFwk::CommonEventData& data) override
+        {
+            if (data.GetWant().GetAction() != EventFwk::CommonEventSupport::COMMON_EVENT_USER_SWITCHED) {
+                return;
+            }
+            HILOGI("user switched, userId:%{public}d", data.GetCode());
+            ProfileClientCache::GetInstance().InvalidateAccessControlProfile();
+        }
+    };
+}
+
+int32_t ProfileClientCache::Enable(int32_t saId, size_t capacity, int64_t maxAgeMs)
+{
+    if (saId <= 0 || saId > MAX_SAID || capacity == 0 || capacity > MAX_CLIENT_CACHE_SIZE || maxAgeMs <= 0) {
+        HILOGE("Params is invalid! saId:%{public}d, capacity:%{public}zu", saId, capacity);
+        return DP_INVALID_PARAMS;
+    }
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (enabled_ && saId_ != saId) {
+        HILOGE("already enabled by saId:%{public}d", saId_);
+        return DP_INVALID_PARAMS;
+    }
+    if (listener_ == nullptr) {
+        listener_ = sptr<CacheChangeListener>(new CacheChangeListener());
+    }
+    enabled_ = true;
+    saId_ = saId;
+    capacity_ = capacity;
+    maxAgeMs_ = maxAgeMs;
+    while (lruList_.size() > capacity_) {
+        std::vector<std::string> evictedKeys;
+        EvictLruLocked(evictedKeys);
+    }
+    HILOGI("saId:%{public}d, capacity:%{public}zu, maxAgeMs:%{public}" PRId64, saId, capacity, maxAgeMs);
+    SubscribeUserSwitch();
+    return DP_SUCCESS;
+}
+
+void ProfileClientCache::Disable(const sptr<IDistributedDeviceProfile>& dpService)
+{
+    std::vector<std::string> subscribeKeys;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (!enabled_) {
+            return;
+        }
+        for (const auto& item : subscribedKeys_) {
+            subscribeKeys.insert(subscribeKeys.end(), item.second.begin(), item.second.end());
+        }
+        enabled_ = false;
+    }
+    ReleaseSubscribes(dpService, subscribeKeys);
+    UnSubscribeUserSwitch();
+    Reset();
+    HILOGI("disabled, released %{public}zu subscribes", subscribeKeys.size());
+}
+
+bool ProfileClientCache::IsEnabled()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    return enabled_;
+}
+
+void ProfileClientCache::Reset()
+{
+    std::lock_guard<std::mutex> subscribeLock(subscribeMutex_);
+    // the app's subscriptions are sent again by the client, with their own listeners
+    heldChangeTypes_.clear();
+    sharedListeners_.clear();
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    lruList_.clear();
+    deviceProfileMap_.clear();
+    serviceProfileMap_.clear();
+    charProfileMap_.clear();
+    aclProfileMap_.clear();
+    subscribedKeys_.clear();
+    changedVersions_.clear();
+    version_++;
+    changedFloorVersion_ = version_;
+    stats_.entryCount = 0;
+}
+
+uint64_t ProfileClientCache::GetVersion()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    return version_;
+}
+
+int32_t ProfileClientCache::GetDeviceProfile(const std::string& deviceId, DeviceProfile& deviceProfile)
+{
+    return GetItem(deviceProfileMap_, ProfileUtils::GenerateDeviceProfileKey(deviceId), deviceProfile);
+}
+
+int32_t ProfileClientCache::GetServiceProfile(const std::string& deviceId, const std::string& serviceName,
+    ServiceProfile& serviceProfile)
+{
+    return GetItem(serviceProfileMap_, ProfileUtils::GenerateServiceProfileKey(deviceId, serviceName),
+        serviceProfile);
+}
+
+int32_t ProfileClientCache::GetCharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
+    const std::string& charKey, CharacteristicProfile& charProfile)
+{
+    return GetItem(charProfileMap_, ProfileUtils::GenerateCharProfileKey(deviceId, serviceName, charKey),
+        charProfile);
+}
+
+int32_t ProfileClientCache::GetAccessControlProfile(const std::map<std::string, std::string>& params,
+    std::vector<AccessControlProfile>& aclProfiles)
+{
+    return GetItem(aclProfileMap_, GenerateAclCacheKey(params), aclProfiles);
+}
+
+bool ProfileClientCache::PrepareDeviceProfile(const sptr<IDistributedDeviceProfile>& dpService,
+    const std::string& deviceId)
+{
+    std::string profileKey = ProfileUtils::GenerateDeviceProfileKey(deviceId);
+    // the service folds the _oh keys onto these when notifying, and a read without a userId never sees the
+    // userId suffixed keys, multi-user profiles are not cached at all
+    std::vector<std::string> subscribeKeys = {
+        ProfileUtils::GenerateDBKey(profileKey, OS_SYS_CAPACITY),
+        ProfileUtils::GenerateDBKey(profileKey, OS_VERSION),
+        ProfileUtils::GenerateDBKey(profileKey, OS_TYPE)
+    };
+    return Prepare(dpService, profileKey, subscribeKeys, { ProfileChangeType::DEVICE_PROFILE_ADD,
+        ProfileChangeType::DEVICE_PROFILE_UPDATE, ProfileChangeType::DEVICE_PROFILE_DELETE });
+}
+
+bool ProfileClientCache::PrepareServiceProfile(const sptr<IDistributedDeviceProfile>& dpService,
+    const std::string& deviceId, const std::string& serviceName)
+{
+    std::string profileKey = ProfileUtils::GenerateServiceProfileKey(deviceId, serviceName);
+    std::vector<std::string> subscribeKeys = { ProfileUtils::GenerateDBKey(profileKey, SERVICE_TYPE) };
+    return Prepare(dpService, profileKey, subscribeKeys, { ProfileChangeType::SERVICE_PROFILE_ADD,
+        ProfileChangeType::SERVICE_PROFILE_UPDATE, ProfileChangeType::SERVICE_PROFILE_DELETE });
+}
+
+bool ProfileClientCache::PrepareCharacteristicProfile(const sptr<IDistributedDeviceProfile>& dpService,
+    const std::string& deviceId, const std::string& serviceName, const std::string& charKey)
+{
+    std::string profileKey = ProfileUtils::GenerateCharProfileKey(deviceId, serviceName, charKey);
+    std::vector<std::string> subscribeKeys = { ProfileUtils::GenerateDBKey(profileKey, CHARACTERISTIC_VALUE) };
+    return Prepare(dpService, profileKey, subscribeKeys, { ProfileChangeType::CHAR_PROFILE_ADD,
+        ProfileChangeType::CHAR_PROFILE_UPDATE, ProfileChangeType::CHAR_PROFILE_DELETE });
+}
+
+bool ProfileClientCache::PrepareAccessControlProfile(const sptr<IDistributedDeviceProfile>& dpService)
+{
+    {
+        std::lock_guard<std::mutex> lock(subscribeMutex_);
+        if (!userSwitchSubscribed_) {
+            HILOGD("user switch is not observed, read through");
+            return false;
+        }
+    }
+    std::vector<std::string> subscribeKeys = { SUBSCRIBE_TRUST_DEVICE_PROFILE };
+    return Prepare(dpService, ACL_CACHE_TAG, subscribeKeys, { ProfileChangeType::TRUST_DEVICE_PROFILE_ADD,
+        ProfileChangeType::TRUST_DEVICE_PROFILE_UPDATE, ProfileChangeType::TRUST_DEVICE_PROFILE_DELETE,
+        ProfileChangeType::TRUST_DEVICE_PROFILE_ACTIVE, ProfileChangeType::TRUST_DEVICE_PROFILE_INACTIVE,
+        ProfileChangeType::DEVICE_ACL_INACTIVE_BY_DELETE, ProfileChangeType::DEVICE_ACL_INACTIVE_BY_UPDATE,
+        ProfileChangeType::ACCOUNT_ACL_DELETE, ProfileChangeType::ACCOUNT_ACL_INACTIVE,
+        ProfileChangeType::ACCOUNT_ACL_ADD, ProfileChangeType::ACCOUNT_ACL_ACTIVE });
+}
+
+void ProfileClientCache::PutDeviceProfile(const sptr<IDistributedDeviceProfile>& dpService, uint64_t version,
+    const std::string& deviceId, const DeviceProfile& deviceProfile)
+{
+    std::vector<std::string> evictedKeys;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        PutItem(deviceProfileMap_, ProfileUtils::GenerateDeviceProfileKey(deviceId), version, deviceProfile,
+            evictedKeys);
+    }
+    ReleaseSubscribes(dpService, evictedKeys);
+}
+
+void ProfileClientCache::PutServiceProfile(const sptr<IDistributedDeviceProfile>& dpService, uint64_t version,
+    const std::string& deviceId, const std::string& serviceName, const ServiceProfile& serviceProfile)
+{
+    std::vector<std::string> evictedKeys;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        PutItem(serviceProfileMap_, ProfileUtils::GenerateServiceProfileKey(deviceId, serviceName), version,
+            serviceProfile, evictedKeys);
+    }
+    ReleaseSubscribes(dpService, evictedKeys);
+}
+
+void ProfileClientCache::PutCharacteristicProfile(const sptr<IDistributedDeviceProfile>& dpService,
+    uint64_t version, const std::string& deviceId, const std::string& serviceName, const std::string& charKey,
+    const CharacteristicProfile& charProfile)
+{
+    if (charProfile.IsMultiUser()) {
+        HILOGD("multi-user profile, skip caching");
+        return;
+    }
+    std::vector<std::string> evictedKeys;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        PutItem(charProfileMap_, ProfileUtils::GenerateCharProfileKey(deviceId, serviceName, charKey), version,
+            charProfile, evictedKeys);
+    }
+    ReleaseSubscribes(dpService, evictedKeys);
+}
+
+void ProfileClientCache::PutAccessControlProfile(const sptr<IDistributedDeviceProfile>& dpService,
+    uint64_t version, const std::map<std::string, std::string>& params,
+    const std::vector<AccessControlProfile>& aclProfiles)
+{
+    std::vector<std::string> evictedKeys;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        auto iter = changedVersions_.find(ACL_CACHE_TAG);
+        if (iter != changedVersions_.end() && iter->second > version) {
+            stats_.staleFillCount++;
+            return;
+        }
+        PutItem(aclProfileMap_, GenerateAclCacheKey(params), version, aclProfiles, evictedKeys);
+    }
+    ReleaseSubscribes(dpService, evictedKeys);
+}
+
+void ProfileClientCache::InvalidateDeviceProfile(const std::string& deviceId)
+{
+    Invalidate(ProfileUtils::GenerateDeviceProfileKey(deviceId));
+}
+
+void ProfileClientCache::InvalidateServiceProfile(const std::string& deviceId, const std::string& serviceName)
+{
+    Invalidate(ProfileUtils::GenerateServiceProfileKey(deviceId, serviceName));
+}
+
+void ProfileClientCache::InvalidateCharacteristicProfile(const std::string& deviceId,
+    const std::string& serviceName, const std::string& charKey)
+{
+    Invalidate(ProfileUtils::GenerateCharProfileKey(deviceId, serviceName, charKey));
+}
+
+void ProfileClientCache::InvalidateAccessControlProfile()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    MarkChangedLocked(ACL_CACHE_TAG);
+    for (auto iter = aclProfileMap_.begin(); iter != aclProfileMap_.end();) {
+        lruList_.erase(iter->second.lruIter);
+        iter = aclProfileMap_.erase(iter);
+        stats_.invalidateCount++;
+    }
+    stats_.entryCount = lruList_.size();
+}
+
+int32_t ProfileClientCache::SubscribeForApp(const sptr<IDistributedDeviceProfile>& dpService,
+    const SubscribeInfo& subscribeInfo)
+{
+    if (dpService == nullptr) {
+        return DP_GET_SERVICE_FAILED;
+    }
+    std::lock_guard<std::mutex> subscribeLock(subscribeMutex_);
+    const std::string subscribeKey = subscribeInfo.GetSubscribeKey();
+    appSubscribes_[GenerateSubscribeTag(subscribeKey, subscribeInfo.GetSaId())] = subscribeInfo;
+    auto heldIter = heldChangeTypes_.find(subscribeKey);
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (heldIter == heldChangeTypes_.end() || subscribeInfo.GetSaId() != saId_) {
+            return dpService->SubscribeDeviceProfile(subscribeInfo);
+        }
+    }
+    return dpService->SubscribeDeviceProfile(MakeCacheSubscribeLocked(subscribeInfo.GetSaId(), subscribeKey,
+        heldIter->second));
+}
+
+int32_t ProfileClientCache::UnSubscribeForApp(const sptr<IDistributedDeviceProfile>& dpService,
+    const SubscribeInfo& subscribeInfo)
+{
+    if (dpService == nullptr) {
+        return DP_GET_SERVICE_FAILED;
+    }
+    std::lock_guard<std::mutex> subscribeLock(subscribeMutex_);
+    const std::string subscribeKey = subscribeInfo.GetSubscribeKey();
+    appSubscribes_.erase(GenerateSubscribeTag(subscribeKey, subscribeInfo.GetSaId()));
+    auto heldIter = heldChangeTypes_.find(subscribeKey);
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (heldIter == heldChangeTypes_.end() || subscribeInfo.GetSaId() != saId_) {
+            return dpService->UnSubscribeDeviceProfile(subscribeInfo);
+        }
+    }
+    // the cache still needs the key, narrow it back to the cache's own listener
+    return dpService->SubscribeDeviceProfile(MakeCacheSubscribeLocked(subscribeInfo.GetSaId(), subscribeKey,
+        heldIter->second));
+}
+
+ProfileClientCacheStats ProfileClientCache::GetStats()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    return stats_;
+}
+
+void ProfileClientCache::ResetStats()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    stats_ = ProfileClientCacheStats();
+    stats_.entryCount = lruList_.size();
+}
+
+template <typename T>
+int32_t ProfileClientCache::GetItem(std::unordered_map<std::string, CacheItem<T>>& items,
+    const std::string& cacheKey, T& value)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (!enabled_) {
+        return DP_NOT_FOUND_FAIL;
+    }
+    auto iter = items.find(cacheKey);
+    if (iter == items.end()) {
+        stats_.missCount++;
+        return DP_NOT_FOUND_FAIL;
+    }
+    int64_t ageMs = GetTickCount() - iter->second.cachedTimeMs;
+    if (ageMs > maxAgeMs_) {
+        EraseLocked(cacheKey);
+        stats_.expiredCount++;
+        stats_.missCount++;
+        return DP_NOT_FOUND_FAIL;
+    }
+    lruList_.splice(lruList_.begin(), lruList_, iter->second.lruIter);
+    value = iter->second.value;
+    stats_.hitCount++;
+    stats_.maxServedAgeMs = std::max(stats_.maxServedAgeMs, ageMs);
+    return DP_SUCCESS;
+}
+
+template <typename T>
+void ProfileClientCache::PutItem(std::unordered_map<std::string, CacheItem<T>>& items,
+    const std::string& cacheKey, uint64_t version, const T& value, std::vector<std::string>& evictedKeys)
+{
+    if (!enabled_) {
+        return;
+    }
+    if (version < changedFloorVersion_) {
+        stats_.staleFillCount++;
+        return;
+    }
+    auto changedIter = changedVersions_.find(cacheKey);
+    if (changedIter != changedVersions_.end() && changedIter->second > version) {
+        HILOGD("a change was notified while reading, drop the fill");
+        stats_.staleFillCount++;
+        return;
+    }
+    std::string subscribeTag = (cacheKey.compare(0, ACL_PREFIX.size(), ACL_PREFIX) == 0) ? ACL_CACHE_TAG : cacheKey;
+    if (subscribedKeys_.find(subscribeTag) == subscribedKeys_.end()) {
+        HILOGD("not subscribed, skip caching");
+        return;
+    }
+    auto iter = items.find(cacheKey);
+    if (iter != items.end()) {
+        iter->second.value = value;
+        iter->second.cachedTimeMs = GetTickCount();
+        lruList_.splice(lruList_.begin(), lruList_, iter->second.lruIter);
+        return;
+    }
+    while (lruList_.size() >= capacity_) {
+        EvictLruLocked(evictedKeys);
+    }
+    lruList_.push_front(cacheKey);
+    CacheItem<T> item;
+    item.value = value;
+    item.cachedTimeMs = GetTickCount();
+    item.lruIter = lruList_.begin();
+    items[cacheKey] = item;
+    stats_.entryCount = lruList_.size();
+}
+
+template <typename T>
+bool ProfileClientCache::EraseItem(std::unordered_map<std::string, CacheItem<T>>& items,
+    const std::string& cacheKey)
+{
+    auto iter = items.find(cacheKey);
+    if (iter == items.end()) {
+        return false;
+    }
+    lruList_.erase(iter->second.lruIter);
+    items.erase(iter);
+    stats_.entryCount = lruList_.size();
+    return true;
+}
+
+bool ProfileClientCache::Prepare(const sptr<IDistributedDeviceProfile>& dpService, const std::string& cacheKey,
+    const std::vector<std::string>& subscribeKeys, const std::unordered_set<ProfileChangeType>& changeTypes)
+{
+    int32_t saId = 0;
+    std::vector<std::string> releasedKeys;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (!enabled_ || dpService == nullptr) {
+            return false;
+        }
+        if (subscribedKeys_.find(cacheKey) != subscribedKeys_.end()) {
+            return true;
+        }
+        // one slot per cached entry plus the shared acl subscription
+        if (subscribedKeys_.size() > capacity_) {
+            ReclaimOrphanSubscribeLocked(releasedKeys);
+        }
+        if (subscribedKeys_.size() > capacity_) {
+            HILOGW("subscribe slots are used up, read through");
+            return false;
+        }
+        saId = saId_;
+    }
+    ReleaseSubscribes(dpService, releasedKeys);
+    std::vector<std::string> doneKeys;
+    {
+        std::lock_guard<std::mutex> subscribeLock(subscribeMutex_);
+        for (const auto& subscribeKey : subscribeKeys) {
+            int32_t ret = dpService->SubscribeDeviceProfile(MakeCacheSubscribeLocked(saId, subscribeKey,
+                changeTypes));
+            if (ret != DP_SUCCESS) {
+                HILOGE("subscribe failed, ret:%{public}d, key:%{public}s", ret,
+                    ProfileUtils::GetDbKeyAnonyString(subscribeKey).c_str());
+                sharedListeners_.erase(subscribeKey);
+                break;
+            }
+            heldChangeTypes_[subscribeKey] = changeTypes;
+            doneKeys.emplace_back(subscribeKey);
+        }
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (enabled_ && saId_ == saId && doneKeys.size() == subscribeKeys.size()) {
+            subscribedKeys_[cacheKey] = subscribeKeys;
+            return true;
+        }
+    }
+    ReleaseSubscribes(dpService, doneKeys);
+    return false;
+}
+
+void ProfileClientCache::EvictLruLocked(std::vector<std::string>& evictedKeys)
+{
+    if (lruList_.empty()) {
+        return;
+    }
+    std::string cacheKey = lruList_.back();
+    EraseLocked(cacheKey);
+    stats_.evictCount++;
+    auto iter = subscribedKeys_.find(cacheKey);
+    if (iter != subscribedKeys_.end()) {
+        evictedKeys.insert(evictedKeys.end(), iter->second.begin(), iter->second.end());
+        subscribedKeys_.erase(iter);
+    }
+}
+
+void ProfileClientCache::EraseLocked(const std::string& cacheKey)
+{
+    bool erased = EraseItem(deviceProfileMap_, cacheKey) || EraseItem(serviceProfileMap_, cacheKey) ||
+        EraseItem(charProfileMap_, cacheKey) || EraseItem(aclProfileMap_, cacheKey);
+    HILOGD("erased:%{public}d", erased);
+}
+
+bool ProfileClientCache::HasItemLocked(const std::string& cacheKey)
+{
+    return deviceProfileMap_.count(cacheKey) != 0 || serviceProfileMap_.count(cacheKey) != 0 ||
+        charProfileMap_.count(cacheKey) != 0;
+}
+
+void ProfileClientCache::ReclaimOrphanSubscribeLocked(std::vector<std::string>& releasedKeys)
+{
+    for (auto iter = subscribedKeys_.begin(); iter != subscribedKeys_.end(); ++iter) {
+        if (iter->first == ACL_CACHE_TAG || HasItemLocked(iter->first)) {
+            continue;
+        }
+        releasedKeys.insert(releasedKeys.end(), iter->second.begin(), iter->second.end());
+        subscribedKeys_.erase(iter);
+        return;
+    }
+}
+
+void ProfileClientCache::Invalidate(const std::string& cacheKey)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    MarkChangedLocked(cacheKey);
+    size_t oldSize = lruList_.size();
+    EraseLocked(cacheKey);
+    if (lruList_.size() != oldSize) {
+        stats_.invalidateCount++;
+    }
+}
+
+void ProfileClientCache::MarkChangedLocked(const std::string& cacheKey)
+{
+    version_++;
+    if (changedVersions_.size() >= MAX_CHANGED_VERSION_SIZE) {
+        changedVersions_.clear();
+        changedFloorVersion_ = version_;
+    }
+    changedVersions_[cacheKey] = version_;
+}
+
+void ProfileClientCache::ReleaseSubscribes(const sptr<IDistributedDeviceProfile>& dpService,
+    const std::vector<std::string>& subscribeKeys)
+{
+    if (dpService == nullptr || subscribeKeys.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> subscribeLock(subscribeMutex_);
+    int32_t saId = 0;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        saId = saId_;
+    }
+    for (const auto& subscribeKey : subscribeKeys) {
+        heldChangeTypes_.erase(subscribeKey);
+        sharedListeners_.erase(subscribeKey);
+        auto appIter = appSubscribes_.find(GenerateSubscribeTag(subscribeKey, saId));
+        if (appIter != appSubscribes_.end()) {
+            // hand the key back to the app's own listener instead of dropping its subscription
+            dpService->SubscribeDeviceProfile(appIter->second);
+            continue;
+        }
+        SubscribeInfo subscribeInfo;
+        subscribeInfo.SetSaId(saId);
+        subscribeInfo.SetSubscribeKey(subscribeKey);
+        dpService->UnSubscribeDeviceProfile(subscribeInfo);
+    }
+}
+
+SubscribeInfo ProfileClientCache::MakeCacheSubscribeLocked(int32_t saId, const std::string& subscribeKey,
+    const std::unordered_set<ProfileChangeType>& changeTypes)
+{
+    auto appIter = appSubscribes_.find(GenerateSubscribeTag(subscribeKey, saId));
+    if (appIter == appSubscribes_.end()) {
+        sharedListeners_.erase(subscribeKey);
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        return SubscribeInfo(saId, subscribeKey, changeTypes, listener_);
+    }
+    sptr<CacheChangeListener>& sharedListener = sharedListeners_[subscribeKey];
+    if (sharedListener == nullptr) {
+        sharedListener = sptr<CacheChangeListener>(new CacheChangeListener());
+    }
+    sharedListener->SetAppSubscribe(appIter->second);
+    std::unordered_set<ProfileChangeType> mergedTypes = changeTypes;
+    std::unordered_set<ProfileChangeType> appTypes = appIter->second.GetProfileChangeTypes();
+    mergedTypes.insert(appTypes.begin(), appTypes.end());
+    return SubscribeInfo(saId, subscribeKey, mergedTypes, sharedListener);
+}
+
+void ProfileClientCache::SubscribeUserSwitch()
+{
+    std::lock_guard<std::mutex> subscribeLock(subscribeMutex_);
+    if (userSwitchSubscribed_) {
+        return;
+    }
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_USER_SWITCHED);
+    EventFwk::CommonEventSubscribeInfo subscribeInfo(matchingSkills);
+    userSwitchSubscriber_ = std::make_shared<UserSwitchSubscriber>(subscribeInfo);
+    if (!EventFwk::CommonEventManager::SubscribeCommonEvent(userSwitchSubscriber_)) {
+        HILOGE("subscribe user switch failed, acl reads pass through");
+        userSwitchSubscriber_ = nullptr;
+        return;
+    }
+    userSwitchSubscribed_ = true;
+}
+
+void ProfileClientCache::UnSubscribeUserSwitch()
+{
+    std::lock_guard<std::mutex> subscribeLock(subscribeMutex_);
+    if (!userSwitchSubscribed_) {
+        return;
+    }
+    if (userSwitchSubscriber_ != nullptr &&
+        !EventFwk::CommonEventManager::UnSubscribeCommonEvent(userSwitchSubscriber_)) {
+        HILOGE("unsubscribe user switch failed");
+    }
+    userSwitchSubscriber_ = nullptr;
+    userSwitchSubscribed_ = false;
+}
+
+std::string ProfileClientCache::GenerateAclCacheKey(const std::map<std::string, std::string>& params)
+{
+    std::string cacheKey = ACL_PREFIX;
+    for (const auto& item : params) {
+        cacheKey += SEPARATOR + item.first + "=" + item.second;
+    }
+    return cacheKey;
+}
+
+void ProfileClientCache::CacheChangeListener::SetAppSubscribe(const SubscribeInfo& subscribeInfo)
+{
+    std::lock_guard<std::mutex> lock(appMutex_);
+    appListener_ = iface_cast<IProfileChangeListener>(subscribeInfo.GetListener());
+    appChangeTypes_ = subscribeInfo.GetProfileChangeTypes();
+}
+
+template <typename Func>
+void ProfileClientCache::CacheChangeListener::Forward(ProfileChangeType changeType, Func func)
+{
+    sptr<IProfileChangeListener> appListener = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(appMutex_);
+        if (appChangeTypes_.count(changeType) == 0) {
+            return;
+        }
+        appListener = appListener_;
+    }
+    if (appListener != nullptr) {
+        func(appListener);
+    }
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnTrustDeviceProfileAdd(const TrustDeviceProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateAccessControlProfile();
+    Forward(ProfileChangeType::TRUST_DEVICE_PROFILE_ADD, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnTrustDeviceProfileAdd(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnTrustDeviceProfileDelete(const TrustDeviceProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateAccessControlProfile();
+    Forward(ProfileChangeType::TRUST_DEVICE_PROFILE_DELETE, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnTrustDeviceProfileDelete(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnTrustDeviceProfileUpdate(const TrustDeviceProfile& oldProfile,
+    const TrustDeviceProfile& newProfile)
+{
+    ProfileClientCache::GetInstance().InvalidateAccessControlProfile();
+    Forward(ProfileChangeType::TRUST_DEVICE_PROFILE_UPDATE, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnTrustDeviceProfileUpdate(oldProfile, newProfile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnTrustDeviceProfileActive(const TrustDeviceProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateAccessControlProfile();
+    Forward(ProfileChangeType::TRUST_DEVICE_PROFILE_ACTIVE, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnTrustDeviceProfileActive(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnTrustDeviceProfileInactive(const TrustDeviceProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateAccessControlProfile();
+    Forward(ProfileChangeType::TRUST_DEVICE_PROFILE_INACTIVE, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnTrustDeviceProfileInactive(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnDeviceAclInactiveByDelete(const TrustDeviceProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateAccessControlProfile();
+    Forward(ProfileChangeType::DEVICE_ACL_INACTIVE_BY_DELETE, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnDeviceAclInactiveByDelete(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnDeviceAclInactiveByUpdate(const TrustDeviceProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateAccessControlProfile();
+    Forward(ProfileChangeType::DEVICE_ACL_INACTIVE_BY_UPDATE, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnDeviceAclInactiveByUpdate(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnAccountAclDelete(const TrustDeviceProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateAccessControlProfile();
+    Forward(ProfileChangeType::ACCOUNT_ACL_DELETE, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnAccountAclDelete(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnAccountAclInactive(const TrustDeviceProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateAccessControlProfile();
+    Forward(ProfileChangeType::ACCOUNT_ACL_INACTIVE, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnAccountAclInactive(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnAccountAclAdd(const TrustDeviceProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateAccessControlProfile();
+    Forward(ProfileChangeType::ACCOUNT_ACL_ADD, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnAccountAclAdd(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnAccountAclActive(const TrustDeviceProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateAccessControlProfile();
+    Forward(ProfileChangeType::ACCOUNT_ACL_ACTIVE, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnAccountAclActive(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnDeviceProfileAdd(const DeviceProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateDeviceProfile(profile.GetDeviceId());
+    Forward(ProfileChangeType::DEVICE_PROFILE_ADD, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnDeviceProfileAdd(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnDeviceProfileDelete(const DeviceProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateDeviceProfile(profile.GetDeviceId());
+    Forward(ProfileChangeType::DEVICE_PROFILE_DELETE, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnDeviceProfileDelete(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnDeviceProfileUpdate(const DeviceProfile& oldProfile,
+    const DeviceProfile& newProfile)
+{
+    ProfileClientCache::GetInstance().InvalidateDeviceProfile(newProfile.GetDeviceId());
+    Forward(ProfileChangeType::DEVICE_PROFILE_UPDATE, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnDeviceProfileUpdate(oldProfile, newProfile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnServiceProfileAdd(const ServiceProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateServiceProfile(profile.GetDeviceId(), profile.GetServiceName());
+    Forward(ProfileChangeType::SERVICE_PROFILE_ADD, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnServiceProfileAdd(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnServiceProfileDelete(const ServiceProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateServiceProfile(profile.GetDeviceId(), profile.GetServiceName());
+    Forward(ProfileChangeType::SERVICE_PROFILE_DELETE, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnServiceProfileDelete(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnServiceProfileUpdate(const ServiceProfile& oldProfile,
+    const ServiceProfile& newProfile)
+{
+    ProfileClientCache::GetInstance().InvalidateServiceProfile(newProfile.GetDeviceId(),
+        newProfile.GetServiceName());
+    Forward(ProfileChangeType::SERVICE_PROFILE_UPDATE, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnServiceProfileUpdate(oldProfile, newProfile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnCharacteristicProfileAdd(const CharacteristicProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateCharacteristicProfile(profile.GetDeviceId(),
+        profile.GetServiceName(), profile.GetCharacteristicKey());
+    Forward(ProfileChangeType::CHAR_PROFILE_ADD, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnCharacteristicProfileAdd(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnCharacteristicProfileDelete(
+    const CharacteristicProfile& profile)
+{
+    ProfileClientCache::GetInstance().InvalidateCharacteristicProfile(profile.GetDeviceId(),
+        profile.GetServiceName(), profile.GetCharacteristicKey());
+    Forward(ProfileChangeType::CHAR_PROFILE_DELETE, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnCharacteristicProfileDelete(profile);
+    });
+    return DP_SUCCESS;
+}
+
+int32_t ProfileClientCache::CacheChangeListener::OnCharacteristicProfileUpdate(
+    const CharacteristicProfile& oldProfile, const CharacteristicProfile& newProfile)
+{
+    ProfileClientCache::GetInstance().InvalidateCharacteristicProfile(newProfile.GetDeviceId(),
+        newProfile.GetServiceName(), newProfile.GetCharacteristicKey());
+    Forward(ProfileChangeType::CHAR_PROFILE_UPDATE, [&](const sptr<IProfileChangeListener>& appListener) {
+        appListener->OnCharacteristicProfileUpdate(oldProfile, newProfile);
+    });
+    return DP_SUCCESS;
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
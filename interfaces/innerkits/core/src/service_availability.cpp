@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "service_availability.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+
+#include "datetime_ex.h"
+
+#include "distributed_device_profile_log.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+namespace {
+    const std::string TAG = "ServiceAvailability";
+    constexpr uint32_t MAX_BACKOFF_SHIFT = 16;
+}
+
+ServiceAvailability::ServiceAvailability(int64_t loadTimeoutMs, uint32_t failureThreshold, int64_t openMs)
+    : loadTimeoutMs_(loadTimeoutMs), failureThreshold_(failureThreshold == 0 ? 1 : failureThreshold),
+    openMs_(openMs), currentOpenMs_(openMs), randomEngine_(std::random_device{}())
+{
+}
+
+bool ServiceAvailability::WaitLoad(const LoadFunc& loadFunc)
+{
+    std::unique_lock<std::mutex> lock(stateMutex_);
+    int64_t nowMs = GetTickCount();
+    if (state_ == ServiceState::DOWN && !loading_) {
+        if (nowMs < openUntilMs_) {
+            HILOGW("dp sa is down, fail fast");
+            return false;
+        }
+        // half open, this caller probes the sa; retries keep failing fast until the probe reports
+        HILOGI("probe dp sa");
+        openUntilMs_ = nowMs + loadTimeoutMs_;
+    }
+    uint64_t generation = loadGeneration_;
+    if (!loading_) {
+        loading_ = true;
+        lock.unlock();
+        int32_t ret = loadFunc == nullptr ? -1 : loadFunc();
+        lock.lock();
+        if (ret != 0 && loadGeneration_ == generation) {
+            HILOGE("start load dp sa failed, ret: %{public}d", ret);
+            FinishLoadLocked(false);
+            return false;
+        }
+    } else {
+        HILOGI("wait for the pending dp sa load");
+    }
+    if (!loadCondVar_.wait_for(lock, std::chrono::milliseconds(loadTimeoutMs_),
+        [this, generation]() { return loadGeneration_ != generation; })) {
+        HILOGE("load dp sa timeout");
+        FinishLoadLocked(false);
+        return false;
+    }
+    return lastLoadSucceeded_;
+}
+
+void ServiceAvailability::OnLoadFinished(bool success)
+{
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    if (!loading_) {
+        // a late answer for a load that already timed out only matters when the sa came up
+        HILOGW("no dp sa load pending, success: %{public}d", success);
+        if (success) {
+            state_ = ServiceState::AVAILABLE;
+            consecutiveFailures_ = 0;
+            currentOpenMs_ = openMs_;
+        }
+        return;
+    }
+    FinishLoadLocked(success);
+}
+
+void ServiceAvailability::OnServiceAvailable()
+{
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    if (state_ != ServiceState::AVAILABLE) {
+        HILOGI("dp sa available");
+    }
+    state_ = ServiceState::AVAILABLE;
+    consecutiveFailures_ = 0;
+    currentOpenMs_ = openMs_;
+    openUntilMs_ = 0;
+}
+
+void ServiceAvailability::OnServiceDied()
+{
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    if (state_ == ServiceState::AVAILABLE) {
+        state_ = ServiceState::UNKNOWN;
+    }
+}
+
+bool ServiceAvailability::IsCircuitOpen()
+{
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    return state_ == ServiceState::DOWN && GetTickCount() < openUntilMs_;
+}
+
+int64_t ServiceAvailability::GetRetryDelayMs(uint32_t attempt)
+{
+    int64_t ceilingMs = DEFAULT_RETRY_BASE_DELAY_MS << std::min(attempt, MAX_BACKOFF_SHIFT);
+    ceilingMs = std::min(ceilingMs, MAX_RETRY_DELAY_MS);
+    // equal jitter keeps a floor of half the ceiling while spreading callers that failed together
+    std::uniform_int_distribution<int64_t> distribution(ceilingMs / 2, ceilingMs);
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    return distribution(randomEngine_);
+}
+
+ServiceState ServiceAvailability::GetState()
+{
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    if (loading_) {
+        return ServiceState::LOADING;
+    }
+    return state_;
+}
+
+void ServiceAvailability::FinishLoadLocked(bool success)
+{
+    loading_ = false;
+    loadGeneration_++;
+    lastLoadSucceeded_ = success;
+    if (success) {
+        state_ = ServiceState::AVAILABLE;
+        consecutiveFailures_ = 0;
+        currentOpenMs_ = openMs_;
+        openUntilMs_ = 0;
+    } else {
+        consecutiveFailures_++;
+        if (consecutiveFailures_ > failureThreshold_) {
+            currentOpenMs_ = std::min(currentOpenMs_ * 2, MAX_CIRCUIT_OPEN_MS);
+        }
+        if (consecutiveFailures_ >= failureThreshold_) {
+            state_ = ServiceState::DOWN;
+            openUntilMs_ = GetTickCount() + currentOpenMs_;
+            HILOGW("dp sa is down, failures: %{public}u, open: %{public}" PRId64 "ms", consecutiveFailures_,
+                currentOpenMs_);
+        } else {
+            state_ = ServiceState::UNKNOWN;
+        }
+    }
+    loadCondVar_.notify_all();
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
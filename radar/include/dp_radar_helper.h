@@ -16,11 +16,16 @@
 #ifndef OHOS_DP_RADAR_HELPER_H
 #define OHOS_DP_RADAR_HELPER_H
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <chrono>
+#include <functional>
 #include <string>
 #include <map>
+#include <mutex>
 #include <list>
+#include <vector>
 
 #include "single_instance.h"
 #include "access_control_profile.h"
@@ -92,6 +97,53 @@ enum class ProfileOperateStage : int32_t {
     DP_NOTIFY_PROFILE_CHANGE = 0x2,
 };
 
+enum class RadarUdidType : int32_t {
+    NONE = 0,
+    LOCAL = 1,
+    LOCAL_AND_PEER = 2,
+    LOCAL_AND_PEER_LIST = 3,
+};
+
+// One radar record, peer udids are kept raw and anonymized by the drain task.
+struct RadarEvent {
+    std::string func;
+    int32_t bizScene = 0;
+    int32_t bizStage = 0;
+    int32_t stageRes = 0;
+    int32_t bizState = 0;
+    int32_t errCode = 0;
+    std::string hostName;
+    std::string hostPkg;
+    std::string toCallPkg;
+    RadarUdidType udidType = RadarUdidType::NONE;
+    std::vector<std::string> peerUdids;
+    std::string extraInfo;
+    // number of successes folded into this record, 0 for a failure
+    uint32_t succCount = 0;
+};
+
+using RadarEventSink = std::function<void(const RadarEvent&)>;
+
+constexpr size_t RADAR_RING_SIZE = 64;
+
+// Bounded lock-free multi-producer queue, Push fails instead of blocking when it is full.
+class RadarEventRing {
+public:
+    RadarEventRing();
+    bool Push(RadarEvent&& event);
+    bool Pop(RadarEvent& event);
+    bool Empty();
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence { 0 };
+        RadarEvent event;
+    };
+    std::array<Slot, RADAR_RING_SIZE> slots_;
+    std::atomic<size_t> enqueuePos_ { 0 };
+    std::atomic<size_t> dequeuePos_ { 0 };
+};
+
 class DpRadarHelper {
     DECLARE_SINGLE_INSTANCE(DpRadarHelper);
 public:
@@ -129,11 +181,73 @@ public:
     std::string GetPeerUdidList(const std::vector<CharacteristicProfile>& characteristicProfiles);
     bool IsDeviceProfileInit();
     void SetDeviceProfileInit(bool isInit);
+    // Write everything pending on the calling thread, including partial success windows.
+    void Flush();
+    // Replace HiSysEventWrite as the destination of the drained records, nullptr restores it.
+    void SetEventSink(RadarEventSink sink);
+    uint64_t GetDroppedCount();
+
 private:
+    enum class RadarFunc : int32_t {
+        CHECK_DP_SA = 0,
+        LOAD_DP_SA,
+        LOAD_DP_SA_CB,
+        SA_CHECK_AUTH,
+        PUT_ACL_PROFILE,
+        UPDATE_ACL_PROFILE,
+        GET_TRUST_PROFILE,
+        GET_ALL_TRUST_PROFILE,
+        GET_ACL_PROFILE,
+        GET_ALL_ACL_PROFILE,
+        DELETE_ACL_PROFILE,
+        PUT_SERVICE_PROFILE,
+        PUT_SERVICE_PROFILE_BATCH,
+        PUT_CHAR_PROFILE,
+        PUT_CHAR_PROFILE_BATCH,
+        GET_DEVICE_PROFILE,
+        GET_SERVICE_PROFILE,
+        GET_CHAR_PROFILE,
+        DELETE_SERVICE_PROFILE,
+        DELETE_CHAR_PROFILE,
+        SUBSCRIBE_DEVICE_PROFILE,
+        UNSUBSCRIBE_DEVICE_PROFILE,
+        SYNC_DEVICE_PROFILE,
+        NOTIFY_DEVICE_PROFILE_ADD,
+        NOTIFY_DEVICE_PROFILE_UPDATE,
+        NOTIFY_DEVICE_PROFILE_DELETE,
+        NOTIFY_SERVICE_PROFILE_ADD,
+        NOTIFY_SERVICE_PROFILE_UPDATE,
+        NOTIFY_SERVICE_PROFILE_DELETE,
+        NOTIFY_CHAR_PROFILE_ADD,
+        NOTIFY_CHAR_PROFILE_UPDATE,
+        NOTIFY_CHAR_PROFILE_DELETE,
+        MAX_FUNC,
+    };
+    static constexpr size_t RADAR_FUNC_SIZE = static_cast<size_t>(RadarFunc::MAX_FUNC);
+
+    void ReportSucc(RadarFunc func);
+    void ReportFail(RadarFunc func, int32_t errCode, std::vector<std::string>&& peerUdids = {},
+        std::string&& extraInfo = "");
+    RadarEvent CreateEvent(RadarFunc func);
+    void StartDrainIfNeeded();
+    void ScheduleDrain();
+    void DrainTask();
+    bool Drain(bool flushWindow);
+    bool HasPending();
+    void WriteEvent(const RadarEvent& event);
+    int32_t WriteSysEvent(const RadarEvent& event);
+    std::string GetPeerUdidList(const std::vector<std::string>& udids);
     std::string GetAnonyUdid(std::string udid);
     std::string GetLocalUdid();
     std::string GetPeerUdid(std::string udid);
     bool isInit_ = false;
+    RadarEventRing ring_;
+    std::array<std::atomic<uint32_t>, RADAR_FUNC_SIZE> succCounts_ {};
+    std::atomic<uint64_t> droppedCount_ { 0 };
+    std::atomic<bool> draining_ { false };
+    std::atomic<int64_t> windowStartMs_ { 0 };
+    std::mutex sinkMutex_;
+    RadarEventSink sink_ = nullptr;
 };
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
@@ -16,7 +16,9 @@
 #include "dp_radar_helper.h"
 
 #include <cJSON.h>
+#include <cinttypes>
 #include <errors.h>
+#include "ffrt.h"
 #include "hisysevent.h"
 #include "content_sensor_manager_utils.h"
 #include "distributed_device_profile_errors.h"
@@ -28,1173 +30,482 @@ namespace DistributedDeviceProfile {
 IMPLEMENT_SINGLE_INSTANCE(DpRadarHelper);
 namespace {
 const std::string TAG = "DpRadarHelper";
+const std::string SUCC_COUNT = "succCount:";
+constexpr int64_t RADAR_DRAIN_INTERVAL_MS = 1000;
+constexpr uint64_t US_PER_MS = 1000;
+// successes are folded into one record per interface per window
+constexpr int64_t RADAR_AGGREGATE_WINDOW_MS = 60000;
+
+struct RadarFuncInfo {
+    std::string func;
+    BizScene bizScene;
+    int32_t bizStage;
+    BizState bizState;
+    std::string hostName;
+    std::string hostPkg;
+    std::string toCallPkg;
+    RadarUdidType udidType;
+};
+
+constexpr int32_t OPERATE_STAGE = static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE);
+constexpr int32_t NOTIFY_STAGE = static_cast<int32_t>(ProfileOperateStage::DP_NOTIFY_PROFILE_CHANGE);
+
+// indexed by DpRadarHelper::RadarFunc
+const RadarFuncInfo RADAR_FUNC_INFOS[] = {
+    { "GetDeviceProfileService", BizScene::DP_GET_SA, static_cast<int32_t>(GetSaStage::DP_CHECK_SA),
+        BizState::BIZ_STATE_START, "", "", SA_MAGR_NAME, RadarUdidType::NONE },
+    { "LoadDeviceProfileService", BizScene::DP_GET_SA, static_cast<int32_t>(GetSaStage::DP_LOAD_SA),
+        BizState::BIZ_STATE_END, "", "", SA_MAGR_NAME, RadarUdidType::NONE },
+    { "LoadSystemAbilitySuccess", BizScene::DP_GET_SA, static_cast<int32_t>(GetSaStage::DP_LOAD_SA),
+        BizState::BIZ_STATE_END, SA_MAGR_NAME, "", "", RadarUdidType::NONE },
+    { "IsCallerTrust", BizScene::DP_GET_SA, static_cast<int32_t>(GetSaStage::DP_SA_CHACK_AUTH),
+        BizState::BIZ_STATE_END, "", "", "", RadarUdidType::NONE },
+    { "PutAccessControlProfile", BizScene::DP_PUT_ACL_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL_AND_PEER },
+    { "UpdateAccessControlProfile", BizScene::DP_UPDATE_ACL_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL_AND_PEER },
+    { "GetTrustDeviceProfile", BizScene::DP_GET_TRUST_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL_AND_PEER },
+    { "GetAllTrustDeviceProfile", BizScene::DP_GET_ALL_TRUST_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL_AND_PEER_LIST },
+    { "GetAccessControlProfile", BizScene::DP_GET_ACL_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL_AND_PEER_LIST },
+    { "GetAllAccessControlProfile", BizScene::DP_GET_ALL_ACL_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL_AND_PEER_LIST },
+    { "DeleteAccessControlProfile", BizScene::DP_DELETE_ACL_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL },
+    { "PutServiceProfile", BizScene::DP_PUT_SERVICE_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL_AND_PEER },
+    { "PutServiceProfileBatch", BizScene::DP_PUT_SERVICE_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL_AND_PEER_LIST },
+    { "PutCharacteristicProfile", BizScene::DP_PUT_CHAR_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL_AND_PEER },
+    { "PutCharacteristicProfileBatch", BizScene::DP_PUT_CHAR_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL_AND_PEER_LIST },
+    { "GetDeviceProfile", BizScene::DP_GET_DEVICE_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL_AND_PEER },
+    { "GetServiceProfile", BizScene::DP_GET_SERVICE_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL_AND_PEER },
+    { "GetCharacteristicProfile", BizScene::DP_GET_CHAR_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL_AND_PEER },
+    { "DeleteServiceProfile", BizScene::DP_DELETE_SERVICE_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL_AND_PEER },
+    { "DeleteCharacteristicProfile", BizScene::DP_DELETE_CHAR_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL_AND_PEER },
+    { "SubscribeDeviceProfile", BizScene::DP_SUBSCRIBE_DEVICE_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", "", RDB_NAME, RadarUdidType::LOCAL },
+    { "UnSubscribeDeviceProfile", BizScene::DP_UNSUNBSCRIBE_DEVICE_PROFILE, OPERATE_STAGE,
+        BizState::BIZ_STATE_END, "", "", RDB_NAME, RadarUdidType::LOCAL },
+    { "SyncDeviceProfile", BizScene::DP_SYNC_DEVICE_PROFILE, OPERATE_STAGE, BizState::BIZ_STATE_END,
+        "", RDB_NAME, RDB_NAME, RadarUdidType::LOCAL },
+    { "NotifyDeviceProfileAdd", BizScene::DP_SYNC_DEVICE_PROFILE, NOTIFY_STAGE, BizState::BIZ_STATE_END,
+        "", RDB_NAME, RDB_NAME, RadarUdidType::LOCAL },
+    { "NotifyDeviceProfileUpdate", BizScene::DP_SYNC_DEVICE_PROFILE, NOTIFY_STAGE, BizState::BIZ_STATE_END,
+        "", RDB_NAME, RDB_NAME, RadarUdidType::LOCAL },
+    { "NotifyDeviceProfileDelete", BizScene::DP_SYNC_DEVICE_PROFILE, NOTIFY_STAGE, BizState::BIZ_STATE_END,
+        "", RDB_NAME, RDB_NAME, RadarUdidType::LOCAL },
+    { "NotifyServiceProfileAdd", BizScene::DP_SYNC_DEVICE_PROFILE, NOTIFY_STAGE, BizState::BIZ_STATE_END,
+        "", RDB_NAME, RDB_NAME, RadarUdidType::LOCAL },
+    { "NotifyServiceProfileUpdate", BizScene::DP_SYNC_DEVICE_PROFILE, NOTIFY_STAGE, BizState::BIZ_STATE_END,
+        "", RDB_NAME, RDB_NAME, RadarUdidType::LOCAL },
+    { "NotifyServiceProfileDelete", BizScene::DP_SYNC_DEVICE_PROFILE, NOTIFY_STAGE, BizState::BIZ_STATE_END,
+        "", RDB_NAME, RDB_NAME, RadarUdidType::LOCAL },
+    { "NotifyCharProfileAdd", BizScene::DP_SYNC_DEVICE_PROFILE, NOTIFY_STAGE, BizState::BIZ_STATE_END,
+        "", RDB_NAME, RDB_NAME, RadarUdidType::LOCAL },
+    { "NotifyCharProfileUpdate", BizScene::DP_SYNC_DEVICE_PROFILE, NOTIFY_STAGE, BizState::BIZ_STATE_END,
+        "", RDB_NAME, RDB_NAME, RadarUdidType::LOCAL },
+    { "NotifyCharProfileDelete", BizScene::DP_SYNC_DEVICE_PROFILE, NOTIFY_STAGE, BizState::BIZ_STATE_END,
+        "", RDB_NAME, RDB_NAME, RadarUdidType::LOCAL },
+};
+
+int64_t GetSteadyTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+template <typename T>
+std::string DumpProfiles(const std::vector<T>& profiles)
+{
+    std::string extraInfo = "";
+    size_t size = profiles.size() > 0 ? (profiles.size() - 1) : 0;
+    for (size_t i = 0; i < profiles.size(); i++) {
+        extraInfo += profiles[i].dump();
+        if (i != size) {
+            extraInfo += ",";
+        }
+    }
+    return extraInfo;
+}
+}
+
+RadarEventRing::RadarEventRing()
+{
+    for (size_t i = 0; i < RADAR_RING_SIZE; i++) {
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool RadarEventRing::Push(RadarEvent&& event)
+{
+    size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+        slot = &slots_[pos % RADAR_RING_SIZE];
+        size_t seq = slot->sequence.load(std::memory_order_acquire);
+        if (seq == pos) {
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (seq < pos) {
+            // the slot still holds the record of the previous lap, the ring is full
+            return false;
+        } else {
+            pos = enqueuePos_.load(std::memory_order_relaxed);
+        }
+    }
+    slot->event = std::move(event);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool RadarEventRing::Pop(RadarEvent& event)
+{
+    size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+        slot = &slots_[pos % RADAR_RING_SIZE];
+        size_t seq = slot->sequence.load(std::memory_order_acquire);
+        if (seq == pos + 1) {
+            if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (seq < pos + 1) {
+            return false;
+        } else {
+            pos = dequeuePos_.load(std::memory_order_relaxed);
+        }
+    }
+    event = std::move(slot->event);
+    slot->sequence.store(pos + RADAR_RING_SIZE, std::memory_order_release);
+    return true;
+}
+
+bool RadarEventRing::Empty()
+{
+    return dequeuePos_.load(std::memory_order_acquire) == enqueuePos_.load(std::memory_order_acquire);
 }
+
 void DpRadarHelper::ReportCheckDpSa(int32_t stageRes)
 {
-    int32_t res = ERR_OK;
     if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetDeviceProfileService",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_SA),
-            "BIZ_STAGE", static_cast<int32_t>(GetSaStage::DP_CHECK_SA),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_START),
-            "TO_CALL_PKG", SA_MAGR_NAME);
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetDeviceProfileService",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_SA),
-            "BIZ_STAGE", static_cast<int32_t>(GetSaStage::DP_CHECK_SA),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_START),
-            "TO_CALL_PKG", SA_MAGR_NAME,
-            "ERROR_CODE", DP_LOAD_SERVICE_ERR);
+        ReportSucc(RadarFunc::CHECK_DP_SA);
+        return;
     }
-    if (res != ERR_OK) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::CHECK_DP_SA, DP_LOAD_SERVICE_ERR);
 }
 
 void DpRadarHelper::ReportLoadDpSa(int32_t stageRes)
 {
-    int32_t res = ERR_OK;
     if (stageRes == static_cast<int32_t>(StageRes::STAGE_IDLE)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "LoadDeviceProfileService",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_SA),
-            "BIZ_STAGE", static_cast<int32_t>(GetSaStage::DP_LOAD_SA),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "TO_CALL_PKG", SA_MAGR_NAME);
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "LoadDeviceProfileService",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_SA),
-            "BIZ_STAGE", static_cast<int32_t>(GetSaStage::DP_LOAD_SA),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "TO_CALL_PKG", SA_MAGR_NAME,
-            "ERROR_CODE", DP_LOAD_SERVICE_ERR);
-    }
-    if (res != ERR_OK) {
-        HILOGD("failed");
+        ReportSucc(RadarFunc::LOAD_DP_SA);
+        return;
     }
-    return;
+    ReportFail(RadarFunc::LOAD_DP_SA, DP_LOAD_SERVICE_ERR);
 }
 
 void DpRadarHelper::ReportLoadDpSaCb(int32_t stageRes)
 {
-    int32_t res = ERR_OK;
     if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "LoadSystemAbilitySuccess",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_SA),
-            "BIZ_STAGE", static_cast<int32_t>(GetSaStage::DP_LOAD_SA),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "HOST_NAME", SA_MAGR_NAME);
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "LoadSystemAbilityFail",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_SA),
-            "BIZ_STAGE", static_cast<int32_t>(GetSaStage::DP_LOAD_SA),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "HOST_NAME", SA_MAGR_NAME,
-            "ERROR_CODE", DP_LOAD_SERVICE_ERR);
-    }
-    if (res != ERR_OK) {
-        HILOGD("failed");
+        ReportSucc(RadarFunc::LOAD_DP_SA_CB);
+        return;
     }
-    return;
+    ReportFail(RadarFunc::LOAD_DP_SA_CB, DP_LOAD_SERVICE_ERR);
 }
 
 void DpRadarHelper::ReportSaCheckAuth(int32_t stageRes)
 {
-    int res = ERR_OK;
     if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "IsCallerTrust",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_SA),
-            "BIZ_STAGE", static_cast<int32_t>(GetSaStage::DP_SA_CHACK_AUTH),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END));
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "IsCallerTrust",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_SA),
-            "BIZ_STAGE", static_cast<int32_t>(GetSaStage::DP_SA_CHACK_AUTH),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "ERROR_CODE", ERR_PERMISSION_DENIED);
+        ReportSucc(RadarFunc::SA_CHECK_AUTH);
+        return;
     }
-    if (res != ERR_OK) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::SA_CHECK_AUTH, ERR_PERMISSION_DENIED);
 }
 
 void DpRadarHelper::ReportPutAclProfile(int32_t errCode, const AccessControlProfile& accessControlProfile)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "PutAccessControlProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_PUT_ACL_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(accessControlProfile.GetAccessee().GetAccesseeDeviceId()),
-            "TO_CALL_PKG", RDB_NAME,
-            "EXTRA_INFO", accessControlProfile.dump());
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "PutAccessControlProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_PUT_ACL_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(accessControlProfile.GetAccessee().GetAccesseeDeviceId()),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode,
-            "EXTRA_INFO", accessControlProfile.dump());
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::PUT_ACL_PROFILE);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::PUT_ACL_PROFILE, errCode, { accessControlProfile.GetAccessee().GetAccesseeDeviceId() },
+        accessControlProfile.dump());
 }
 
 void DpRadarHelper::ReportUpdateAclProfile(int32_t errCode, const AccessControlProfile& accessControlProfile)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "UpdateAccessControlProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_UPDATE_ACL_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(accessControlProfile.GetAccessee().GetAccesseeDeviceId()),
-            "TO_CALL_PKG", RDB_NAME,
-            "EXTRA_INFO", accessControlProfile.dump());
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "UpdateAccessControlProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_UPDATE_ACL_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(accessControlProfile.GetAccessee().GetAccesseeDeviceId()),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode,
-            "EXTRA_INFO", accessControlProfile.dump());
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::UPDATE_ACL_PROFILE);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::UPDATE_ACL_PROFILE, errCode,
+        { accessControlProfile.GetAccessee().GetAccesseeDeviceId() }, accessControlProfile.dump());
 }
 
 void DpRadarHelper::ReportGetTrustProfile(int32_t errCode, const std::string& deviceId,
     const TrustDeviceProfile& trustDeviceProfile)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetTrustDeviceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_TRUST_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(deviceId),
-            "TO_CALL_PKG", RDB_NAME,
-            "EXTRA_INFO", trustDeviceProfile.dump());
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetTrustDeviceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_TRUST_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(deviceId),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode,
-            "EXTRA_INFO", trustDeviceProfile.dump());
-    }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::GET_TRUST_PROFILE);
+        return;
     }
-    return;
+    ReportFail(RadarFunc::GET_TRUST_PROFILE, errCode, { deviceId }, trustDeviceProfile.dump());
 }
 
 void DpRadarHelper::ReportGetAllTrustProfile(int32_t errCode, std::vector<TrustDeviceProfile>& trustDeviceProfiles)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    std::string extraInfo = "";
-    size_t size = trustDeviceProfiles.size() > 0 ? (trustDeviceProfiles.size() - 1) : 0;
-    for (size_t i = 0; i < trustDeviceProfiles.size(); i++) {
-        extraInfo += trustDeviceProfiles[i].dump();
-        if (i != size) {
-            extraInfo += ",";
-        }
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::GET_ALL_TRUST_PROFILE);
+        return;
     }
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetAllTrustDeviceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_ALL_TRUST_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID_LIST", GetPeerUdidList(trustDeviceProfiles),
-            "TO_CALL_PKG", RDB_NAME,
-            "EXTRA_INFO", extraInfo);
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetAllTrustDeviceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_ALL_TRUST_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID_LIST", GetPeerUdidList(trustDeviceProfiles),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode,
-            "EXTRA_INFO", extraInfo);
+    std::vector<std::string> peerUdids;
+    for (const auto& item : trustDeviceProfiles) {
+        peerUdids.emplace_back(item.GetDeviceId());
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::GET_ALL_TRUST_PROFILE, errCode, std::move(peerUdids), DumpProfiles(trustDeviceProfiles));
 }
 
 void DpRadarHelper::ReportGetAclProfile(int32_t errCode, std::vector<AccessControlProfile>& accessControlProfiles)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    std::string extraInfo = "";
-    size_t size = accessControlProfiles.size() > 0 ? (accessControlProfiles.size() - 1) : 0;
-    for (size_t i = 0; i < accessControlProfiles.size(); i++) {
-        extraInfo += accessControlProfiles[i].dump();
-        if (i != size) {
-            extraInfo += ",";
-        }
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::GET_ACL_PROFILE);
+        return;
     }
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetAccessControlProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_ACL_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID_LIST", GetPeerUdidList(accessControlProfiles),
-            "TO_CALL_PKG", RDB_NAME,
-            "EXTRA_INFO", extraInfo);
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetAccessControlProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_ACL_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID_LIST", GetPeerUdidList(accessControlProfiles),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode,
-            "EXTRA_INFO", extraInfo);
+    std::vector<std::string> peerUdids;
+    for (const auto& item : accessControlProfiles) {
+        peerUdids.emplace_back(item.GetAccessee().GetAccesseeDeviceId());
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::GET_ACL_PROFILE, errCode, std::move(peerUdids), DumpProfiles(accessControlProfiles));
 }
 
 void DpRadarHelper::ReportGetAllAclProfile(int32_t errCode, std::vector<AccessControlProfile>& accessControlProfiles)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    std::string extraInfo = "";
-    size_t size = accessControlProfiles.size() > 0 ? (accessControlProfiles.size() - 1) : 0;
-    for (size_t i = 0; i < accessControlProfiles.size(); i++) {
-        extraInfo += accessControlProfiles[i].dump();
-        if (i != size) {
-            extraInfo += ",";
-        }
-    }
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetAllAccessControlProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_ALL_ACL_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID_LIST", GetPeerUdidList(accessControlProfiles),
-            "TO_CALL_PKG", RDB_NAME,
-            "EXTRA_INFO", extraInfo);
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetAllAccessControlProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_ALL_ACL_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID_LIST", GetPeerUdidList(accessControlProfiles),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode,
-            "EXTRA_INFO", extraInfo);
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::GET_ALL_ACL_PROFILE);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
+    std::vector<std::string> peerUdids;
+    for (const auto& item : accessControlProfiles) {
+        peerUdids.emplace_back(item.GetAccessee().GetAccesseeDeviceId());
     }
-    return;
+    ReportFail(RadarFunc::GET_ALL_ACL_PROFILE, errCode, std::move(peerUdids), DumpProfiles(accessControlProfiles));
 }
 
 void DpRadarHelper::ReportDeleteAclProfile(int32_t errCode)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "DeleteAccessControlProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_DELETE_ACL_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "TO_CALL_PKG", RDB_NAME);
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "DeleteAccessControlProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_DELETE_ACL_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode);
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::DELETE_ACL_PROFILE);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::DELETE_ACL_PROFILE, errCode);
 }
 
 void DpRadarHelper::ReportPutServiceProfile(int32_t errCode, const ServiceProfile& serviceProfile)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "PutServiceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_PUT_SERVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_IDLE),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_START),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(serviceProfile.GetDeviceId()),
-            "TO_CALL_PKG", RDB_NAME,
-            "EXTRA_INFO", serviceProfile.dump());
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "PutServiceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_PUT_SERVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(serviceProfile.GetDeviceId()),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode,
-            "EXTRA_INFO", serviceProfile.dump());
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::PUT_SERVICE_PROFILE);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::PUT_SERVICE_PROFILE, errCode, { serviceProfile.GetDeviceId() }, serviceProfile.dump());
 }
 
 void DpRadarHelper::ReportPutServiceProfileBatch(int32_t errCode, const std::vector<ServiceProfile>& serviceProfiles)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    std::string extraInfo = "";
-    size_t size = serviceProfiles.size() > 0 ? (serviceProfiles.size() - 1) : 0;
-    for (size_t i = 0; i < serviceProfiles.size(); i++) {
-        extraInfo += serviceProfiles[i].dump();
-        if (i != size) {
-            extraInfo += ",";
-        }
-    }
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "PutServiceProfileBatch",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_PUT_SERVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_IDLE),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_START),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID_LIST", GetPeerUdidList(serviceProfiles),
-            "TO_CALL_PKG", RDB_NAME,
-            "EXTRA_INFO", extraInfo);
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "PutServiceProfileBatch",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_PUT_SERVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID_LIST", GetPeerUdidList(serviceProfiles),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode,
-            "EXTRA_INFO", extraInfo);
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::PUT_SERVICE_PROFILE_BATCH);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
+    std::vector<std::string> peerUdids;
+    for (const auto& item : serviceProfiles) {
+        peerUdids.emplace_back(item.GetDeviceId());
     }
-    return;
+    ReportFail(RadarFunc::PUT_SERVICE_PROFILE_BATCH, errCode, std::move(peerUdids), DumpProfiles(serviceProfiles));
 }
 
 void DpRadarHelper::ReportPutCharProfile(int32_t errCode, const CharacteristicProfile& characteristicProfile)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "PutCharacteristicProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_PUT_CHAR_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_IDLE),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_START),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(characteristicProfile.GetDeviceId()),
-            "TO_CALL_PKG", RDB_NAME,
-            "EXTRA_INFO", characteristicProfile.dump());
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "PutCharacteristicProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_PUT_CHAR_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(characteristicProfile.GetDeviceId()),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode,
-            "EXTRA_INFO", characteristicProfile.dump());
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::PUT_CHAR_PROFILE);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::PUT_CHAR_PROFILE, errCode, { characteristicProfile.GetDeviceId() },
+        characteristicProfile.dump());
 }
 
 void DpRadarHelper::ReportPutCharProfileBatch(int32_t errCode,
     const std::vector<CharacteristicProfile>& characteristicProfiles)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    std::string extraInfo = "";
-    size_t size = characteristicProfiles.size() > 0 ? (characteristicProfiles.size() - 1) : 0;
-    for (size_t i = 0; i < characteristicProfiles.size(); i++) {
-        extraInfo += characteristicProfiles[i].dump();
-        if (i != size) {
-            extraInfo += ",";
-        }
-    }
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "PutCharacteristicProfileBatch",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_PUT_CHAR_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_IDLE),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_START),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID_LIST", GetPeerUdidList(characteristicProfiles),
-            "TO_CALL_PKG", RDB_NAME,
-            "EXTRA_INFO", extraInfo);
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "PutCharacteristicProfileBatch",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_PUT_CHAR_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID_LIST", GetPeerUdidList(characteristicProfiles),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode,
-            "EXTRA_INFO", extraInfo);
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::PUT_CHAR_PROFILE_BATCH);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
+    std::vector<std::string> peerUdids;
+    for (const auto& item : characteristicProfiles) {
+        peerUdids.emplace_back(item.GetDeviceId());
     }
-    return;
+    ReportFail(RadarFunc::PUT_CHAR_PROFILE_BATCH, errCode, std::move(peerUdids),
+        DumpProfiles(characteristicProfiles));
 }
 
 void DpRadarHelper::ReportGetDeviceProfile(int32_t errCode, const std::string& deviceId, DeviceProfile& deviceProfile)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetDeviceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_DEVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(deviceId),
-            "TO_CALL_PKG", RDB_NAME,
-            "EXTRA_INFO", deviceProfile.dump());
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetDeviceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_DEVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(deviceId),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode,
-            "EXTRA_INFO", deviceProfile.dump());
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::GET_DEVICE_PROFILE);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::GET_DEVICE_PROFILE, errCode, { deviceId }, deviceProfile.dump());
 }
 
 void DpRadarHelper::ReportGetServiceProfile(int32_t errCode,
     const std::string& deviceId, ServiceProfile& serviceProfile)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetServiceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_SERVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(deviceId),
-            "TO_CALL_PKG", RDB_NAME,
-            "EXTRA_INFO", serviceProfile.dump());
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetServiceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_SERVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(deviceId),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode,
-            "EXTRA_INFO", serviceProfile.dump());
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::GET_SERVICE_PROFILE);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::GET_SERVICE_PROFILE, errCode, { deviceId }, serviceProfile.dump());
 }
 
 void DpRadarHelper::ReportGetCharProfile(int32_t errCode,
     const std::string& deviceId, CharacteristicProfile& characteristicProfile)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetCharacteristicProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_CHAR_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(deviceId),
-            "TO_CALL_PKG", RDB_NAME,
-            "EXTRA_INFO", characteristicProfile.dump());
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "GetCharacteristicProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_GET_CHAR_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(deviceId),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode,
-            "EXTRA_INFO", characteristicProfile.dump());
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::GET_CHAR_PROFILE);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::GET_CHAR_PROFILE, errCode, { deviceId }, characteristicProfile.dump());
 }
 
 void DpRadarHelper::ReportDeleteServiceProfile(int32_t errCode, const std::string& deviceId)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "DeleteServiceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_DELETE_SERVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_IDLE),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_START),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(deviceId),
-            "TO_CALL_PKG", RDB_NAME);
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "DeleteServiceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_DELETE_SERVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(deviceId),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode);
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::DELETE_SERVICE_PROFILE);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::DELETE_SERVICE_PROFILE, errCode, { deviceId });
 }
 
 void DpRadarHelper::ReportDeleteCharProfile(int32_t errCode, const std::string& deviceId)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "DeleteCharacteristicProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_DELETE_CHAR_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_IDLE),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_START),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(deviceId),
-            "TO_CALL_PKG", RDB_NAME);
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "DeleteCharacteristicProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_DELETE_CHAR_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "PEER_UDID", GetPeerUdid(deviceId),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode);
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::DELETE_CHAR_PROFILE);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::DELETE_CHAR_PROFILE, errCode, { deviceId });
 }
 
 void DpRadarHelper::ReportSubscribeDeviceProfile(int32_t errCode, const SubscribeInfo& subscribeInfo)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "SubscribeDeviceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_SUBSCRIBE_DEVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "TO_CALL_PKG", RDB_NAME,
-            "EXTRA_INFO", subscribeInfo.dump());
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "SubscribeDeviceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_SUBSCRIBE_DEVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode,
-            "EXTRA_INFO", subscribeInfo.dump());
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::SUBSCRIBE_DEVICE_PROFILE);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::SUBSCRIBE_DEVICE_PROFILE, errCode, {}, subscribeInfo.dump());
 }
 
 void DpRadarHelper::ReportUnSubscribeDeviceProfile(int32_t errCode, const SubscribeInfo& subscribeInfo)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "UnSubscribeDeviceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_UNSUNBSCRIBE_DEVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "TO_CALL_PKG", RDB_NAME,
-            "EXTRA_INFO", subscribeInfo.dump());
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "UnSubscribeDeviceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_UNSUNBSCRIBE_DEVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "LOCAL_UDID", GetLocalUdid(),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode,
-            "EXTRA_INFO", subscribeInfo.dump());
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::UNSUBSCRIBE_DEVICE_PROFILE);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::UNSUBSCRIBE_DEVICE_PROFILE, errCode, {}, subscribeInfo.dump());
 }
 
 void DpRadarHelper::ReportSyncDeviceProfile(int32_t errCode)
 {
-    int res = DP_SUCCESS;
-    int32_t stageRes = (errCode == DP_SUCCESS) ?
-        static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
-    if (stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "SyncDeviceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_SYNC_DEVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "HOST_PKG", RDB_NAME,
-            "LOCAL_UDID", GetLocalUdid(),
-            "TO_CALL_PKG", RDB_NAME);
-    } else {
-        res = HiSysEventWrite(
-            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-            DP_DATA_OPERATE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-            "ORG_PKG", ORGPKG_NAME,
-            "FUNC", "SyncDeviceProfile",
-            "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_SYNC_DEVICE_PROFILE),
-            "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_PROFILE_OPERATE),
-            "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_FAIL),
-            "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-            "HOST_PKG", RDB_NAME,
-            "LOCAL_UDID", GetLocalUdid(),
-            "TO_CALL_PKG", RDB_NAME,
-            "ERROR_CODE", errCode);
+    if (errCode == DP_SUCCESS) {
+        ReportSucc(RadarFunc::SYNC_DEVICE_PROFILE);
+        return;
     }
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
+    ReportFail(RadarFunc::SYNC_DEVICE_PROFILE, errCode);
 }
 
 void DpRadarHelper::ReportNotifyProfileChange(int32_t code)
 {
-    std::string funcName = "";
     switch (code) {
         case ProfileType::DEVICE_PROFILE * ChangeType::ADD:
-            funcName = "NotifyDeviceProfileAdd";
+            ReportSucc(RadarFunc::NOTIFY_DEVICE_PROFILE_ADD);
             break;
         case ProfileType::DEVICE_PROFILE * ChangeType::UPDATE:
-            funcName = "NotifyDeviceProfileUpdate";
+            ReportSucc(RadarFunc::NOTIFY_DEVICE_PROFILE_UPDATE);
             break;
         case ProfileType::DEVICE_PROFILE * ChangeType::DELETE:
-            funcName = "NotifyDeviceProfileDelete";
+            ReportSucc(RadarFunc::NOTIFY_DEVICE_PROFILE_DELETE);
             break;
         case ProfileType::SERVICE_PROFILE * ChangeType::ADD:
-            funcName = "NotifyServiceProfileAdd";
+            ReportSucc(RadarFunc::NOTIFY_SERVICE_PROFILE_ADD);
             break;
         case ProfileType::SERVICE_PROFILE * ChangeType::UPDATE:
-            funcName = "NotifyServiceProfileUpdate";
+            ReportSucc(RadarFunc::NOTIFY_SERVICE_PROFILE_UPDATE);
             break;
         case ProfileType::SERVICE_PROFILE * ChangeType::DELETE:
-            funcName = "NotifyServiceProfileDelete";
+            ReportSucc(RadarFunc::NOTIFY_SERVICE_PROFILE_DELETE);
             break;
         case ProfileType::CHAR_PROFILE * ChangeType::ADD:
-            funcName = "NotifyCharProfileAdd";
+            ReportSucc(RadarFunc::NOTIFY_CHAR_PROFILE_ADD);
             break;
         case ProfileType::CHAR_PROFILE * ChangeType::UPDATE:
-            funcName = "NotifyCharProfileUpdate";
+            ReportSucc(RadarFunc::NOTIFY_CHAR_PROFILE_UPDATE);
             break;
         case ProfileType::CHAR_PROFILE * ChangeType::DELETE:
-            funcName = "NotifyCharProfileDelete";
+            ReportSucc(RadarFunc::NOTIFY_CHAR_PROFILE_DELETE);
+            break;
+        default:
+            HILOGD("unknown code:%{public}d", code);
             break;
     }
-    int res = HiSysEventWrite(
-        OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
-        DP_DATA_OPERATE_BEHAVIOR,
-        HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-        "ORG_PKG", ORGPKG_NAME,
-        "FUNC", funcName,
-        "BIZ_SCENE", static_cast<int32_t>(BizScene::DP_SYNC_DEVICE_PROFILE),
-        "BIZ_STAGE", static_cast<int32_t>(ProfileOperateStage::DP_NOTIFY_PROFILE_CHANGE),
-        "STAGE_RES", static_cast<int32_t>(StageRes::STAGE_SUCC),
-        "BIZ_STATE", static_cast<int32_t>(BizState::BIZ_STATE_END),
-        "HOST_PKG", RDB_NAME,
-        "LOCAL_UDID", GetLocalUdid(),
-        "TO_CALL_PKG", RDB_NAME);
-    if (res != DP_SUCCESS) {
-        HILOGD("failed");
-    }
-    return;
 }
 
 std::string DpRadarHelper::GetPeerUdidList(const std::vector<TrustDeviceProfile>& trustDeviceProfiles)
 {
-    if (trustDeviceProfiles.size() == 0) {
-        return "";
-    }
-    cJSON* deviceInfoJson = cJSON_CreateObject();
-    if (deviceInfoJson == nullptr) {
-        return "";
-    }
-    cJSON* peerUdidList = cJSON_CreateArray();
-    if (peerUdidList == nullptr) {
-        cJSON_Delete(deviceInfoJson);
-        return "";
-    }
-    if (!cJSON_AddItemToObject(deviceInfoJson, "PEER_UDID_LIST", peerUdidList)) {
-        cJSON_Delete(peerUdidList);
-        cJSON_Delete(deviceInfoJson);
-        return "";
+    std::vector<std::string> udids;
+    for (const auto& item : trustDeviceProfiles) {
+        udids.emplace_back(item.GetDeviceId());
     }
-    for (size_t i = 0; i < trustDeviceProfiles.size(); i++) {
-        std::string udid = GetPeerUdid(trustDeviceProfiles[i].GetDeviceId());
-        cJSON* object = cJSON_CreateString(udid.c_str());
-        if (object == nullptr) {
-            cJSON_Delete(deviceInfoJson);
-            return "";
-        }
-        if (!cJSON_AddItemToArray(peerUdidList, object)) {
-            cJSON_Delete(object);
-            cJSON_Delete(deviceInfoJson);
-            return "";
-        }
-    }
-    char *peerDevUdidStr = cJSON_PrintUnformatted(deviceInfoJson);
-    if (peerDevUdidStr == nullptr) {
-        cJSON_Delete(deviceInfoJson);
-        return "";
-    }
-    std::string peerUdidStr = std::string(peerDevUdidStr);
-    cJSON_Delete(deviceInfoJson);
-    cJSON_free(peerDevUdidStr);
-    return peerUdidStr;
+    return GetPeerUdidList(udids);
 }
 
 std::string DpRadarHelper::GetPeerUdidList(const std::vector<AccessControlProfile>& accessControlProfiles)
 {
-    if (accessControlProfiles.size() == 0) {
-        return "";
+    std::vector<std::string> udids;
+    for (const auto& item : accessControlProfiles) {
+        udids.emplace_back(item.GetAccessee().GetAccesseeDeviceId());
     }
-    cJSON* deviceInfoJson = cJSON_CreateObject();
-    if (deviceInfoJson == nullptr) {
-        return "";
-    }
-    cJSON* peerUdidList = cJSON_CreateArray();
-    if (peerUdidList == nullptr) {
-        cJSON_Delete(deviceInfoJson);
-        return "";
-    }
-    if (!cJSON_AddItemToObject(deviceInfoJson, "PEER_UDID_LIST", peerUdidList)) {
-        cJSON_Delete(peerUdidList);
-        cJSON_Delete(deviceInfoJson);
-        return "";
-    }
-    for (size_t i = 0; i < accessControlProfiles.size(); i++) {
-        std::string udid = GetPeerUdid(accessControlProfiles[i].GetAccessee().GetAccesseeDeviceId());
-        cJSON* object = cJSON_CreateString(udid.c_str());
-        if (object == nullptr) {
-            cJSON_Delete(deviceInfoJson);
-            return "";
-        }
-        if (!cJSON_AddItemToArray(peerUdidList, object)) {
-            cJSON_Delete(object);
-            cJSON_Delete(deviceInfoJson);
-            return "";
-        }
-    }
-    char *peerDevUdidStr = cJSON_PrintUnformatted(deviceInfoJson);
-    if (peerDevUdidStr == nullptr) {
-        cJSON_Delete(deviceInfoJson);
-        return "";
-    }
-    std::string peerUdidStr = std::string(peerDevUdidStr);
-    cJSON_Delete(deviceInfoJson);
-    cJSON_free(peerDevUdidStr);
-    return peerUdidStr;
+    return GetPeerUdidList(udids);
 }
 
 std::string DpRadarHelper::GetPeerUdidList(const std::vector<ServiceProfile>& serviceProfiles)
 {
-    if (serviceProfiles.size() == 0) {
-        return "";
-    }
-    cJSON* deviceInfoJson = cJSON_CreateObject();
-    if (deviceInfoJson == nullptr) {
-        return "";
-    }
-    cJSON* peerUdidList = cJSON_CreateArray();
-    if (peerUdidList == nullptr) {
-        cJSON_Delete(deviceInfoJson);
-        return "";
+    std::vector<std::string> udids;
+    for (const auto& item : serviceProfiles) {
+        udids.emplace_back(item.GetDeviceId());
     }
-    if (!cJSON_AddItemToObject(deviceInfoJson, "PEER_UDID_LIST", peerUdidList)) {
-        cJSON_Delete(peerUdidList);
-        cJSON_Delete(deviceInfoJson);
-        return "";
-    }
-    for (size_t i = 0; i < serviceProfiles.size(); i++) {
-        std::string udid = GetPeerUdid(serviceProfiles[i].GetDeviceId());
-        cJSON* object = cJSON_CreateString(udid.c_str());
-        if (object == nullptr) {
-            cJSON_Delete(deviceInfoJson);
-            return "";
-        }
-        if (!cJSON_AddItemToArray(peerUdidList, object)) {
-            cJSON_Delete(object);
-            cJSON_Delete(deviceInfoJson);
-            return "";
-        }
-    }
-    char *peerDevUdidStr = cJSON_PrintUnformatted(deviceInfoJson);
-    if (peerDevUdidStr == nullptr) {
-        cJSON_Delete(deviceInfoJson);
-        return "";
-    }
-    std::string peerUdidStr = std::string(peerDevUdidStr);
-    cJSON_Delete(deviceInfoJson);
-    cJSON_free(peerDevUdidStr);
-    return peerUdidStr;
+    return GetPeerUdidList(udids);
 }
 
 std::string DpRadarHelper::GetPeerUdidList(const std::vector<CharacteristicProfile>& characteristicProfiles)
 {
-    if (characteristicProfiles.size() == 0) {
+    std::vector<std::string> udids;
+    for (const auto& item : characteristicProfiles) {
+        udids.emplace_back(item.GetDeviceId());
+    }
+    return GetPeerUdidList(udids);
+}
+
+std::string DpRadarHelper::GetPeerUdidList(const std::vector<std::string>& udids)
+{
+    if (udids.size() == 0) {
         return "";
     }
     cJSON* deviceInfoJson = cJSON_CreateObject();
@@ -1211,8 +522,8 @@ std::string DpRadarHelper::GetPeerUdidList(const std::vector<CharacteristicProfi
         cJSON_Delete(deviceInfoJson);
         return "";
     }
-    for (size_t i = 0; i < characteristicProfiles.size(); i++) {
-        std::string udid = GetPeerUdid(characteristicProfiles[i].GetDeviceId());
+    for (size_t i = 0; i < udids.size(); i++) {
+        std::string udid = GetPeerUdid(udids[i]);
         cJSON* object = cJSON_CreateString(udid.c_str());
         if (object == nullptr) {
             cJSON_Delete(deviceInfoJson);
@@ -1263,5 +574,202 @@ void DpRadarHelper::SetDeviceProfileInit(bool isInit)
 {
     isInit_ = isInit;
 }
+
+void DpRadarHelper::Flush()
+{
+    Drain(true);
+    windowStartMs_.store(GetSteadyTimeMs());
+}
+
+void DpRadarHelper::SetEventSink(RadarEventSink sink)
+{
+    std::lock_guard<std::mutex> lock(sinkMutex_);
+    sink_ = sink;
+}
+
+uint64_t DpRadarHelper::GetDroppedCount()
+{
+    return droppedCount_.load(std::memory_order_relaxed);
+}
+
+void DpRadarHelper::ReportSucc(RadarFunc func)
+{
+    succCounts_[static_cast<size_t>(func)].fetch_add(1, std::memory_order_relaxed);
+    StartDrainIfNeeded();
+}
+
+void DpRadarHelper::ReportFail(RadarFunc func, int32_t errCode, std::vector<std::string>&& peerUdids,
+    std::string&& extraInfo)
+{
+    RadarEvent event = CreateEvent(func);
+    if (func == RadarFunc::LOAD_DP_SA_CB) {
+        event.func = "LoadSystemAbilityFail";
+    }
+    event.stageRes = static_cast<int32_t>(StageRes::STAGE_FAIL);
+    event.errCode = errCode;
+    event.peerUdids = std::move(peerUdids);
+    event.extraInfo = std::move(extraInfo);
+    if (!ring_.Push(std::move(event))) {
+        // never wait for the drain task, losing a record is cheaper than stalling the caller
+        droppedCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+    StartDrainIfNeeded();
+}
+
+RadarEvent DpRadarHelper::CreateEvent(RadarFunc func)
+{
+    static_assert(sizeof(RADAR_FUNC_INFOS) / sizeof(RADAR_FUNC_INFOS[0]) == RADAR_FUNC_SIZE,
+        "RADAR_FUNC_INFOS must match RadarFunc");
+    const RadarFuncInfo& info = RADAR_FUNC_INFOS[static_cast<size_t>(func)];
+    RadarEvent event;
+    event.func = info.func;
+    event.bizScene = static_cast<int32_t>(info.bizScene);
+    event.bizStage = info.bizStage;
+    event.stageRes = static_cast<int32_t>(StageRes::STAGE_SUCC);
+    event.bizState = static_cast<int32_t>(info.bizState);
+    event.hostName = info.hostName;
+    event.hostPkg = info.hostPkg;
+    event.toCallPkg = info.toCallPkg;
+    event.udidType = info.udidType;
+    return event;
+}
+
+void DpRadarHelper::StartDrainIfNeeded()
+{
+    if (draining_.load(std::memory_order_acquire)) {
+        return;
+    }
+    bool expected = false;
+    if (!draining_.compare_exchange_strong(expected, true)) {
+        return;
+    }
+    windowStartMs_.store(GetSteadyTimeMs());
+    ScheduleDrain();
+}
+
+void DpRadarHelper::ScheduleDrain()
+{
+    ffrt::submit([this]() { DrainTask(); }, {}, {},
+        ffrt::task_attr().name("DpRadarDrain").delay(RADAR_DRAIN_INTERVAL_MS * US_PER_MS));
+}
+
+void DpRadarHelper::DrainTask()
+{
+    bool windowEnd = GetSteadyTimeMs() - windowStartMs_.load() >= RADAR_AGGREGATE_WINDOW_MS;
+    if (Drain(windowEnd)) {
+        ScheduleDrain();
+        return;
+    }
+    if (windowEnd) {
+        windowStartMs_.store(GetSteadyTimeMs());
+    }
+    draining_.store(false, std::memory_order_release);
+    // a report may have seen draining_ still set just before it was cleared
+    if (HasPending() && !draining_.exchange(true)) {
+        ScheduleDrain();
+    }
+}
+
+bool DpRadarHelper::Drain(bool flushWindow)
+{
+    RadarEvent event;
+    while (ring_.Pop(event)) {
+        WriteEvent(event);
+    }
+    bool pending = false;
+    for (size_t i = 0; i < RADAR_FUNC_SIZE; i++) {
+        if (!flushWindow) {
+            pending = pending || succCounts_[i].load(std::memory_order_relaxed) != 0;
+            continue;
+        }
+        uint32_t succCount = succCounts_[i].exchange(0, std::memory_order_relaxed);
+        if (succCount == 0) {
+            continue;
+        }
+        RadarEvent succEvent = CreateEvent(static_cast<RadarFunc>(i));
+        succEvent.succCount = succCount;
+        succEvent.extraInfo = SUCC_COUNT + std::to_string(succCount);
+        WriteEvent(succEvent);
+    }
+    if (flushWindow && droppedCount_.load(std::memory_order_relaxed) != 0) {
+        HILOGW("dropped %{public}" PRIu64 " radar records so far", droppedCount_.load());
+    }
+    return pending;
+}
+
+bool DpRadarHelper::HasPending()
+{
+    if (!ring_.Empty()) {
+        return true;
+    }
+    for (const auto& succCount : succCounts_) {
+        if (succCount.load(std::memory_order_relaxed) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void DpRadarHelper::WriteEvent(const RadarEvent& event)
+{
+    RadarEventSink sink = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(sinkMutex_);
+        sink = sink_;
+    }
+    if (sink != nullptr) {
+        sink(event);
+        return;
+    }
+    if (WriteSysEvent(event) != ERR_OK) {
+        HILOGD("failed");
+    }
+}
+
+int32_t DpRadarHelper::WriteSysEvent(const RadarEvent& event)
+{
+    std::string localUdid = (event.udidType == RadarUdidType::NONE) ? "" : GetLocalUdid();
+    std::string peerUdid = (event.udidType == RadarUdidType::LOCAL_AND_PEER && !event.peerUdids.empty()) ?
+        GetPeerUdid(event.peerUdids.front()) : "";
+    std::string peerUdidList = (event.udidType == RadarUdidType::LOCAL_AND_PEER_LIST) ?
+        GetPeerUdidList(event.peerUdids) : "";
+    if (event.stageRes == static_cast<int32_t>(StageRes::STAGE_SUCC)) {
+        return HiSysEventWrite(
+            OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
+            DP_DATA_OPERATE_BEHAVIOR,
+            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            "ORG_PKG", ORGPKG_NAME,
+            "FUNC", event.func,
+            "BIZ_SCENE", event.bizScene,
+            "BIZ_STAGE", event.bizStage,
+            "STAGE_RES", event.stageRes,
+            "BIZ_STATE", event.bizState,
+            "HOST_NAME", event.hostName,
+            "HOST_PKG", event.hostPkg,
+            "LOCAL_UDID", localUdid,
+            "PEER_UDID", peerUdid,
+            "PEER_UDID_LIST", peerUdidList,
+            "TO_CALL_PKG", event.toCallPkg,
+            "EXTRA_INFO", event.extraInfo);
+    }
+    return HiSysEventWrite(
+        OHOS::HiviewDFX::HiSysEvent::Domain::DEVICE_PROFILE,
+        DP_DATA_OPERATE_BEHAVIOR,
+        HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+        "ORG_PKG", ORGPKG_NAME,
+        "FUNC", event.func,
+        "BIZ_SCENE", event.bizScene,
+        "BIZ_STAGE", event.bizStage,
+        "STAGE_RES", event.stageRes,
+        "BIZ_STATE", event.bizState,
+        "HOST_NAME", event.hostName,
+        "HOST_PKG", event.hostPkg,
+        "LOCAL_UDID", localUdid,
+        "PEER_UDID", peerUdid,
+        "PEER_UDID_LIST", peerUdidList,
+        "TO_CALL_PKG", event.toCallPkg,
+        "ERROR_CODE", event.errCode,
+        "EXTRA_INFO", event.extraInfo);
+}
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
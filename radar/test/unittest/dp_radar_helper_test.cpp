@@ -14,16 +14,24 @@
  */
 
 #include "dp_radar_helper_test.h"
+
+#include <mutex>
+#include <vector>
+
 #include "dp_radar_helper.h"
+#include "distributed_device_profile_errors.h"
 
 namespace OHOS {
 namespace DistributedDeviceProfile {
 void DpRadarHelperTest::SetUp()
 {
+    DpRadarHelper::GetInstance().SetEventSink(nullptr);
+    DpRadarHelper::GetInstance().Flush();
 }
 
 void DpRadarHelperTest::TearDown()
 {
+    DpRadarHelper::GetInstance().SetEventSink(nullptr);
 }
 
 void DpRadarHelperTest::SetUpTestCase()
@@ -317,5 +325,93 @@ HWTEST_F(DpRadarHelperTest, GetAnonyUdid_003, testing::ext::TestSize.Level0)
     std::string res = DpRadarHelper::GetInstance().GetAnonyUdid(udid);
     EXPECT_EQ(res, "12345**78910");
 }
+
+HWTEST_F(DpRadarHelperTest, EventSink_001, testing::ext::TestSize.Level0)
+{
+    std::mutex eventsMutex;
+    std::vector<RadarEvent> events;
+    DpRadarHelper::GetInstance().SetEventSink([&eventsMutex, &events](const RadarEvent& event) {
+        std::lock_guard<std::mutex> lock(eventsMutex);
+        if (event.func == "GetCharacteristicProfile") {
+            events.emplace_back(event);
+        }
+    });
+    CharacteristicProfile characteristicProfile;
+    const uint32_t succTimes = 100;
+    const uint32_t failTimes = 3;
+    for (uint32_t i = 0; i < succTimes; i++) {
+        DpRadarHelper::GetInstance().ReportGetCharProfile(DP_SUCCESS, "deviceId", characteristicProfile);
+    }
+    for (uint32_t i = 0; i < failTimes; i++) {
+        DpRadarHelper::GetInstance().ReportGetCharProfile(DP_INVALID_PARAMS, "deviceId", characteristicProfile);
+    }
+    DpRadarHelper::GetInstance().Flush();
+    DpRadarHelper::GetInstance().SetEventSink(nullptr);
+
+    uint32_t failCount = 0;
+    uint32_t succCount = 0;
+    uint32_t succEventCount = 0;
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    for (const auto& event : events) {
+        if (event.stageRes == static_cast<int32_t>(StageRes::STAGE_FAIL)) {
+            EXPECT_EQ(event.errCode, DP_INVALID_PARAMS);
+            failCount++;
+            continue;
+        }
+        succEventCount++;
+        succCount += event.succCount;
+    }
+    EXPECT_EQ(failCount, failTimes);
+    EXPECT_EQ(succEventCount, 1);
+    EXPECT_EQ(succCount, succTimes);
+}
+
+HWTEST_F(DpRadarHelperTest, EventSink_002, testing::ext::TestSize.Level0)
+{
+    std::mutex eventsMutex;
+    std::vector<RadarEvent> events;
+    DpRadarHelper::GetInstance().SetEventSink([&eventsMutex, &events](const RadarEvent& event) {
+        std::lock_guard<std::mutex> lock(eventsMutex);
+        if (event.stageRes == static_cast<int32_t>(StageRes::STAGE_FAIL)) {
+            events.emplace_back(event);
+        }
+    });
+    DpRadarHelper::GetInstance().ReportCheckDpSa(static_cast<int32_t>(StageRes::STAGE_FAIL));
+    DpRadarHelper::GetInstance().ReportLoadDpSa(static_cast<int32_t>(StageRes::STAGE_FAIL));
+    DpRadarHelper::GetInstance().Flush();
+    DpRadarHelper::GetInstance().SetEventSink(nullptr);
+
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    ASSERT_EQ(events.size(), 2);
+    for (const auto& event : events) {
+        BizState bizState = (event.func == "GetDeviceProfileService") ? BizState::BIZ_STATE_START :
+            BizState::BIZ_STATE_END;
+        EXPECT_EQ(event.bizState, static_cast<int32_t>(bizState));
+    }
+}
+
+HWTEST_F(DpRadarHelperTest, RadarEventRing_001, testing::ext::TestSize.Level0)
+{
+    RadarEventRing ring;
+    for (size_t i = 0; i < RADAR_RING_SIZE; i++) {
+        RadarEvent event;
+        event.errCode = static_cast<int32_t>(i);
+        EXPECT_TRUE(ring.Push(std::move(event)));
+    }
+    RadarEvent overflow;
+    EXPECT_FALSE(ring.Push(std::move(overflow)));
+
+    RadarEvent event;
+    EXPECT_TRUE(ring.Pop(event));
+    EXPECT_EQ(event.errCode, 0);
+    RadarEvent again;
+    EXPECT_TRUE(ring.Push(std::move(again)));
+    size_t popCount = 0;
+    while (ring.Pop(event)) {
+        popCount++;
+    }
+    EXPECT_EQ(popCount, RADAR_RING_SIZE);
+    EXPECT_TRUE(ring.Empty());
+}
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
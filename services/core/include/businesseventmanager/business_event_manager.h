@@ -17,12 +17,14 @@
 #define OHOS_DP_BUSINESS_EVENT_MANAGER_H
 
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
 
 #include "business_event.h"
 #include "business_event_adapter.h"
 #include "distributed_device_profile_constants.h"
+#include "ikv_adapter.h"
 #include "single_instance.h"
 
 namespace OHOS {
@@ -36,10 +38,16 @@ public:
     int32_t GetBusinessEvent(BusinessEvent& event);
 private:
     bool IsValidKey(const std::string& key);
+    void LoadBusinessEvents();
 
 private:
-    std::shared_ptr<BusinessEventAdapter> businessEventAdapter_ = nullptr;
+    // a write behind buffer over the BusinessEventAdapter, repeated puts within a window are written once
+    std::shared_ptr<IKVAdapter> businessEventAdapter_ = nullptr;
+    // serialises writes to the store and to events_, reads only take eventMutex_
     std::mutex dynamicStoreMutex_;
+    std::mutex eventMutex_;
+    // the events as last put, the store is local only so nothing else changes it
+    std::map<std::string, std::string> events_;
 };
 } // DistributedDeviceProfile
 } // OHOS
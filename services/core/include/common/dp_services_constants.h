@@ -50,8 +50,16 @@ extern const std::string SERVICE_INFO_DATABASE_NAME;
 extern const std::string CREATE_DEVICE_ICON_INFO_TABLE_SQL ;
 extern const std::string CREATE_DEVICE_ICON_INFO_TABLE_UNIQUE_INDEX_SQL;
 extern const std::string SELECT_DEVICE_ICON_INFO_TABLE;
+extern const std::string SELECT_DEVICE_ICON_INFO_META_TABLE;
+extern const std::string SELECT_DEVICE_ICON_INFO_META_BY_UNIQUE_KEY;
+extern const std::string SELECT_DEVICE_ICON_INFO_HASH_BY_ID;
 extern const std::string ALTER_TABLE_DEVICE_ICON_INFO_ADD_COLUMN_INTENAL_MODEL_SQL;
 extern const std::string ALTER_TABLE_DEVICE_ICON_INFO_ADD_COLUMN_MODIFY_TIME_SQL;
+extern const std::string ALTER_TABLE_DEVICE_ICON_INFO_ADD_COLUMN_ICON_HASH_SQL;
+extern const std::string CREATE_DEVICE_ICON_BLOB_TABLE_SQL;
+extern const std::string SELECT_DEVICE_ICON_BLOB_REF_COUNT;
+extern const std::string SELECT_DEVICE_ICON_BLOB_BY_HASH;
+extern const std::string ICON_HASH_EQUAL_CONDITION;
 // ProductInfoDao
 extern const std::string CREATE_PRODUCT_INFO_TABLE_SQL;
 extern const std::string SELECT_PRODUCT_INFO_TABLE;
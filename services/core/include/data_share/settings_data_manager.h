@@ -17,9 +17,11 @@
 
 #include <string>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
 
+#include "data_ability_observer_stub.h"
 #include "datashare_helper.h"
 
 #include "single_instance.h"
@@ -37,20 +39,60 @@ public:
     int32_t GetDisplayDeviceName(int32_t userId, std::string &deviceName);
     int32_t SetDisplayDeviceName(const std::string &deviceName, int32_t userId);
     int32_t GetDeviceName(std::string &deviceName);
+    void OnSettingsDataChange(const std::string &cacheKey);
+    // Releases the pooled helpers that have been idle for longer than the expiry, or all of them.
+    void ReleaseIdleHelpers(bool releaseAll);
+
 private:
+    struct HelperEntry {
+        std::shared_ptr<DataShare::DataShareHelper> helper = nullptr;
+        int64_t lastUsedMs = 0;
+        // cacheKey -> observer registered through this helper
+        std::map<std::string, sptr<AAFwk::IDataAbilityObserver>> observers;
+    };
+
     int32_t GetValue(const std::string &tableName, int32_t userId, const std::string &key, std::string &value);
     int32_t SetValue(const std::string &tableName, int32_t userId, const std::string &key, const std::string &value);
 
     std::string GetProxyUriStr(const std::string &tableName, int32_t userId);
     std::shared_ptr<DataShare::DataShareHelper> CreateDataShareHelper(const std::string &proxyUri);
+    std::shared_ptr<DataShare::DataShareHelper> AcquireDataShareHelper(const std::string &proxyUri);
+    void DiscardDataShareHelper(const std::string &proxyUri, std::shared_ptr<DataShare::DataShareHelper> helper);
+    void ReleaseHelperEntry(HelperEntry &entry);
+    bool RegisterValueObserver(const std::string &proxyUri, const std::string &key);
+    void PostIdleCheck();
     Uri MakeUri(const std::string &proxyUri, const std::string &key);
     bool ReleaseDataShareHelper(std::shared_ptr<DataShare::DataShareHelper> helper);
 
+    bool GetCachedValue(const std::string &cacheKey, std::string &value);
+    void PutCachedValue(const std::string &cacheKey, const std::string &value, uint64_t cacheVersion);
+    void InvalidateCachedValues(const std::string &cacheKeyPrefix);
+    uint64_t GetCacheVersion();
+    static bool IsCachedKey(const std::string &key);
+
     sptr<IRemoteObject> GetRemoteObj();
 
 private:
     std::mutex remoteObjMtx_;
     sptr<IRemoteObject> remoteObj_;
+    // proxyUri -> pooled helper, the proxy uri already identifies the table and the user
+    std::mutex helperPoolMtx_;
+    std::map<std::string, HelperEntry> helperPool_;
+    bool idleCheckPosted_ = false;
+    // MakeUri string -> value, only for the device name keys
+    std::mutex valueCacheMtx_;
+    std::map<std::string, std::string> valueCache_;
+    uint64_t cacheVersion_ = 0;
+};
+
+class SettingsDataObserver : public AAFwk::DataAbilityObserverStub {
+public:
+    explicit SettingsDataObserver(const std::string &cacheKey);
+    ~SettingsDataObserver() override = default;
+    void OnChange() override;
+
+private:
+    std::string cacheKey_;
 };
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
@@ -37,6 +37,7 @@
 #include "kv_sync_completed_listener.h"
 #include "service_profile.h"
 #include "single_instance.h"
+#include "sync_scheduler.h"
 #include "trusted_device_info.h"
 
 namespace OHOS {
@@ -58,6 +59,8 @@ public:
         ServiceProfile& serviceProfile);
     int32_t GetCharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
         const std::string& characteristicKey, CharacteristicProfile& charProfile);
+    int32_t GetCharacteristicProfileBatch(const std::vector<CharacteristicProfile>& queries,
+        std::vector<CharacteristicProfile>& charProfiles, std::vector<int32_t>& results);
     int32_t DeleteServiceProfile(const std::string& deviceId, const std::string& serviceName, bool isMultiUser = false,
         int32_t userId = DEFAULT_USER_ID);
     int32_t DeleteCharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
@@ -74,6 +77,7 @@ public:
     void ResetFirst();
     void OnDeviceOnline(const TrustedDeviceInfo& trustedDeviceInfo);
     void OnUserChange(int32_t lastUserId, int32_t curUserId);
+    void OnSyncCompleted(const SyncResult& syncResults);
 
 private:
     bool LoadDpSyncAdapter();
@@ -106,6 +110,7 @@ private:
     bool IsSameAccount(const std::string deviceId, const int32_t userId);
     bool HasTrustP2PRelation(const std::string deviceId, const int32_t userId);
     bool IsDeviceE2ESync();
+    std::shared_ptr<SyncScheduler> GetSyncScheduler();
     bool isAdapterSoLoaded_ = false;
     std::mutex isAdapterLoadLock_;
     std::mutex dynamicStoreMutex_;
@@ -114,6 +119,8 @@ private:
     std::atomic<bool> isFirst_{true};
     std::mutex putTempCacheMutex_;
     std::map<std::string, std::string> putTempCache_;
+    std::mutex syncSchedulerMutex_;
+    std::shared_ptr<SyncScheduler> syncScheduler_ = nullptr;
 };
 } // namespace DeviceProfile
 } // namespace OHOS
@@ -68,12 +68,13 @@ public:
     void EraseSwitchCacheMap(const std::string& netWorkId);
 
 private:
-    int32_t GenerateSwitchNotify(const std::string& udid, const std::string& serviceName,
-        const std::string& characteristicProfileKey, const std::string& characteristicProfileValue,
-        ChangeType changeType);
+    // returns the bits that differ from the last switch seen for udid, all bits the first time
+    uint32_t ExchangeLastSwitch(const std::string& udid, uint32_t switchValue, bool& isFirstSwitch);
 
     std::mutex switchCacheMapMutex_;
     std::map<std::string, uint32_t> switchCacheMap_;
+    std::mutex lastSwitchMapMutex_;
+    std::map<std::string, uint32_t> lastSwitchMap_;
 };
 } // namespace DeviceProfile
 } // namespace OHOS
@@ -16,6 +16,12 @@
 #ifndef OHOS_DP_STATIC_PROFILE_MANAGER_H
 #define OHOS_DP_STATIC_PROFILE_MANAGER_H
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 #include "dm_device_info.h"
 #include "iremote_object.h"
 
@@ -23,6 +29,7 @@
 #include "dp_sync_options.h"
 #include "kv_adapter.h"
 #include "single_instance.h"
+#include "sync_scheduler.h"
 #include "trusted_device_info.h"
 
 namespace OHOS {
@@ -40,20 +47,36 @@ public:
     int32_t GetAllCharacteristicProfile(std::vector<CharacteristicProfile>& staticCapabilityProfiles);
     void E2ESyncStaticProfile(const TrustedDeviceInfo& deviceInfo);
     int32_t SyncStaticProfile(const DpSyncOptions& syncOptions, sptr<IRemoteObject> syncCompletedCallback);
-    void GetSyncListeners(std::map<std::string, sptr<IRemoteObject>>& syncListeners);
-    void RemoveSyncListeners(std::map<std::string, sptr<IRemoteObject>> syncListeners);
+    void OnSyncCompleted(const SyncResult& syncResults);
 
 private:
+    // serviceName -> static info charValue, generated once per static capability version and value
+    struct StaticInfoIndex {
+        std::unordered_map<std::string, std::string> charValues;
+    };
+    struct DeviceStaticInfo {
+        std::string staticCapabilityCharValue;
+        std::shared_ptr<const StaticInfoIndex> index = nullptr;
+    };
+
     int32_t GenerateStaticInfoProfile(const CharacteristicProfile& staticCapabilityProfile,
         std::unordered_map<std::string, CharacteristicProfile>& staticInfoProfiles);
-    int32_t AddSyncListener(const std::string& caller, sptr<IRemoteObject> syncListener);
+    int32_t ParseStaticCapability(const std::string& charValue, std::string& staticCapabilityVersion,
+        std::string& staticCapabilityValue);
+    int32_t GetStaticInfoIndex(const CharacteristicProfile& staticCapabilityProfile,
+        std::shared_ptr<const StaticInfoIndex>& index);
+    void ClearStaticInfoIndex();
+    std::shared_ptr<SyncScheduler> GetSyncScheduler();
 
 private:
     std::mutex staticStoreMutex_;
     std::shared_ptr<IKVAdapter> staticProfileStore_ = nullptr;
-    std::mutex syncListenerMapMutex_;
-    std::map<std::string, sptr<IRemoteObject>> syncListenerMap_;
-    sptr<IRemoteObject::DeathRecipient> syncListenerDeathRecipient_ = nullptr;
+    std::mutex syncSchedulerMutex_;
+    std::shared_ptr<SyncScheduler> syncScheduler_ = nullptr;
+    std::mutex staticInfoIndexMutex_;
+    // keyed by staticCapabilityVersion + "#" + staticCapabilityValue, shared by peers with the same capability
+    std::map<std::string, std::shared_ptr<const StaticInfoIndex>> staticInfoIndexes_;
+    std::unordered_map<std::string, DeviceStaticInfo> deviceStaticInfos_;
 };
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DP_SYNC_SCHEDULER_H
+#define OHOS_DP_SYNC_SCHEDULER_H
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "iremote_object.h"
+
+#include "distributed_device_profile_enums.h"
+#include "i_sync_completed_callback.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+constexpr uint32_t DEFAULT_MAX_IN_FLIGHT_SYNC = 4;
+constexpr int64_t DEFAULT_SYNC_TIMEOUT_MS = 30000;
+
+// Serialises kv syncs per peer: a request for a peer that is already queued is merged into the
+// queued one, a request for a peer that is syncing queues a single follow-up sync, and at most
+// maxInFlight peers sync at the same time. Every merged callback is answered from one completion.
+class SyncScheduler : public std::enable_shared_from_this<SyncScheduler> {
+public:
+    using SyncFunc = std::function<int32_t(const std::vector<std::string>& deviceIds, SyncMode syncMode)>;
+
+    SyncScheduler(const std::string& name, SyncFunc syncFunc, uint32_t maxInFlight = DEFAULT_MAX_IN_FLIGHT_SYNC,
+        int64_t timeoutMs = DEFAULT_SYNC_TIMEOUT_MS);
+    ~SyncScheduler() = default;
+
+    // syncCompletedCallback may be nullptr when nobody waits for the result.
+    int32_t Schedule(const std::vector<std::string>& deviceIds, SyncMode syncMode,
+        sptr<IRemoteObject> syncCompletedCallback);
+    void OnSyncCompleted(const SyncResult& syncResults);
+    // Fails the syncs that have been in flight for longer than the timeout.
+    void CheckTimeout();
+    // Fails everything in flight or queued, used when the kv store goes away.
+    void Reset();
+    uint32_t GetInFlightCount();
+    // Number of peers with a sync waiting to start, including follow-ups behind an in flight one.
+    size_t GetQueuedCount();
+
+private:
+    struct SyncWaiter {
+        sptr<IRemoteObject> callback = nullptr;
+        std::set<std::string> remaining;
+        SyncResult results;
+    };
+    struct DeviceSyncState {
+        bool inFlight = false;
+        int64_t dispatchTimeMs = 0;
+        std::vector<std::shared_ptr<SyncWaiter>> inFlightWaiters;
+        bool queued = false;
+        SyncMode queuedMode = SyncMode::MIN;
+        std::vector<std::shared_ptr<SyncWaiter>> queuedWaiters;
+    };
+
+    void Dispatch();
+    void FinishLocked(const std::string& deviceId, SyncStatus status,
+        std::vector<std::shared_ptr<SyncWaiter>>& doneWaiters);
+    void NotifyWaiters(const std::vector<std::shared_ptr<SyncWaiter>>& doneWaiters);
+    void PostTimeoutCheck();
+    static SyncMode MergeSyncMode(SyncMode queuedMode, SyncMode syncMode);
+
+private:
+    std::string name_;
+    SyncFunc syncFunc_;
+    uint32_t maxInFlight_ = DEFAULT_MAX_IN_FLIGHT_SYNC;
+    int64_t timeoutMs_ = DEFAULT_SYNC_TIMEOUT_MS;
+    std::mutex schedulerMutex_;
+    std::map<std::string, DeviceSyncState> devices_;
+    // devices that are queued and not in flight, in request order
+    std::deque<std::string> readyQueue_;
+    uint32_t inFlightCount_ = 0;
+    bool timeoutCheckPosted_ = false;
+};
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
+#endif // OHOS_DP_SYNC_SCHEDULER_H
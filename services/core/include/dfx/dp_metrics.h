@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DP_METRICS_H
+#define OHOS_DP_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "dp_ipc_interface_code.h"
+#include "single_instance.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+enum class DpMetricsTimer : int32_t {
+    RDB_PUT = 0,
+    RDB_DELETE,
+    RDB_UPDATE,
+    RDB_GET,
+    KV_PUT,
+    KV_PUT_BATCH,
+    KV_DELETE,
+    KV_DELETE_BATCH,
+    KV_GET,
+    KV_GET_BY_PREFIX,
+    KV_DELETE_BY_PREFIX,
+    // time a task spent queued in the shared event handler before it ran
+    EVENT_TASK_WAIT,
+    EVENT_TASK_RUN,
+    NOTIFY_PROFILE_CHANGE,
+    NOTIFY_TRUST_PROFILE_CHANGE,
+    MAX_TIMER
+};
+
+enum class DpMetricsCounter : int32_t {
+    PROFILE_CACHE_HIT = 0,
+    PROFILE_CACHE_MISS,
+    EVENT_TASK_POST_FAILED,
+    DATASHARE_HELPER_CREATED,
+    SETTINGS_CACHE_HIT,
+    SETTINGS_CACHE_MISS,
+    // puts absorbed by a newer put of the same key before the write-behind flush
+    KV_WRITE_COALESCED,
+    KV_GROUP_COMMIT,
+    MAX_COUNTER
+};
+
+constexpr size_t METRICS_BUCKET_SIZE = 10;
+constexpr int64_t IPC_SUMMARY_INTERVAL_US = 60 * 1000 * 1000;
+// upper bounds in microseconds, the last bucket holds everything above the previous bound
+constexpr std::array<int64_t, METRICS_BUCKET_SIZE - 1> METRICS_BUCKET_BOUNDS_US = {
+    100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000
+};
+
+class LatencyHistogram {
+public:
+    void Record(int64_t costUs);
+    void Reset();
+    uint64_t GetCount() const;
+    // Appends one line, nothing when no sample was recorded.
+    void Dump(const std::string& name, std::string& result) const;
+
+private:
+    int64_t GetPercentileUs(uint64_t total, uint32_t percent) const;
+
+private:
+    std::array<std::atomic<uint64_t>, METRICS_BUCKET_SIZE> buckets_ {};
+    std::atomic<uint64_t> count_ {0};
+    std::atomic<uint64_t> totalUs_ {0};
+    std::atomic<int64_t> maxUs_ {0};
+};
+
+class DpMetrics {
+    DECLARE_SINGLE_INSTANCE(DpMetrics);
+
+public:
+    static int64_t GetNowUs();
+    void RecordIpc(uint32_t code, int64_t costUs);
+    void RecordTimer(DpMetricsTimer timer, int64_t costUs);
+    void IncreaseCounter(DpMetricsCounter counter);
+    uint64_t GetCounter(DpMetricsCounter counter) const;
+    void OnTaskPosted();
+    void OnTaskDropped();
+    void OnTaskStart(int64_t postTimeUs);
+    void OnTaskEnd(int64_t startTimeUs);
+    int64_t GetQueueDepth() const;
+    void Dump(std::string& result);
+    void Reset();
+    // Every IPC_SUMMARY_INTERVAL_US one INFO line lists the calls per code since the previous line.
+    void SetIpcSummaryEnabled(bool enabled);
+
+private:
+    void LogIpcSummary(int64_t intervalUs);
+
+    static constexpr size_t IPC_CODE_SIZE = static_cast<size_t>(DpIpcInterfaceCode::MAX);
+    static constexpr size_t TIMER_SIZE = static_cast<size_t>(DpMetricsTimer::MAX_TIMER);
+    static constexpr size_t COUNTER_SIZE = static_cast<size_t>(DpMetricsCounter::MAX_COUNTER);
+
+    // index IPC_CODE_SIZE collects codes out of the known range
+    std::array<LatencyHistogram, IPC_CODE_SIZE + 1> ipcHistograms_;
+    std::array<LatencyHistogram, TIMER_SIZE> timerHistograms_;
+    std::array<std::atomic<uint64_t>, COUNTER_SIZE> counters_ {};
+    std::atomic<int64_t> queueDepth_ {0};
+    std::atomic<int64_t> maxQueueDepth_ {0};
+    std::atomic<int64_t> startTimeUs_ {0};
+    std::atomic<bool> ipcSummaryEnabled_ {true};
+    std::atomic<int64_t> lastIpcSummaryUs_ {0};
+    // only touched by the caller that moved lastIpcSummaryUs_
+    std::array<uint64_t, IPC_CODE_SIZE + 1> lastIpcCounts_ {};
+};
+
+class DpMetricsScope {
+public:
+    explicit DpMetricsScope(DpMetricsTimer timer);
+    ~DpMetricsScope();
+
+private:
+    DpMetricsTimer timer_;
+    int64_t startTimeUs_ = 0;
+};
+
+class DpIpcMetricsScope {
+public:
+    explicit DpIpcMetricsScope(uint32_t code);
+    ~DpIpcMetricsScope();
+
+private:
+    uint32_t code_ = 0;
+    int64_t startTimeUs_ = 0;
+};
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
+#endif // OHOS_DP_METRICS_H
@@ -25,6 +25,7 @@
 #include "device_profile_filter_options.h"
 #include "distributed_device_profile_stub_new.h"
 #include "dp_account_common_event.h"
+#include "dp_memory_manager.h"
 #include "event_handler.h"
 #include "event_runner.h"
 #include "i_dp_inited_callback.h"
@@ -58,6 +59,8 @@ public:
     int32_t GetAllTrustDeviceProfile(std::vector<TrustDeviceProfile>& trustDeviceProfiles) override;
     int32_t GetAccessControlProfile(std::map<std::string, std::string> queryParams,
         std::vector<AccessControlProfile>& accessControlProfiles) override;
+    int32_t GetAccessControlProfileBatch(const std::vector<std::map<std::string, std::string>>& queryParamsList,
+        std::vector<std::vector<AccessControlProfile>>& aclProfilesList, std::vector<int32_t>& results) override;
     int32_t GetAllAccessControlProfile(std::vector<AccessControlProfile>& accessControlProfiles) override;
     int32_t GetAllAclIncludeLnnAcl(std::vector<AccessControlProfile>& accessControlProfiles) override;
     int32_t DeleteAccessControlProfile(int32_t accessControlId) override;
@@ -78,6 +81,8 @@ public:
         ServiceProfile& serviceProfile) override;
     int32_t GetCharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
         const std::string& characteristicKey, CharacteristicProfile& charProfile) override;
+    int32_t GetCharacteristicProfileBatch(const std::vector<CharacteristicProfile>& queries,
+        std::vector<CharacteristicProfile>& charProfiles, std::vector<int32_t>& results) override;
     int32_t DeleteServiceProfile(const std::string& deviceId, const std::string& serviceName, bool isMultiUser = false,
         int32_t userId = DEFAULT_USER_ID) override;
     int32_t DeleteCharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
@@ -143,6 +148,7 @@ private:
     int32_t NotifyBusinessEvent(const BusinessEvent& event);
     void GetDynamicProfilesFromTempCache(std::map<std::string, std::string>& entries);
     void ClearProfileCache();
+    DpCacheUsage GetTempCacheUsage();
     int32_t UnInitNext();
     int32_t PutCharacteristicProfileBatchPreprocess(const std::vector<CharacteristicProfile>& charProfiles);
 #ifdef WATCH_SUPPORT
@@ -39,6 +39,7 @@ public:
     int32_t GetTrustDeviceProfileInner(MessageParcel& data, MessageParcel& reply);
     int32_t GetAllTrustDeviceProfileInner(MessageParcel& data, MessageParcel& reply);
     int32_t GetAccessControlProfileInner(MessageParcel& data, MessageParcel& reply);
+    int32_t GetAccessControlProfileBatchInner(MessageParcel& data, MessageParcel& reply);
     int32_t GetAllAccessControlProfileInner(MessageParcel& data, MessageParcel& reply);
     int32_t GetAllAclIncludeLnnAclInner(MessageParcel& data, MessageParcel& reply);
     int32_t DeleteAccessControlProfileInner(MessageParcel& data, MessageParcel& reply);
@@ -55,6 +56,7 @@ public:
     int32_t GetDeviceProfileInner(MessageParcel& data, MessageParcel& reply);
     int32_t GetServiceProfileInner(MessageParcel& data, MessageParcel& reply);
     int32_t GetCharacteristicProfileInner(MessageParcel& data, MessageParcel& reply);
+    int32_t GetCharacteristicProfileBatchInner(MessageParcel& data, MessageParcel& reply);
     int32_t DeleteServiceProfileInner(MessageParcel& data, MessageParcel& reply);
     int32_t DeleteCharacteristicProfileInner(MessageParcel& data, MessageParcel& reply);
     int32_t SubscribeDeviceProfileInner(MessageParcel& data, MessageParcel& reply);
@@ -17,9 +17,12 @@
 #define OHOS_DP_LOCAL_SERVICE_INFO_MANAGER_H
 
 #include <cstdint>
+#include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "kvstore_observer.h"
@@ -43,12 +46,34 @@ public:
         int32_t pinExchangeType, LocalServiceInfo& localServiceInfo);
     int32_t DeleteLocalServiceInfo(const std::string& bundleName, int32_t pinExchangeType);
 private:
+    using LocalServiceInfoCacheKey = std::pair<std::string, int32_t>;
+    struct LocalServiceInfoCacheEntry {
+        // false caches a lookup that found no row
+        bool isExist = false;
+        LocalServiceInfo localServiceInfo;
+        std::list<LocalServiceInfoCacheKey>::iterator lruIter;
+    };
+
     int32_t ConvertToLocalServiceInfo(std::shared_ptr<ResultSet> resultSet, LocalServiceInfo& localServiceInfo);
     int32_t LocalServiceInfoToEntries(const LocalServiceInfo& localServiceInfo, ValuesBucket& values);
     int32_t CreateTable();
     int32_t CreateIndex();
+    int32_t QueryLocalServiceInfo(const std::string& bundleName, int32_t pinExchangeType,
+        LocalServiceInfo& localServiceInfo);
+    bool GetLocalServiceInfoFromCache(const LocalServiceInfoCacheKey& cacheKey, int32_t& ret,
+        LocalServiceInfo& localServiceInfo);
+    void PutLocalServiceInfoToCache(const LocalServiceInfoCacheKey& cacheKey, uint64_t generation, int32_t ret,
+        const LocalServiceInfo& localServiceInfo);
+    void RemoveLocalServiceInfoFromCache(const LocalServiceInfoCacheKey& cacheKey);
+    void ClearLocalServiceInfoCache();
 
 private:
+    std::mutex cacheMutex_;
+    // most recently used at the front
+    std::list<LocalServiceInfoCacheKey> cacheLru_;
+    std::map<LocalServiceInfoCacheKey, LocalServiceInfoCacheEntry> cache_;
+    // bumped by every write, a query that started before a write does not fill the cache
+    uint64_t cacheGeneration_ = 0;
 };
 } // DistributedDeviceProfile
 } // OHOS
@@ -16,11 +16,13 @@
 #ifndef OHOS_DP_PERMISSION_MANAGER_H
 #define OHOS_DP_PERMISSION_MANAGER_H
 
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_set>
 #include <unordered_map>
 #include "cJSON.h"
+#include "perm_state_change_callback_customize.h"
 #include "single_instance.h"
 
 namespace OHOS {
@@ -35,9 +37,36 @@ public:
     bool CheckCallerPermission();
     bool CheckCallerSyncPermission();
     std::string GetCallerProcName();
+    void InvalidateCallerCache(uint32_t tokenId);
+    void ClearCallerCache();
 
 private:
-    bool CheckInterfacePermission(const std::string& interfaceName);
+    class DpPermStateChangeCallback : public Security::AccessToken::PermStateChangeCallbackCustomize {
+    public:
+        explicit DpPermStateChangeCallback(const Security::AccessToken::PermStateChangeScope& scope)
+            : PermStateChangeCallbackCustomize(scope) {}
+        void PermStateChangeCallback(Security::AccessToken::PermStateChangeInfo& result) override;
+    };
+
+    struct CallerDecision {
+        bool result = false;
+        int64_t expireTimeMs = 0;
+    };
+
+    struct CallerProcName {
+        std::string procName;
+        int64_t expireTimeMs = 0;
+    };
+
+    bool CheckCallerAccessPermission(const std::string& permissionName);
+    // isDecided is false when the token could not be looked up, such a deny must not be cached
+    bool CheckTrustedCaller(uint32_t tokenId, const std::string& interfaceName, bool& isDecided);
+    bool GetCachedDecision(uint32_t tokenId, const std::string& decisionName, bool& result);
+    void PutCachedDecision(uint32_t tokenId, const std::string& decisionName, bool result);
+    bool GetCallerProcName(uint32_t tokenId, std::string& procName);
+    void RegisterPermStateChangeCallback();
+    void UnRegisterPermStateChangeCallback();
+    bool CheckInterfacePermission(uint32_t tokenId, const std::string& interfaceName, bool& isDecided);
     int32_t LoadPermissionCfg(const std::string& filePath);
     int32_t ParsePermissionJson(const cJSON* const permissionJson);
     void SetRdbPermissionMap(const cJSON* const permissionJson);
@@ -47,6 +76,11 @@ private:
 private:
     std::mutex permissionMutex_;
     std::unordered_map<std::string, std::unordered_set<std::string>> permissionMap_;
+    std::mutex callerCacheMutex_;
+    // The key is tokenId#interfaceName or tokenId#permissionName, the value is the last decision
+    std::unordered_map<std::string, CallerDecision> decisionCache_;
+    std::unordered_map<uint32_t, CallerProcName> procNameCache_;
+    std::shared_ptr<DpPermStateChangeCallback> permStateChangeCallback_ = nullptr;
 };
 } // namespace DeviceProfile
 } // namespace OHOS
@@ -34,6 +34,9 @@ class ServiceInfoKvAdapter : public DistributedDeviceProfile::IKVAdapter {
 public:
     ServiceInfoKvAdapter(
         const std::shared_ptr<DistributedKv::KvStoreDeathRecipient> &deathListener, DistributedKv::DataType dataType);
+    // a local store of the same kind under another store id
+    ServiceInfoKvAdapter(const std::shared_ptr<DistributedKv::KvStoreDeathRecipient> &deathListener,
+        DistributedKv::DataType dataType, const std::string& storeId);
 
     int32_t Init() override;
     int32_t UnInit() override;
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DP_WRITE_BEHIND_KV_ADAPTER_H
+#define OHOS_DP_WRITE_BEHIND_KV_ADAPTER_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ikv_adapter.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+constexpr int64_t DEFAULT_WRITE_BEHIND_WINDOW_MS = 100;
+constexpr size_t DEFAULT_WRITE_BEHIND_MAX_PENDING = 128;
+
+// Buffers Put and PutBatch in front of another kv adapter. Puts of the same key within windowMs
+// collapse into one entry and the buffer is written with a single PutBatch when the window ends,
+// when it holds maxPending keys, or before anything that must see the store: deletes, Sync,
+// GetDeviceEntries, RemoveDeviceData and UnInit. Reads are served from the buffer first.
+// A failed flush keeps the entries buffered and retries with the next window.
+class WriteBehindKvAdapter : public IKVAdapter, public std::enable_shared_from_this<WriteBehindKvAdapter> {
+public:
+    WriteBehindKvAdapter(const std::string& name, std::shared_ptr<IKVAdapter> kvStore,
+        int64_t windowMs = DEFAULT_WRITE_BEHIND_WINDOW_MS, size_t maxPending = DEFAULT_WRITE_BEHIND_MAX_PENDING);
+    ~WriteBehindKvAdapter() override;
+
+    int32_t Init() override;
+    int32_t UnInit() override;
+    int32_t Put(const std::string& key, const std::string& value) override;
+    int32_t PutBatch(const std::map<std::string, std::string>& values) override;
+    int32_t Delete(const std::string& key) override;
+    int32_t DeleteByPrefix(const std::string& keyPrefix) override;
+    int32_t Get(const std::string& key, std::string& value) override;
+    int32_t GetByPrefix(const std::string& keyPrefix, std::map<std::string, std::string>& values) override;
+    int32_t Sync(const std::vector<std::string>& deviceList, SyncMode syncMode) override;
+    int32_t GetDeviceEntries(const std::string& udid, std::map<std::string, std::string>& values) override;
+    int32_t DeleteBatch(const std::vector<std::string>& keys) override;
+    int32_t RemoveDeviceData(const std::string& uuid) override;
+    int32_t Flush();
+    size_t GetPendingCount();
+
+private:
+    int32_t FlushLocked();
+    void FlushBeforeLocked(const std::string& operation);
+    bool PostFlushTask();
+    void ErasePendingByPrefix(const std::string& keyPrefix);
+
+private:
+    std::string name_;
+    std::shared_ptr<IKVAdapter> kvStore_ = nullptr;
+    int64_t windowMs_ = DEFAULT_WRITE_BEHIND_WINDOW_MS;
+    size_t maxPending_ = DEFAULT_WRITE_BEHIND_MAX_PENDING;
+    // serialises flushes with the operations that must run against a flushed store
+    std::mutex flushMutex_;
+    std::mutex pendingMutex_;
+    std::map<std::string, std::string> pending_;
+    // entries handed to the store by the running flush, still visible to reads until it returns
+    std::map<std::string, std::string> flushing_;
+    bool flushPosted_ = false;
+};
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
+#endif // OHOS_DP_WRITE_BEHIND_KV_ADAPTER_H
@@ -16,7 +16,8 @@
 #ifndef OHOS_DP_PROFILE_DATA_RDB_ADAPTER_H
 #define OHOS_DP_PROFILE_DATA_RDB_ADAPTER_H
 
-
+#include <functional>
+#include <mutex>
 #include <set>
 #include "dp_services_constants.h"
 #include "irdb_adapter.h"
@@ -37,12 +38,15 @@ public:
         const std::string& whereClause, const std::vector<ValueObject>& bindArgs = {}) override;
     int32_t CreateTable(const std::string& sql) override;
     std::shared_ptr <ResultSet> Get(const std::string& sql, const std::vector<ValueObject>& args = {}) override;
+    // the writes of func apply together, or not at all when it fails; other callers wait until it returns
+    int32_t ExecuteInTransaction(const std::function<int32_t()>& func);
     int32_t GetRDBPtr();
     bool IsInit();
 
 private:
     std::shared_ptr<RdbStore> store_ = nullptr;
-    std::mutex ProfileDataRdbAdapterMtx_;
+    // recursive, func of ExecuteInTransaction calls back into the adapter
+    std::recursive_mutex ProfileDataRdbAdapterMtx_;
 };
 
 class ProfileDataOpenCallback : public NativeRdb::RdbOpenCallback {
@@ -53,6 +57,7 @@ private:
     int32_t CheckAndAlterTable(RdbStore& store, const RdbTableAlterInfo& info);
     int32_t UpdateFromVer1To2(RdbStore& store);
     int32_t UpdateToVer3(RdbStore& store);
+    int32_t UpdateToVer4(RdbStore& store);
 };
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
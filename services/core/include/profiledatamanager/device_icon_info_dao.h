@@ -40,15 +40,36 @@ public:
     int32_t PutDeviceIconInfo(const DeviceIconInfo& deviceIconInfo);
     int32_t GetDeviceIconInfos(const DeviceIconInfoFilterOptions& filterOptions,
         std::vector<DeviceIconInfo>& deviceIconInfos);
+    // looks up the row of the unique (productId, subProductId, imageType, specName) key without the icon blob
+    int32_t GetDeviceIconInfoMeta(const DeviceIconInfo& deviceIconInfo, DeviceIconInfo& meta);
     int32_t DeleteDeviceIconInfo(const DeviceIconInfo& deviceIconInfo);
     int32_t UpdateDeviceIconInfo(const DeviceIconInfo& deviceIconInfo);
     int32_t CreateTable();
     int32_t CreateIndex();
     bool CreateQuerySqlAndCondition(const DeviceIconInfoFilterOptions& filterOptions,
         std::string& sql, std::vector<ValueObject>& condition);
+    bool CreateQuerySqlAndCondition(const DeviceIconInfoFilterOptions& filterOptions, const std::string& selectSql,
+        std::string& sql, std::vector<ValueObject>& condition);
     int32_t DeviceIconInfoToEntries(const DeviceIconInfo& deviceIconInfo, ValuesBucket& values);
-    int32_t ConvertToDeviceIconInfo(std::shared_ptr<ResultSet> resultSet, DeviceIconInfo& deviceIconInfo);
+    int32_t ConvertToDeviceIconInfo(std::shared_ptr<ResultSet> resultSet, DeviceIconInfo& deviceIconInfo,
+        bool withIcon = true);
+    // key of the icon in the blob table, empty for an empty icon
+    static std::string GetIconHash(const std::vector<uint8_t>& icon);
 private:
+    int32_t QueryDeviceIconInfos(const std::string& sql, const std::vector<ValueObject>& condition, bool withIcon,
+        std::vector<DeviceIconInfo>& deviceIconInfos);
+    // the blob helpers run in the transaction of the device_icon_info write they belong to
+    // iconHash is the hash of icon on the way in and the key of the row holding icon on the way out, or a free
+    // key with isFound false; rows of another icon with the same hash are skipped
+    int32_t FindIconBlob(const std::vector<uint8_t>& icon, std::string& iconHash, int32_t& refCount,
+        bool& isFound);
+    // takes one more reference on the row FindIconBlob returned, inserts it when it was not found
+    int32_t AcquireIconBlob(const std::vector<uint8_t>& icon, const std::string& iconHash, int32_t refCount,
+        bool isFound);
+    int32_t ReleaseIconBlob(const std::string& iconHash);
+    int32_t GetIconBlobRefCount(const std::string& iconHash, int32_t& refCount);
+    int32_t GetIconHashById(int32_t id, std::string& iconHash);
+
     std::mutex rdbMutex_;
 };
 } // DistributedDeviceProfile
@@ -17,6 +17,7 @@
 #define OHOS_DP_SERVICE_INFO_MANAGER_H
 
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
 
@@ -65,6 +66,8 @@ public:
     bool ParseAndValidateJSON(cJSON* jsonObj, ParsedJSONFields& fields);
     void FillServiceInfo(const ParsedJSONFields& fields, ServiceInfo& serviceInfo);
     int32_t DeleteSyncServiceInfo(std::vector<std::string> matchedKeys);
+    // reads both the binary encoding and the json one written before it
+    int32_t DecodeServiceInfo(const std::string& key, const std::string& value, ServiceInfo& serviceInfo);
 
 private:
     std::mutex storeMutex_;
@@ -74,6 +77,7 @@ private:
 
     int32_t ProcessServiceInfoEntry(const std::string& key, const std::string& value, const UserInfo& userInfo,
         std::vector<ServiceInfo>& serviceInfos);
+    void MigrateToBinary(const std::map<std::string, std::string>& jsonEntries);
     bool ValidateStringFields(const ParsedJSONFields& fields);
     bool ValidateNumberFields(const ParsedJSONFields& fields);
     bool IsStringFieldValid(const cJSON* item);
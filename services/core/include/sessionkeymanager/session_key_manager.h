@@ -18,8 +18,14 @@
 
 #include <chrono>
 #include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
 #include <random>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "distributed_device_profile_constants.h"
 #include "single_instance.h"
@@ -34,9 +40,39 @@ public:
     int32_t GetSessionKey(int32_t sessionKeyId, std::vector<uint8_t>& sessionKey);
     int32_t UpdateSessionKey(uint32_t userId, int32_t sessionKeyId, const std::vector<uint8_t>& sessionKey);
     int32_t DeleteSessionKey(uint32_t userId, int32_t sessionKeyId);
+    // Drops and zeroizes every cached key, called on user switch and screen lock.
+    void ClearSessionKeyCache();
 
 private:
+    using SessionKeyCacheKey = std::pair<uint32_t, int32_t>;
+    struct SessionKeyCacheEntry {
+        std::vector<uint8_t> sessionKey;
+        std::list<SessionKeyCacheKey>::iterator lruIter;
+    };
+
     void GeneratedSessionKeyId(uint32_t userId, int32_t& sessionKeyId);
+    int32_t GetSessionKeyFromAsset(uint32_t userId, int32_t sessionKeyId, std::vector<uint8_t>& sessionKey);
+    // generation is the cache generation the lookup saw, a fill after a miss passes it back
+    bool GetSessionKeyFromCache(uint32_t userId, int32_t sessionKeyId, std::vector<uint8_t>& sessionKey,
+        uint64_t& generation);
+    bool GetUserIdFromCache(int32_t sessionKeyId, uint32_t& userId);
+    void PutSessionKeyToCache(uint32_t userId, int32_t sessionKeyId, const std::vector<uint8_t>& sessionKey);
+    void FillSessionKeyCache(uint32_t userId, int32_t sessionKeyId, const std::vector<uint8_t>& sessionKey,
+        uint64_t generation);
+    void PutSessionKeyToCacheLocked(uint32_t userId, int32_t sessionKeyId, const std::vector<uint8_t>& sessionKey);
+    void RemoveSessionKeyFromCache(uint32_t userId, int32_t sessionKeyId);
+    void EraseCacheEntryLocked(std::map<SessionKeyCacheKey, SessionKeyCacheEntry>::iterator iter);
+    static void ZeroizeSessionKey(std::vector<uint8_t>& sessionKey);
+
+private:
+    std::mutex sessionKeyCacheMutex_;
+    // most recently used at the front
+    std::list<SessionKeyCacheKey> sessionKeyLru_;
+    std::map<SessionKeyCacheKey, SessionKeyCacheEntry> sessionKeyCache_;
+    // sessionKeyId -> userId of the cached entries
+    std::unordered_map<int32_t, uint32_t> sessionKeyUserIndex_;
+    // bumped by every put, update, delete and clear
+    uint64_t cacheGeneration_ = 0;
 };
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
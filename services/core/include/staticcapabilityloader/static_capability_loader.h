@@ -17,11 +17,14 @@
 #define OHOS_DP_STATIC_CAPABILITY_LOADER_H
 
 #include "cJSON.h"
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include "characteristic_profile.h"
 #include "distributed_device_profile_log.h"
 #include "single_instance.h"
+#include "static_profile_table.h"
 
 namespace OHOS {
 namespace DistributedDeviceProfile {
@@ -58,6 +61,26 @@ private:
     bool HasStaticCapability(const std::string& serviceId, const std::string& staticCapability);
     bool StaticVersionCheck(const std::string& peerVersion, const std::string& localVersion);
     bool IsValidVersion(const std::string& version);
+    std::shared_ptr<StaticProfileTable> GetStaticTable(StaticTableKind kind);
+    int32_t GetStaticCapability(const StaticProfileTable& table, std::string& staticCapability);
+    int32_t GetStaticInfo(const StaticProfileTable& table, const std::string& staticCapability,
+        std::string& staticVersion, std::unordered_map<std::string, CharacteristicProfile>& charProfiles);
+    int32_t GetStaticInfoByVersion(const std::string& deviceId, const std::string& staticCapability,
+        const StaticProfileTable& table, const std::string& staticVersion,
+        std::unordered_map<std::string, CharacteristicProfile>& charProfiles);
+    int32_t GenerateStaticProfiles(const std::string& deviceId, const std::string& staticCapability,
+        const StaticProfileTable& table, const StaticInfoRecord& staticInfo,
+        std::unordered_map<std::string, CharacteristicProfile>& charProfiles);
+    void AddStaticProfile(const std::string& deviceId, const std::string& serviceId, const std::string& charValue,
+        std::unordered_map<std::string, CharacteristicProfile>& charProfiles);
+
+private:
+    std::mutex staticTableMutex_;
+    // The precompiled tables stay mapped until UnInit, nullptr means the json is used instead
+    std::shared_ptr<StaticProfileTable> capabilityTable_ = nullptr;
+    std::shared_ptr<StaticProfileTable> infoTable_ = nullptr;
+    bool capabilityTableLoaded_ = false;
+    bool infoTableLoaded_ = false;
 };
 }
 }
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DP_STATIC_PROFILE_TABLE_H
+#define OHOS_DP_STATIC_PROFILE_TABLE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+// Binary form of the static capability and static info json, produced at build time by
+// etc/staticprofile/dp_static_profile_compiler.py. Keep both sides in sync when the layout changes.
+constexpr uint32_t STATIC_TABLE_MAGIC = 0x54535044;
+constexpr uint16_t STATIC_TABLE_FORMAT_VERSION = 2;
+constexpr uint32_t STATIC_INFO_FLAG_IS_OBJECT = 0x1;
+constexpr uint32_t STATIC_INFO_FLAG_HAS_VERSION = 0x2;
+constexpr uint32_t STATIC_INFO_FLAG_HAS_ABILITIES = 0x4;
+
+enum class StaticTableKind : uint16_t {
+    CAPABILITY = 1,
+    INFO = 2
+};
+
+struct StaticTableHeader {
+    uint32_t magic;
+    uint16_t formatVersion;
+    uint16_t kind;
+    // fnv-1a of the json the table was compiled from
+    uint32_t sourceHash;
+    uint32_t totalSize;
+    uint32_t checksum;
+    uint32_t primaryOffset;
+    uint32_t primaryCount;
+    uint32_t secondaryOffset;
+    uint32_t secondaryCount;
+    uint32_t stringPoolOffset;
+    uint32_t stringPoolSize;
+};
+
+// A string in the string pool, length 0 means the json field was absent or invalid.
+struct StaticTableString {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct StaticCapabilityRecord {
+    StaticTableString handlerName;
+    StaticTableString handlerLoc;
+};
+
+struct StaticInfoRecord {
+    StaticTableString version;
+    uint32_t flags;
+    uint32_t abilityStart;
+    uint32_t abilityCount;
+};
+
+struct StaticAbilityRecord {
+    StaticTableString abilityKey;
+    StaticTableString abilityValue;
+};
+
+class StaticProfileTable {
+public:
+    // Maps the table that sits next to jsonCfgPath, nullptr when it is missing, corrupt or stale.
+    static std::shared_ptr<StaticProfileTable> Open(const std::string& jsonCfgPath, StaticTableKind kind);
+    // sourceHash 0 skips the staleness check.
+    static std::shared_ptr<StaticProfileTable> OpenFile(const std::string& binPath, StaticTableKind kind,
+        uint32_t sourceHash);
+    ~StaticProfileTable();
+
+    uint32_t GetRecordCount() const;
+    const StaticCapabilityRecord* GetCapabilityRecord(uint32_t index) const;
+    const StaticInfoRecord* GetStaticInfoRecord(uint32_t index) const;
+    const StaticAbilityRecord* GetAbilityRecord(uint32_t index) const;
+    std::string GetString(const StaticTableString& str) const;
+
+private:
+    StaticProfileTable(const uint8_t* base, size_t size);
+    bool Validate(StaticTableKind kind, uint32_t sourceHash) const;
+    bool IsStringValid(const StaticTableString& str) const;
+    static std::string GetBinPath(const std::string& jsonCfgPath);
+    static bool ResolveCfgFile(const std::string& cfgPath, std::string& realPath);
+
+private:
+    const uint8_t* base_ = nullptr;
+    size_t size_ = 0;
+    const StaticTableHeader* header_ = nullptr;
+};
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
+#endif // OHOS_DP_STATIC_PROFILE_TABLE_H
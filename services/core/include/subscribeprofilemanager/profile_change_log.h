@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DP_PROFILE_CHANGE_LOG_H
+#define OHOS_DP_PROFILE_CHANGE_LOG_H
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "distributed_device_profile_enums.h"
+#include "dp_memory_manager.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+constexpr size_t MAX_PROFILE_CHANGE_LOG_SIZE = 256;
+constexpr size_t MAX_PROFILE_CHANGE_KEY_SIZE = 1024;
+
+struct ProfileChangeRecord {
+    uint64_t seq = 0;
+    ProfileType profileType = ProfileType::PROFILE_TYPE_MIN;
+    ChangeType changeType = ChangeType::CHANGE_TYPE_MIN;
+    std::string subscribeKey;
+    std::string dbKey;
+    std::string dbValue;
+};
+
+// The last profile changes per profile type, numbered from 1 on. A subscriber that missed changes gets
+// the ones of its key after the change it missed first. Once the log no longer reaches back that far,
+// the last change of the key stands in for all of them.
+class ProfileChangeLog {
+public:
+    explicit ProfileChangeLog(size_t capacity = MAX_PROFILE_CHANGE_LOG_SIZE,
+        size_t keyCapacity = MAX_PROFILE_CHANGE_KEY_SIZE);
+    // returns the sequence number of the change
+    uint64_t Append(ProfileType profileType, ChangeType changeType, const std::string& subscribeKey,
+        const std::string& dbKey, const std::string& dbValue);
+    uint64_t GetLastSeq(ProfileType profileType);
+    // the changes of subscribeKey from fromSeq on, false when they are no longer known
+    bool GetChanges(ProfileType profileType, uint64_t fromSeq, const std::string& subscribeKey,
+        std::vector<ProfileChangeRecord>& records);
+    void Clear();
+    DpCacheUsage GetUsage();
+
+private:
+    struct TypeLog {
+        uint64_t lastSeq = 0;
+        // the newest change of a key dropped from lastChanges_
+        uint64_t evictedSeq = 0;
+        std::deque<ProfileChangeRecord> records;
+    };
+    struct LastChange {
+        // append order across all profile types, the sequence numbers of two types do not compare
+        uint64_t order = 0;
+        ProfileChangeRecord record;
+    };
+
+    void EvictLastChange();
+
+private:
+    std::mutex logMutex_;
+    size_t capacity_;
+    size_t keyCapacity_;
+    uint64_t appendCount_ = 0;
+    std::map<ProfileType, TypeLog> typeLogs_;
+    std::unordered_map<std::string, LastChange> lastChanges_;
+};
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
+#endif // OHOS_DP_PROFILE_CHANGE_LOG_H
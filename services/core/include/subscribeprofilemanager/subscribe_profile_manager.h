@@ -18,23 +18,35 @@
 
 #include <string>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <utility>
+#include <vector>
 #include "single_instance.h"
 #include "distributed_device_profile_enums.h"
 #include "device_profile.h"
 #include "dp_subscribe_info.h"
+#include "ikv_adapter.h"
+#include "profile_change_log.h"
 #include "service_profile.h"
 #include "characteristic_profile.h"
 
 namespace OHOS {
 namespace DistributedDeviceProfile {
+// restarts a restored subscription is kept for without its caller subscribing again
+constexpr int32_t MAX_SUBSCRIBE_RESTORE_COUNT = 3;
+
 class SubscribeProfileManager {
     DECLARE_SINGLE_INSTANCE(SubscribeProfileManager);
 public:
     int32_t Init();
     int32_t UnInit();
+    // reopens the subscribe store only, the subscriptions in memory are kept and written to it again
+    int32_t ReInit();
     int32_t NotifyProfileChange(ProfileType profileType, ChangeType changeType, const std::string& dbKey,
         const std::string& dbValue);
+    // one notification for all switches of a device that flipped together, each value is the new one
+    int32_t NotifySwitchChange(const std::vector<CharacteristicProfile>& switchProfiles);
     /* User level */
     int32_t NotifyTrustDeviceProfileAdd(const TrustDeviceProfile& trustDeviceProfile);
     int32_t NotifyTrustDeviceProfileUpdate(const TrustDeviceProfile& oldDeviceProfile,
@@ -56,24 +68,76 @@ public:
     int32_t UnSubscribeDeviceProfile(const SubscribeInfo& subscribeInfo);
 
 private:
-    int32_t NotifyDeviceProfileAdd(const std::string& dbKey, const std::string& dbValue);
-    int32_t NotifyDeviceProfileUpdate(const std::string& dbKey, const std::string& dbValue);
-    int32_t NotifyDeviceProfileDelete(const std::string& dbKey, const std::string& dbValue);
-    int32_t NotifyServiceProfileAdd(const std::string& dbKey, const std::string& dbValue);
-    int32_t NotifyServiceProfileUpdate(const std::string& dbKey, const std::string& dbValue);
-    int32_t NotifyServiceProfileDelete(const std::string& dbKey, const std::string& dbValue);
-    int32_t NotifyCharProfileAdd(const std::string& dbKey, const std::string& dbValue);
-    int32_t NotifyCharProfileUpdate(const std::string& dbKey, const std::string& dbValue);
-    int32_t NotifyCharProfileDelete(const std::string& dbKey, const std::string& dbValue);
-    std::unordered_set<SubscribeInfo, SubscribeHash, SubscribeCompare> GetSubscribeInfos(const std::string& dbKey);
+    int32_t NotifyDeviceProfileAdd(const std::string& dbKey, const std::string& dbValue,
+        const SubscribeInfo* replayTo = nullptr);
+    int32_t NotifyDeviceProfileUpdate(const std::string& dbKey, const std::string& dbValue,
+        const SubscribeInfo* replayTo = nullptr);
+    int32_t NotifyDeviceProfileDelete(const std::string& dbKey, const std::string& dbValue,
+        const SubscribeInfo* replayTo = nullptr);
+    int32_t NotifyServiceProfileAdd(const std::string& dbKey, const std::string& dbValue,
+        const SubscribeInfo* replayTo = nullptr);
+    int32_t NotifyServiceProfileUpdate(const std::string& dbKey, const std::string& dbValue,
+        const SubscribeInfo* replayTo = nullptr);
+    int32_t NotifyServiceProfileDelete(const std::string& dbKey, const std::string& dbValue,
+        const SubscribeInfo* replayTo = nullptr);
+    int32_t NotifyCharProfileAdd(const std::string& dbKey, const std::string& dbValue,
+        const SubscribeInfo* replayTo = nullptr);
+    int32_t NotifyCharProfileUpdate(const std::string& dbKey, const std::string& dbValue,
+        const SubscribeInfo* replayTo = nullptr);
+    int32_t NotifyCharProfileDelete(const std::string& dbKey, const std::string& dbValue,
+        const SubscribeInfo* replayTo = nullptr);
+    // replayTo set: only that subscriber, the one catching up on what it missed
+    std::unordered_set<SubscribeInfo, SubscribeHash, SubscribeCompare> GetSubscribeInfos(const std::string& dbKey,
+        const SubscribeInfo* replayTo = nullptr);
     std::string DBKeyToSubcribeKey(const std::string& dbkey);
+    uint64_t AppendChangeLog(ProfileType profileType, ChangeType changeType, const std::string& dbKey,
+        const std::string& dbValue);
+    // replays until the subscription has caught up with the log, live changes skip it until then
+    void ReplayMissedChanges(const SubscribeInfo& subscribeInfo, ProfileType profileType, uint64_t fromSeq,
+        uint64_t replayId);
+    void ReplayChange(const ProfileChangeRecord& record, const SubscribeInfo& subscribeInfo);
+    // the current value of the key as updates, or a delete when it is gone, for changes the log lost
+    void GetCurrentChanges(ProfileType profileType, const std::string& subscribeKey,
+        std::vector<ProfileChangeRecord>& records);
+    bool IsReplayingLocked(const SubscribeInfo& subscribeInfo);
+    void InitSubscribeStore();
+    int32_t OpenSubscribeStore();
+    void LoadSubscribeInfos();
+    // false when a restored subscription of the key belongs to another caller
+    bool BindRestoredLocked(const SubscribeInfo& subscribeInfo, uint32_t tokenId);
+    // the value to write, empty when the persisted one is the same; the store keys of the restored
+    // subscriptions evicted to make room are added to deleteKeys
+    std::string UpdatePersistedLocked(const SubscribeInfo& subscribeInfo, uint32_t tokenId,
+        std::vector<std::string>& deleteKeys);
+    bool EvictRestoredLocked(std::vector<std::string>& deleteKeys);
+    void DropUnboundRestored(const std::map<std::string, SubscribeInfo>& subscribeInfos);
+    // called with subscribeMutex_ held, so the writes of a key reach the store in the order of the map updates
+    void WriteSubscribeStore(const std::map<std::string, std::string>& values,
+        const std::vector<std::string>& deleteKeys);
 
 private:
-    using Func = int32_t(SubscribeProfileManager::*)(const std::string& profileKey, const std::string& profileValue);
+    using Func = int32_t(SubscribeProfileManager::*)(const std::string& profileKey, const std::string& profileValue,
+        const SubscribeInfo* replayTo);
     std::mutex funcsMutex_;
     std::map<uint32_t, Func> funcsMap_;
     std::mutex subscribeMutex_;
     std::map<std::string, std::unordered_set<SubscribeInfo, SubscribeHash, SubscribeCompare>> subscribeInfoMap_;
+    // per saId and subscribe key whose listener died: the profile type and the first change it missed,
+    // guarded by subscribeMutex_
+    std::map<std::pair<int32_t, std::string>, std::pair<ProfileType, uint64_t>> missedChanges_;
+    // per saId and subscribe key whose missed changes are being replayed, the id of that replay,
+    // guarded by subscribeMutex_
+    std::map<std::pair<int32_t, std::string>, uint64_t> replayingSubscribes_;
+    uint64_t replayCount_ = 0;
+    // per saId and subscribe key the value in subscribeStore_, guarded by subscribeMutex_
+    std::map<std::pair<int32_t, std::string>, std::string> persistedSubscribes_;
+    // per subscribe key the saIds restored from subscribeStore_ and the token of their caller, until the
+    // caller subscribes again with its listener, guarded by subscribeMutex_
+    std::map<std::string, std::map<int32_t, uint32_t>> restoredSubscribes_;
+    ProfileChangeLog changeLog_;
+    // taken after subscribeMutex_ when both are held
+    std::mutex storeMutex_;
+    std::shared_ptr<IKVAdapter> subscribeStore_ = nullptr;
 };
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
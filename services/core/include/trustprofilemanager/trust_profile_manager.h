@@ -58,6 +58,8 @@ public:
     int32_t GetAllAclIncludeLnnAcl(std::vector<AccessControlProfile>& profiles);
     int32_t GetAccessControlProfile(const std::map<std::string, std::string>& params,
         std::vector<AccessControlProfile>& profile);
+    int32_t GetAccessControlProfileBatch(const std::vector<std::map<std::string, std::string>>& paramsList,
+        std::vector<std::vector<AccessControlProfile>>& profilesList, std::vector<int32_t>& results);
     int32_t DeleteTrustDeviceProfile(const std::string& deviceId);
     int32_t DeleteAccessControlProfile(int64_t accessControlId);
     int32_t GetUserIdBySessionKeyId(int32_t sessionKeyId, int32_t& userId);
@@ -72,6 +74,8 @@ private:
     bool CheckReverseByAcer(const QueryProfile& queryProfile, const AccessControlProfile& aclProfile);
     int32_t GetAccessControlProfile(const QueryType& queryType,
         const QueryProfile& queryProfile, std::vector<AccessControlProfile>& profile);
+    int32_t GetAccessControlProfileByParams(const std::map<std::string, std::string>& params,
+        std::vector<AccessControlProfile>& profile);
     bool GenerateQueryProfile(const std::map<std::string, std::string>& params,
         QueryType& queryType, QueryProfile& queryProfile);
     int32_t GetAllAccessControlProfiles(std::vector<AccessControlProfile>& profiles);
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DP_MEMORY_MANAGER_H
+#define OHOS_DP_MEMORY_MANAGER_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "single_instance.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+constexpr size_t DEFAULT_CACHE_BUDGET_BYTES = 4 * 1024 * 1024;
+// an over budget check trims down to this share of the budget, so the next few inserts do not trim again
+constexpr size_t CACHE_TRIM_TARGET_PERCENT = 80;
+// the caches report what they add, the budget is checked each time this share of it has been added
+constexpr size_t CACHE_CHECK_STEP_PERCENT = 5;
+// rough per entry cost of a node based map on top of key and value
+constexpr size_t CACHE_NODE_OVERHEAD_BYTES = 4 * sizeof(void*);
+
+struct DpCacheUsage {
+    size_t entries = 0;
+    size_t bytes = 0;
+};
+
+// Every in-process cache reports its estimated footprint here. The sum is held against one budget:
+// when it is exceeded the trimmable caches are trimmed, cheapest to rebuild first, and on memory
+// pressure from the sa framework all of them are. Caches holding state that exists nowhere else
+// register without a trim function and only count against the budget.
+class DpMemoryManager {
+    DECLARE_SINGLE_INSTANCE(DpMemoryManager);
+
+public:
+    using UsageFunc = std::function<DpCacheUsage()>;
+    // frees at least bytesToFree when the cache holds that much, returns the bytes freed
+    using TrimFunc = std::function<size_t(size_t bytesToFree)>;
+
+    void RegisterCache(const std::string& name, UsageFunc usageFunc, TrimFunc trimFunc = nullptr,
+        uint32_t rebuildCost = 0);
+    void UnRegisterCache(const std::string& name);
+    void SetBudget(size_t budgetBytes);
+    size_t GetBudget() const;
+    DpCacheUsage GetTotalUsage();
+    // returns the bytes freed, 0 when the caches are within the budget
+    size_t CheckBudget();
+    // called by a cache after an insert, without any of its locks held, as CheckBudget may trim it
+    size_t OnCacheGrown(size_t bytes);
+    size_t TrimAll();
+    void Dump(std::string& result);
+    static size_t EstimateBytes(const std::string& str);
+    static DpCacheUsage EstimateUsage(const std::map<std::string, std::string>& entries);
+
+private:
+    struct CacheEntry {
+        UsageFunc usageFunc = nullptr;
+        TrimFunc trimFunc = nullptr;
+        uint32_t rebuildCost = 0;
+    };
+
+    size_t TrimTo(size_t targetBytes);
+    std::map<std::string, CacheEntry> GetCaches();
+
+private:
+    std::mutex cacheMutex_;
+    std::map<std::string, CacheEntry> caches_;
+    std::atomic<size_t> budgetBytes_ {DEFAULT_CACHE_BUDGET_BYTES};
+    // bytes added since the last budget check
+    std::atomic<size_t> grownBytes_ {0};
+    // one trim at a time, a second caller would only see the first one's work half done
+    std::mutex trimMutex_;
+};
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
+#endif // OHOS_DP_MEMORY_MANAGER_H
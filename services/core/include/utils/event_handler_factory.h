@@ -30,6 +30,8 @@ public:
     int32_t Init();
     int32_t UnInit();
     std::shared_ptr<AppExecFwk::EventHandler> GetEventHandler();
+    // Posts to the shared handler and records queue depth and task wait time.
+    bool PostTask(const AppExecFwk::EventHandler::Callback& task);
 
 private:
     std::mutex eventHandlerMutex_;
@@ -29,6 +29,7 @@
 #include "device_profile.h"
 #include "distributed_device_profile_constants.h"
 #include "distributed_device_profile_log.h"
+#include "dp_memory_manager.h"
 #include "dp_subscribe_info.h"
 #include "profile_utils.h"
 #include "service_profile.h"
@@ -68,11 +69,6 @@ public:
     bool IsServiceProfileExist(const ServiceProfile& serviceProfile);
     bool IsCharProfileExist(const CharacteristicProfile& charProfile);
     int32_t RefreshProfileCache();
-    int32_t AddSyncListener(const std::string& caller, sptr<IRemoteObject> syncListener);
-    int32_t GetSyncListeners(std::map<std::string, sptr<IRemoteObject>>& syncListeners);
-    int32_t RemoveSyncListeners(std::map<std::string, sptr<IRemoteObject>> syncListeners);
-    int32_t RemoveSyncListener(const std::string& caller);
-    int32_t RemoveSyncListener(sptr<IRemoteObject> syncListener);
     int32_t SetSwitchByProfileBatch(const std::vector<CharacteristicProfile>& charProfiles,
         const std::unordered_map<std::string, SwitchFlag>& switchServiceMap, uint32_t& outSwitch);
     int32_t SetSwitchByProfile(const CharacteristicProfile& charProfile,
@@ -83,6 +79,9 @@ public:
     void OnNodeOnline(const TrustedDeviceInfo& trustedDeviceInfo);
     void OnNodeOffline(const std::string& peerNetworkId);
     void SetCurSwitch(uint32_t newSwitch);
+    // the whole switch word of an online peer, kept by switch change notifications until it goes offline
+    void SetRemoteSwitch(const std::string& netWorkId, uint32_t switchValue);
+    int32_t GetRemoteSwitch(const std::string& netWorkId, uint32_t& switchValue);
     int32_t GetServiceNameByPos(int32_t pos, const std::unordered_map<std::string, SwitchFlag>& switchServiceMap,
         std::string& serviceName);
     int32_t GetSwitchProfilesByServiceName(const std::string& charProfileKey, CharacteristicProfile& switchProfile);
@@ -96,6 +95,9 @@ public:
         std::vector<std::string>& ohBasedDevices,
         std::vector<std::tuple<std::string, std::string, bool>>& notOHBasedDevices);
     bool IsDeviceOnline();
+    DpCacheUsage GetUsage();
+    // Evicts what can be read back from the kv stores: static char profiles, then service and device profiles.
+    size_t Trim(size_t bytesToFree);
 
 private:
     int32_t RefreshCharProfileCache(const std::vector<CharacteristicProfile>& characteristicProfiles);
@@ -105,6 +107,9 @@ private:
     std::string localNetworkId_;
     std::mutex switchMutex_;
     uint32_t curLocalSwitch_ = 0x0000;
+    std::mutex remoteSwitchMutex_;
+    // The key is networkId, the value is the switch word of that peer
+    std::unordered_map<std::string, uint32_t> remoteSwitchMap_;
     std::mutex onlineDeviceLock_;
     std::unordered_map<std::string, TrustedDeviceInfo> onlineDevMap_;
     std::mutex deviceProfileMutex_;
@@ -119,10 +124,6 @@ private:
     std::mutex staticCharProfileMutex_;
     // The key is profileKey, the value is CharacteristicProfile
     std::unordered_map<std::string, CharacteristicProfile> staticCharProfileMap_;
-    std::mutex syncListenerMutex_;
-    // The key is procName, the value is syncCallback
-    std::map<std::string, sptr<IRemoteObject>> syncListenerMap_;
-    sptr<IRemoteObject::DeathRecipient> syncListenerDeathRecipient_ = nullptr;
     std::mutex localUuidMtx_;
     std::string localUuid_;
 };
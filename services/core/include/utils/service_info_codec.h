@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DP_SERVICE_INFO_CODEC_H
+#define OHOS_DP_SERVICE_INFO_CODEC_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "service_info.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+constexpr uint8_t SERVICE_INFO_CODEC_MAGIC = 0xB1;
+constexpr uint8_t SERVICE_INFO_CODEC_VERSION = 1;
+
+// Binary kv value of a ServiceInfo: the magic byte, the version, the numeric fields at fixed width in
+// little endian, then every string as a uint32 length and its bytes. A later version only appends
+// fields, so a reader skips what it does not know. JSON values start with '{' and never match the magic.
+class ServiceInfoCodec {
+public:
+    static bool IsBinary(std::string_view value);
+    static std::string Encode(const ServiceInfo& serviceInfo);
+};
+
+// Reads the fields in place, the strings point into the value passed to Parse and must not outlive it.
+class ServiceInfoView {
+public:
+    // false when the value is not a complete binary value
+    bool Parse(std::string_view value);
+    void ToServiceInfo(ServiceInfo& serviceInfo) const;
+    std::string_view GetUdid() const { return udid_; }
+    int32_t GetUserId() const { return userId_; }
+    int64_t GetServiceId() const { return serviceId_; }
+
+private:
+    int32_t userId_ = 0;
+    int64_t displayId_ = 0;
+    int32_t serviceOwnerTokenId_ = 0;
+    int32_t serviceRegisterTokenId_ = 0;
+    int64_t serviceId_ = 0;
+    int64_t timeStamp_ = 0;
+    int8_t publishState_ = 0;
+    uint32_t dataLen_ = 0;
+    std::string_view udid_;
+    std::string_view serviceOwnerPkgName_;
+    std::string_view serviceType_;
+    std::string_view serviceName_;
+    std::string_view serviceDisplayName_;
+    std::string_view customData_;
+    std::string_view serviceCode_;
+    std::string_view extraData_;
+    std::string_view version_;
+    std::string_view description_;
+};
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
+#endif // OHOS_DP_SERVICE_INFO_CODEC_H
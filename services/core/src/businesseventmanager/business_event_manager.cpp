@@ -23,6 +23,7 @@
 #include "kv_data_change_listener.h"
 #include "kv_store_death_recipient.h"
 #include "kv_sync_completed_listener.h"
+#include "write_behind_kv_adapter.h"
 
 namespace OHOS {
 namespace DistributedDeviceProfile {
@@ -40,13 +41,19 @@ int32_t BusinessEventManager::Init()
 {
     HILOGI("call!");
     std::lock_guard<std::mutex> lock(dynamicStoreMutex_);
-    businessEventAdapter_ = std::make_shared<BusinessEventAdapter>(
+    auto kvAdapter = std::make_shared<BusinessEventAdapter>(
         std::make_shared<KvDeathRecipient>(STORE_ID), DistributedKv::TYPE_DYNAMICAL);
+#ifdef DP_KV_WRITE_BEHIND_ENABLE
+    businessEventAdapter_ = std::make_shared<WriteBehindKvAdapter>(STORE_ID, kvAdapter);
+#else
+    businessEventAdapter_ = kvAdapter;
+#endif
     int32_t ret = businessEventAdapter_->Init();
     if (ret != DP_SUCCESS) {
         HILOGE("businessEventAdapter init failed, ret: %{public}d", ret);
         return DP_INIT_DB_FAILED;
     }
+    LoadBusinessEvents();
     HILOGI("Init finish, ret: %{public}d", ret);
     return DP_SUCCESS;
 }
@@ -60,8 +67,15 @@ int32_t BusinessEventManager::UnInit()
             HILOGE("businessEventAdapter_ is nullptr");
             return DP_KV_DB_PTR_NULL;
         }
-        businessEventAdapter_->UnInit();
+        // with write-behind a failed final flush keeps the store open and the events buffered
+        int32_t ret = businessEventAdapter_->UnInit();
+        if (ret != DP_SUCCESS) {
+            HILOGE("businessEventAdapter UnInit failed, ret: %{public}d", ret);
+            return ret;
+        }
         businessEventAdapter_ = nullptr;
+        std::lock_guard<std::mutex> eventLock(eventMutex_);
+        events_.clear();
     }
     HILOGI("UnInit success");
     return DP_SUCCESS;
@@ -86,11 +100,23 @@ int32_t BusinessEventManager::PutBusinessEvent(const BusinessEvent& event)
             HILOGE("businessEventAdapter_ is null");
             return DP_KV_DB_PTR_NULL;
         }
+        {
+            std::lock_guard<std::mutex> eventLock(eventMutex_);
+            auto iter = events_.find(key);
+            if (iter != events_.end() && iter->second == value) {
+                HILOGI("business event not changed, key: %{public}s", key.c_str());
+                return DP_SUCCESS;
+            }
+        }
+        // on a failed flush the value stays buffered and is retried with the next window
         int32_t ret = businessEventAdapter_->Put(key, value);
         if (ret != DP_SUCCESS) {
             HILOGE("Failed to insert business event with key: %{public}s", key.c_str());
             return DP_PUT_BUSINESS_EVENT_FAIL;
         }
+        // dynamicStoreMutex_ is still held, no other put of the key runs between the check and here
+        std::lock_guard<std::mutex> eventLock(eventMutex_);
+        events_[key] = value;
     }
     HILOGI("PutBusinessEvent success for key: %{public}s", key.c_str());
     return DP_SUCCESS;
@@ -108,8 +134,17 @@ int32_t BusinessEventManager::GetBusinessEvent(BusinessEvent& event)
     }
 
     std::string key = event.GetBusinessKey();
+    {
+        std::lock_guard<std::mutex> eventLock(eventMutex_);
+        auto iter = events_.find(key);
+        if (iter != events_.end()) {
+            event.SetBusinessValue(iter->second);
+            return DP_SUCCESS;
+        }
+    }
     std::string value;
     {
+        // only a key that was never put or failed to load at Init gets here
         std::lock_guard<std::mutex> lock(dynamicStoreMutex_);
         if (businessEventAdapter_ == nullptr) {
             HILOGE("businessEventAdapter_ is null");
@@ -121,6 +156,8 @@ int32_t BusinessEventManager::GetBusinessEvent(BusinessEvent& event)
             return DP_GET_BUSINESS_EVENT_FAIL;
         }
         event.SetBusinessValue(value);
+        std::lock_guard<std::mutex> eventLock(eventMutex_);
+        events_[key] = value;
     }
     HILOGI("GetBusinessEvent success for key: %{public}s", key.c_str());
     return DP_SUCCESS;
@@ -130,6 +167,20 @@ bool BusinessEventManager::IsValidKey(const std::string& key)
 {
     return validKeys_.find(key) != validKeys_.end();
 }
+
+void BusinessEventManager::LoadBusinessEvents()
+{
+    std::map<std::string, std::string> events;
+    for (const auto& key : validKeys_) {
+        std::string value;
+        if (businessEventAdapter_ != nullptr && businessEventAdapter_->Get(key, value) == DP_SUCCESS) {
+            events[key] = value;
+        }
+    }
+    HILOGI("loaded %{public}zu business events", events.size());
+    std::lock_guard<std::mutex> eventLock(eventMutex_);
+    events_.swap(events);
+}
 //LCOV_EXCL_STOP
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
@@ -79,16 +79,39 @@ const std::string CREATE_DEVICE_ICON_INFO_TABLE_SQL = "CREATE TABLE IF NOT EXIST
     url           TEXT,\
     icon          blob,\
     internalModel    TEXT,\
-    modifyTime    BIGINT DEFAULT 0);";
+    modifyTime    BIGINT DEFAULT 0,\
+    iconHash      TEXT);";
 const std::string CREATE_DEVICE_ICON_INFO_TABLE_UNIQUE_INDEX_SQL = "CREATE UNIQUE INDEX if not exists \
     unique_device_icon_info ON device_icon_info (productId, subProductId, imageType, specName);";
 const std::string ALTER_TABLE_DEVICE_ICON_INFO_ADD_COLUMN_INTENAL_MODEL_SQL =
     "ALTER TABLE device_icon_info ADD COLUMN internalModel TEXT";
 const std::string ALTER_TABLE_DEVICE_ICON_INFO_ADD_COLUMN_MODIFY_TIME_SQL =
     "ALTER TABLE device_icon_info ADD COLUMN modifyTime BIGINT  DEFAULT 0";
-const std::string SELECT_DEVICE_ICON_INFO_TABLE = "SELECT a.*,b.imageVersion FROM device_icon_info a \
+const std::string ALTER_TABLE_DEVICE_ICON_INFO_ADD_COLUMN_ICON_HASH_SQL =
+    "ALTER TABLE device_icon_info ADD COLUMN iconHash TEXT";
+// rows written before the blob table keep their icon inline, the hash is empty for them
+const std::string SELECT_DEVICE_ICON_INFO_TABLE = "SELECT a.id,a.productId,a.subProductId,a.imageType,\
+    a.specName,a.version,a.url,a.internalModel,a.modifyTime,b.imageVersion,COALESCE(c.icon, a.icon) AS icon \
+    FROM device_icon_info a \
     LEFT JOIN product_info b ON a.productId = b.productId \
+    LEFT JOIN device_icon_blob c ON a.iconHash = c.iconHash \
     WHERE ";
+// every column but the icon blob
+const std::string SELECT_DEVICE_ICON_INFO_META_TABLE = "SELECT a.id,a.productId,a.subProductId,a.imageType,\
+    a.specName,a.version,a.url,a.internalModel,a.modifyTime,b.imageVersion FROM device_icon_info a \
+    LEFT JOIN product_info b ON a.productId = b.productId \
+    WHERE ";
+const std::string SELECT_DEVICE_ICON_INFO_META_BY_UNIQUE_KEY = SELECT_DEVICE_ICON_INFO_META_TABLE +
+    "a.productId = ? AND a.subProductId = ? AND a.imageType = ? AND a.specName = ? LIMIT 1";
+const std::string SELECT_DEVICE_ICON_INFO_HASH_BY_ID = "SELECT iconHash FROM device_icon_info WHERE id = ?";
+// one row per distinct icon, shared by every device_icon_info row with the same iconHash
+const std::string CREATE_DEVICE_ICON_BLOB_TABLE_SQL = "CREATE TABLE IF NOT EXISTS device_icon_blob\
+    (iconHash     TEXT PRIMARY KEY,\
+    icon          blob,\
+    refCount      INTEGER DEFAULT 0);";
+const std::string SELECT_DEVICE_ICON_BLOB_REF_COUNT = "SELECT refCount FROM device_icon_blob WHERE iconHash = ?";
+const std::string SELECT_DEVICE_ICON_BLOB_BY_HASH = "SELECT icon,refCount FROM device_icon_blob WHERE iconHash = ?";
+const std::string ICON_HASH_EQUAL_CONDITION = "iconHash = ?";
 // ProductInfoDao
 const std::string CREATE_PRODUCT_INFO_TABLE_SQL = "CREATE TABLE IF NOT EXISTS product_info \
     (productId          TEXT PRIMARY KEY,\
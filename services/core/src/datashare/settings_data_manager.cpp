@@ -15,12 +15,15 @@
 
 #include "settings_data_manager.h"
 
+#include "datetime_ex.h"
 #include "iservice_registry.h"
 #include "system_ability_definition.h"
 
 #include "distributed_device_profile_constants.h"
 #include "distributed_device_profile_errors.h"
 #include "distributed_device_profile_log.h"
+#include "dp_metrics.h"
+#include "event_handler_factory.h"
 
 namespace OHOS {
 namespace DistributedDeviceProfile {
@@ -40,6 +43,8 @@ const std::string SETTINGS_GENERAL_USER_DEFINED_DEVICE_NAME = "settings.general.
 
 const std::string SETTING_COLUMN_VALUE = "VALUE";
 const std::string SETTING_COLUMN_KEYWORD = "KEYWORD";
+const std::string HELPER_IDLE_CHECK_TASK = "settings_helper_idle_check";
+constexpr int64_t HELPER_IDLE_TIMEOUT_MS = 30000;
 }
 
 int32_t SettingsDataManager::Init()
@@ -50,6 +55,7 @@ int32_t SettingsDataManager::Init()
 
 int32_t SettingsDataManager::UnInit()
 {
+    ReleaseIdleHelpers(true);
     std::lock_guard<std::mutex> lock(remoteObjMtx_);
     remoteObj_ = nullptr;
     return DP_SUCCESS;
@@ -104,19 +110,27 @@ int32_t SettingsDataManager::GetValue(const std::string &tableName, int32_t user
     const std::string &key, std::string &value)
 {
     std::string proxyUri = GetProxyUriStr(tableName, userId);
-    auto helper = CreateDataShareHelper(proxyUri);
+    Uri uri = MakeUri(proxyUri, key);
+    std::string cacheKey = uri.ToString();
+    bool isCachedKey = IsCachedKey(key);
+    if (isCachedKey && GetCachedValue(cacheKey, value)) {
+        return DP_SUCCESS;
+    }
+    auto helper = AcquireDataShareHelper(proxyUri);
     if (helper == nullptr) {
         HILOGE("helper is nullptr");
         return DP_NULLPTR;
     }
+    // register before querying, a change that lands during the query then keeps the result out of the cache
+    bool canCache = isCachedKey && RegisterValueObserver(proxyUri, key);
+    uint64_t cacheVersion = GetCacheVersion();
     std::vector<std::string> columns = { SETTING_COLUMN_VALUE };
     DataShare::DataSharePredicates predicates;
     predicates.EqualTo(SETTING_COLUMN_KEYWORD, key);
-    Uri uri = MakeUri(proxyUri, key);
     auto resultSet = helper->Query(uri, predicates, columns);
-    ReleaseDataShareHelper(helper);
     if (resultSet == nullptr) {
         HILOGE("Query failed key=%{public}s", key.c_str());
+        DiscardDataShareHelper(proxyUri, helper);
         return DP_NULLPTR;
     }
     int32_t count = ROWCOUNT_INIT;
@@ -135,6 +149,9 @@ int32_t SettingsDataManager::GetValue(const std::string &tableName, int32_t user
         return ret;
     }
     resultSet->Close();
+    if (canCache) {
+        PutCachedValue(cacheKey, value, cacheVersion);
+    }
     return DP_SUCCESS;
 }
 
@@ -142,7 +159,7 @@ int32_t SettingsDataManager::SetValue(const std::string &tableName, int32_t user
     const std::string &key, const std::string &value)
 {
     std::string proxyUri = GetProxyUriStr(tableName, userId);
-    auto helper = CreateDataShareHelper(proxyUri);
+    auto helper = AcquireDataShareHelper(proxyUri);
     if (helper == nullptr) {
         HILOGE("helper is nullptr");
         return DP_NULLPTR;
@@ -159,7 +176,7 @@ int32_t SettingsDataManager::SetValue(const std::string &tableName, int32_t user
         HILOGW("Update failed, ret=%{public}d", ret);
         ret = helper->Insert(uri, val);
     }
-    ReleaseDataShareHelper(helper);
+    InvalidateCachedValues(uri.ToString());
     if (ret <= 0) {
         HILOGE("set value failed, ret=%{public}d", ret);
         return ret;
@@ -178,9 +195,195 @@ std::shared_ptr<DataShare::DataShareHelper> SettingsDataManager::CreateDataShare
         HILOGE("create helper failed ret %{public}d", ret);
         return nullptr;
     }
+    DpMetrics::GetInstance().IncreaseCounter(DpMetricsCounter::DATASHARE_HELPER_CREATED);
     return helper;
 }
 
+std::shared_ptr<DataShare::DataShareHelper> SettingsDataManager::AcquireDataShareHelper(const std::string &proxyUri)
+{
+    {
+        std::lock_guard<std::mutex> lock(helperPoolMtx_);
+        auto iter = helperPool_.find(proxyUri);
+        if (iter != helperPool_.end() && iter->second.helper != nullptr) {
+            iter->second.lastUsedMs = GetTickCount();
+            return iter->second.helper;
+        }
+    }
+    auto helper = CreateDataShareHelper(proxyUri);
+    if (helper == nullptr) {
+        return nullptr;
+    }
+    std::shared_ptr<DataShare::DataShareHelper> pooledHelper = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(helperPoolMtx_);
+        HelperEntry& entry = helperPool_[proxyUri];
+        if (entry.helper == nullptr) {
+            entry.helper = helper;
+        }
+        entry.lastUsedMs = GetTickCount();
+        pooledHelper = entry.helper;
+    }
+    if (pooledHelper != helper) {
+        // another caller pooled a helper for this uri in the meantime
+        ReleaseDataShareHelper(helper);
+    }
+    PostIdleCheck();
+    return pooledHelper;
+}
+
+void SettingsDataManager::DiscardDataShareHelper(const std::string &proxyUri,
+    std::shared_ptr<DataShare::DataShareHelper> helper)
+{
+    HelperEntry entry;
+    {
+        std::lock_guard<std::mutex> lock(helperPoolMtx_);
+        auto iter = helperPool_.find(proxyUri);
+        if (iter == helperPool_.end() || iter->second.helper != helper) {
+            return;
+        }
+        entry = std::move(iter->second);
+        helperPool_.erase(iter);
+    }
+    InvalidateCachedValues(proxyUri);
+    ReleaseHelperEntry(entry);
+}
+
+void SettingsDataManager::ReleaseIdleHelpers(bool releaseAll)
+{
+    std::vector<std::string> idleProxyUris;
+    std::vector<HelperEntry> idleEntries;
+    bool hasHelper = false;
+    {
+        std::lock_guard<std::mutex> lock(helperPoolMtx_);
+        idleCheckPosted_ = false;
+        int64_t nowMs = GetTickCount();
+        for (auto iter = helperPool_.begin(); iter != helperPool_.end();) {
+            if (!releaseAll && nowMs - iter->second.lastUsedMs < HELPER_IDLE_TIMEOUT_MS) {
+                iter++;
+                continue;
+            }
+            idleProxyUris.emplace_back(iter->first);
+            idleEntries.emplace_back(std::move(iter->second));
+            iter = helperPool_.erase(iter);
+        }
+        hasHelper = !helperPool_.empty();
+    }
+    // a cached value is only trusted while the observer registered through its helper is alive
+    for (const auto& proxyUri : idleProxyUris) {
+        InvalidateCachedValues(proxyUri);
+    }
+    for (auto& entry : idleEntries) {
+        ReleaseHelperEntry(entry);
+    }
+    if (!idleEntries.empty()) {
+        HILOGI("release %{public}zu helpers", idleEntries.size());
+    }
+    if (hasHelper) {
+        PostIdleCheck();
+    }
+}
+
+void SettingsDataManager::ReleaseHelperEntry(HelperEntry &entry)
+{
+    if (entry.helper == nullptr) {
+        return;
+    }
+    for (const auto& [cacheKey, observer] : entry.observers) {
+        entry.helper->UnregisterObserver(Uri(cacheKey), observer);
+    }
+    entry.observers.clear();
+    ReleaseDataShareHelper(entry.helper);
+    entry.helper = nullptr;
+}
+
+bool SettingsDataManager::RegisterValueObserver(const std::string &proxyUri, const std::string &key)
+{
+    std::string cacheKey = MakeUri(proxyUri, key).ToString();
+    std::lock_guard<std::mutex> lock(helperPoolMtx_);
+    auto iter = helperPool_.find(proxyUri);
+    if (iter == helperPool_.end() || iter->second.helper == nullptr) {
+        return false;
+    }
+    if (iter->second.observers.count(cacheKey) != 0) {
+        return true;
+    }
+    sptr<AAFwk::IDataAbilityObserver> observer = sptr<SettingsDataObserver>(new SettingsDataObserver(cacheKey));
+    iter->second.helper->RegisterObserver(Uri(cacheKey), observer);
+    iter->second.observers[cacheKey] = observer;
+    return true;
+}
+
+void SettingsDataManager::PostIdleCheck()
+{
+    {
+        std::lock_guard<std::mutex> lock(helperPoolMtx_);
+        if (idleCheckPosted_) {
+            return;
+        }
+        idleCheckPosted_ = true;
+    }
+    auto task = []() {
+        SettingsDataManager::GetInstance().ReleaseIdleHelpers(false);
+    };
+    auto handler = EventHandlerFactory::GetInstance().GetEventHandler();
+    if (handler == nullptr || !handler->PostTask(task, HELPER_IDLE_CHECK_TASK, HELPER_IDLE_TIMEOUT_MS)) {
+        HILOGW("post idle check fail");
+        std::lock_guard<std::mutex> lock(helperPoolMtx_);
+        idleCheckPosted_ = false;
+    }
+}
+
+void SettingsDataManager::OnSettingsDataChange(const std::string &cacheKey)
+{
+    HILOGI("settings changed");
+    InvalidateCachedValues(cacheKey);
+}
+
+bool SettingsDataManager::GetCachedValue(const std::string &cacheKey, std::string &value)
+{
+    std::lock_guard<std::mutex> lock(valueCacheMtx_);
+    auto iter = valueCache_.find(cacheKey);
+    if (iter == valueCache_.end()) {
+        DpMetrics::GetInstance().IncreaseCounter(DpMetricsCounter::SETTINGS_CACHE_MISS);
+        return false;
+    }
+    DpMetrics::GetInstance().IncreaseCounter(DpMetricsCounter::SETTINGS_CACHE_HIT);
+    value = iter->second;
+    return true;
+}
+
+void SettingsDataManager::PutCachedValue(const std::string &cacheKey, const std::string &value,
+    uint64_t cacheVersion)
+{
+    std::lock_guard<std::mutex> lock(valueCacheMtx_);
+    if (cacheVersion != cacheVersion_) {
+        return;
+    }
+    valueCache_[cacheKey] = value;
+}
+
+void SettingsDataManager::InvalidateCachedValues(const std::string &cacheKeyPrefix)
+{
+    std::lock_guard<std::mutex> lock(valueCacheMtx_);
+    cacheVersion_++;
+    auto iter = valueCache_.lower_bound(cacheKeyPrefix);
+    while (iter != valueCache_.end() && iter->first.compare(0, cacheKeyPrefix.size(), cacheKeyPrefix) == 0) {
+        iter = valueCache_.erase(iter);
+    }
+}
+
+uint64_t SettingsDataManager::GetCacheVersion()
+{
+    std::lock_guard<std::mutex> lock(valueCacheMtx_);
+    return cacheVersion_;
+}
+
+bool SettingsDataManager::IsCachedKey(const std::string &key)
+{
+    return key == SETTINGS_GENERAL_DEVICE_NAME || key == SETTINGS_GENERAL_DISPLAY_DEVICE_NAME ||
+        key == SETTINGS_GENERAL_USER_DEFINED_DEVICE_NAME;
+}
+
 std::string SettingsDataManager::GetProxyUriStr(const std::string &tableName, int32_t userId)
 {
     if (userId < USERID_HELPER_NUMBER) {
@@ -214,5 +417,14 @@ bool SettingsDataManager::ReleaseDataShareHelper(std::shared_ptr<DataShare::Data
     }
     return true;
 }
+
+SettingsDataObserver::SettingsDataObserver(const std::string &cacheKey) : cacheKey_(cacheKey)
+{
+}
+
+void SettingsDataObserver::OnChange()
+{
+    SettingsDataManager::GetInstance().OnSettingsDataChange(cacheKey_);
+}
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
@@ -18,7 +18,6 @@
 #include <algorithm>
 #include <dlfcn.h>
 #include <list>
-#include <thread>
 
 #include "datetime_ex.h"
 #include "dm_constants.h"
@@ -27,7 +26,9 @@
 #include "distributed_device_profile_errors.h"
 #include "distributed_device_profile_enums.h"
 #include "distributed_device_profile_log.h"
+#include "dp_memory_manager.h"
 #include "event_handler_factory.h"
+#include "ffrt.h"
 #include "i_sync_completed_callback.h"
 #include "kv_adapter.h"
 #include "multi_user_manager.h"
@@ -37,6 +38,7 @@
 #include "profile_utils.h"
 #include "static_profile_manager.h"
 #include "trust_profile_manager.h"
+#include "write_behind_kv_adapter.h"
 
 namespace OHOS {
 namespace DistributedDeviceProfile {
@@ -49,6 +51,7 @@ namespace {
     const std::unordered_set<std::string> NON_OHBASE_NEED_CLEAR_SVR_NAMES {
         "collaborationFwk", "Nfc_Publish_Br_Mac_Address" };
     constexpr uint32_t MAX_MAP_LEN = 1000;
+    const std::string PUT_TEMP_CACHE_NAME = "DeviceProfileManager.putTempCache";
 }
 
 int32_t DeviceProfileManager::Init()
@@ -57,10 +60,16 @@ int32_t DeviceProfileManager::Init()
     int32_t initResult = DP_MANAGER_INIT_FAIL;
     {
         std::lock_guard<std::mutex> lock(dynamicStoreMutex_);
-        deviceProfileStore_ = std::make_shared<KVAdapter>(APP_ID, STORE_ID,
+        std::shared_ptr<IKVAdapter> kvAdapter = std::make_shared<KVAdapter>(APP_ID, STORE_ID,
             std::make_shared<KvDataChangeListener>(STORE_ID),
             std::make_shared<KvSyncCompletedListener>(STORE_ID), std::make_shared<KvDeathRecipient>(STORE_ID),
             DistributedKv::TYPE_DYNAMICAL);
+#ifdef DP_KV_WRITE_BEHIND_ENABLE
+        // bursts of profile puts become one commit, and one change notification, per window
+        deviceProfileStore_ = std::make_shared<WriteBehindKvAdapter>(STORE_ID, kvAdapter);
+#else
+        deviceProfileStore_ = kvAdapter;
+#endif
         initResult = deviceProfileStore_->Init();
         if (initResult != DP_SUCCESS) {
             HILOGE("deviceProfileStore init failed");
@@ -75,6 +84,11 @@ int32_t DeviceProfileManager::Init()
         }
     }
     LoadDpSyncAdapter();
+    // puts waiting for the first sync, they exist nowhere else
+    DpMemoryManager::GetInstance().RegisterCache(PUT_TEMP_CACHE_NAME, [this]() {
+        std::lock_guard<std::mutex> lock(putTempCacheMutex_);
+        return DpMemoryManager::EstimateUsage(putTempCache_);
+    });
     HILOGI("Init finish, res: %{public}d", initResult);
     return initResult;
 }
@@ -91,6 +105,8 @@ int32_t DeviceProfileManager::UnInit()
         deviceProfileStore_->UnInit();
         deviceProfileStore_ = nullptr;
     }
+    GetSyncScheduler()->Reset();
+    DpMemoryManager::GetInstance().UnRegisterCache(PUT_TEMP_CACHE_NAME);
     {
         std::lock_guard<std::mutex> lock(putTempCacheMutex_);
         putTempCache_.clear();
@@ -361,6 +377,32 @@ int32_t DeviceProfileManager::GetCharacteristicProfile(const std::string& device
     return DP_SUCCESS;
 }
 
+int32_t DeviceProfileManager::GetCharacteristicProfileBatch(const std::vector<CharacteristicProfile>& queries,
+    std::vector<CharacteristicProfile>& charProfiles, std::vector<int32_t>& results)
+{
+    charProfiles.clear();
+    results.clear();
+    for (const auto& query : queries) {
+        CharacteristicProfile charProfile;
+        charProfile.SetDeviceId(query.GetDeviceId());
+        charProfile.SetIsMultiUser(query.IsMultiUser());
+        charProfile.SetUserId(query.GetUserId());
+        results.emplace_back(IsMultiUserValid(charProfile));
+        charProfiles.emplace_back(charProfile);
+    }
+    // one store lock for the whole batch instead of one per binder call
+    std::lock_guard<std::mutex> lock(dynamicStoreMutex_);
+    for (size_t i = 0; i < queries.size(); i++) {
+        if (results[i] != DP_SUCCESS) {
+            continue;
+        }
+        results[i] = ProfileControlUtils::GetCharacteristicProfile(deviceProfileStore_, queries[i].GetDeviceId(),
+            queries[i].GetServiceName(), queries[i].GetCharacteristicKey(), charProfiles[i]);
+    }
+    HILOGD("GetCharacteristicProfileBatch end, size: %{public}zu", queries.size());
+    return DP_SUCCESS;
+}
+
 int32_t DeviceProfileManager::DeleteServiceProfile(const std::string& deviceId, const std::string& serviceName,
     bool isMultiUser, int32_t userId)
 {
@@ -507,30 +549,53 @@ int32_t DeviceProfileManager::SyncDeviceProfile(const DistributedDeviceProfile::
     }
     std::string callerDescriptor = PermissionManager::GetInstance().GetCallerProcName();
     if (!ohBasedDevices.empty()) {
-        ProfileCache::GetInstance().AddSyncListener(callerDescriptor, syncCompletedCallback);
         {
             std::lock_guard<std::mutex> lock(dynamicStoreMutex_);
             if (deviceProfileStore_ == nullptr) {
                 HILOGE("deviceProfileStore is nullptr");
                 return DP_SYNC_DEVICE_FAIL;
             }
-            int32_t syncResult = deviceProfileStore_->Sync(ohBasedDevices, syncOptions.GetSyncMode());
-            if (syncResult != DP_SUCCESS) {
-                HILOGE("SyncDeviceProfile fail, res: %{public}d!", syncResult);
-                return DP_SYNC_DEVICE_FAIL;
-            }
+        }
+        int32_t scheduleResult = GetSyncScheduler()->Schedule(ohBasedDevices, syncOptions.GetSyncMode(),
+            syncCompletedCallback);
+        if (scheduleResult != DP_SUCCESS) {
+            HILOGE("SyncDeviceProfile fail, res: %{public}d!", scheduleResult);
+            return DP_SYNC_DEVICE_FAIL;
         }
     }
     if (!notOHBasedDevices.empty()) {
+        // the adapter call can block, keep it off the shared serial handler
         auto syncTask = [this, notOHBasedDevices, callerDescriptor, syncCompletedCallback]() {
             SyncWithNotOHBasedDevice(notOHBasedDevices, callerDescriptor, syncCompletedCallback);
         };
-        std::thread(syncTask).detach();
+        ffrt::submit(syncTask);
     }
     HILOGI("SyncDeviceProfile success, caller: %{public}s!", callerDescriptor.c_str());
     return DP_SUCCESS;
 }
 
+void DeviceProfileManager::OnSyncCompleted(const SyncResult& syncResults)
+{
+    GetSyncScheduler()->OnSyncCompleted(syncResults);
+}
+
+std::shared_ptr<SyncScheduler> DeviceProfileManager::GetSyncScheduler()
+{
+    std::lock_guard<std::mutex> lock(syncSchedulerMutex_);
+    if (syncScheduler_ == nullptr) {
+        auto syncFunc = [this](const std::vector<std::string>& deviceIds, SyncMode syncMode) {
+            std::lock_guard<std::mutex> storeLock(dynamicStoreMutex_);
+            if (deviceProfileStore_ == nullptr) {
+                HILOGE("deviceProfileStore is nullptr");
+                return DP_SYNC_DEVICE_FAIL;
+            }
+            return deviceProfileStore_->Sync(deviceIds, syncMode);
+        };
+        syncScheduler_ = std::make_shared<SyncScheduler>(STORE_ID, syncFunc);
+    }
+    return syncScheduler_;
+}
+
 bool DeviceProfileManager::LoadDpSyncAdapter()
 {
     HILOGI("start.");
@@ -797,8 +862,7 @@ void DeviceProfileManager::FixDataOnDeviceOnline(const TrustedDeviceInfo& device
         }
         FixRemoteDataWhenPeerIsOHBase(deviceInfo.GetUdid(), localDataByOwner);
     };
-    auto handler = EventHandlerFactory::GetInstance().GetEventHandler();
-    if (handler == nullptr || !handler->PostTask(task)) {
+    if (!EventHandlerFactory::GetInstance().PostTask(task)) {
         HILOGE("Post FixDataOnDeviceOnline task faild");
         return;
     }
@@ -906,8 +970,7 @@ void DeviceProfileManager::NotifyNotOHBaseOnline(const TrustedDeviceInfo& device
             return;
         }
     };
-    auto handler = EventHandlerFactory::GetInstance().GetEventHandler();
-    if (handler == nullptr || !handler->PostTask(task)) {
+    if (!EventHandlerFactory::GetInstance().PostTask(task)) {
         HILOGE("Post NotifyNotOHBaseOnline task faild");
         return;
     }
@@ -927,20 +990,14 @@ void DeviceProfileManager::E2ESyncDynamicProfile(const TrustedDeviceInfo& device
                 ProfileUtils::GetAnonyString(deviceInfo.GetNetworkId()).c_str());
             return;
         }
-        std::lock_guard<std::mutex> lock(dynamicStoreMutex_);
-        if (deviceProfileStore_ == nullptr) {
-            HILOGE("deviceProfileStore is nullptr");
-            return;
-        }
-        int32_t syncResult = deviceProfileStore_->Sync({deviceInfo.GetNetworkId()}, SyncMode::PUSH_PULL);
+        int32_t syncResult = GetSyncScheduler()->Schedule({deviceInfo.GetNetworkId()}, SyncMode::PUSH_PULL, nullptr);
         if (syncResult != DP_SUCCESS) {
             HILOGE("E2ESyncDynamicProfile fail, res: %{public}d!", syncResult);
             return;
         }
         HILOGI("E2ESyncDynamicProfile success!");
     };
-    auto handler = EventHandlerFactory::GetInstance().GetEventHandler();
-    if (handler == nullptr || !handler->PostTask(task)) {
+    if (!EventHandlerFactory::GetInstance().PostTask(task)) {
         HILOGE("Post E2ESyncDynamicProfile task fail!");
         return;
     }
@@ -16,6 +16,7 @@
 #include "listener/kv_data_change_listener.h"
 
 #include <algorithm>
+#include <array>
 #include <cinttypes>
 #include <thread>
 
@@ -46,6 +47,24 @@ namespace {
     const std::string STATIC_STORE_ID = "dp_kv_static_store";
     constexpr uint32_t MAX_SWITCH_CACHE_SIZE = 1000;
     constexpr int32_t DEVICE_UUID_LENGTH = 65;
+    constexpr int32_t SWITCH_WIDTH = static_cast<int32_t>(SwitchFlag::SWITCH_FLAG_MAX);
+    constexpr uint32_t SWITCH_VALID_BITS = (1u << SWITCH_WIDTH) - 1;
+
+    // switch position to service name, built once instead of searching SWITCH_SERVICE_MAP per bit
+    const std::array<std::string, SWITCH_WIDTH>& GetSwitchServiceNames()
+    {
+        static const std::array<std::string, SWITCH_WIDTH> serviceNames = []() {
+            std::array<std::string, SWITCH_WIDTH> names;
+            for (const auto& [serviceName, switchFlag] : SWITCH_SERVICE_MAP) {
+                int32_t pos = static_cast<int32_t>(switchFlag);
+                if (pos >= 0 && pos < SWITCH_WIDTH) {
+                    names[pos] = serviceName;
+                }
+            }
+            return names;
+        }();
+        return serviceNames;
+    }
 }
 
 KvDataChangeListener::KvDataChangeListener(const std::string& storeId)
@@ -298,6 +317,9 @@ void KvDataChangeListener::OnSwitchChange(const DistributedKv::SwitchNotificatio
             return;
         }
         SwitchUpdater::GetInstance().EraseSwitchCacheMap(netWorkId);
+        if (udid != ProfileCache::GetInstance().GetLocalUdid()) {
+            ProfileCache::GetInstance().SetRemoteSwitch(netWorkId, notification.data.value);
+        }
         SwitchUpdater::GetInstance().HandleSwitchUpdateChange(udid, notification.data.value);
     };
     std::thread(task).detach();
@@ -409,6 +431,7 @@ void SwitchUpdater::OnDeviceOnline(const TrustedDeviceInfo& deviceInfo)
         return;
     }
     uint32_t switchValue = item->second;
+    ProfileCache::GetInstance().SetRemoteSwitch(onlineNetworkId, switchValue);
     HandleSwitchUpdateChange(onlineUdid, switchValue);
     switchCacheMap_.erase(item);
     HILOGI("end");
@@ -417,58 +440,57 @@ void SwitchUpdater::OnDeviceOnline(const TrustedDeviceInfo& deviceInfo)
 void SwitchUpdater::HandleSwitchUpdateChange(const std::string& udid, uint32_t switchValue)
 {
     HILOGI("udid: %{public}s, switch: %{public}u", ProfileUtils::GetAnonyString(udid).c_str(), switchValue);
-    std::string serviceName;
-
-    for (int32_t i = (int32_t)SwitchFlag::SWITCH_FLAG_MIN + NUM_1;
-        i < (int32_t)SwitchFlag::SWITCH_FLAG_MAX; ++i) {
-        std::string itemSwitchValue = std::to_string((switchValue >> i) & NUM_1);
-        int32_t res = ProfileCache::GetInstance().GetServiceNameByPos(i, SWITCH_SERVICE_MAP, serviceName);
-        if (res != DP_SUCCESS || serviceName.empty()) {
-            HILOGE("GetServiceNameByPos failed, pos:%{public}d", i);
-            return;
-        }
-        res = GenerateSwitchNotify(udid, serviceName, SWITCH_STATUS,
-        itemSwitchValue, ChangeType::UPDATE);
-        if (res != DP_SUCCESS) {
-            HILOGE("GenerateSwitchNotify failed, res: %{public}d", res);
-            return;
-        }
-        if (udid == ProfileCache::GetInstance().GetLocalUdid()) {
-            ProfileCache::GetInstance().SetCurSwitch(switchValue);
-            HILOGD("update curLocalSwitch: %{public}d", ProfileCache::GetInstance().GetSwitch());
+    if (!ProfileUtils::IsKeyValid(udid)) {
+        HILOGE("Params are invalid!");
+        return;
+    }
+    bool isFirstSwitch = true;
+    uint32_t changedBits = SWITCH_VALID_BITS;
+    if (udid == ProfileCache::GetInstance().GetLocalUdid()) {
+        // the local switch is also written by put, the cache is the one record that follows both
+        ProfileCache::GetInstance().SetCurSwitch(switchValue);
+        HILOGD("update curLocalSwitch: %{public}d", ProfileCache::GetInstance().GetSwitch());
+    } else {
+        changedBits = ExchangeLastSwitch(udid, switchValue, isFirstSwitch);
+    }
+    const auto& serviceNames = GetSwitchServiceNames();
+    std::vector<CharacteristicProfile> switchProfiles;
+    while (changedBits != 0) {
+        int32_t pos = __builtin_ctz(changedBits);
+        changedBits &= changedBits - 1;
+        CharacteristicProfile switchProfile(udid, serviceNames[pos], SWITCH_STATUS,
+            ((switchValue >> pos) & NUM_1) != 0 ? SWITCH_ON : SWITCH_OFF);
+        // without a last switch the cache is the only record of what subscribers have seen
+        if (isFirstSwitch && ProfileCache::GetInstance().IsCharProfileExist(switchProfile)) {
+            continue;
         }
+        ProfileCache::GetInstance().AddCharProfile(switchProfile);
+        switchProfiles.emplace_back(std::move(switchProfile));
+    }
+    if (switchProfiles.empty()) {
+        HILOGD("switch is not change");
+        return;
+    }
+    int32_t res = SubscribeProfileManager::GetInstance().NotifySwitchChange(switchProfiles);
+    if (res != DP_SUCCESS) {
+        HILOGE("NotifySwitchChange failed, res: %{public}d", res);
     }
 }
 
-int32_t SwitchUpdater::GenerateSwitchNotify(const std::string& udid, const std::string& serviceName,
-    const std::string& characteristicProfileKey, const std::string& characteristicProfileValue, ChangeType changeType)
+uint32_t SwitchUpdater::ExchangeLastSwitch(const std::string& udid, uint32_t switchValue, bool& isFirstSwitch)
 {
-    if (!ProfileUtils::IsKeyValid(udid) ||
-        !ProfileUtils::IsKeyValid(serviceName) ||
-        !ProfileUtils::IsKeyValid(characteristicProfileKey) ||
-        !ProfileUtils::IsKeyValid(characteristicProfileValue)) {
-        HILOGE("Params are invalid!");
-        return DP_INVALID_PARAMS;
-    }
-
-    CharacteristicProfile newSwitchProfile = {udid, serviceName, characteristicProfileKey,
-        characteristicProfileValue};
-    HILOGI("Gen SwitchProfile :%{public}s", newSwitchProfile.dump().c_str());
-    if (ProfileCache::GetInstance().IsCharProfileExist(newSwitchProfile)) {
-        HILOGW("switch is not change");
-        return DP_SUCCESS;
-    }
-    const CharacteristicProfile cacheProfile = newSwitchProfile;
-    ProfileCache::GetInstance().AddCharProfile(cacheProfile);
-    std::string dbKey = ProfileUtils::GetDbKeyByProfile(newSwitchProfile);
-    ProfileType profileType = ProfileUtils::GetProfileType(dbKey);
-    int32_t res = SubscribeProfileManager::GetInstance().NotifyProfileChange(profileType, changeType, dbKey,
-        newSwitchProfile.GetCharacteristicValue());
-    if (res != DP_SUCCESS) {
-        HILOGE("NotifyProfileChange failed");
-        return DP_GENERATE_SWITCH_NOTIFY_FAIL;
+    std::lock_guard<std::mutex> lock(lastSwitchMapMutex_);
+    auto iter = lastSwitchMap_.find(udid);
+    isFirstSwitch = iter == lastSwitchMap_.end();
+    if (isFirstSwitch) {
+        if (lastSwitchMap_.size() < MAX_SWITCH_CACHE_SIZE) {
+            lastSwitchMap_[udid] = switchValue;
+        }
+        return SWITCH_VALID_BITS;
     }
-    return DP_SUCCESS;
+    uint32_t changedBits = (iter->second ^ switchValue) & SWITCH_VALID_BITS;
+    iter->second = switchValue;
+    return changedBits;
 }
 
 void SwitchUpdater::AddSwitchCacheMap(const std::string& netWorkId, uint32_t switchValue)
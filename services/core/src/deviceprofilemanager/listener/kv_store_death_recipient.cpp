@@ -21,6 +21,7 @@
 #include "distributed_device_profile_constants.h"
 #include "static_profile_manager.h"
 #include "service_info_manager.h"
+#include "subscribe_profile_manager.h"
 
 namespace OHOS {
 namespace DistributedDeviceProfile {
@@ -31,6 +32,7 @@ namespace {
     const std::string STATIC_STORE_ID = "dp_kv_static_store";
     const std::string BUSINESS_STORE_ID = "dp_kv_store_business";
     const std::string SERVICE_INFO_STORE_ID = "dp_kv_store_service_info_profile";
+    const std::string SUBSCRIBE_STORE_ID = "dp_kv_store_subscribe_info";
 }
 
 KvDeathRecipient::KvDeathRecipient(const std::string& storeId)
@@ -74,6 +76,9 @@ void KvDeathRecipient::OnRemoteDied()
         if (storeId == SERVICE_INFO_STORE_ID) {
             ServiceInfoManager::GetInstance().ReInit();
         }
+        if (storeId == SUBSCRIBE_STORE_ID) {
+            SubscribeProfileManager::GetInstance().ReInit();
+        }
     };
     {
         std::lock_guard<std::mutex> lock(reInitMutex_);
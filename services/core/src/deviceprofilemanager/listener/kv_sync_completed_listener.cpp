@@ -20,11 +20,10 @@
 #include "datetime_ex.h"
 #include "string_ex.h"
 
+#include "device_profile_manager.h"
 #include "distributed_device_profile_log.h"
 #include "event_handler_factory.h"
-#include "i_sync_completed_callback.h"
 #include "profile_utils.h"
-#include "profile_cache.h"
 #include "static_profile_manager.h"
 
 namespace OHOS {
@@ -72,9 +71,11 @@ void KvSyncCompletedListener::SyncCompleted(const std::map<std::string, Distribu
     auto notifyTask = [this, syncResults = std::move(syncResults)]() {
         if (storeId_ == DYNAMIC_STORE_ID) {
             NotifySyncCompleted(syncResults);
+            return;
         }
         if (storeId_ == STATIC_STORE_ID) {
             NotifyStaticSyncCompleted(syncResults);
+            return;
         }
         HILOGE("storeId invalid,storeId:%{public}s", storeId_.c_str());
     };
@@ -94,17 +95,7 @@ void KvSyncCompletedListener::SyncCompleted(const std::map<std::string, Distribu
 void KvSyncCompletedListener::NotifySyncCompleted(const SyncResults& syncResults)
 {
     int64_t beginTime = GetTickCount();
-    std::map<std::string, sptr<IRemoteObject>> syncListeners;
-    ProfileCache::GetInstance().GetSyncListeners(syncListeners);
-    for (const auto& [_, syncListenerStub] : syncListeners) {
-        sptr<ISyncCompletedCallback> syncListenerProxy = iface_cast<ISyncCompletedCallback>(syncListenerStub);
-        if (syncListenerProxy == nullptr) {
-            HILOGE("Cast to ISyncCompletedCallback failed");
-            continue;
-        }
-        syncListenerProxy->OnSyncCompleted(syncResults);
-    }
-    ProfileCache::GetInstance().RemoveSyncListeners(syncListeners);
+    DeviceProfileManager::GetInstance().OnSyncCompleted(syncResults);
     int64_t endTime = GetTickCount();
     HILOGI("spend %{public}" PRId64 " ms", endTime - beginTime);
 }
@@ -112,17 +103,7 @@ void KvSyncCompletedListener::NotifySyncCompleted(const SyncResults& syncResults
 void KvSyncCompletedListener::NotifyStaticSyncCompleted(const SyncResults& syncResults)
 {
     int64_t beginTime = GetTickCount();
-    std::map<std::string, sptr<IRemoteObject>> syncListeners;
-    StaticProfileManager::GetInstance().GetSyncListeners(syncListeners);
-    for (const auto& [_, syncListenerStub] : syncListeners) {
-        sptr<ISyncCompletedCallback> syncListenerProxy = iface_cast<ISyncCompletedCallback>(syncListenerStub);
-        if (syncListenerProxy == nullptr) {
-            HILOGE("Cast to ISyncCompletedCallback failed");
-            continue;
-        }
-        syncListenerProxy->OnSyncCompleted(syncResults);
-    }
-    StaticProfileManager::GetInstance().RemoveSyncListeners(syncListeners);
+    StaticProfileManager::GetInstance().OnSyncCompleted(syncResults);
     int64_t endTime = GetTickCount();
     HILOGI("spend %{public}" PRId64 " ms", endTime - beginTime);
 }
@@ -41,6 +41,8 @@ namespace {
     const std::string TAG = "StaticProfileManager";
     const std::string APP_ID = "distributed_device_profile_service";
     const std::string STORE_ID = "dp_kv_static_store";
+    const std::string STATIC_INFO_INDEX_SEPARATOR = "#";
+    constexpr size_t MAX_STATIC_INFO_INDEX_SIZE = 64;
 }
 
 int32_t StaticProfileManager::Init()
@@ -71,6 +73,8 @@ int32_t StaticProfileManager::UnInit()
         staticProfileStore_->UnInit();
         staticProfileStore_ = nullptr;
     }
+    GetSyncScheduler()->Reset();
+    ClearStaticInfoIndex();
     return DP_SUCCESS;
 }
 
@@ -106,7 +110,7 @@ int32_t StaticProfileManager::GetCharacteristicProfile(const std::string& device
         ProfileUtils::GetAnonyString(deviceId).c_str(), serviceName.c_str(), characteristicKey.c_str());
     if (ProfileCache::GetInstance().GetStaticCharacteristicProfile(deviceId, serviceName, characteristicKey,
         charProfile) == DP_SUCCESS) {
-        HILOGI("profile: %{public}s!", charProfile.dump().c_str());
+        HILOGD("profile: %{public}s!", charProfile.dump().c_str());
         return DP_SUCCESS;
     }
     CharacteristicProfile staticCapabilityProfile;
@@ -120,21 +124,21 @@ int32_t StaticProfileManager::GetCharacteristicProfile(const std::string& device
         HILOGE("GetCharacteristicProfile fail, reason: %{public}d!", getResult);
         return getResult;
     }
-    HILOGI("profile : %{public}s", staticCapabilityProfile.dump().c_str());
-    std::unordered_map<std::string, CharacteristicProfile> staticInfoProfiles;
-    int generateProfileResult = GenerateStaticInfoProfile(staticCapabilityProfile, staticInfoProfiles);
-    if (generateProfileResult != DP_SUCCESS) {
-        HILOGE("GenerateStaticInfoProfile fail, reason: %{public}d!", generateProfileResult);
-        return generateProfileResult;
+    HILOGD("profile : %{public}s", staticCapabilityProfile.dump().c_str());
+    std::shared_ptr<const StaticInfoIndex> index = nullptr;
+    int32_t indexResult = GetStaticInfoIndex(staticCapabilityProfile, index);
+    if (indexResult != DP_SUCCESS) {
+        HILOGE("GetStaticInfoIndex fail, reason: %{public}d!", indexResult);
+        return indexResult;
     }
-    std::string charProfileKey = ProfileUtils::GenerateCharProfileKey(deviceId, serviceName, characteristicKey);
-    if (staticInfoProfiles.find(charProfileKey) == staticInfoProfiles.end()) {
+    auto iter = index->charValues.find(serviceName);
+    if (characteristicKey != STATIC_CHARACTERISTIC_KEY || iter == index->charValues.end()) {
         HILOGE("charKey not exist, deviceId: %{public}s, serviceName: %{public}s, characteristicKey: %{public}s",
             ProfileUtils::GetAnonyString(deviceId).c_str(), serviceName.c_str(), characteristicKey.c_str());
         return DP_NOT_FOUND_FAIL;
     }
-    charProfile = staticInfoProfiles[charProfileKey];
-    ProfileCache::GetInstance().AddStaticCharProfileBatch(staticInfoProfiles);
+    charProfile = CharacteristicProfile(deviceId, serviceName, STATIC_CHARACTERISTIC_KEY, iter->second);
+    ProfileCache::GetInstance().AddStaticCharProfile(charProfile);
     return DP_SUCCESS;
 }
 
@@ -158,7 +162,21 @@ int32_t StaticProfileManager::GenerateStaticInfoProfile(const CharacteristicProf
     std::unordered_map<std::string, CharacteristicProfile>& staticInfoProfiles)
 {
     HILOGD("call!");
-    std::string charValue = staticCapabilityProfile.GetCharacteristicValue();
+    std::string staticCapabilityVersion = "";
+    std::string staticCapabilityValue = "";
+    int32_t parseResult = ParseStaticCapability(staticCapabilityProfile.GetCharacteristicValue(),
+        staticCapabilityVersion, staticCapabilityValue);
+    if (parseResult != DP_SUCCESS) {
+        return parseResult;
+    }
+    StaticCapabilityLoader::GetInstance().LoadStaticProfiles(staticCapabilityProfile.GetDeviceId(),
+        staticCapabilityValue, staticCapabilityVersion, staticInfoProfiles);
+    return DP_SUCCESS;
+}
+
+int32_t StaticProfileManager::ParseStaticCapability(const std::string& charValue,
+    std::string& staticCapabilityVersion, std::string& staticCapabilityValue)
+{
     cJSON* charValueJson = cJSON_Parse(charValue.c_str());
     if (!cJSON_IsObject(charValueJson)) {
         HILOGE("cJSON_Parse fail! charValue : %{public}s", ProfileUtils::GetAnonyString(charValue).c_str());
@@ -172,20 +190,79 @@ int32_t StaticProfileManager::GenerateStaticInfoProfile(const CharacteristicProf
         cJSON_Delete(charValueJson);
         return DP_PARSE_STATIC_CAP_FAIL;
     }
-    std::string staticCapabilityVersion = staticCapabilityVersionItem->valuestring;
+    staticCapabilityVersion = staticCapabilityVersionItem->valuestring;
     cJSON* staticCapabilityValueItem = cJSON_GetObjectItemCaseSensitive(charValueJson, STATIC_CAPABILITY_VALUE.c_str());
     if (!cJSON_IsString(staticCapabilityValueItem) || (staticCapabilityValueItem->valuestring == NULL)) {
         HILOGE("staticCapabilityValue is invalid!");
         cJSON_Delete(charValueJson);
         return DP_PARSE_STATIC_CAP_FAIL;
     }
-    std::string staticCapabilityValue = staticCapabilityValueItem->valuestring;
+    staticCapabilityValue = staticCapabilityValueItem->valuestring;
     cJSON_Delete(charValueJson);
-    StaticCapabilityLoader::GetInstance().LoadStaticProfiles(staticCapabilityProfile.GetDeviceId(),
-        staticCapabilityValue, staticCapabilityVersion, staticInfoProfiles);
     return DP_SUCCESS;
 }
 
+int32_t StaticProfileManager::GetStaticInfoIndex(const CharacteristicProfile& staticCapabilityProfile,
+    std::shared_ptr<const StaticInfoIndex>& index)
+{
+    std::string deviceId = staticCapabilityProfile.GetDeviceId();
+    std::string charValue = staticCapabilityProfile.GetCharacteristicValue();
+    {
+        std::lock_guard<std::mutex> lock(staticInfoIndexMutex_);
+        auto iter = deviceStaticInfos_.find(deviceId);
+        if (iter != deviceStaticInfos_.end() && iter->second.staticCapabilityCharValue == charValue) {
+            index = iter->second.index;
+            return DP_SUCCESS;
+        }
+    }
+    std::string staticCapabilityVersion = "";
+    std::string staticCapabilityValue = "";
+    int32_t parseResult = ParseStaticCapability(charValue, staticCapabilityVersion, staticCapabilityValue);
+    if (parseResult != DP_SUCCESS) {
+        return parseResult;
+    }
+    std::string indexKey = staticCapabilityVersion + STATIC_INFO_INDEX_SEPARATOR + staticCapabilityValue;
+    {
+        std::lock_guard<std::mutex> lock(staticInfoIndexMutex_);
+        auto iter = staticInfoIndexes_.find(indexKey);
+        if (iter != staticInfoIndexes_.end()) {
+            index = iter->second;
+        }
+    }
+    if (index == nullptr) {
+        std::unordered_map<std::string, CharacteristicProfile> staticInfoProfiles;
+        int32_t loadResult = StaticCapabilityLoader::GetInstance().LoadStaticProfiles(deviceId,
+            staticCapabilityValue, staticCapabilityVersion, staticInfoProfiles);
+        if (loadResult != DP_SUCCESS) {
+            HILOGE("LoadStaticProfiles fail, reason: %{public}d!", loadResult);
+            return loadResult;
+        }
+        auto newIndex = std::make_shared<StaticInfoIndex>();
+        for (const auto& [_, profile] : staticInfoProfiles) {
+            newIndex->charValues[profile.GetServiceName()] = profile.GetCharacteristicValue();
+        }
+        index = newIndex;
+        HILOGI("static info index generated, size: %{public}zu", newIndex->charValues.size());
+    }
+    std::lock_guard<std::mutex> lock(staticInfoIndexMutex_);
+    if (staticInfoIndexes_.size() >= MAX_STATIC_INFO_INDEX_SIZE && staticInfoIndexes_.count(indexKey) == 0) {
+        staticInfoIndexes_.clear();
+    }
+    staticInfoIndexes_.emplace(indexKey, index);
+    if (deviceStaticInfos_.size() >= MAX_DEVICE_SIZE && deviceStaticInfos_.count(deviceId) == 0) {
+        deviceStaticInfos_.clear();
+    }
+    deviceStaticInfos_[deviceId] = {charValue, index};
+    return DP_SUCCESS;
+}
+
+void StaticProfileManager::ClearStaticInfoIndex()
+{
+    std::lock_guard<std::mutex> lock(staticInfoIndexMutex_);
+    staticInfoIndexes_.clear();
+    deviceStaticInfos_.clear();
+}
+
 void StaticProfileManager::E2ESyncStaticProfile(const TrustedDeviceInfo& deviceInfo)
 {
     HILOGI("deviceInfo:%{public}s", deviceInfo.dump().c_str());
@@ -200,20 +277,14 @@ void StaticProfileManager::E2ESyncStaticProfile(const TrustedDeviceInfo& deviceI
                 ProfileUtils::GetAnonyString(deviceInfo.GetNetworkId()).c_str());
             return;
         }
-        std::lock_guard<std::mutex> lock(staticStoreMutex_);
-        if (staticProfileStore_ == nullptr) {
-            HILOGE("staticProfileStore is nullptr");
-            return;
-        }
-        int32_t syncResult = staticProfileStore_->Sync({deviceInfo.GetNetworkId()}, SyncMode::PUSH_PULL);
+        int32_t syncResult = GetSyncScheduler()->Schedule({deviceInfo.GetNetworkId()}, SyncMode::PUSH_PULL, nullptr);
         if (syncResult != DP_SUCCESS) {
             HILOGE("E2ESyncStaticProfile fail, res: %{public}d!", syncResult);
             return;
         }
         HILOGI("E2ESyncStaticProfile success!");
     };
-    auto handler = EventHandlerFactory::GetInstance().GetEventHandler();
-    if (handler == nullptr || !handler->PostTask(task)) {
+    if (!EventHandlerFactory::GetInstance().PostTask(task)) {
         HILOGE("Post E2ESyncStaticProfile task fail!");
         return;
     }
@@ -236,74 +307,43 @@ int32_t StaticProfileManager::SyncStaticProfile(const DpSyncOptions& syncOptions
         return DP_INVALID_PARAMS;
     }
     std::string callerDescriptor = PermissionManager::GetInstance().GetCallerProcName();
-    int32_t addRet = AddSyncListener(callerDescriptor, syncCompletedCallback);
-    if (addRet != DP_SUCCESS) {
-        return addRet;
-    }
     {
         std::lock_guard<std::mutex> lock(staticStoreMutex_);
         if (staticProfileStore_ == nullptr) {
             HILOGE("staticProfileStore is nullptr");
             return DP_NULLPTR;
         }
-        int32_t syncResult = staticProfileStore_->Sync(ohBasedDevices, syncOptions.GetSyncMode());
-        if (syncResult != DP_SUCCESS) {
-            HILOGE("SyncStaticProfile fail, res: %{public}d!", syncResult);
-            return DP_SYNC_DEVICE_FAIL;
-        }
     }
-    HILOGI("SyncStaticProfile success, caller: %{public}s!", callerDescriptor.c_str());
-    return DP_SUCCESS;
-}
-
-int32_t StaticProfileManager::AddSyncListener(const std::string& caller, sptr<IRemoteObject> syncListener)
-{
-    if (caller.empty() || caller.size() > MAX_STRING_LEN || syncListener == nullptr) {
-        HILOGE("params is invalid!");
-        return DP_INVALID_PARAMS;
-    }
-    {
-        std::lock_guard<std::mutex> lock(syncListenerMapMutex_);
-        if (syncListenerMap_.size() > MAX_LISTENER_SIZE) {
-            HILOGE("syncListenerMap is exceed max listenerSize!");
-            return DP_EXCEED_MAX_SIZE_FAIL;
-        }
-        HILOGI("caller %{public}s!", caller.c_str());
-        syncListener->AddDeathRecipient(syncListenerDeathRecipient_);
-        syncListenerMap_[caller] = syncListener;
+    int32_t syncResult = GetSyncScheduler()->Schedule(ohBasedDevices, syncOptions.GetSyncMode(),
+        syncCompletedCallback);
+    if (syncResult != DP_SUCCESS) {
+        HILOGE("SyncStaticProfile fail, res: %{public}d!", syncResult);
+        return DP_SYNC_DEVICE_FAIL;
     }
+    HILOGI("SyncStaticProfile success, caller: %{public}s!", callerDescriptor.c_str());
     return DP_SUCCESS;
 }
 
-void StaticProfileManager::GetSyncListeners(std::map<std::string, sptr<IRemoteObject>>& syncListeners)
+void StaticProfileManager::OnSyncCompleted(const SyncResult& syncResults)
 {
-    HILOGD("call!");
-    {
-        std::lock_guard<std::mutex> lock(syncListenerMapMutex_);
-        for (const auto& item : syncListenerMap_) {
-            syncListeners[item.first] = item.second;
-        }
-    }
+    GetSyncScheduler()->OnSyncCompleted(syncResults);
 }
 
-void StaticProfileManager::RemoveSyncListeners(std::map<std::string, sptr<IRemoteObject>> syncListeners)
+std::shared_ptr<SyncScheduler> StaticProfileManager::GetSyncScheduler()
 {
-    HILOGD("call!");
-    {
-        std::lock_guard<std::mutex> lock(syncListenerMapMutex_);
-        auto iter = syncListenerMap_.begin();
-        while (iter!= syncListenerMap_.end()) {
-            if (syncListeners.count(iter->first) != 0) {
-                if (iter->second != nullptr) {
-                    iter->second->RemoveDeathRecipient(syncListenerDeathRecipient_);
-                }
-                HILOGI("caller %{public}s!", iter->first.c_str());
-                iter = syncListenerMap_.erase(iter);
-            } else {
-                iter++;
+    std::lock_guard<std::mutex> lock(syncSchedulerMutex_);
+    if (syncScheduler_ == nullptr) {
+        auto syncFunc = [this](const std::vector<std::string>& deviceIds, SyncMode syncMode) {
+            std::lock_guard<std::mutex> storeLock(staticStoreMutex_);
+            if (staticProfileStore_ == nullptr) {
+                HILOGE("staticProfileStore is nullptr");
+                return DP_NULLPTR;
             }
-        }
+            return staticProfileStore_->Sync(deviceIds, syncMode);
+        };
+        syncScheduler_ = std::make_shared<SyncScheduler>(STORE_ID, syncFunc);
     }
+    return syncScheduler_;
 }
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sync_scheduler.h"
+
+#include "datetime_ex.h"
+
+#include "distributed_device_profile_constants.h"
+#include "distributed_device_profile_errors.h"
+#include "distributed_device_profile_log.h"
+#include "event_handler_factory.h"
+#include "profile_utils.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+namespace {
+    const std::string TAG = "SyncScheduler";
+    const std::string SYNC_TIMEOUT_TASK_PREFIX = "sync_timeout_";
+}
+
+SyncScheduler::SyncScheduler(const std::string& name, SyncFunc syncFunc, uint32_t maxInFlight, int64_t timeoutMs)
+    : name_(name), syncFunc_(std::move(syncFunc)), maxInFlight_(maxInFlight == 0 ? 1 : maxInFlight),
+    timeoutMs_(timeoutMs)
+{
+}
+
+int32_t SyncScheduler::Schedule(const std::vector<std::string>& deviceIds, SyncMode syncMode,
+    sptr<IRemoteObject> syncCompletedCallback)
+{
+    if (deviceIds.empty() || deviceIds.size() > MAX_DEVICE_SIZE || syncMode <= SyncMode::MIN ||
+        syncMode >= SyncMode::MAX) {
+        HILOGE("params is invalid!");
+        return DP_INVALID_PARAMS;
+    }
+    auto waiter = std::make_shared<SyncWaiter>();
+    waiter->callback = syncCompletedCallback;
+    waiter->remaining.insert(deviceIds.begin(), deviceIds.end());
+    {
+        std::lock_guard<std::mutex> lock(schedulerMutex_);
+        if (devices_.size() + waiter->remaining.size() > MAX_DEVICE_SIZE) {
+            HILOGE("%{public}s too many devices waiting for sync!", name_.c_str());
+            return DP_EXCEED_MAX_SIZE_FAIL;
+        }
+        for (const auto& deviceId : waiter->remaining) {
+            DeviceSyncState& state = devices_[deviceId];
+            if (state.queued) {
+                HILOGI("%{public}s merge sync, deviceId: %{public}s", name_.c_str(),
+                    ProfileUtils::GetAnonyString(deviceId).c_str());
+            } else if (!state.inFlight) {
+                readyQueue_.push_back(deviceId);
+            }
+            state.queued = true;
+            state.queuedMode = MergeSyncMode(state.queuedMode, syncMode);
+            state.queuedWaiters.emplace_back(waiter);
+        }
+    }
+    Dispatch();
+    return DP_SUCCESS;
+}
+
+void SyncScheduler::OnSyncCompleted(const SyncResult& syncResults)
+{
+    std::vector<std::shared_ptr<SyncWaiter>> doneWaiters;
+    {
+        std::lock_guard<std::mutex> lock(schedulerMutex_);
+        for (const auto& [deviceId, status] : syncResults) {
+            FinishLocked(deviceId, status, doneWaiters);
+        }
+    }
+    NotifyWaiters(doneWaiters);
+    Dispatch();
+}
+
+void SyncScheduler::CheckTimeout()
+{
+    std::vector<std::shared_ptr<SyncWaiter>> doneWaiters;
+    bool hasInFlight = false;
+    {
+        std::lock_guard<std::mutex> lock(schedulerMutex_);
+        timeoutCheckPosted_ = false;
+        int64_t nowMs = GetTickCount();
+        std::vector<std::string> timeoutDevices;
+        for (const auto& [deviceId, state] : devices_) {
+            if (state.inFlight && nowMs - state.dispatchTimeMs >= timeoutMs_) {
+                timeoutDevices.emplace_back(deviceId);
+            }
+        }
+        for (const auto& deviceId : timeoutDevices) {
+            HILOGW("%{public}s sync timeout, deviceId: %{public}s", name_.c_str(),
+                ProfileUtils::GetAnonyString(deviceId).c_str());
+            FinishLocked(deviceId, SyncStatus::FAILED, doneWaiters);
+        }
+        hasInFlight = inFlightCount_ > 0;
+    }
+    NotifyWaiters(doneWaiters);
+    Dispatch();
+    if (hasInFlight) {
+        PostTimeoutCheck();
+    }
+}
+
+void SyncScheduler::Reset()
+{
+    std::vector<std::shared_ptr<SyncWaiter>> doneWaiters;
+    {
+        std::lock_guard<std::mutex> lock(schedulerMutex_);
+        for (auto& [deviceId, state] : devices_) {
+            state.inFlightWaiters.insert(state.inFlightWaiters.end(), state.queuedWaiters.begin(),
+                state.queuedWaiters.end());
+            for (auto& waiter : state.inFlightWaiters) {
+                waiter->results[deviceId] = SyncStatus::FAILED;
+                if (waiter->remaining.erase(deviceId) != 0 && waiter->remaining.empty()) {
+                    doneWaiters.emplace_back(waiter);
+                }
+            }
+        }
+        devices_.clear();
+        readyQueue_.clear();
+        inFlightCount_ = 0;
+    }
+    NotifyWaiters(doneWaiters);
+}
+
+uint32_t SyncScheduler::GetInFlightCount()
+{
+    std::lock_guard<std::mutex> lock(schedulerMutex_);
+    return inFlightCount_;
+}
+
+size_t SyncScheduler::GetQueuedCount()
+{
+    std::lock_guard<std::mutex> lock(schedulerMutex_);
+    size_t queuedCount = 0;
+    for (const auto& [_, state] : devices_) {
+        if (state.queued) {
+            queuedCount++;
+        }
+    }
+    return queuedCount;
+}
+
+void SyncScheduler::Dispatch()
+{
+    while (true) {
+        // peers dispatched together with the same mode share one kv sync call
+        std::map<SyncMode, std::vector<std::string>> batches;
+        {
+            std::lock_guard<std::mutex> lock(schedulerMutex_);
+            int64_t nowMs = GetTickCount();
+            while (inFlightCount_ < maxInFlight_ && !readyQueue_.empty()) {
+                std::string deviceId = readyQueue_.front();
+                readyQueue_.pop_front();
+                auto iter = devices_.find(deviceId);
+                if (iter == devices_.end() || !iter->second.queued || iter->second.inFlight) {
+                    continue;
+                }
+                DeviceSyncState& state = iter->second;
+                state.inFlight = true;
+                state.dispatchTimeMs = nowMs;
+                state.inFlightWaiters.swap(state.queuedWaiters);
+                state.queuedWaiters.clear();
+                state.queued = false;
+                batches[state.queuedMode].emplace_back(deviceId);
+                state.queuedMode = SyncMode::MIN;
+                inFlightCount_++;
+            }
+        }
+        if (batches.empty()) {
+            return;
+        }
+        PostTimeoutCheck();
+        std::vector<std::shared_ptr<SyncWaiter>> doneWaiters;
+        for (const auto& [syncMode, deviceIds] : batches) {
+            int32_t syncResult = syncFunc_ == nullptr ? DP_NULLPTR : syncFunc_(deviceIds, syncMode);
+            if (syncResult == DP_SUCCESS) {
+                HILOGI("%{public}s sync dispatched, size: %{public}zu", name_.c_str(), deviceIds.size());
+                continue;
+            }
+            HILOGE("%{public}s sync fail, res: %{public}d!", name_.c_str(), syncResult);
+            std::lock_guard<std::mutex> lock(schedulerMutex_);
+            for (const auto& deviceId : deviceIds) {
+                FinishLocked(deviceId, SyncStatus::FAILED, doneWaiters);
+            }
+        }
+        NotifyWaiters(doneWaiters);
+    }
+}
+
+void SyncScheduler::FinishLocked(const std::string& deviceId, SyncStatus status,
+    std::vector<std::shared_ptr<SyncWaiter>>& doneWaiters)
+{
+    auto iter = devices_.find(deviceId);
+    if (iter == devices_.end() || !iter->second.inFlight) {
+        HILOGD("%{public}s no sync in flight, deviceId: %{public}s", name_.c_str(),
+            ProfileUtils::GetAnonyString(deviceId).c_str());
+        return;
+    }
+    DeviceSyncState& state = iter->second;
+    for (auto& waiter : state.inFlightWaiters) {
+        waiter->results[deviceId] = status;
+        if (waiter->remaining.erase(deviceId) != 0 && waiter->remaining.empty()) {
+            doneWaiters.emplace_back(waiter);
+        }
+    }
+    state.inFlightWaiters.clear();
+    state.inFlight = false;
+    inFlightCount_--;
+    if (state.queued) {
+        readyQueue_.push_back(deviceId);
+        return;
+    }
+    devices_.erase(iter);
+}
+
+void SyncScheduler::NotifyWaiters(const std::vector<std::shared_ptr<SyncWaiter>>& doneWaiters)
+{
+    for (const auto& waiter : doneWaiters) {
+        if (waiter->callback == nullptr) {
+            continue;
+        }
+        sptr<ISyncCompletedCallback> syncListenerProxy = iface_cast<ISyncCompletedCallback>(waiter->callback);
+        if (syncListenerProxy == nullptr) {
+            HILOGE("Cast to ISyncCompletedCallback failed");
+            continue;
+        }
+        syncListenerProxy->OnSyncCompleted(waiter->results);
+    }
+}
+
+void SyncScheduler::PostTimeoutCheck()
+{
+    {
+        std::lock_guard<std::mutex> lock(schedulerMutex_);
+        if (timeoutCheckPosted_) {
+            return;
+        }
+        timeoutCheckPosted_ = true;
+    }
+    std::weak_ptr<SyncScheduler> weakScheduler = weak_from_this();
+    auto task = [weakScheduler]() {
+        auto scheduler = weakScheduler.lock();
+        if (scheduler != nullptr) {
+            scheduler->CheckTimeout();
+        }
+    };
+    auto handler = EventHandlerFactory::GetInstance().GetEventHandler();
+    if (handler == nullptr || !handler->PostTask(task, SYNC_TIMEOUT_TASK_PREFIX + name_, timeoutMs_)) {
+        HILOGW("%{public}s post timeout check fail", name_.c_str());
+        std::lock_guard<std::mutex> lock(schedulerMutex_);
+        timeoutCheckPosted_ = false;
+    }
+}
+
+SyncMode SyncScheduler::MergeSyncMode(SyncMode queuedMode, SyncMode syncMode)
+{
+    if (queuedMode == SyncMode::MIN || queuedMode == syncMode) {
+        return syncMode;
+    }
+    return SyncMode::PUSH_PULL;
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
@@ -16,6 +16,8 @@
 #include "device_profile_dumper.h"
 
 #include "distributed_device_profile_log.h"
+#include "dp_memory_manager.h"
+#include "dp_metrics.h"
 #include "ipc_skeleton.h"
 
 namespace OHOS {
@@ -24,6 +26,8 @@ namespace {
 constexpr size_t MIN_ARGS_SIZE = 1;
 const std::string ARGS_H = "-h";
 const std::string ARGS_HELP = "-help";
+const std::string ARGS_METRICS = "-metrics";
+const std::string ARGS_RESET_METRICS = "-reset-metrics";
 const std::string TAG = "DeviceProfileDumper";
 constexpr int32_t UID_HIDUMPER = 1212;
 }
@@ -31,7 +35,8 @@ constexpr int32_t UID_HIDUMPER = 1212;
 bool DeviceProfileDumper::DumpDefault(std::string& result)
 {
     result.append("DeviceProfile Dump:\n");
-//    DeviceProfileStorageManager::GetInstance().DumpLocalProfile(result);
+    DpMetrics::GetInstance().Dump(result);
+    DpMemoryManager::GetInstance().Dump(result);
     return true;
 }
 
@@ -58,6 +63,15 @@ bool DeviceProfileDumper::Dump(const std::vector<std::string>& args, std::string
             ShowHelp(result);
             return true;
         }
+        if (args[0] == ARGS_METRICS) {
+            DpMetrics::GetInstance().Dump(result);
+            return true;
+        }
+        if (args[0] == ARGS_RESET_METRICS) {
+            DpMetrics::GetInstance().Reset();
+            result.append("Metrics reset\n");
+            return true;
+        }
     }
     IllegalInput(result);
     return false;
@@ -66,7 +80,9 @@ bool DeviceProfileDumper::Dump(const std::vector<std::string>& args, std::string
 void DeviceProfileDumper::ShowHelp(std::string& result)
 {
     result.append("DeviceProfile Dump options:\n")
-        .append("  [-h] [cmd]...\n");
+        .append("  [-h] [cmd]...\n")
+        .append("  -metrics: dump ipc latency histograms, storage timings, cache and event queue stats\n")
+        .append("  -reset-metrics: clear the collected metrics and start a new window\n");
 }
 
 void DeviceProfileDumper::IllegalInput(std::string& result)
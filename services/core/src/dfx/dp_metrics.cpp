@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dp_metrics.h"
+
+#include <chrono>
+#include <cinttypes>
+
+#include "distributed_device_profile_log.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+IMPLEMENT_SINGLE_INSTANCE(DpMetrics);
+
+namespace {
+    const std::string TAG = "DpMetrics";
+    constexpr uint32_t PERCENT_50 = 50;
+    constexpr uint32_t PERCENT_99 = 99;
+    constexpr uint32_t PERCENT_ALL = 100;
+    constexpr int64_t US_PER_SECOND = 1000000;
+    const char* const TIMER_NAMES[] = {
+        "RdbPut", "RdbDelete", "RdbUpdate", "RdbGet", "KvPut", "KvPutBatch", "KvDelete", "KvDeleteBatch",
+        "KvGet", "KvGetByPrefix", "KvDeleteByPrefix", "EventTaskWait", "EventTaskRun", "NotifyProfileChange",
+        "NotifyTrustProfileChange"
+    };
+    const char* const COUNTER_NAMES[] = { "ProfileCacheHit", "ProfileCacheMiss", "EventTaskPostFailed",
+        "DataShareHelperCreated", "SettingsCacheHit", "SettingsCacheMiss", "KvWriteCoalesced", "KvGroupCommit" };
+    static_assert(sizeof(TIMER_NAMES) / sizeof(TIMER_NAMES[0]) ==
+        static_cast<size_t>(DpMetricsTimer::MAX_TIMER), "TIMER_NAMES must match DpMetricsTimer");
+    static_assert(sizeof(COUNTER_NAMES) / sizeof(COUNTER_NAMES[0]) ==
+        static_cast<size_t>(DpMetricsCounter::MAX_COUNTER), "COUNTER_NAMES must match DpMetricsCounter");
+
+    void UpdateMax(std::atomic<int64_t>& maxValue, int64_t value)
+    {
+        int64_t current = maxValue.load(std::memory_order_relaxed);
+        while (value > current && !maxValue.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+}
+
+void LatencyHistogram::Record(int64_t costUs)
+{
+    if (costUs < 0) {
+        costUs = 0;
+    }
+    size_t index = 0;
+    while (index < METRICS_BUCKET_BOUNDS_US.size() && costUs > METRICS_BUCKET_BOUNDS_US[index]) {
+        index++;
+    }
+    buckets_[index].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    totalUs_.fetch_add(static_cast<uint64_t>(costUs), std::memory_order_relaxed);
+    UpdateMax(maxUs_, costUs);
+}
+
+void LatencyHistogram::Reset()
+{
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    totalUs_.store(0, std::memory_order_relaxed);
+    maxUs_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::GetCount() const
+{
+    return count_.load(std::memory_order_relaxed);
+}
+
+int64_t LatencyHistogram::GetPercentileUs(uint64_t total, uint32_t percent) const
+{
+    // the bound of the bucket that reaches the percentile, the max sample for the overflow bucket
+    uint64_t target = (total * percent + PERCENT_ALL - 1) / PERCENT_ALL;
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < METRICS_BUCKET_BOUNDS_US.size(); i++) {
+        accumulated += buckets_[i].load(std::memory_order_relaxed);
+        if (accumulated >= target) {
+            return METRICS_BUCKET_BOUNDS_US[i];
+        }
+    }
+    return maxUs_.load(std::memory_order_relaxed);
+}
+
+void LatencyHistogram::Dump(const std::string& name, std::string& result) const
+{
+    uint64_t count = GetCount();
+    if (count == 0) {
+        return;
+    }
+    result.append("  ").append(name)
+        .append(": count=").append(std::to_string(count))
+        .append(", avgUs=").append(std::to_string(totalUs_.load(std::memory_order_relaxed) / count))
+        .append(", p50Us<=").append(std::to_string(GetPercentileUs(count, PERCENT_50)))
+        .append(", p99Us<=").append(std::to_string(GetPercentileUs(count, PERCENT_99)))
+        .append(", maxUs=").append(std::to_string(maxUs_.load(std::memory_order_relaxed)))
+        .append(", buckets=[");
+    for (size_t i = 0; i < buckets_.size(); i++) {
+        if (i != 0) {
+            result.append(",");
+        }
+        result.append(std::to_string(buckets_[i].load(std::memory_order_relaxed)));
+    }
+    result.append("]\n");
+}
+
+int64_t DpMetrics::GetNowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void DpMetrics::RecordIpc(uint32_t code, int64_t costUs)
+{
+    int64_t expected = 0;
+    if (startTimeUs_.load(std::memory_order_relaxed) == expected) {
+        startTimeUs_.compare_exchange_strong(expected, GetNowUs() - costUs, std::memory_order_relaxed);
+    }
+    size_t index = code < IPC_CODE_SIZE ? code : IPC_CODE_SIZE;
+    ipcHistograms_[index].Record(costUs);
+    if (!ipcSummaryEnabled_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    int64_t nowUs = GetNowUs();
+    int64_t lastUs = lastIpcSummaryUs_.load(std::memory_order_relaxed);
+    if (lastUs == 0) {
+        lastIpcSummaryUs_.compare_exchange_strong(lastUs, nowUs, std::memory_order_relaxed);
+        return;
+    }
+    if (nowUs - lastUs >= IPC_SUMMARY_INTERVAL_US &&
+        lastIpcSummaryUs_.compare_exchange_strong(lastUs, nowUs, std::memory_order_relaxed)) {
+        LogIpcSummary(nowUs - lastUs);
+    }
+}
+
+void DpMetrics::SetIpcSummaryEnabled(bool enabled)
+{
+    ipcSummaryEnabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void DpMetrics::LogIpcSummary(int64_t intervalUs)
+{
+    std::string summary;
+    uint64_t total = 0;
+    for (size_t code = 0; code <= IPC_CODE_SIZE; code++) {
+        uint64_t count = ipcHistograms_[code].GetCount();
+        // a Reset() in between restarts the histogram from zero
+        uint64_t delta = count >= lastIpcCounts_[code] ? count - lastIpcCounts_[code] : count;
+        lastIpcCounts_[code] = count;
+        if (delta == 0) {
+            continue;
+        }
+        total += delta;
+        summary.append(code == IPC_CODE_SIZE ? "unknown" : std::to_string(code)).append(":")
+            .append(std::to_string(delta)).append(" ");
+    }
+    HILOGI("ipc in last %{public}" PRId64 "s, total: %{public}" PRIu64 ", per code: %{public}s",
+        intervalUs / US_PER_SECOND, total, summary.c_str());
+}
+
+void DpMetrics::RecordTimer(DpMetricsTimer timer, int64_t costUs)
+{
+    size_t index = static_cast<size_t>(timer);
+    if (index >= TIMER_SIZE) {
+        return;
+    }
+    timerHistograms_[index].Record(costUs);
+}
+
+void DpMetrics::IncreaseCounter(DpMetricsCounter counter)
+{
+    size_t index = static_cast<size_t>(counter);
+    if (index >= COUNTER_SIZE) {
+        return;
+    }
+    counters_[index].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t DpMetrics::GetCounter(DpMetricsCounter counter) const
+{
+    size_t index = static_cast<size_t>(counter);
+    if (index >= COUNTER_SIZE) {
+        return 0;
+    }
+    return counters_[index].load(std::memory_order_relaxed);
+}
+
+void DpMetrics::OnTaskPosted()
+{
+    UpdateMax(maxQueueDepth_, queueDepth_.fetch_add(1, std::memory_order_relaxed) + 1);
+}
+
+void DpMetrics::OnTaskDropped()
+{
+    queueDepth_.fetch_sub(1, std::memory_order_relaxed);
+    IncreaseCounter(DpMetricsCounter::EVENT_TASK_POST_FAILED);
+}
+
+void DpMetrics::OnTaskStart(int64_t postTimeUs)
+{
+    queueDepth_.fetch_sub(1, std::memory_order_relaxed);
+    RecordTimer(DpMetricsTimer::EVENT_TASK_WAIT, GetNowUs() - postTimeUs);
+}
+
+void DpMetrics::OnTaskEnd(int64_t startTimeUs)
+{
+    RecordTimer(DpMetricsTimer::EVENT_TASK_RUN, GetNowUs() - startTimeUs);
+}
+
+int64_t DpMetrics::GetQueueDepth() const
+{
+    return queueDepth_.load(std::memory_order_relaxed);
+}
+
+void DpMetrics::Dump(std::string& result)
+{
+    int64_t startTimeUs = startTimeUs_.load(std::memory_order_relaxed);
+    int64_t elapsedSec = startTimeUs == 0 ? 0 : (GetNowUs() - startTimeUs) / US_PER_SECOND;
+    uint64_t ipcTotal = 0;
+    for (const auto& histogram : ipcHistograms_) {
+        ipcTotal += histogram.GetCount();
+    }
+    result.append("IPC latency (since ").append(std::to_string(elapsedSec)).append("s ago, total=")
+        .append(std::to_string(ipcTotal)).append(", qps=")
+        .append(std::to_string(elapsedSec == 0 ? ipcTotal : ipcTotal / static_cast<uint64_t>(elapsedSec)))
+        .append("):\n");
+    for (size_t code = 0; code < IPC_CODE_SIZE; code++) {
+        ipcHistograms_[code].Dump("code " + std::to_string(code), result);
+    }
+    ipcHistograms_[IPC_CODE_SIZE].Dump("code unknown", result);
+
+    result.append("Operation latency:\n");
+    for (size_t i = 0; i < TIMER_SIZE; i++) {
+        timerHistograms_[i].Dump(TIMER_NAMES[i], result);
+    }
+
+    result.append("Counters:\n");
+    for (size_t i = 0; i < COUNTER_SIZE; i++) {
+        result.append("  ").append(COUNTER_NAMES[i]).append("=")
+            .append(std::to_string(counters_[i].load(std::memory_order_relaxed))).append("\n");
+    }
+    uint64_t hit = GetCounter(DpMetricsCounter::PROFILE_CACHE_HIT);
+    uint64_t lookups = hit + GetCounter(DpMetricsCounter::PROFILE_CACHE_MISS);
+    result.append("  ProfileCacheHitRate=")
+        .append(std::to_string(lookups == 0 ? 0 : hit * PERCENT_ALL / lookups)).append("%\n");
+
+    result.append("Event queue: depth=").append(std::to_string(GetQueueDepth()))
+        .append(", maxDepth=").append(std::to_string(maxQueueDepth_.load(std::memory_order_relaxed)))
+        .append("\n");
+}
+
+void DpMetrics::Reset()
+{
+    for (auto& histogram : ipcHistograms_) {
+        histogram.Reset();
+    }
+    for (auto& histogram : timerHistograms_) {
+        histogram.Reset();
+    }
+    for (auto& counter : counters_) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+    // queueDepth_ tracks live tasks and is not a statistic, keep it
+    maxQueueDepth_.store(queueDepth_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    startTimeUs_.store(GetNowUs(), std::memory_order_relaxed);
+}
+
+DpMetricsScope::DpMetricsScope(DpMetricsTimer timer) : timer_(timer), startTimeUs_(DpMetrics::GetNowUs())
+{
+}
+
+DpMetricsScope::~DpMetricsScope()
+{
+    DpMetrics::GetInstance().RecordTimer(timer_, DpMetrics::GetNowUs() - startTimeUs_);
+}
+
+DpIpcMetricsScope::DpIpcMetricsScope(uint32_t code) : code_(code), startTimeUs_(DpMetrics::GetNowUs())
+{
+}
+
+DpIpcMetricsScope::~DpIpcMetricsScope()
+{
+    DpMetrics::GetInstance().RecordIpc(code_, DpMetrics::GetNowUs() - startTimeUs_);
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
@@ -39,6 +39,7 @@
 #include "distributed_device_profile_errors.h"
 #include "dm_adapter.h"
 #include "device_profile_manager.h"
+#include "dp_memory_manager.h"
 #include "dp_radar_helper.h"
 #include "event_handler_factory.h"
 #include "ibusiness_callback.h"
@@ -67,6 +68,7 @@ const std::string TAG = "ServiceNew";
 const std::string UNLOAD_TASK_ID = "unload_dp_svr";
 const std::string IDLE_REASON_LOW_MEMORY = "resourceschedule.memmgr.low.memory.prepare";
 const std::string DP_ONSTART_TIMER = "dp_onstart_timer";
+const std::string TEMP_CACHE_NAME = "ServiceNew.tempCache";
 constexpr int32_t DELAY_TIME = 180000;
 constexpr int32_t SA_READY_INTO_IDLE = 0;
 constexpr int32_t SA_REFUSE_INTO_IDLE = -1;
@@ -129,6 +131,8 @@ int32_t DistributedDeviceProfileServiceNew::Init()
         HILOGE("ProfileDataManager init failed");
     }
     SubscribeProfileManager::GetInstance().Init();
+    // profiles put before the managers were ready, they exist nowhere else until written
+    DpMemoryManager::GetInstance().RegisterCache(TEMP_CACHE_NAME, [this]() { return GetTempCacheUsage(); });
     HILOGI("init finish");
 #ifdef WATCH_SUPPORT
     ResetDpThreadPriority(tid, isRestorePriority);
@@ -241,6 +245,8 @@ void DistributedDeviceProfileServiceNew::SubtractRunningIpcCount()
 int32_t DistributedDeviceProfileServiceNew::UnInit()
 {
     isInited_ = false;
+    // the aggregated successes and the queued failures are written out before the SA goes away
+    DpRadarHelper::GetInstance().Flush();
     if (TrustProfileManager::GetInstance().UnInit() != DP_SUCCESS) {
         HILOGE("TrustProfileManager UnInit failed");
         return DP_TRUST_PROFILE_MANAGER_UNINIT_FAIL;
@@ -275,9 +281,27 @@ int32_t DistributedDeviceProfileServiceNew::UnInit()
     }
     DestroyUnloadHandler();
     ClearProfileCache();
+    DpMemoryManager::GetInstance().UnRegisterCache(TEMP_CACHE_NAME);
     return DP_SUCCESS;
 }
 
+DpCacheUsage DistributedDeviceProfileServiceNew::GetTempCacheUsage()
+{
+    DpCacheUsage usage;
+    {
+        std::lock_guard<std::mutex> lock(dynamicProfileMapMtx_);
+        usage = DpMemoryManager::EstimateUsage(dynamicProfileMap_);
+    }
+    std::lock_guard<std::mutex> lock(switchProfileMapMtx_);
+    usage.entries += switchProfileMap_.size();
+    for (const auto& [profileKey, profile] : switchProfileMap_) {
+        usage.bytes += CACHE_NODE_OVERHEAD_BYTES + sizeof(profileKey) + sizeof(profile) +
+            DpMemoryManager::EstimateBytes(profileKey) +
+            DpMemoryManager::EstimateBytes(profile.GetCharacteristicValue());
+    }
+    return usage;
+}
+
 bool DistributedDeviceProfileServiceNew::ExitIdleState()
 {
     if (!CancelIdle()) {
@@ -462,6 +486,32 @@ int32_t DistributedDeviceProfileServiceNew::GetAccessControlProfile(std::map<std
     return ret;
 }
 
+int32_t DistributedDeviceProfileServiceNew::GetAccessControlProfileBatch(
+    const std::vector<std::map<std::string, std::string>>& queryParamsList,
+    std::vector<std::vector<AccessControlProfile>>& aclProfilesList, std::vector<int32_t>& results)
+{
+    if (!PermissionManager::GetInstance().IsCallerTrust(GET_ACCESS_CONTROL_PROFILE)) {
+        HILOGE("the caller is permission denied!");
+        return DP_PERMISSION_DENIED;
+    }
+    if (queryParamsList.empty() || queryParamsList.size() > MAX_BATCH_QUERY_SIZE) {
+        HILOGE("queryParamsList size is invalid! size: %{public}zu", queryParamsList.size());
+        return DP_INVALID_PARAMS;
+    }
+    int32_t ret = TrustProfileManager::GetInstance().GetAccessControlProfileBatch(queryParamsList, aclProfilesList,
+        results);
+    // one radar event per batch, carrying the first item that failed for a reason other than no data
+    int32_t reportRet = ret;
+    for (size_t i = 0; reportRet == DP_SUCCESS && i < results.size(); i++) {
+        if (results[i] != DP_NOT_FIND_DATA) {
+            reportRet = results[i];
+        }
+    }
+    std::vector<AccessControlProfile> reportProfiles;
+    DpRadarHelper::GetInstance().ReportGetAclProfile(reportRet, reportProfiles);
+    return ret;
+}
+
 int32_t DistributedDeviceProfileServiceNew::GetAllAccessControlProfile(
     std::vector<AccessControlProfile>& accessControlProfiles)
 {
@@ -765,6 +815,66 @@ int32_t DistributedDeviceProfileServiceNew::GetCharacteristicProfile(const std::
     return ret;
 }
 
+int32_t DistributedDeviceProfileServiceNew::GetCharacteristicProfileBatch(
+    const std::vector<CharacteristicProfile>& queries, std::vector<CharacteristicProfile>& charProfiles,
+    std::vector<int32_t>& results)
+{
+    if (!PermissionManager::GetInstance().CheckCallerPermission()) {
+        HILOGE("this caller is permission denied!");
+        return DP_PERMISSION_DENIED;
+    }
+    if (queries.empty() || queries.size() > MAX_BATCH_QUERY_SIZE) {
+        HILOGE("queries size is invalid! size: %{public}zu", queries.size());
+        return DP_INVALID_PARAMS;
+    }
+    charProfiles.assign(queries.size(), CharacteristicProfile());
+    results.assign(queries.size(), DP_SUCCESS);
+    std::vector<CharacteristicProfile> dynamicQueries;
+    std::vector<size_t> dynamicIndexes;
+    for (size_t i = 0; i < queries.size(); i++) {
+        const auto& query = queries[i];
+        charProfiles[i].SetIsMultiUser(query.IsMultiUser());
+        charProfiles[i].SetUserId(query.GetUserId());
+        if (query.GetCharacteristicKey() == SWITCH_STATUS) {
+#ifndef DEVICE_PROFILE_SWITCH_DISABLE
+            results[i] = SwitchProfileManager::GetInstance().GetCharacteristicProfile(query.GetDeviceId(),
+                query.GetServiceName(), query.GetCharacteristicKey(), charProfiles[i]);
+#else
+            results[i] = DP_DEVICE_UNSUPPORTED_SWITCH;
+#endif
+            continue;
+        }
+        if (query.GetCharacteristicKey() == STATIC_CHARACTERISTIC_KEY) {
+            results[i] = StaticProfileManager::GetInstance().GetCharacteristicProfile(query.GetDeviceId(),
+                query.GetServiceName(), query.GetCharacteristicKey(), charProfiles[i]);
+            continue;
+        }
+        dynamicQueries.emplace_back(query);
+        dynamicIndexes.emplace_back(i);
+    }
+    if (!dynamicQueries.empty()) {
+        std::vector<CharacteristicProfile> dynamicProfiles;
+        std::vector<int32_t> dynamicResults;
+        DeviceProfileManager::GetInstance().GetCharacteristicProfileBatch(dynamicQueries, dynamicProfiles,
+            dynamicResults);
+        for (size_t i = 0; i < dynamicIndexes.size(); i++) {
+            charProfiles[dynamicIndexes[i]] = dynamicProfiles[i];
+            results[dynamicIndexes[i]] = dynamicResults[i];
+        }
+    }
+    // one radar event per batch, carrying the first failed item
+    size_t reportIndex = 0;
+    for (size_t i = 0; i < results.size(); i++) {
+        if (results[i] != DP_SUCCESS) {
+            reportIndex = i;
+            break;
+        }
+    }
+    DpRadarHelper::GetInstance().ReportGetCharProfile(results[reportIndex], queries[reportIndex].GetDeviceId(),
+        charProfiles[reportIndex]);
+    return DP_SUCCESS;
+}
+
 int32_t DistributedDeviceProfileServiceNew::DeleteServiceProfile(const std::string& deviceId,
     const std::string& serviceName, bool isMultiUser, int32_t userId)
 {
@@ -1004,6 +1114,8 @@ int32_t DistributedDeviceProfileServiceNew::OnIdle(const SystemAbilityOnDemandRe
     HILOGI("idleReason name=%{public}s, id=%{public}d, value=%{public}s", idleReason.GetName().c_str(),
         idleReason.GetId(), idleReason.GetValue().c_str());
     if (idleReason.GetName() == IDLE_REASON_LOW_MEMORY) {
+        size_t freedBytes = DpMemoryManager::GetInstance().TrimAll();
+        HILOGI("low memory, trimmed caches: %{public}zu bytes", freedBytes);
         return IsReadyIntoIdle() ? SA_READY_INTO_IDLE : SA_REFUSE_INTO_IDLE;
     }
     // process set critical false
@@ -1053,6 +1165,7 @@ void DistributedDeviceProfileServiceNew::SubscribeAccountCommonEvent()
     std::vector<std::string> AccountCommonEventVec;
     AccountCommonEventVec.emplace_back(EventFwk::CommonEventSupport::COMMON_EVENT_USER_SWITCHED);
     AccountCommonEventVec.emplace_back(EventFwk::CommonEventSupport::COMMON_EVENT_USER_REMOVED);
+    AccountCommonEventVec.emplace_back(EventFwk::CommonEventSupport::COMMON_EVENT_SCREEN_LOCKED);
     std::lock_guard<std::mutex> lock(accountCommonEventManagerMtx_);
     if (accountCommonEventManager_->SubscribeAccountCommonEvent(AccountCommonEventVec, callback)) {
         HILOGI("Success");
@@ -1063,8 +1176,13 @@ void DistributedDeviceProfileServiceNew::SubscribeAccountCommonEvent()
 void DistributedDeviceProfileServiceNew::AccountCommonEventCallback(int32_t userId, const std::string commonEventType)
 {
     HILOGI("CommonEventType: %{public}s, userId: %{public}d", commonEventType.c_str(), userId);
+    if (commonEventType == EventFwk::CommonEventSupport::COMMON_EVENT_SCREEN_LOCKED) {
+        SessionKeyManager::GetInstance().ClearSessionKeyCache();
+        return;
+    }
     if (commonEventType == EventFwk::CommonEventSupport::COMMON_EVENT_USER_SWITCHED) {
         // swithed
+        SessionKeyManager::GetInstance().ClearSessionKeyCache();
         MultiUserManager::GetInstance().SetCurrentForegroundUserID(userId);
         if (ContentSensorManager::GetInstance().Init() != DP_SUCCESS) {
             HILOGE("ContentSensorManager init failed");
@@ -1365,9 +1483,8 @@ int32_t DistributedDeviceProfileServiceNew::NotifyPinCodeInvalid(const LocalServ
         }
         callbackProxy->OnPincodeInvalid(localServiceInfo);
     };
-    auto handler = EventHandlerFactory::GetInstance().GetEventHandler();
     HILOGI("notify");
-    if (handler == nullptr || !handler->PostTask(task)) {
+    if (!EventHandlerFactory::GetInstance().PostTask(task)) {
         HILOGE("Post OnPincodeInvalid task failed");
         return DP_POST_TASK_FAILED;
     }
@@ -1492,9 +1609,8 @@ int32_t DistributedDeviceProfileServiceNew::NotifyBusinessEvent(const BusinessEv
             BusinessEventExt eventExt(event.GetBusinessKey(), event.GetBusinessValue());
             callbackProxy->OnBusinessEvent(eventExt);
         };
-        auto handler = EventHandlerFactory::GetInstance().GetEventHandler();
         HILOGI("notify");
-        if (handler == nullptr || !handler->PostTask(task)) {
+        if (!EventHandlerFactory::GetInstance().PostTask(task)) {
             HILOGE("Post OnBusinessEvent task failed");
             continue;
         }
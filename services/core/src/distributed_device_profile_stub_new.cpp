@@ -25,6 +25,7 @@
 #include "distributed_device_profile_log.h"
 #include "distributed_device_profile_service_new.h"
 #include "dp_ipc_interface_code.h"
+#include "dp_metrics.h"
 #include "profile_utils.h"
 
 namespace OHOS {
@@ -45,6 +46,7 @@ void DistributedDeviceProfileStubNew::InitAclAndSubscribe()
     aclAndSubscribeFuncs_.insert(static_cast<uint32_t>(DpIpcInterfaceCode::GET_TRUST_DEVICE_PROFILE));
     aclAndSubscribeFuncs_.insert(static_cast<uint32_t>(DpIpcInterfaceCode::GET_ALL_TRUST_DEVICE_PROFILE));
     aclAndSubscribeFuncs_.insert(static_cast<uint32_t>(DpIpcInterfaceCode::GET_ACL_PROFILE));
+    aclAndSubscribeFuncs_.insert(static_cast<uint32_t>(DpIpcInterfaceCode::GET_ACL_PROFILE_BATCH));
     aclAndSubscribeFuncs_.insert(static_cast<uint32_t>(DpIpcInterfaceCode::GET_ALL_ACL_PROFILE));
     aclAndSubscribeFuncs_.insert(static_cast<uint32_t>(DpIpcInterfaceCode::GET_ALL_ACL_INCLUDE_LNN_ACL));
     aclAndSubscribeFuncs_.insert(static_cast<uint32_t>(DpIpcInterfaceCode::DELETE_ACL_PROFILE));
@@ -103,6 +105,8 @@ int32_t DistributedDeviceProfileStubNew::NotifyAclEventInner(uint32_t code, Mess
             return GetAllTrustDeviceProfileInner(data, reply);
         case static_cast<uint32_t>(DpIpcInterfaceCode::GET_ACL_PROFILE):
             return GetAccessControlProfileInner(data, reply);
+        case static_cast<uint32_t>(DpIpcInterfaceCode::GET_ACL_PROFILE_BATCH):
+            return GetAccessControlProfileBatchInner(data, reply);
         case static_cast<uint32_t>(DpIpcInterfaceCode::GET_ALL_ACL_PROFILE):
             return GetAllAccessControlProfileInner(data, reply);
         case static_cast<uint32_t>(DpIpcInterfaceCode::GET_ALL_ACL_INCLUDE_LNN_ACL):
@@ -200,6 +204,8 @@ int32_t DistributedDeviceProfileStubNew::NotifyEventInner(uint32_t code, Message
             return GetServiceProfileInner(data, reply);
         case static_cast<uint32_t>(DpIpcInterfaceCode::GET_CHAR_PROFILE):
             return GetCharacteristicProfileInner(data, reply);
+        case static_cast<uint32_t>(DpIpcInterfaceCode::GET_CHAR_PROFILE_BATCH):
+            return GetCharacteristicProfileBatchInner(data, reply);
         case static_cast<uint32_t>(DpIpcInterfaceCode::DEL_SERVICE_PROFILE):
             return DeleteServiceProfileInner(data, reply);
         case static_cast<uint32_t>(DpIpcInterfaceCode::DEL_CHAR_PROFILE):
@@ -242,7 +248,9 @@ int32_t DistributedDeviceProfileStubNew::NotifyLocalServiceEventInner(uint32_t c
 int32_t DistributedDeviceProfileStubNew::OnRemoteRequest(uint32_t code, MessageParcel& data,
     MessageParcel& reply, MessageOption& option)
 {
-    HILOGI("code = %{public}u, CallingPid = %{public}u", code, IPCSkeleton::GetCallingPid());
+    // per call detail is DEBUG only, DpMetrics writes a per code summary line instead
+    HILOGD("code = %{public}u, CallingPid = %{public}u", code, IPCSkeleton::GetCallingPid());
+    DpIpcMetricsScope metricsScope(code);
     if (DistributedDeviceProfileServiceNew::GetInstance().IsStopped()) {
         HILOGE("dp service has stopped");
         return DP_SERVICE_STOPPED;
@@ -358,6 +366,30 @@ int32_t DistributedDeviceProfileStubNew::GetAccessControlProfileInner(MessagePar
     return DP_SUCCESS;
 }
 
+int32_t DistributedDeviceProfileStubNew::GetAccessControlProfileBatchInner(MessageParcel& data,
+    MessageParcel& reply)
+{
+    HILOGD("called");
+    std::vector<std::map<std::string, std::string>> queryParamsList;
+    if (!IpcUtils::UnMarshalling(data, queryParamsList)) {
+        return DP_READ_PARCEL_FAIL;
+    }
+    std::vector<std::vector<AccessControlProfile>> aclProfilesList;
+    std::vector<int32_t> results;
+    int32_t ret = GetAccessControlProfileBatch(queryParamsList, aclProfilesList, results);
+    if (!reply.WriteInt32(ret)) {
+        HILOGE("Write reply failed");
+        return ERR_FLATTEN_OBJECT;
+    }
+    if (ret != DP_SUCCESS) {
+        return DP_SUCCESS;
+    }
+    if (!IpcUtils::Marshalling(reply, results) || !IpcUtils::Marshalling(reply, aclProfilesList)) {
+        return DP_WRITE_PARCEL_FAIL;
+    }
+    return DP_SUCCESS;
+}
+
 int32_t DistributedDeviceProfileStubNew::GetAllAccessControlProfileInner(MessageParcel& data, MessageParcel& reply)
 {
     HILOGD("called");
@@ -636,6 +668,31 @@ int32_t DistributedDeviceProfileStubNew::GetCharacteristicProfileInner(MessagePa
     return DP_SUCCESS;
 }
 
+int32_t DistributedDeviceProfileStubNew::GetCharacteristicProfileBatchInner(MessageParcel& data,
+    MessageParcel& reply)
+{
+    std::vector<CharacteristicProfile> queries;
+    if (!IpcUtils::UnMarshalling(data, queries)) {
+        HILOGE("read parcel fail!");
+        return DP_READ_PARCEL_FAIL;
+    }
+    std::vector<CharacteristicProfile> charProfiles;
+    std::vector<int32_t> results;
+    int32_t ret = GetCharacteristicProfileBatch(queries, charProfiles, results);
+    if (!reply.WriteInt32(ret)) {
+        HILOGE("Write reply failed");
+        return ERR_FLATTEN_OBJECT;
+    }
+    if (ret != DP_SUCCESS) {
+        return DP_SUCCESS;
+    }
+    if (!IpcUtils::Marshalling(reply, results) || !IpcUtils::Marshalling(reply, charProfiles)) {
+        HILOGE("write parcel fail!");
+        return DP_WRITE_PARCEL_FAIL;
+    }
+    return DP_SUCCESS;
+}
+
 int32_t DistributedDeviceProfileStubNew::DeleteServiceProfileInner(MessageParcel& data, MessageParcel& reply)
 {
     std::string deviceId;
@@ -28,6 +28,7 @@ IMPLEMENT_SINGLE_INSTANCE(LocalServiceInfoManager)
 
 namespace {
 const std::string TAG = "LocalServiceInfoManager";
+constexpr size_t MAX_LOCAL_SERVICE_INFO_CACHE_SIZE = 64;
 }
 
 int32_t LocalServiceInfoManager::Init()
@@ -45,6 +46,7 @@ int32_t LocalServiceInfoManager::Init()
 
 int32_t LocalServiceInfoManager::UnInit()
 {
+    ClearLocalServiceInfoCache();
     int32_t ret = LocalServiceInfoRdbAdapter::GetInstance().UnInit();
     if (ret != DP_SUCCESS) {
         HILOGE("LocalServiceInfoRdbAdapter UnInit failed");
@@ -93,6 +95,7 @@ int32_t LocalServiceInfoManager::PutLocalServiceInfo(const LocalServiceInfo& loc
         return DP_LOCAL_SERVICE_INFO_EXISTS;
     }
     ret = LocalServiceInfoRdbAdapter::GetInstance().Put(rowId, LOCAL_SERVICE_INFO_TABLE, values);
+    RemoveLocalServiceInfoFromCache({bundleName, pinExchangeType});
     if (ret != DP_SUCCESS) {
         HILOGE("%{public}s insert failed", LOCAL_SERVICE_INFO_TABLE.c_str());
         return DP_PUT_LOCAL_SERVICE_INFO_FAIL;
@@ -121,6 +124,7 @@ int32_t LocalServiceInfoManager::DeleteLocalServiceInfo(const std::string& bundl
     int32_t ret = LocalServiceInfoRdbAdapter::GetInstance().Delete(deleteRows, LOCAL_SERVICE_INFO_TABLE,
         LOCAL_SERVICE_INFO_UNIQUE_INDEX_EQUAL_CONDITION,
         std::vector<ValueObject>{ValueObject(bundleName), ValueObject(pinExchangeType)});
+    RemoveLocalServiceInfoFromCache({bundleName, pinExchangeType});
     if (ret != DP_SUCCESS) {
         HILOGE("delete %{public}s data failed", LOCAL_SERVICE_INFO_TABLE.c_str());
         return DP_DELETE_LOCAL_SERVICE_INFO_FAIL;
@@ -153,6 +157,7 @@ int32_t LocalServiceInfoManager::UpdateLocalServiceInfo(const LocalServiceInfo&
     int32_t ret = LocalServiceInfoRdbAdapter::GetInstance().Update(changeRowCnt, LOCAL_SERVICE_INFO_TABLE, values,
         LOCAL_SERVICE_INFO_UNIQUE_INDEX_EQUAL_CONDITION,
         std::vector<ValueObject>{ValueObject(bundleName), ValueObject(pinExchangeType)});
+    RemoveLocalServiceInfoFromCache({bundleName, pinExchangeType});
     if (ret != DP_SUCCESS) {
         HILOGE("Update %{public}s table failed", LOCAL_SERVICE_INFO_TABLE.c_str());
         return DP_UPDATE_LOCAL_SERVICE_INFO_FAIL;
@@ -168,6 +173,24 @@ int32_t LocalServiceInfoManager::GetLocalServiceInfoByBundleAndPinType(const std
         HILOGE("Invalid parameter");
         return DP_INVALID_PARAM;
     }
+    LocalServiceInfoCacheKey cacheKey = {bundleName, pinExchangeType};
+    int32_t ret = DP_SUCCESS;
+    if (GetLocalServiceInfoFromCache(cacheKey, ret, localServiceInfo)) {
+        return ret;
+    }
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        generation = cacheGeneration_;
+    }
+    ret = QueryLocalServiceInfo(bundleName, pinExchangeType, localServiceInfo);
+    PutLocalServiceInfoToCache(cacheKey, generation, ret, localServiceInfo);
+    return ret;
+}
+
+int32_t LocalServiceInfoManager::QueryLocalServiceInfo(const std::string& bundleName, int32_t pinExchangeType,
+    LocalServiceInfo& localServiceInfo)
+{
     std::vector<ValueObject> condition;
     condition.emplace_back(ValueObject(bundleName));
     condition.emplace_back(ValueObject(pinExchangeType));
@@ -218,6 +241,68 @@ int32_t LocalServiceInfoManager::ConvertToLocalServiceInfo(std::shared_ptr<Resul
     return DP_SUCCESS;
 }
 
+bool LocalServiceInfoManager::GetLocalServiceInfoFromCache(const LocalServiceInfoCacheKey& cacheKey, int32_t& ret,
+    LocalServiceInfo& localServiceInfo)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    auto iter = cache_.find(cacheKey);
+    if (iter == cache_.end()) {
+        return false;
+    }
+    cacheLru_.splice(cacheLru_.begin(), cacheLru_, iter->second.lruIter);
+    if (!iter->second.isExist) {
+        ret = DP_NOT_FIND_DATA;
+        return true;
+    }
+    localServiceInfo = iter->second.localServiceInfo;
+    ret = DP_SUCCESS;
+    return true;
+}
+
+void LocalServiceInfoManager::PutLocalServiceInfoToCache(const LocalServiceInfoCacheKey& cacheKey,
+    uint64_t generation, int32_t ret, const LocalServiceInfo& localServiceInfo)
+{
+    // query errors are not cached, the next lookup tries the db again
+    if (ret != DP_SUCCESS && ret != DP_NOT_FIND_DATA) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (generation != cacheGeneration_ || cache_.find(cacheKey) != cache_.end()) {
+        return;
+    }
+    while (cache_.size() >= MAX_LOCAL_SERVICE_INFO_CACHE_SIZE && !cacheLru_.empty()) {
+        cache_.erase(cacheLru_.back());
+        cacheLru_.pop_back();
+    }
+    cacheLru_.emplace_front(cacheKey);
+    LocalServiceInfoCacheEntry& entry = cache_[cacheKey];
+    entry.isExist = ret == DP_SUCCESS;
+    if (entry.isExist) {
+        entry.localServiceInfo = localServiceInfo;
+    }
+    entry.lruIter = cacheLru_.begin();
+}
+
+void LocalServiceInfoManager::RemoveLocalServiceInfoFromCache(const LocalServiceInfoCacheKey& cacheKey)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    cacheGeneration_++;
+    auto iter = cache_.find(cacheKey);
+    if (iter == cache_.end()) {
+        return;
+    }
+    cacheLru_.erase(iter->second.lruIter);
+    cache_.erase(iter);
+}
+
+void LocalServiceInfoManager::ClearLocalServiceInfoCache()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    cacheGeneration_++;
+    cache_.clear();
+    cacheLru_.clear();
+}
+
 int32_t LocalServiceInfoManager::LocalServiceInfoToEntries(const LocalServiceInfo& LocalServiceInfo,
     ValuesBucket& values)
 {
@@ -20,6 +20,7 @@
 #include <unordered_set>
 
 #include "accesstoken_kit.h"
+#include "datetime_ex.h"
 #include "file_ex.h"
 #include "ipc_skeleton.h"
 #include "securec.h"
@@ -46,6 +47,9 @@ namespace {
     const std::string PERMISSION_JSON_PATH = "/system/etc/deviceprofile/permission.json";
     const std::string DP_SERVICE_ACCESS_PERMISSION = "ohos.permission.ACCESS_SERVICE_DP";
     const std::string DP_SERVICE_SYNC_PERMISSION = "ohos.permission.SYNC_PROFILE_DP";
+    constexpr size_t MAX_CALLER_CACHE_SIZE = 256;
+    // Decisions are re-verified at least this often even without a permission change notification
+    constexpr int64_t CALLER_CACHE_TTL_MS = 60000;
 }
 
 IMPLEMENT_SINGLE_INSTANCE(PermissionManager);
@@ -53,11 +57,13 @@ IMPLEMENT_SINGLE_INSTANCE(PermissionManager);
 int32_t PermissionManager::Init()
 {
     HILOGI("call!");
+    ClearCallerCache();
     int32_t ret = LoadPermissionCfg(PERMISSION_JSON_PATH);
     if (ret != DP_SUCCESS) {
         HILOGE("LoadPermissionCfg failed,ret:%{public}d", ret);
         return ret;
     }
+    RegisterPermStateChangeCallback();
     HILOGI("init succeeded");
     return DP_SUCCESS;
 }
@@ -65,6 +71,8 @@ int32_t PermissionManager::Init()
 int32_t PermissionManager::UnInit()
 {
     HILOGI("UnInit");
+    UnRegisterPermStateChangeCallback();
+    ClearCallerCache();
     std::lock_guard<std::mutex> lockGuard(permissionMutex_);
     permissionMap_.clear();
     return DP_SUCCESS;
@@ -175,19 +183,39 @@ void PermissionManager::SetKVPermissionMap(const cJSON *const permissionJson)
     return;
 }
 
-bool PermissionManager::CheckInterfacePermission(const std::string& interfaceName)
+bool PermissionManager::CheckInterfacePermission(uint32_t tokenId, const std::string& interfaceName,
+    bool& isDecided)
 {
-    std::string callProcName = GetCallerProcName();
-    std::unordered_set<std::string> permittedProcNames;
+    std::string callProcName;
+    isDecided = GetCallerProcName(tokenId, callProcName);
+    if (!isDecided) {
+        HILOGE("get native token info failed, interface %{public}s", interfaceName.c_str());
+        return false;
+    }
+    bool checkResult = false;
     {
         std::lock_guard<std::mutex> lockGuard(permissionMutex_);
-        permittedProcNames = permissionMap_[interfaceName];
+        auto iter = permissionMap_.find(interfaceName);
+        if (iter != permissionMap_.end()) {
+            checkResult = (iter->second.count(callProcName) != 0 || iter->second.count(ALL_PROC) != 0);
+        }
     }
-    bool checkResult =  (permittedProcNames.count(callProcName) != 0 || permittedProcNames.count(ALL_PROC) != 0);
     HILOGD("success interface %{public}s callProc %{public}s!", interfaceName.c_str(), callProcName.c_str());
     return checkResult;
 }
 
+bool PermissionManager::CheckTrustedCaller(uint32_t tokenId, const std::string& interfaceName, bool& isDecided)
+{
+    ATokenTypeEnum tokenType = AccessTokenKit::GetTokenTypeFlag(tokenId);
+    isDecided = (tokenType != ATokenTypeEnum::TOKEN_INVALID);
+    // currently only support native trusted caller
+    if (tokenType != ATokenTypeEnum::TOKEN_NATIVE) {
+        HILOGE("TokenType is not native");
+        return false;
+    }
+    return CheckInterfacePermission(tokenId, interfaceName, isDecided);
+}
+
 bool PermissionManager::IsCallerTrust(const std::string& interfaceName)
 {
     int32_t stageRes = static_cast<int32_t>(StageRes::STAGE_FAIL);
@@ -197,14 +225,15 @@ bool PermissionManager::IsCallerTrust(const std::string& interfaceName)
         DpRadarHelper::GetInstance().ReportSaCheckAuth(stageRes);
         return false;
     }
-    ATokenTypeEnum tokenType = AccessTokenKit::GetTokenTypeFlag(tokenID);
-    // currently only support native trusted caller
-    if (tokenType != ATokenTypeEnum::TOKEN_NATIVE) {
-        HILOGE("TokenType is not native");
-        DpRadarHelper::GetInstance().ReportSaCheckAuth(stageRes);
-        return false;
+    bool result = false;
+    bool isDecided = false;
+    if (!GetCachedDecision(tokenID, interfaceName, result)) {
+        result = CheckTrustedCaller(tokenID, interfaceName, isDecided);
+        if (isDecided) {
+            PutCachedDecision(tokenID, interfaceName, result);
+        }
     }
-    if (!CheckInterfacePermission(interfaceName)) {
+    if (!result) {
         HILOGE("This caller cannot call this interface, interfaceName: %{public}s", interfaceName.c_str());
         DpRadarHelper::GetInstance().ReportSaCheckAuth(stageRes);
         return false;
@@ -214,7 +243,7 @@ bool PermissionManager::IsCallerTrust(const std::string& interfaceName)
     return true;
 }
 
-bool PermissionManager::CheckCallerPermission()
+bool PermissionManager::CheckCallerAccessPermission(const std::string& permissionName)
 {
     int32_t stageRes = static_cast<int32_t>(StageRes::STAGE_FAIL);
     auto tokenID = IPCSkeleton::GetCallingTokenID();
@@ -223,64 +252,171 @@ bool PermissionManager::CheckCallerPermission()
         DpRadarHelper::GetInstance().ReportSaCheckAuth(stageRes);
         return false;
     }
+    bool result = false;
+    if (GetCachedDecision(tokenID, permissionName, result)) {
+        stageRes = static_cast<int32_t>(result ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL);
+        DpRadarHelper::GetInstance().ReportSaCheckAuth(stageRes);
+        return result;
+    }
     ATokenTypeEnum tokenType = AccessTokenKit::GetTokenTypeFlag(tokenID);
     if (tokenType != ATokenTypeEnum::TOKEN_NATIVE) {
         HILOGE("TokenType is not native");
+        if (tokenType != ATokenTypeEnum::TOKEN_INVALID) {
+            PutCachedDecision(tokenID, permissionName, false);
+        }
         DpRadarHelper::GetInstance().ReportSaCheckAuth(stageRes);
         return false;
     }
-    std::string callProcName = GetCallerProcName();
-    int32_t ret = AccessTokenKit::VerifyAccessToken(tokenID, DP_SERVICE_ACCESS_PERMISSION);
+    std::string callProcName;
+    GetCallerProcName(tokenID, callProcName);
+    int32_t ret = AccessTokenKit::VerifyAccessToken(tokenID, permissionName);
     if (ret != PermissionState::PERMISSION_GRANTED) {
         HILOGE("failed callProc %{public}s!", callProcName.c_str());
+        PutCachedDecision(tokenID, permissionName, false);
         DpRadarHelper::GetInstance().ReportSaCheckAuth(stageRes);
         return false;
     }
+    PutCachedDecision(tokenID, permissionName, true);
     stageRes = static_cast<int32_t>(StageRes::STAGE_SUCC);
     DpRadarHelper::GetInstance().ReportSaCheckAuth(stageRes);
+    // a sync is rare enough to log, the access check runs on every call
+    if (permissionName == DP_SERVICE_SYNC_PERMISSION) {
+        HILOGI("success callProc %{public}s!", callProcName.c_str());
+    } else {
+        HILOGD("success callProc %{public}s!", callProcName.c_str());
+    }
     return true;
 }
 
+bool PermissionManager::CheckCallerPermission()
+{
+    return CheckCallerAccessPermission(DP_SERVICE_ACCESS_PERMISSION);
+}
+
 bool PermissionManager::CheckCallerSyncPermission()
 {
-    int32_t stageRes = static_cast<int32_t>(StageRes::STAGE_FAIL);
-    auto tokenID = IPCSkeleton::GetCallingTokenID();
-    if (tokenID == INVALID_TOKEN_ID) {
-        HILOGW("invalid token id");
-        DpRadarHelper::GetInstance().ReportSaCheckAuth(stageRes);
+    return CheckCallerAccessPermission(DP_SERVICE_SYNC_PERMISSION);
+}
+
+std::string PermissionManager::GetCallerProcName()
+{
+    // called after CheckCallerTrust, and keep same policy with CheckCallerTrust
+    std::string procName;
+    GetCallerProcName(IPCSkeleton::GetCallingTokenID(), procName);
+    return procName;
+}
+
+bool PermissionManager::GetCallerProcName(uint32_t tokenId, std::string& procName)
+{
+    int64_t nowMs = GetTickCount();
+    {
+        std::lock_guard<std::mutex> lock(callerCacheMutex_);
+        auto iter = procNameCache_.find(tokenId);
+        if (iter != procNameCache_.end() && iter->second.expireTimeMs > nowMs) {
+            procName = iter->second.procName;
+            return true;
+        }
+    }
+    NativeTokenInfo nativeTokenInfo;
+    auto errCode = AccessTokenKit::GetNativeTokenInfo(tokenId, nativeTokenInfo);
+    if (errCode != EOK) {
         return false;
     }
-    ATokenTypeEnum tokenType = AccessTokenKit::GetTokenTypeFlag(tokenID);
-    if (tokenType != ATokenTypeEnum::TOKEN_NATIVE) {
-        HILOGE("TokenType is not native");
-        DpRadarHelper::GetInstance().ReportSaCheckAuth(stageRes);
+    procName = std::move(nativeTokenInfo.processName);
+    HILOGD("procName:%{public}s", procName.c_str());
+    std::lock_guard<std::mutex> lock(callerCacheMutex_);
+    if (procNameCache_.size() >= MAX_CALLER_CACHE_SIZE) {
+        procNameCache_.clear();
+    }
+    procNameCache_[tokenId] = { procName, nowMs + CALLER_CACHE_TTL_MS };
+    return true;
+}
+
+bool PermissionManager::GetCachedDecision(uint32_t tokenId, const std::string& decisionName, bool& result)
+{
+    std::string cacheKey = std::to_string(tokenId) + SEPARATOR + decisionName;
+    std::lock_guard<std::mutex> lock(callerCacheMutex_);
+    auto iter = decisionCache_.find(cacheKey);
+    if (iter == decisionCache_.end()) {
         return false;
     }
-    std::string callProcName = GetCallerProcName();
-    int32_t ret = AccessTokenKit::VerifyAccessToken(tokenID, DP_SERVICE_SYNC_PERMISSION);
-    if (ret != PermissionState::PERMISSION_GRANTED) {
-        HILOGE("failed callProc %{public}s!", callProcName.c_str());
-        DpRadarHelper::GetInstance().ReportSaCheckAuth(stageRes);
+    if (iter->second.expireTimeMs <= GetTickCount()) {
+        decisionCache_.erase(iter);
         return false;
     }
-    stageRes = static_cast<int32_t>(StageRes::STAGE_SUCC);
-    DpRadarHelper::GetInstance().ReportSaCheckAuth(stageRes);
-    HILOGI("success callProc %{public}s!", callProcName.c_str());
+    result = iter->second.result;
     return true;
 }
 
-std::string PermissionManager::GetCallerProcName()
+void PermissionManager::PutCachedDecision(uint32_t tokenId, const std::string& decisionName, bool result)
 {
-    // called after CheckCallerTrust, and keep same policy with CheckCallerTrust
-    NativeTokenInfo nativeTokenInfo;
-    auto tokenID = IPCSkeleton::GetCallingTokenID();
-    auto errCode = AccessTokenKit::GetNativeTokenInfo(tokenID, nativeTokenInfo);
-    std::string procName;
-    if (errCode == EOK) {
-        procName = std::move(nativeTokenInfo.processName);
-        HILOGD("procName:%{public}s", procName.c_str());
+    std::string cacheKey = std::to_string(tokenId) + SEPARATOR + decisionName;
+    int64_t nowMs = GetTickCount();
+    std::lock_guard<std::mutex> lock(callerCacheMutex_);
+    if (decisionCache_.size() >= MAX_CALLER_CACHE_SIZE) {
+        for (auto iter = decisionCache_.begin(); iter != decisionCache_.end();) {
+            iter = (iter->second.expireTimeMs <= nowMs) ? decisionCache_.erase(iter) : std::next(iter);
+        }
     }
-    return procName;
+    if (decisionCache_.size() >= MAX_CALLER_CACHE_SIZE) {
+        HILOGW("caller cache is full, clear it");
+        decisionCache_.clear();
+    }
+    decisionCache_[cacheKey] = { result, nowMs + CALLER_CACHE_TTL_MS };
+}
+
+void PermissionManager::InvalidateCallerCache(uint32_t tokenId)
+{
+    std::string prefix = std::to_string(tokenId) + SEPARATOR;
+    std::lock_guard<std::mutex> lock(callerCacheMutex_);
+    for (auto iter = decisionCache_.begin(); iter != decisionCache_.end();) {
+        iter = (iter->first.compare(0, prefix.size(), prefix) == 0) ? decisionCache_.erase(iter) : std::next(iter);
+    }
+    procNameCache_.erase(tokenId);
+}
+
+void PermissionManager::ClearCallerCache()
+{
+    std::lock_guard<std::mutex> lock(callerCacheMutex_);
+    decisionCache_.clear();
+    procNameCache_.clear();
+}
+
+void PermissionManager::RegisterPermStateChangeCallback()
+{
+    PermStateChangeScope scope;
+    scope.permList = { DP_SERVICE_ACCESS_PERMISSION, DP_SERVICE_SYNC_PERMISSION };
+    auto callback = std::make_shared<DpPermStateChangeCallback>(scope);
+    int32_t ret = AccessTokenKit::RegisterPermStateChangeCallback(callback);
+    if (ret != RET_SUCCESS) {
+        HILOGE("RegisterPermStateChangeCallback failed, ret:%{public}d", ret);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(callerCacheMutex_);
+    permStateChangeCallback_ = callback;
+}
+
+void PermissionManager::UnRegisterPermStateChangeCallback()
+{
+    std::shared_ptr<DpPermStateChangeCallback> callback = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(callerCacheMutex_);
+        callback = permStateChangeCallback_;
+        permStateChangeCallback_ = nullptr;
+    }
+    if (callback == nullptr) {
+        return;
+    }
+    int32_t ret = AccessTokenKit::UnRegisterPermStateChangeCallback(callback);
+    if (ret != RET_SUCCESS) {
+        HILOGE("UnRegisterPermStateChangeCallback failed, ret:%{public}d", ret);
+    }
+}
+
+void PermissionManager::DpPermStateChangeCallback::PermStateChangeCallback(PermStateChangeInfo& result)
+{
+    HILOGI("permission of tokenId %{public}u changed", result.tokenID);
+    PermissionManager::GetInstance().InvalidateCallerCache(result.tokenID);
 }
 
 void PermissionManager::SetPermissionMap(const cJSON* const permissionJson, const std::string& interfaceName)
@@ -229,7 +229,35 @@ int32_t BusinessEventAdapter::DeleteBatch(const std::vector<std::string>& keys)
 
 int32_t BusinessEventAdapter::PutBatch(const std::map<std::string, std::string>& values)
 {
-    (void)values;
+    if (values.empty() || values.size() > MAX_BATCH_SIZE) {
+        HILOGE("Param is invalid: values size %{public}zu", values.size());
+        return DP_INVALID_PARAMS;
+    }
+    std::vector<DistributedKv::Entry> entries;
+    for (const auto& [key, value] : values) {
+        if (key.empty() || key.size() > MAX_STRING_LEN || value.empty() || value.size() > MAX_STRING_LEN) {
+            HILOGE("Param is invalid: key or value is empty or too long");
+            return DP_INVALID_PARAMS;
+        }
+        DistributedKv::Entry entry;
+        entry.key = key;
+        entry.value = value;
+        entries.emplace_back(entry);
+    }
+    DistributedKv::Status status;
+    {
+        std::lock_guard<std::mutex> lock(BusinessAdapterMutex_);
+        if (kvStorePtr_ == nullptr) {
+            HILOGE("kvDBPtr is null!");
+            return DP_KV_DB_PTR_NULL;
+        }
+        // one transaction, a crash leaves either all of the batch or none of it
+        status = kvStorePtr_->PutBatch(entries);
+    }
+    if (status != DistributedKv::Status::SUCCESS) {
+        HILOGE("PutBatch kv to db failed, ret: %{public}d", status);
+        return DP_PUT_KV_DB_FAIL;
+    }
     return DP_SUCCESS;
 }
 
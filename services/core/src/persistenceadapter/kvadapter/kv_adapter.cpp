@@ -23,6 +23,7 @@
 #include "distributed_device_profile_errors.h"
 #include "distributed_device_profile_log.h"
 #include "distributed_device_profile_constants.h"
+#include "dp_metrics.h"
 #include "profile_cache.h"
 #include "profile_utils.h"
 
@@ -101,6 +102,7 @@ int32_t KVAdapter::UnInit()
 
 int32_t KVAdapter::Put(const std::string& key, const std::string& value)
 {
+    DpMetricsScope metricsScope(DpMetricsTimer::KV_PUT);
     if (key.empty() || key.size() > MAX_STRING_LEN || value.empty() || value.size() > MAX_STRING_LEN) {
         HILOGE("Param is invalid!");
         return DP_INVALID_PARAMS;
@@ -134,6 +136,7 @@ int32_t KVAdapter::Put(const std::string& key, const std::string& value)
 
 int32_t KVAdapter::PutBatch(const std::map<std::string, std::string>& values)
 {
+    DpMetricsScope metricsScope(DpMetricsTimer::KV_PUT_BATCH);
     if (values.empty() || values.size() > MAX_PROFILE_SIZE) {
         HILOGE("Param is invalid!");
         return DP_INVALID_PARAMS;
@@ -177,6 +180,7 @@ int32_t KVAdapter::PutBatch(const std::map<std::string, std::string>& values)
 
 int32_t KVAdapter::Delete(const std::string& key)
 {
+    DpMetricsScope metricsScope(DpMetricsTimer::KV_DELETE);
     HILOGI("key: %{public}s", ProfileUtils::GetDbKeyAnonyString(key).c_str());
     DistributedKv::Status status;
     {
@@ -198,6 +202,7 @@ int32_t KVAdapter::Delete(const std::string& key)
 
 int32_t KVAdapter::Get(const std::string& key, std::string& value)
 {
+    DpMetricsScope metricsScope(DpMetricsTimer::KV_GET);
     HILOGI("key: %{public}s", ProfileUtils::GetDbKeyAnonyString(key).c_str());
     DistributedKv::Key kvKey(key);
     DistributedKv::Value kvValue;
@@ -220,6 +225,7 @@ int32_t KVAdapter::Get(const std::string& key, std::string& value)
 
 int32_t KVAdapter::GetByPrefix(const std::string& keyPrefix, std::map<std::string, std::string>& values)
 {
+    DpMetricsScope metricsScope(DpMetricsTimer::KV_GET_BY_PREFIX);
     HILOGI("key prefix: %{public}s", ProfileUtils::GetDbKeyAnonyString(keyPrefix).c_str());
     std::lock_guard<std::mutex> lock(kvAdapterMutex_);
     if (kvStorePtr_ == nullptr) {
@@ -248,6 +254,7 @@ int32_t KVAdapter::GetByPrefix(const std::string& keyPrefix, std::map<std::strin
 
 int32_t KVAdapter::DeleteByPrefix(const std::string& keyPrefix)
 {
+    DpMetricsScope metricsScope(DpMetricsTimer::KV_DELETE_BY_PREFIX);
     HILOGI("delete by key prefix: %{public}s", ProfileUtils::GetDbKeyAnonyString(keyPrefix).c_str());
     std::lock_guard<std::mutex> lock(kvAdapterMutex_);
     if (kvStorePtr_ == nullptr) {
@@ -367,6 +374,7 @@ int32_t KVAdapter::GetDeviceEntries(const std::string& udid, std::map<std::strin
 
 int32_t KVAdapter::DeleteBatch(const std::vector<std::string>& keys)
 {
+    DpMetricsScope metricsScope(DpMetricsTimer::KV_DELETE_BATCH);
     if (keys.empty() || keys.size() > MAX_PROFILE_SIZE) {
         HILOGE("keys size(%{public}zu) is invalid!", keys.size());
         return DP_INVALID_PARAMS;
@@ -42,11 +42,17 @@ namespace {
 
 ServiceInfoKvAdapter::ServiceInfoKvAdapter(
     const std::shared_ptr<DistributedKv::KvStoreDeathRecipient> &deathListener, DistributedKv::DataType dataType)
+    : ServiceInfoKvAdapter(deathListener, dataType, STORE_ID)
+{
+}
+
+ServiceInfoKvAdapter::ServiceInfoKvAdapter(const std::shared_ptr<DistributedKv::KvStoreDeathRecipient> &deathListener,
+    DistributedKv::DataType dataType, const std::string& storeId)
 {
     this->deathRecipient_ = deathListener;
     this->dataType_ = dataType;
     this->appId_.appId = APP_ID;
-    this->storeId_.storeId = STORE_ID;
+    this->storeId_.storeId = storeId;
 }
 
 int32_t ServiceInfoKvAdapter::Init()
@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "write_behind_kv_adapter.h"
+
+#include "distributed_device_profile_constants.h"
+#include "distributed_device_profile_errors.h"
+#include "distributed_device_profile_log.h"
+#include "dp_metrics.h"
+#include "event_handler_factory.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+namespace {
+    const std::string TAG = "WriteBehindKvAdapter";
+    const std::string FLUSH_TASK_PREFIX = "write_behind_flush_";
+
+    bool HasPrefix(const std::string& key, const std::string& keyPrefix)
+    {
+        return key.compare(0, keyPrefix.size(), keyPrefix) == 0;
+    }
+
+    void CollectByPrefix(const std::map<std::string, std::string>& entries, const std::string& keyPrefix,
+        std::map<std::string, std::string>& values)
+    {
+        for (auto iter = entries.lower_bound(keyPrefix); iter != entries.end() && HasPrefix(iter->first, keyPrefix);
+            ++iter) {
+            values[iter->first] = iter->second;
+        }
+    }
+}
+
+WriteBehindKvAdapter::WriteBehindKvAdapter(const std::string& name, std::shared_ptr<IKVAdapter> kvStore,
+    int64_t windowMs, size_t maxPending)
+    : name_(name), kvStore_(kvStore), windowMs_(windowMs), maxPending_(maxPending == 0 ? 1 : maxPending)
+{
+}
+
+WriteBehindKvAdapter::~WriteBehindKvAdapter()
+{
+    Flush();
+}
+
+int32_t WriteBehindKvAdapter::Init()
+{
+    if (kvStore_ == nullptr) {
+        HILOGE("kvStore is nullptr!");
+        return DP_KV_DB_PTR_NULL;
+    }
+    return kvStore_->Init();
+}
+
+int32_t WriteBehindKvAdapter::UnInit()
+{
+    if (kvStore_ == nullptr) {
+        HILOGE("kvStore is nullptr!");
+        return DP_KV_DB_PTR_NULL;
+    }
+    {
+        std::lock_guard<std::mutex> flushLock(flushMutex_);
+        int32_t ret = FlushLocked();
+        if (ret != DP_SUCCESS) {
+            // keep the store open and the entries buffered, the retry task or a later UnInit writes them
+            std::lock_guard<std::mutex> lock(pendingMutex_);
+            HILOGE("%{public}s final flush fail, ret: %{public}d, keep %{public}zu entries", name_.c_str(), ret,
+                pending_.size());
+            return ret;
+        }
+    }
+    auto handler = EventHandlerFactory::GetInstance().GetEventHandler();
+    if (handler != nullptr) {
+        handler->RemoveTask(FLUSH_TASK_PREFIX + name_);
+    }
+    return kvStore_->UnInit();
+}
+
+int32_t WriteBehindKvAdapter::Put(const std::string& key, const std::string& value)
+{
+    if (key.empty() || key.size() > MAX_STRING_LEN || value.empty() || value.size() > MAX_STRING_LEN) {
+        HILOGE("Param is invalid!");
+        return DP_INVALID_PARAMS;
+    }
+    bool needFlush = false;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        if (!pending_.insert_or_assign(key, value).second) {
+            DpMetrics::GetInstance().IncreaseCounter(DpMetricsCounter::KV_WRITE_COALESCED);
+        }
+        needFlush = pending_.size() >= maxPending_;
+    }
+    // without a timer the buffer is written through
+    if (needFlush || !PostFlushTask()) {
+        return Flush();
+    }
+    return DP_SUCCESS;
+}
+
+int32_t WriteBehindKvAdapter::PutBatch(const std::map<std::string, std::string>& values)
+{
+    if (values.empty() || values.size() > MAX_PROFILE_SIZE) {
+        HILOGE("Param is invalid!");
+        return DP_INVALID_PARAMS;
+    }
+    if (values.size() >= maxPending_) {
+        // already a group commit on its own, only the buffered entries have to go first
+        std::lock_guard<std::mutex> flushLock(flushMutex_);
+        FlushBeforeLocked("PutBatch");
+        {
+            // older values a failed flush kept buffered must not be written over these by the retry
+            std::lock_guard<std::mutex> lock(pendingMutex_);
+            for (const auto& [key, value] : values) {
+                pending_.erase(key);
+            }
+        }
+        return kvStore_->PutBatch(values);
+    }
+    bool needFlush = false;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        for (const auto& [key, value] : values) {
+            if (!pending_.insert_or_assign(key, value).second) {
+                DpMetrics::GetInstance().IncreaseCounter(DpMetricsCounter::KV_WRITE_COALESCED);
+            }
+        }
+        needFlush = pending_.size() >= maxPending_;
+    }
+    // without a timer the buffer is written through
+    if (needFlush || !PostFlushTask()) {
+        return Flush();
+    }
+    return DP_SUCCESS;
+}
+
+int32_t WriteBehindKvAdapter::Delete(const std::string& key)
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        pending_.erase(key);
+    }
+    FlushBeforeLocked("Delete");
+    return kvStore_->Delete(key);
+}
+
+int32_t WriteBehindKvAdapter::DeleteByPrefix(const std::string& keyPrefix)
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    ErasePendingByPrefix(keyPrefix);
+    FlushBeforeLocked("DeleteByPrefix");
+    return kvStore_->DeleteByPrefix(keyPrefix);
+}
+
+int32_t WriteBehindKvAdapter::Get(const std::string& key, std::string& value)
+{
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        auto iter = pending_.find(key);
+        if (iter != pending_.end()) {
+            value = iter->second;
+            return DP_SUCCESS;
+        }
+        iter = flushing_.find(key);
+        if (iter != flushing_.end()) {
+            value = iter->second;
+            return DP_SUCCESS;
+        }
+    }
+    return kvStore_->Get(key, value);
+}
+
+int32_t WriteBehindKvAdapter::GetByPrefix(const std::string& keyPrefix, std::map<std::string, std::string>& values)
+{
+    std::map<std::string, std::string> buffered;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        CollectByPrefix(flushing_, keyPrefix, buffered);
+        CollectByPrefix(pending_, keyPrefix, buffered);
+    }
+    int32_t ret = kvStore_->GetByPrefix(keyPrefix, values);
+    if (buffered.empty()) {
+        return ret;
+    }
+    // the kv adapter reports a prefix without entries as DP_INVALID_PARAMS
+    if (ret != DP_SUCCESS && ret != DP_INVALID_PARAMS) {
+        return ret;
+    }
+    for (auto& [key, value] : buffered) {
+        values[key] = std::move(value);
+    }
+    return DP_SUCCESS;
+}
+
+int32_t WriteBehindKvAdapter::Sync(const std::vector<std::string>& deviceList, SyncMode syncMode)
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    FlushBeforeLocked("Sync");
+    return kvStore_->Sync(deviceList, syncMode);
+}
+
+int32_t WriteBehindKvAdapter::GetDeviceEntries(const std::string& udid, std::map<std::string, std::string>& values)
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    FlushBeforeLocked("GetDeviceEntries");
+    return kvStore_->GetDeviceEntries(udid, values);
+}
+
+int32_t WriteBehindKvAdapter::DeleteBatch(const std::vector<std::string>& keys)
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        for (const auto& key : keys) {
+            pending_.erase(key);
+        }
+    }
+    FlushBeforeLocked("DeleteBatch");
+    return kvStore_->DeleteBatch(keys);
+}
+
+int32_t WriteBehindKvAdapter::RemoveDeviceData(const std::string& uuid)
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    FlushBeforeLocked("RemoveDeviceData");
+    return kvStore_->RemoveDeviceData(uuid);
+}
+
+int32_t WriteBehindKvAdapter::Flush()
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    return FlushLocked();
+}
+
+size_t WriteBehindKvAdapter::GetPendingCount()
+{
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    return pending_.size();
+}
+
+int32_t WriteBehindKvAdapter::FlushLocked()
+{
+    if (kvStore_ == nullptr) {
+        HILOGE("kvStore is nullptr!");
+        return DP_KV_DB_PTR_NULL;
+    }
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        flushPosted_ = false;
+        if (pending_.empty()) {
+            return DP_SUCCESS;
+        }
+        flushing_.swap(pending_);
+    }
+    // flushing_ is only written under flushMutex_, reads under pendingMutex_ may run alongside
+    int32_t ret = kvStore_->PutBatch(flushing_);
+    DpMetrics::GetInstance().IncreaseCounter(DpMetricsCounter::KV_GROUP_COMMIT);
+    bool retry = false;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        if (ret != DP_SUCCESS) {
+            HILOGE("%{public}s flush %{public}zu entries fail, ret: %{public}d", name_.c_str(), flushing_.size(), ret);
+            // entries written again in the meantime are newer than the failed ones
+            pending_.merge(flushing_);
+            retry = true;
+        }
+        flushing_.clear();
+    }
+    if (retry) {
+        PostFlushTask();
+    }
+    return ret;
+}
+
+void WriteBehindKvAdapter::FlushBeforeLocked(const std::string& operation)
+{
+    // the operation still runs, the entries that did not make it stay buffered for the retry
+    int32_t ret = FlushLocked();
+    if (ret != DP_SUCCESS) {
+        HILOGW("%{public}s flush before %{public}s fail, ret: %{public}d", name_.c_str(), operation.c_str(), ret);
+    }
+}
+
+bool WriteBehindKvAdapter::PostFlushTask()
+{
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        if (flushPosted_ || pending_.empty()) {
+            return true;
+        }
+        flushPosted_ = true;
+    }
+    std::weak_ptr<WriteBehindKvAdapter> weakAdapter = weak_from_this();
+    auto task = [weakAdapter]() {
+        auto adapter = weakAdapter.lock();
+        if (adapter != nullptr) {
+            adapter->Flush();
+        }
+    };
+    auto handler = EventHandlerFactory::GetInstance().GetEventHandler();
+    if (handler == nullptr || !handler->PostTask(task, FLUSH_TASK_PREFIX + name_, windowMs_)) {
+        HILOGW("%{public}s post flush task fail", name_.c_str());
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        flushPosted_ = false;
+        return false;
+    }
+    return true;
+}
+
+void WriteBehindKvAdapter::ErasePendingByPrefix(const std::string& keyPrefix)
+{
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    auto iter = pending_.lower_bound(keyPrefix);
+    while (iter != pending_.end() && HasPrefix(iter->first, keyPrefix)) {
+        iter = pending_.erase(iter);
+    }
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
@@ -36,10 +36,12 @@ namespace {
         "service_profile",
         "characteristic_profile",
         "device_icon_info",
+        "device_icon_blob",
         "product_info"
     };
     const std::string TAG = "ProfileDatardbAdapter";
     constexpr int32_t PROFILE_DATA_VER_3 = 3;
+    constexpr int32_t PROFILE_DATA_VER_4 = 4;
 }
 
 int32_t ProfileDataRdbAdapter::Init()
@@ -61,7 +63,7 @@ int32_t ProfileDataRdbAdapter::UnInit()
 {
     HILOGI("ProfileDatardbAdapter unInit");
     {
-        std::lock_guard<std::mutex> lock(ProfileDataRdbAdapterMtx_);
+        std::lock_guard<std::recursive_mutex> lock(ProfileDataRdbAdapterMtx_);
         store_ = nullptr;
     }
     return DP_SUCCESS;
@@ -74,7 +76,7 @@ int32_t ProfileDataRdbAdapter::Put(int64_t& outRowId, const std::string& table,
         return DP_RDBADAPTER_TABLE_NOT_EXIST;
     }
     {
-        std::lock_guard<std::mutex> lock(ProfileDataRdbAdapterMtx_);
+        std::lock_guard<std::recursive_mutex> lock(ProfileDataRdbAdapterMtx_);
         if (store_ == nullptr) {
             HILOGE("RDBStore_ is null");
             return DP_RDB_DB_PTR_NULL;
@@ -105,7 +107,7 @@ int32_t ProfileDataRdbAdapter::Delete(int32_t& deleteRows, const std::string& ta
         return DP_RDBADAPTER_TABLE_NOT_EXIST;
     }
     {
-        std::lock_guard<std::mutex> lock(ProfileDataRdbAdapterMtx_);
+        std::lock_guard<std::recursive_mutex> lock(ProfileDataRdbAdapterMtx_);
         if (store_ == nullptr) {
             HILOGE("RDBStore_ is null");
             return DP_RDB_DB_PTR_NULL;
@@ -136,7 +138,7 @@ int32_t ProfileDataRdbAdapter::Update(int32_t& changedRows, const std::string& t
         return DP_RDBADAPTER_TABLE_NOT_EXIST;
     }
     {
-        std::lock_guard<std::mutex> lock(ProfileDataRdbAdapterMtx_);
+        std::lock_guard<std::recursive_mutex> lock(ProfileDataRdbAdapterMtx_);
         if (store_ == nullptr) {
             HILOGE("RDBStore_ is null");
             return DP_RDB_DB_PTR_NULL;
@@ -163,7 +165,7 @@ std::shared_ptr<ResultSet> ProfileDataRdbAdapter::Get(const std::string& sql, co
 {
     std::shared_ptr<ResultSet> resultSet = nullptr;
     {
-        std::lock_guard<std::mutex> lock(ProfileDataRdbAdapterMtx_);
+        std::lock_guard<std::recursive_mutex> lock(ProfileDataRdbAdapterMtx_);
         if (store_ == nullptr) {
             HILOGE("RDBStore_ is null");
             return nullptr;
@@ -189,9 +191,40 @@ std::shared_ptr<ResultSet> ProfileDataRdbAdapter::Get(const std::string& sql, co
     return resultSet;
 }
 
+int32_t ProfileDataRdbAdapter::ExecuteInTransaction(const std::function<int32_t()>& func)
+{
+    if (func == nullptr) {
+        HILOGE("func is null");
+        return DP_INVALID_PARAMS;
+    }
+    std::lock_guard<std::recursive_mutex> lock(ProfileDataRdbAdapterMtx_);
+    if (store_ == nullptr) {
+        HILOGE("RDBStore_ is null");
+        return DP_RDB_DB_PTR_NULL;
+    }
+    int32_t ret = store_->BeginTransaction();
+    if (ret != E_OK) {
+        HILOGE("begin transaction failed ret:%{public}d", ret);
+        return DP_RDBADAPTER_TRANSACTION_FAIL;
+    }
+    int32_t funcRet = func();
+    if (funcRet != DP_SUCCESS) {
+        ret = store_->RollBack();
+        HILOGE("rollback, funcRet:%{public}d, ret:%{public}d", funcRet, ret);
+        return funcRet;
+    }
+    ret = store_->Commit();
+    if (ret != E_OK) {
+        HILOGE("commit failed ret:%{public}d", ret);
+        store_->RollBack();
+        return DP_RDBADAPTER_TRANSACTION_FAIL;
+    }
+    return DP_SUCCESS;
+}
+
 int32_t ProfileDataRdbAdapter::GetRDBPtr()
 {
-    int32_t version = PROFILE_DATA_VER_3;
+    int32_t version = PROFILE_DATA_VER_4;
     ProfileDataOpenCallback helper;
     RdbStoreConfig config(PROFILE_DATA_RDB_PATH + PROFILE_DATA_DATABASE_NAME);
     config.SetSecurityLevel(SecurityLevel::S2);
@@ -199,7 +232,7 @@ int32_t ProfileDataRdbAdapter::GetRDBPtr()
     config.SetAllowRebuild(true);
     int32_t errCode = E_OK;
     {
-        std::lock_guard<std::mutex> lock(ProfileDataRdbAdapterMtx_);
+        std::lock_guard<std::recursive_mutex> lock(ProfileDataRdbAdapterMtx_);
         store_ = RdbHelper::GetRdbStore(config, version, helper, errCode);
         if (store_ == nullptr) {
             HILOGE("RDBStore_ is null");
@@ -226,7 +259,7 @@ int32_t ProfileDataRdbAdapter::GetRDBPtr()
 bool ProfileDataRdbAdapter::IsInit()
 {
     {
-        std::lock_guard<std::mutex> lock(ProfileDataRdbAdapterMtx_);
+        std::lock_guard<std::recursive_mutex> lock(ProfileDataRdbAdapterMtx_);
         if (store_ == nullptr) {
             return false;
         }
@@ -237,7 +270,7 @@ bool ProfileDataRdbAdapter::IsInit()
 int32_t ProfileDataRdbAdapter::CreateTable(const std::string& sql)
 {
     {
-        std::lock_guard<std::mutex> lock(ProfileDataRdbAdapterMtx_);
+        std::lock_guard<std::recursive_mutex> lock(ProfileDataRdbAdapterMtx_);
         if (store_ == nullptr) {
             HILOGE("RDBStore_ is null");
             return DP_RDB_DB_PTR_NULL;
@@ -267,13 +300,20 @@ int32_t ProfileDataOpenCallback::OnUpgrade(RdbStore& store, int oldVersion, int
         HILOGE("UpdateFromVer1To2 failed,reason:%{public}d", ret);
         return ret;
     }
-    if (oldVersion < PROFILE_DATA_VER_3 && newVersion == PROFILE_DATA_VER_3) {
+    if (oldVersion < PROFILE_DATA_VER_3 && newVersion >= PROFILE_DATA_VER_3) {
         ret = UpdateToVer3(store);
     }
     if (ret != NativeRdb::E_OK) {
         HILOGE("UpdateToVer3 failed,reason:%{public}d", ret);
         return ret;
     }
+    if (oldVersion < PROFILE_DATA_VER_4 && newVersion >= PROFILE_DATA_VER_4) {
+        ret = UpdateToVer4(store);
+    }
+    if (ret != NativeRdb::E_OK) {
+        HILOGE("UpdateToVer4 failed,reason:%{public}d", ret);
+        return ret;
+    }
     return NativeRdb::E_OK;
 }
 
@@ -372,5 +412,25 @@ int32_t ProfileDataOpenCallback::UpdateToVer3(RdbStore& store)
     HILOGI("succeed");
     return NativeRdb::E_OK;
 }
+
+int32_t ProfileDataOpenCallback::UpdateToVer4(RdbStore& store)
+{
+    // the blob table itself is created by DeviceIconInfoDao::CreateTable, existing rows keep their inline icon
+    RdbTableAlterInfo deviceIconInfoAddColumnIconHash {
+        .tabName = DEVICE_ICON_INFO_TABLE,
+        .colName = DEVICE_ICON_HASH,
+        .colType = RDB_TYPE_TEXT,
+        .sql = ALTER_TABLE_DEVICE_ICON_INFO_ADD_COLUMN_ICON_HASH_SQL
+    };
+    int32_t ret = CheckAndAlterTable(store, deviceIconInfoAddColumnIconHash);
+    if (ret != DP_SUCCESS) {
+        HILOGE("CheckAndAlterTable failed,reason:%{public}d,tableName:%{public}s,columnName:%{public}s", ret,
+            ProfileUtils::GetAnonyString(deviceIconInfoAddColumnIconHash.tabName).c_str(),
+            deviceIconInfoAddColumnIconHash.colName.c_str());
+        return ret;
+    }
+    HILOGI("succeed");
+    return NativeRdb::E_OK;
+}
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
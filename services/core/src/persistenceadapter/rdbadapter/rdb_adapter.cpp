@@ -21,6 +21,7 @@
 #include "distributed_device_profile_constants.h"
 #include "distributed_device_profile_errors.h"
 #include "distributed_device_profile_log.h"
+#include "dp_metrics.h"
 
 namespace OHOS {
 namespace DistributedDeviceProfile {
@@ -79,6 +80,7 @@ int32_t RdbAdapter::UnInit()
 
 int32_t RdbAdapter::Put(int64_t& outRowId, const std::string& table, const ValuesBucket& values)
 {
+    DpMetricsScope metricsScope(DpMetricsTimer::RDB_PUT);
     if (TABLES.find(table) == TABLES.end()) {
         HILOGE("table does not exist");
         return DP_RDBADAPTER_TABLE_NOT_EXIST;
@@ -110,6 +112,7 @@ int32_t RdbAdapter::Put(int64_t& outRowId, const std::string& table, const Value
 int32_t RdbAdapter::Delete(int32_t& deleteRows, const std::string& table, const std::string& whereClause,
     const std::vector<ValueObject>& bindArgs)
 {
+    DpMetricsScope metricsScope(DpMetricsTimer::RDB_DELETE);
     if (TABLES.find(table) == TABLES.end()) {
         HILOGE("table does not exist");
         return DP_RDBADAPTER_TABLE_NOT_EXIST;
@@ -141,6 +144,7 @@ int32_t RdbAdapter::Delete(int32_t& deleteRows, const std::string& table, const
 int32_t RdbAdapter::Update(int32_t& changedRows, const std::string& table, const ValuesBucket& values,
     const std::string& whereClause, const std::vector<ValueObject>& bindArgs)
 {
+    DpMetricsScope metricsScope(DpMetricsTimer::RDB_UPDATE);
     if (TABLES.find(table) == TABLES.end()) {
         HILOGE("table does not exist");
         return DP_RDBADAPTER_TABLE_NOT_EXIST;
@@ -171,6 +175,7 @@ int32_t RdbAdapter::Update(int32_t& changedRows, const std::string& table, const
 
 std::shared_ptr<ResultSet> RdbAdapter::Get(const std::string& sql, const std::vector<ValueObject>& args)
 {
+    DpMetricsScope metricsScope(DpMetricsTimer::RDB_GET);
     std::shared_ptr<ResultSet> resultSet = nullptr;
     {
         std::lock_guard<std::mutex> lock(rdbAdapterMtx_);
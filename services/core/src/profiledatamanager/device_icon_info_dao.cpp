@@ -15,6 +15,10 @@
 
 #include "device_icon_info_dao.h"
 
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
 #include "distributed_device_profile_constants.h"
 #include "distributed_device_profile_errors.h"
 #include "distributed_device_profile_log.h"
@@ -26,6 +30,12 @@ namespace DistributedDeviceProfile {
 IMPLEMENT_SINGLE_INSTANCE(DeviceIconInfoDao);
 namespace {
     const std::string TAG = "DeviceIconInfoDao";
+    constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+    constexpr int32_t HEX_WIDTH = 16;
+    // keys tried for one hash, the hash itself and then hash#1 on
+    constexpr int32_t MAX_ICON_HASH_PROBE = 8;
+    const std::string ICON_HASH_PROBE_SEPARATOR = "#";
 }
 
 int32_t DeviceIconInfoDao::Init()
@@ -66,15 +76,28 @@ int32_t DeviceIconInfoDao::PutDeviceIconInfo(const DeviceIconInfo& deviceIconInf
     HILOGI("deviceIconInfo:%{public}s", deviceIconInfo.dump().c_str());
     ValuesBucket values;
     DeviceIconInfoToEntries(deviceIconInfo, values);
-    int64_t rowId = ROWID_INIT;
-    int32_t ret = RET_INIT;
-    {
-        std::lock_guard<std::mutex> lock(rdbMutex_);
-        ret = ProfileDataRdbAdapter::GetInstance().Put(rowId, DEVICE_ICON_INFO_TABLE, values);
-        if (ret != DP_SUCCESS) {
-            HILOGE("%{public}s insert failed", DEVICE_ICON_INFO_TABLE.c_str());
-            return DP_PUT_DEVICE_ICON_INFO_FAIL;
+    std::lock_guard<std::mutex> lock(rdbMutex_);
+    int32_t ret = ProfileDataRdbAdapter::GetInstance().ExecuteInTransaction([this, &deviceIconInfo, &values]() {
+        std::string iconHash = GetIconHash(deviceIconInfo.GetIcon());
+        if (!iconHash.empty()) {
+            int32_t refCount = 0;
+            bool isFound = false;
+            int32_t blobRet = FindIconBlob(deviceIconInfo.GetIcon(), iconHash, refCount, isFound);
+            if (blobRet != DP_SUCCESS) {
+                return blobRet;
+            }
+            blobRet = AcquireIconBlob(deviceIconInfo.GetIcon(), iconHash, refCount, isFound);
+            if (blobRet != DP_SUCCESS) {
+                return blobRet;
+            }
         }
+        values.PutString(DEVICE_ICON_HASH, iconHash);
+        int64_t rowId = ROWID_INIT;
+        return ProfileDataRdbAdapter::GetInstance().Put(rowId, DEVICE_ICON_INFO_TABLE, values);
+    });
+    if (ret != DP_SUCCESS) {
+        HILOGE("%{public}s insert failed", DEVICE_ICON_INFO_TABLE.c_str());
+        return DP_PUT_DEVICE_ICON_INFO_FAIL;
     }
     return DP_SUCCESS;
 }
@@ -84,45 +107,67 @@ int32_t DeviceIconInfoDao::GetDeviceIconInfos(const DeviceIconInfoFilterOptions&
 {
     std::string sql;
     std::vector<ValueObject> condition;
-    if (!CreateQuerySqlAndCondition(filterOptions, sql, condition)) {
+    if (filterOptions.GetKnownVersion().empty()) {
+        if (!CreateQuerySqlAndCondition(filterOptions, sql, condition)) {
+            HILOGE("invalid params:%{public}s", filterOptions.dump().c_str());
+            return DP_INVALID_PARAMS;
+        }
+        return QueryDeviceIconInfos(sql, condition, true, deviceIconInfos);
+    }
+    if (!CreateQuerySqlAndCondition(filterOptions, SELECT_DEVICE_ICON_INFO_META_TABLE, sql, condition)) {
         HILOGE("invalid params:%{public}s", filterOptions.dump().c_str());
         return DP_INVALID_PARAMS;
     }
-    std::shared_ptr<ResultSet> resultSet = ProfileDataRdbAdapter::GetInstance().Get(sql, condition);
-    if (resultSet == nullptr) {
-        HILOGE("resultSet is nullptr");
-        return DP_GET_RESULTSET_FAIL;
-    }
-    int32_t rowCount = ROWCOUNT_INIT;
-    resultSet->GetRowCount(rowCount);
-    if (rowCount == 0) {
-        HILOGE("by condition not find data");
-        resultSet->Close();
-        return DP_NOT_FIND_DATA;
+    std::vector<DeviceIconInfo> metas;
+    int32_t ret = QueryDeviceIconInfos(sql, condition, false, metas);
+    if (ret != DP_SUCCESS) {
+        return ret;
     }
-    while (resultSet->GoToNextRow() == DP_SUCCESS) {
-        DeviceIconInfo deviceIconInfo;
-        ConvertToDeviceIconInfo(resultSet, deviceIconInfo);
-        deviceIconInfos.emplace_back(deviceIconInfo);
+    bool isModified = std::any_of(metas.begin(), metas.end(), [&filterOptions](const DeviceIconInfo& meta) {
+        return meta.GetVersion() != filterOptions.GetKnownVersion();
+    });
+    if (!isModified) {
+        HILOGI("icon not modified, version:%{public}s", filterOptions.GetKnownVersion().c_str());
+        deviceIconInfos.insert(deviceIconInfos.end(), metas.begin(), metas.end());
+        return DP_SUCCESS;
     }
-    resultSet->Close();
-    if (deviceIconInfos.empty()) {
-        return DP_NOT_FIND_DATA;
+    sql.clear();
+    condition.clear();
+    CreateQuerySqlAndCondition(filterOptions, sql, condition);
+    return QueryDeviceIconInfos(sql, condition, true, deviceIconInfos);
+}
+
+int32_t DeviceIconInfoDao::GetDeviceIconInfoMeta(const DeviceIconInfo& deviceIconInfo, DeviceIconInfo& meta)
+{
+    std::vector<ValueObject> condition {
+        ValueObject(deviceIconInfo.GetProductId()), ValueObject(deviceIconInfo.GetSubProductId()),
+        ValueObject(deviceIconInfo.GetImageType()), ValueObject(deviceIconInfo.GetSpecName()) };
+    std::vector<DeviceIconInfo> metas;
+    int32_t ret = QueryDeviceIconInfos(SELECT_DEVICE_ICON_INFO_META_BY_UNIQUE_KEY, condition, false, metas);
+    if (ret != DP_SUCCESS) {
+        return ret;
     }
+    meta = metas.front();
     return DP_SUCCESS;
 }
 
 int32_t DeviceIconInfoDao::DeleteDeviceIconInfo(const DeviceIconInfo& deviceIconInfo)
 {
-    {
-        std::lock_guard<std::mutex> lock(rdbMutex_);
+    std::lock_guard<std::mutex> lock(rdbMutex_);
+    int32_t ret = ProfileDataRdbAdapter::GetInstance().ExecuteInTransaction([this, &deviceIconInfo]() {
+        std::string iconHash;
+        GetIconHashById(deviceIconInfo.GetId(), iconHash);
         int32_t deleteRows = DELETEROWS_INIT;
-        int32_t ret = ProfileDataRdbAdapter::GetInstance().Delete(deleteRows, DEVICE_ICON_INFO_TABLE,
+        int32_t deleteRet = ProfileDataRdbAdapter::GetInstance().Delete(deleteRows, DEVICE_ICON_INFO_TABLE,
             ID_EQUAL_CONDITION, std::vector<ValueObject>{ ValueObject(deviceIconInfo.GetId()) });
-        if (ret != DP_SUCCESS) {
-            HILOGE("delete %{public}s data failed", DEVICE_ICON_INFO_TABLE.c_str());
-            return DP_DEL_DEVICE_ICON_INFO_FAIL;
+        if (deleteRet != DP_SUCCESS) {
+            return deleteRet;
         }
+        return ReleaseIconBlob(iconHash);
+    });
+    if (ret != DP_SUCCESS) {
+        HILOGE("delete %{public}s data failed", DEVICE_ICON_INFO_TABLE.c_str());
+        return DP_DEL_DEVICE_ICON_INFO_FAIL;
     }
     return DP_SUCCESS;
 }
@@ -132,15 +177,41 @@ int32_t DeviceIconInfoDao::UpdateDeviceIconInfo(const DeviceIconInfo& deviceIcon
     HILOGI("deviceIconInfo:%{public}s", deviceIconInfo.dump().c_str());
     ValuesBucket values;
     DeviceIconInfoToEntries(deviceIconInfo, values);
-    int32_t changeRowCnt = CHANGEROWCNT_INIT;
-    {
-        std::lock_guard<std::mutex> lock(rdbMutex_);
-        int32_t ret = ProfileDataRdbAdapter::GetInstance().Update(changeRowCnt, DEVICE_ICON_INFO_TABLE, values,
-            ID_EQUAL_CONDITION, std::vector<ValueObject>{ ValueObject(deviceIconInfo.GetId()) });
-        if (ret != DP_SUCCESS) {
-            HILOGE("Update %{public}s table failed", DEVICE_ICON_INFO_TABLE.c_str());
-            return DP_UPDATE_DEVICE_ICON_INFO_FAIL;
+    std::lock_guard<std::mutex> lock(rdbMutex_);
+    int32_t ret = ProfileDataRdbAdapter::GetInstance().ExecuteInTransaction([this, &deviceIconInfo, &values]() {
+        // an empty icon keeps the stored one
+        std::string newHash = GetIconHash(deviceIconInfo.GetIcon());
+        std::string oldHash;
+        int32_t refCount = 0;
+        bool isFound = false;
+        if (!newHash.empty()) {
+            GetIconHashById(deviceIconInfo.GetId(), oldHash);
+            int32_t blobRet = FindIconBlob(deviceIconInfo.GetIcon(), newHash, refCount, isFound);
+            if (blobRet != DP_SUCCESS) {
+                return blobRet;
+            }
+        }
+        bool iconChanged = !newHash.empty() && (!isFound || newHash != oldHash);
+        if (iconChanged) {
+            int32_t blobRet = AcquireIconBlob(deviceIconInfo.GetIcon(), newHash, refCount, isFound);
+            if (blobRet != DP_SUCCESS) {
+                return blobRet;
+            }
+            values.PutString(DEVICE_ICON_HASH, newHash);
+            // drops the inline icon of a row written before the blob table
+            values.PutNull(DEVICE_ICON);
+        }
+        int32_t changeRowCnt = CHANGEROWCNT_INIT;
+        int32_t updateRet = ProfileDataRdbAdapter::GetInstance().Update(changeRowCnt, DEVICE_ICON_INFO_TABLE,
+            values, ID_EQUAL_CONDITION, std::vector<ValueObject>{ ValueObject(deviceIconInfo.GetId()) });
+        if (updateRet != DP_SUCCESS) {
+            return updateRet;
         }
+        return iconChanged ? ReleaseIconBlob(oldHash) : DP_SUCCESS;
+    });
+    if (ret != DP_SUCCESS) {
+        HILOGE("Update %{public}s table failed", DEVICE_ICON_INFO_TABLE.c_str());
+        return DP_UPDATE_DEVICE_ICON_INFO_FAIL;
     }
     return DP_SUCCESS;
 }
@@ -152,6 +223,11 @@ int32_t DeviceIconInfoDao::CreateTable()
         HILOGE("%{public}s create failed", DEVICE_ICON_INFO_TABLE.c_str());
         return DP_CREATE_TABLE_FAIL;
     }
+    ret = ProfileDataRdbAdapter::GetInstance().CreateTable(CREATE_DEVICE_ICON_BLOB_TABLE_SQL);
+    if (ret != DP_SUCCESS) {
+        HILOGE("%{public}s create failed", DEVICE_ICON_BLOB_TABLE.c_str());
+        return DP_CREATE_TABLE_FAIL;
+    }
     return DP_SUCCESS;
 }
 
@@ -168,7 +244,13 @@ int32_t DeviceIconInfoDao::CreateIndex()
 bool DeviceIconInfoDao::CreateQuerySqlAndCondition(const DeviceIconInfoFilterOptions& filterOptions,
     std::string& sql, std::vector<ValueObject>& condition)
 {
-    sql = SELECT_DEVICE_ICON_INFO_TABLE;
+    return CreateQuerySqlAndCondition(filterOptions, SELECT_DEVICE_ICON_INFO_TABLE, sql, condition);
+}
+
+bool DeviceIconInfoDao::CreateQuerySqlAndCondition(const DeviceIconInfoFilterOptions& filterOptions,
+    const std::string& selectSql, std::string& sql, std::vector<ValueObject>& condition)
+{
+    sql = selectSql;
     bool flag = false;
     if (!filterOptions.GetProductIds().empty()) {
         sql += "a." + PRODUCT_ID + " IN(";
@@ -208,14 +290,13 @@ int32_t DeviceIconInfoDao::DeviceIconInfoToEntries(const DeviceIconInfo& deviceI
     values.PutString(SPEC_NAME, deviceIconInfo.GetSpecName());
     values.PutString(DEVICE_ICON_VERSION, deviceIconInfo.GetVersion());
     values.PutString(DEVICE_ICON_URL, deviceIconInfo.GetUrl());
-    if (!deviceIconInfo.GetIcon().empty()) {
-        values.PutBlob(DEVICE_ICON, deviceIconInfo.GetIcon());
-    }
+    // the icon itself goes to the blob table, see AcquireIconBlob
     values.PutLong(MODIFY_TIME, deviceIconInfo.GetModifyTime());
     return DP_SUCCESS;
 }
 
-int32_t DeviceIconInfoDao::ConvertToDeviceIconInfo(std::shared_ptr<ResultSet> resultSet, DeviceIconInfo& deviceIconInfo)
+int32_t DeviceIconInfoDao::ConvertToDeviceIconInfo(std::shared_ptr<ResultSet> resultSet, DeviceIconInfo& deviceIconInfo,
+    bool withIcon)
 {
     if (resultSet == nullptr) {
         HILOGE("resultSet is nullptr.");
@@ -235,9 +316,186 @@ int32_t DeviceIconInfoDao::ConvertToDeviceIconInfo(std::shared_ptr<ResultSet> re
     deviceIconInfo.SetVersion(rowEntity.Get(DEVICE_ICON_VERSION));
     deviceIconInfo.SetWiseVersion(rowEntity.Get(IMAGE_VERSION));
     deviceIconInfo.SetUrl(rowEntity.Get(DEVICE_ICON_URL));
-    deviceIconInfo.SetIcon(rowEntity.Get(DEVICE_ICON));
+    if (withIcon) {
+        deviceIconInfo.SetIcon(rowEntity.Get(DEVICE_ICON));
+    }
     deviceIconInfo.SetModifyTime(rowEntity.Get(MODIFY_TIME));
     return DP_SUCCESS;
 }
+
+int32_t DeviceIconInfoDao::QueryDeviceIconInfos(const std::string& sql, const std::vector<ValueObject>& condition,
+    bool withIcon, std::vector<DeviceIconInfo>& deviceIconInfos)
+{
+    std::shared_ptr<ResultSet> resultSet = ProfileDataRdbAdapter::GetInstance().Get(sql, condition);
+    if (resultSet == nullptr) {
+        HILOGE("resultSet is nullptr");
+        return DP_GET_RESULTSET_FAIL;
+    }
+    int32_t rowCount = ROWCOUNT_INIT;
+    resultSet->GetRowCount(rowCount);
+    if (rowCount == 0) {
+        HILOGE("by condition not find data");
+        resultSet->Close();
+        return DP_NOT_FIND_DATA;
+    }
+    size_t oldSize = deviceIconInfos.size();
+    while (resultSet->GoToNextRow() == DP_SUCCESS) {
+        DeviceIconInfo deviceIconInfo;
+        ConvertToDeviceIconInfo(resultSet, deviceIconInfo, withIcon);
+        deviceIconInfos.emplace_back(std::move(deviceIconInfo));
+    }
+    resultSet->Close();
+    if (deviceIconInfos.size() == oldSize) {
+        return DP_NOT_FIND_DATA;
+    }
+    return DP_SUCCESS;
+}
+
+std::string DeviceIconInfoDao::GetIconHash(const std::vector<uint8_t>& icon)
+{
+    if (icon.empty()) {
+        return "";
+    }
+    // FNV-1a with the size in front, only the key to look the icon up by: FindIconBlob compares the bytes
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (uint8_t byte : icon) {
+        hash ^= byte;
+        hash *= FNV_PRIME;
+    }
+    std::ostringstream oss;
+    oss << icon.size() << "-" << std::hex << std::setw(HEX_WIDTH) << std::setfill('0') << hash;
+    return oss.str();
+}
+
+int32_t DeviceIconInfoDao::FindIconBlob(const std::vector<uint8_t>& icon, std::string& iconHash, int32_t& refCount,
+    bool& isFound)
+{
+    std::string baseHash = iconHash;
+    for (int32_t probe = 0; probe < MAX_ICON_HASH_PROBE; probe++) {
+        iconHash = probe == 0 ? baseHash : baseHash + ICON_HASH_PROBE_SEPARATOR + std::to_string(probe);
+        std::shared_ptr<ResultSet> resultSet = ProfileDataRdbAdapter::GetInstance().Get(
+            SELECT_DEVICE_ICON_BLOB_BY_HASH, std::vector<ValueObject>{ ValueObject(iconHash) });
+        if (resultSet == nullptr) {
+            HILOGE("resultSet is nullptr");
+            return DP_GET_RESULTSET_FAIL;
+        }
+        if (resultSet->GoToFirstRow() != DP_SUCCESS) {
+            resultSet->Close();
+            refCount = 0;
+            isFound = false;
+            return DP_SUCCESS;
+        }
+        std::vector<uint8_t> storedIcon;
+        int32_t columnIndex = COLUMNINDEX_INIT;
+        resultSet->GetColumnIndex(DEVICE_ICON, columnIndex);
+        resultSet->GetBlob(columnIndex, storedIcon);
+        resultSet->GetColumnIndex(DEVICE_ICON_REF_COUNT, columnIndex);
+        resultSet->GetInt(columnIndex, refCount);
+        resultSet->Close();
+        if (storedIcon == icon) {
+            isFound = true;
+            return DP_SUCCESS;
+        }
+        HILOGW("another icon has the same hash, iconHash:%{public}s", iconHash.c_str());
+    }
+    HILOGE("no free key for the icon, iconHash:%{public}s", baseHash.c_str());
+    return DP_EXCEED_MAX_SIZE_FAIL;
+}
+
+int32_t DeviceIconInfoDao::AcquireIconBlob(const std::vector<uint8_t>& icon, const std::string& iconHash,
+    int32_t refCount, bool isFound)
+{
+    int32_t ret = DP_SUCCESS;
+    ValuesBucket values;
+    if (!isFound) {
+        values.PutString(DEVICE_ICON_HASH, iconHash);
+        values.PutBlob(DEVICE_ICON, icon);
+        values.PutInt(DEVICE_ICON_REF_COUNT, 1);
+        int64_t rowId = ROWID_INIT;
+        ret = ProfileDataRdbAdapter::GetInstance().Put(rowId, DEVICE_ICON_BLOB_TABLE, values);
+    } else {
+        values.PutInt(DEVICE_ICON_REF_COUNT, refCount + 1);
+        int32_t changeRowCnt = CHANGEROWCNT_INIT;
+        ret = ProfileDataRdbAdapter::GetInstance().Update(changeRowCnt, DEVICE_ICON_BLOB_TABLE, values,
+            ICON_HASH_EQUAL_CONDITION, std::vector<ValueObject>{ ValueObject(iconHash) });
+    }
+    if (ret != DP_SUCCESS) {
+        HILOGE("acquire icon blob failed, iconHash:%{public}s", iconHash.c_str());
+        return ret;
+    }
+    return DP_SUCCESS;
+}
+
+int32_t DeviceIconInfoDao::ReleaseIconBlob(const std::string& iconHash)
+{
+    if (iconHash.empty()) {
+        return DP_SUCCESS;
+    }
+    int32_t refCount = 0;
+    int32_t ret = GetIconBlobRefCount(iconHash, refCount);
+    if (ret == DP_NOT_FIND_DATA) {
+        // nothing left to release, the device_icon_info write goes on
+        HILOGW("icon blob not found, iconHash:%{public}s", iconHash.c_str());
+        return DP_SUCCESS;
+    }
+    if (ret != DP_SUCCESS) {
+        return ret;
+    }
+    if (refCount <= 1) {
+        int32_t deleteRows = DELETEROWS_INIT;
+        ret = ProfileDataRdbAdapter::GetInstance().Delete(deleteRows, DEVICE_ICON_BLOB_TABLE,
+            ICON_HASH_EQUAL_CONDITION, std::vector<ValueObject>{ ValueObject(iconHash) });
+    } else {
+        ValuesBucket values;
+        values.PutInt(DEVICE_ICON_REF_COUNT, refCount - 1);
+        int32_t changeRowCnt = CHANGEROWCNT_INIT;
+        ret = ProfileDataRdbAdapter::GetInstance().Update(changeRowCnt, DEVICE_ICON_BLOB_TABLE, values,
+            ICON_HASH_EQUAL_CONDITION, std::vector<ValueObject>{ ValueObject(iconHash) });
+    }
+    if (ret != DP_SUCCESS) {
+        HILOGE("release icon blob failed, iconHash:%{public}s", iconHash.c_str());
+        return ret;
+    }
+    return DP_SUCCESS;
+}
+
+int32_t DeviceIconInfoDao::GetIconBlobRefCount(const std::string& iconHash, int32_t& refCount)
+{
+    std::shared_ptr<ResultSet> resultSet = ProfileDataRdbAdapter::GetInstance().Get(
+        SELECT_DEVICE_ICON_BLOB_REF_COUNT, std::vector<ValueObject>{ ValueObject(iconHash) });
+    if (resultSet == nullptr) {
+        HILOGE("resultSet is nullptr");
+        return DP_GET_RESULTSET_FAIL;
+    }
+    if (resultSet->GoToFirstRow() != DP_SUCCESS) {
+        resultSet->Close();
+        return DP_NOT_FIND_DATA;
+    }
+    int32_t columnIndex = COLUMNINDEX_INIT;
+    resultSet->GetColumnIndex(DEVICE_ICON_REF_COUNT, columnIndex);
+    resultSet->GetInt(columnIndex, refCount);
+    resultSet->Close();
+    return DP_SUCCESS;
+}
+
+int32_t DeviceIconInfoDao::GetIconHashById(int32_t id, std::string& iconHash)
+{
+    std::shared_ptr<ResultSet> resultSet = ProfileDataRdbAdapter::GetInstance().Get(
+        SELECT_DEVICE_ICON_INFO_HASH_BY_ID, std::vector<ValueObject>{ ValueObject(id) });
+    if (resultSet == nullptr) {
+        HILOGE("resultSet is nullptr");
+        return DP_GET_RESULTSET_FAIL;
+    }
+    if (resultSet->GoToFirstRow() != DP_SUCCESS) {
+        resultSet->Close();
+        return DP_NOT_FIND_DATA;
+    }
+    int32_t columnIndex = COLUMNINDEX_INIT;
+    resultSet->GetColumnIndex(DEVICE_ICON_HASH, columnIndex);
+    // a row written before the blob table has a null hash, GetString leaves it empty
+    resultSet->GetString(columnIndex, iconHash);
+    resultSet->Close();
+    return DP_SUCCESS;
+}
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
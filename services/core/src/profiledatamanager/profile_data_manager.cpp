@@ -234,24 +234,18 @@ int32_t ProfileDataManager::PutDeviceIconInfoBatch(const std::vector<DeviceIconI
 
 int32_t ProfileDataManager::PutDeviceIconInfo(const DeviceIconInfo& deviceIconInfo)
 {
-    DeviceIconInfoFilterOptions filterOptions;
-    std::vector<std::string> productIds;
-    productIds.emplace_back(deviceIconInfo.GetProductId());
-    filterOptions.SetProductIds(productIds);
-    filterOptions.SetSubProductId(deviceIconInfo.GetSubProductId());
-    filterOptions.SetImageType(deviceIconInfo.GetImageType());
-    filterOptions.SetSpecName(deviceIconInfo.GetSpecName());
-    std::vector<DeviceIconInfo> deviceIconInfos;
-    int32_t ret = DeviceIconInfoDao::GetInstance().GetDeviceIconInfos(filterOptions, deviceIconInfos);
+    // upsert on the unique key, the icon about to be overwritten is never read
+    DeviceIconInfo meta;
+    int32_t ret = DeviceIconInfoDao::GetInstance().GetDeviceIconInfoMeta(deviceIconInfo, meta);
     if ((ret != DP_SUCCESS) && (ret != DP_NOT_FIND_DATA)) {
-        HILOGE("GetDeviceIconInfos failed,ret=%{public}d", ret);
+        HILOGE("GetDeviceIconInfoMeta failed,ret=%{public}d", ret);
         return ret;
     }
-    if (deviceIconInfos.empty()) {
+    if (ret == DP_NOT_FIND_DATA) {
         ret = DeviceIconInfoDao::GetInstance().PutDeviceIconInfo(deviceIconInfo);
     } else {
         DeviceIconInfo updateDeviceIconInfo = deviceIconInfo;
-        updateDeviceIconInfo.SetId(deviceIconInfos[0].GetId());
+        updateDeviceIconInfo.SetId(meta.GetId());
         ret = DeviceIconInfoDao::GetInstance().UpdateDeviceIconInfo(updateDeviceIconInfo);
     }
     if (ret != DP_SUCCESS) {
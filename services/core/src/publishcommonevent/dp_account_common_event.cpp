@@ -136,6 +136,10 @@ void DpAccountEventSubscriber::OnReceiveEvent(const CommonEventData &data)
     std::string receiveEvent = data.GetWant().GetAction();
     HILOGI("Received account event: %{public}s", receiveEvent.c_str());
     int32_t userId = data.GetCode();
+    if (receiveEvent == EventFwk::CommonEventSupport::COMMON_EVENT_SCREEN_LOCKED) {
+        ffrt::submit([=]() { callback_(userId, receiveEvent); });
+        return;
+    }
     bool isValidEvent = false;
     if (receiveEvent == EventFwk::CommonEventSupport::COMMON_EVENT_USER_SWITCHED ||
         receiveEvent == EventFwk::CommonEventSupport::COMMON_EVENT_USER_REMOVED) {
@@ -27,6 +27,7 @@
 #include "kv_store_death_recipient.h"
 #include "kv_sync_completed_listener.h"
 #include "profile_control_utils.h"
+#include "service_info_codec.h"
 
 #include "multi_user_manager.h"
 #include "parameter.h"
@@ -111,13 +112,19 @@ int32_t ServiceInfoManager::PutServiceInfo(const ServiceInfo &serviceInfo)
     }
     std::map<std::string, std::string> entries;
     ProfileUtils::ServiceInfoToEntries(serviceInfo, entries);
+    // the local store keeps the binary encoding, the sync store stays json for the peers to read
+    std::string encodedValue = ServiceInfoCodec::Encode(serviceInfo);
+    std::map<std::string, std::string> localEntries;
+    for (const auto& [key, value] : entries) {
+        localEntries[key] = encodedValue;
+    }
     {
         std::lock_guard<std::mutex> lock(storeMutex_);
         if (serviceInfoKvAdapter_ == nullptr) {
             HILOGE("deviceProfileStore is nullptr!");
             return DP_KV_DB_PTR_NULL;
         }
-        if (serviceInfoKvAdapter_->PutBatch(entries) != DP_SUCCESS) {
+        if (serviceInfoKvAdapter_->PutBatch(localEntries) != DP_SUCCESS) {
             return DP_PUT_KV_DB_FAIL;
         }
     }
@@ -214,26 +221,25 @@ int32_t ServiceInfoManager::GetAllServiceInfoList(std::vector<ServiceInfo>& serv
             return ret;
         }
     }
+    std::map<std::string, std::string> jsonEntries;
     for (const auto &entry : allEntries) {
         const std::string& keyStr = entry.first;
         const std::string& value = entry.second;
 
-        cJSON *jsonObj = cJSON_Parse(value.c_str());
-        if (jsonObj == nullptr) {
-            HILOGE("Parse JSON failed for key: %{public}s", ProfileUtils::GetDbKeyAnonyString(keyStr).c_str());
+        ServiceInfo serviceInfo;
+        int32_t ret = DecodeServiceInfo(keyStr, value, serviceInfo);
+        if (ret == DP_LOAD_JSON_FILE_FAIL) {
             continue;
         }
-
-        ParsedJSONFields fields;
-        if (!ParseAndValidateJSON(jsonObj, fields)) {
-            cJSON_Delete(jsonObj);
+        if (ret != DP_SUCCESS) {
             return DP_INVALID_PARAMS;
         }
-        ServiceInfo serviceInfo;
-        FillServiceInfo(fields, serviceInfo);
+        if (!ServiceInfoCodec::IsBinary(value)) {
+            jsonEntries[keyStr] = value;
+        }
         serviceInfos.push_back(serviceInfo);
-        cJSON_Delete(jsonObj);
     }
+    MigrateToBinary(jsonEntries);
     HILOGI("Get all serviceInfo success, count: %{public}zu", serviceInfos.size());
     return DP_SUCCESS;
 }
@@ -455,9 +461,79 @@ int32_t ServiceInfoManager::DeleteSyncServiceInfo(std::vector<std::string> match
     return DP_SUCCESS;
 }
 
+int32_t ServiceInfoManager::DecodeServiceInfo(const std::string& key, const std::string& value,
+    ServiceInfo& serviceInfo)
+{
+    if (ServiceInfoCodec::IsBinary(value)) {
+        ServiceInfoView view;
+        if (!view.Parse(value)) {
+            HILOGE("Parse binary failed for key: %{public}s", ProfileUtils::GetDbKeyAnonyString(key).c_str());
+            return DP_INVALID_PARAMS;
+        }
+        view.ToServiceInfo(serviceInfo);
+        return DP_SUCCESS;
+    }
+    cJSON *jsonObj = cJSON_Parse(value.c_str());
+    if (jsonObj == nullptr) {
+        HILOGE("Parse JSON failed for key: %{public}s", ProfileUtils::GetDbKeyAnonyString(key).c_str());
+        return DP_LOAD_JSON_FILE_FAIL;
+    }
+    ParsedJSONFields fields;
+    if (!ParseAndValidateJSON(jsonObj, fields)) {
+        cJSON_Delete(jsonObj);
+        return DP_INVALID_PARAMS;
+    }
+    FillServiceInfo(fields, serviceInfo);
+    cJSON_Delete(jsonObj);
+    return DP_SUCCESS;
+}
+
+void ServiceInfoManager::MigrateToBinary(const std::map<std::string, std::string>& jsonEntries)
+{
+    if (jsonEntries.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(storeMutex_);
+    if (serviceInfoKvAdapter_ == nullptr) {
+        return;
+    }
+    std::map<std::string, std::string> binaryEntries;
+    for (const auto& [key, value] : jsonEntries) {
+        // a put since the read has already stored the binary encoding of a newer value
+        std::string current;
+        ServiceInfo serviceInfo;
+        if (serviceInfoKvAdapter_->Get(key, current) != DP_SUCCESS || current != value ||
+            DecodeServiceInfo(key, value, serviceInfo) != DP_SUCCESS) {
+            continue;
+        }
+        binaryEntries[key] = ServiceInfoCodec::Encode(serviceInfo);
+    }
+    if (!binaryEntries.empty() && serviceInfoKvAdapter_->PutBatch(binaryEntries) != DP_SUCCESS) {
+        HILOGW("migrate %{public}zu entries failed, retry on the next read", binaryEntries.size());
+        return;
+    }
+    HILOGI("migrate %{public}zu entries to binary", binaryEntries.size());
+}
+
 int32_t ServiceInfoManager::ProcessServiceInfoEntry(const std::string& key, const std::string& value,
     const UserInfo& userInfo, std::vector<ServiceInfo>& serviceInfos)
 {
+    if (ServiceInfoCodec::IsBinary(value)) {
+        // only a match is copied out of the value
+        ServiceInfoView view;
+        if (!view.Parse(value)) {
+            HILOGE("Parse binary failed for key: %{public}s", ProfileUtils::GetDbKeyAnonyString(key).c_str());
+            return DP_INVALID_PARAMS;
+        }
+        if (view.GetUdid() == userInfo.udid &&
+            (userInfo.userId == DEFAULT_USER_ID || view.GetUserId() == userInfo.userId) &&
+            (userInfo.serviceId == DEFAULT_SERVICE_ID || view.GetServiceId() == userInfo.serviceId)) {
+            ServiceInfo serviceInfo;
+            view.ToServiceInfo(serviceInfo);
+            serviceInfos.push_back(serviceInfo);
+        }
+        return DP_SUCCESS;
+    }
     cJSON *jsonObj = cJSON_Parse(value.c_str());
     if (jsonObj == nullptr) {
         HILOGE("Parse JSON failed for key: %{public}s", ProfileUtils::GetDbKeyAnonyString(key).c_str());
@@ -16,6 +16,8 @@
 #include "session_key_manager.h"
 #include "asset_adapter.h"
 
+#include "securec.h"
+
 #include "distributed_device_profile_errors.h"
 #include "distributed_device_profile_log.h"
 #include "trust_profile_manager.h"
@@ -28,6 +30,7 @@ namespace DistributedDeviceProfile {
 IMPLEMENT_SINGLE_INSTANCE(SessionKeyManager);
 namespace {
     const std::string TAG = "SessionKeyManager";
+    constexpr size_t MAX_SESSION_KEY_CACHE_SIZE = 64;
 }
 
 int32_t SessionKeyManager::PutSessionKey(uint32_t userId,
@@ -57,6 +60,7 @@ int32_t SessionKeyManager::PutSessionKey(uint32_t userId,
         HILOGE("PutSessionKey failed");
         return ret;
     }
+    PutSessionKeyToCache(userId, sessionKeyId, sessionKey);
     HILOGI("userId : %{public}u, sessionKeyId : %{public}d", userId, sessionKeyId);
     return DP_SUCCESS;
 }
@@ -69,6 +73,23 @@ int32_t SessionKeyManager::GetSessionKey(uint32_t userId,
         HILOGE("params is invalid");
         return DP_INVALID_PARAMS;
     }
+    uint64_t generation = 0;
+    if (GetSessionKeyFromCache(userId, sessionKeyId, sessionKey, generation)) {
+        HILOGI("hit cache!");
+        return DP_SUCCESS;
+    }
+    int32_t ret = GetSessionKeyFromAsset(userId, sessionKeyId, sessionKey);
+    if (ret != DP_SUCCESS) {
+        return ret;
+    }
+    FillSessionKeyCache(userId, sessionKeyId, sessionKey, generation);
+    HILOGI("success!");
+    return DP_SUCCESS;
+}
+
+int32_t SessionKeyManager::GetSessionKeyFromAsset(uint32_t userId,
+    int32_t sessionKeyId, std::vector<uint8_t>& sessionKey)
+{
     DpAssetValue aliasValue = { .blob = { static_cast<uint32_t>(sizeof(sessionKeyId)),
         const_cast<uint8_t *>(reinterpret_cast<const uint8_t *>(&sessionKeyId)) } };
     DpAssetValue userIdValue = { .u32 = userId };
@@ -103,13 +124,19 @@ int32_t SessionKeyManager::GetSessionKey(uint32_t userId,
     }
     sessionKey = std::vector<uint8_t>(data, data + length);
     AssetAdapter::GetInstance().FreeResultSet(&resultSet);
-    HILOGI("success!");
     return DP_SUCCESS;
 }
 
 int32_t SessionKeyManager::GetSessionKey(int32_t sessionKeyId, std::vector<uint8_t>& sessionKey)
 {
     HILOGI("call! sessionKeyId : %{public}d", sessionKeyId);
+    uint32_t cachedUserId = 0;
+    uint64_t generation = 0;
+    if (GetUserIdFromCache(sessionKeyId, cachedUserId) &&
+        GetSessionKeyFromCache(cachedUserId, sessionKeyId, sessionKey, generation)) {
+        HILOGI("hit cache!");
+        return DP_SUCCESS;
+    }
     int32_t userId = 0;
     int32_t ret = TrustProfileManager::GetInstance().GetUserIdBySessionKeyId(sessionKeyId, userId);
     if (ret != DP_SUCCESS || userId < 0) {
@@ -150,8 +177,10 @@ int32_t SessionKeyManager::UpdateSessionKey(uint32_t userId,
         attrUpdate, sizeof(attrUpdate) / sizeof(attrUpdate[0]));
     if (ret != DP_SUCCESS) {
         HILOGE("UpdateSessionKey failed");
+        RemoveSessionKeyFromCache(userId, sessionKeyId);
         return ret;
     }
+    PutSessionKeyToCache(userId, sessionKeyId, sessionKey);
     HILOGI("success!");
     return DP_SUCCESS;
 }
@@ -171,7 +200,10 @@ int32_t SessionKeyManager::DeleteSessionKey(uint32_t userId, int32_t sessionKeyI
         { .tag = SEC_ASSET_TAG_USER_ID, .value = userIdValue }
     };
 
+    RemoveSessionKeyFromCache(userId, sessionKeyId);
     int32_t ret = AssetAdapter::GetInstance().DeleteAsset(attr, sizeof(attr) / sizeof(attr[0]));
+    // a get that read the asset before the delete must not fill the cache with it afterwards
+    RemoveSessionKeyFromCache(userId, sessionKeyId);
     if (ret != DP_SUCCESS) {
         HILOGE("DeleteAsset failed");
         return ret;
@@ -180,6 +212,114 @@ int32_t SessionKeyManager::DeleteSessionKey(uint32_t userId, int32_t sessionKeyI
     return DP_SUCCESS;
 }
 
+void SessionKeyManager::ClearSessionKeyCache()
+{
+    std::lock_guard<std::mutex> lock(sessionKeyCacheMutex_);
+    HILOGI("size : %{public}zu", sessionKeyCache_.size());
+    for (auto& [_, entry] : sessionKeyCache_) {
+        ZeroizeSessionKey(entry.sessionKey);
+    }
+    sessionKeyCache_.clear();
+    sessionKeyLru_.clear();
+    sessionKeyUserIndex_.clear();
+    cacheGeneration_++;
+}
+
+bool SessionKeyManager::GetSessionKeyFromCache(uint32_t userId, int32_t sessionKeyId,
+    std::vector<uint8_t>& sessionKey, uint64_t& generation)
+{
+    std::lock_guard<std::mutex> lock(sessionKeyCacheMutex_);
+    generation = cacheGeneration_;
+    auto iter = sessionKeyCache_.find({userId, sessionKeyId});
+    if (iter == sessionKeyCache_.end()) {
+        return false;
+    }
+    sessionKeyLru_.splice(sessionKeyLru_.begin(), sessionKeyLru_, iter->second.lruIter);
+    sessionKey = iter->second.sessionKey;
+    return true;
+}
+
+bool SessionKeyManager::GetUserIdFromCache(int32_t sessionKeyId, uint32_t& userId)
+{
+    std::lock_guard<std::mutex> lock(sessionKeyCacheMutex_);
+    auto iter = sessionKeyUserIndex_.find(sessionKeyId);
+    if (iter == sessionKeyUserIndex_.end()) {
+        return false;
+    }
+    userId = iter->second;
+    return true;
+}
+
+void SessionKeyManager::PutSessionKeyToCache(uint32_t userId, int32_t sessionKeyId,
+    const std::vector<uint8_t>& sessionKey)
+{
+    std::lock_guard<std::mutex> lock(sessionKeyCacheMutex_);
+    cacheGeneration_++;
+    PutSessionKeyToCacheLocked(userId, sessionKeyId, sessionKey);
+}
+
+void SessionKeyManager::FillSessionKeyCache(uint32_t userId, int32_t sessionKeyId,
+    const std::vector<uint8_t>& sessionKey, uint64_t generation)
+{
+    std::lock_guard<std::mutex> lock(sessionKeyCacheMutex_);
+    // a put, update, delete or clear since the cache miss may have changed what the asset read
+    if (generation != cacheGeneration_) {
+        HILOGI("cache changed, skip fill, sessionKeyId : %{public}d", sessionKeyId);
+        return;
+    }
+    PutSessionKeyToCacheLocked(userId, sessionKeyId, sessionKey);
+}
+
+void SessionKeyManager::PutSessionKeyToCacheLocked(uint32_t userId, int32_t sessionKeyId,
+    const std::vector<uint8_t>& sessionKey)
+{
+    SessionKeyCacheKey cacheKey = {userId, sessionKeyId};
+    auto iter = sessionKeyCache_.find(cacheKey);
+    if (iter != sessionKeyCache_.end()) {
+        ZeroizeSessionKey(iter->second.sessionKey);
+        iter->second.sessionKey = sessionKey;
+        sessionKeyLru_.splice(sessionKeyLru_.begin(), sessionKeyLru_, iter->second.lruIter);
+        return;
+    }
+    // a sessionKeyId belongs to one user, drop a stale entry left under another one
+    auto indexIter = sessionKeyUserIndex_.find(sessionKeyId);
+    if (indexIter != sessionKeyUserIndex_.end()) {
+        EraseCacheEntryLocked(sessionKeyCache_.find({indexIter->second, sessionKeyId}));
+    }
+    while (sessionKeyCache_.size() >= MAX_SESSION_KEY_CACHE_SIZE && !sessionKeyLru_.empty()) {
+        EraseCacheEntryLocked(sessionKeyCache_.find(sessionKeyLru_.back()));
+    }
+    sessionKeyLru_.emplace_front(cacheKey);
+    sessionKeyCache_[cacheKey] = {sessionKey, sessionKeyLru_.begin()};
+    sessionKeyUserIndex_[sessionKeyId] = userId;
+}
+
+void SessionKeyManager::RemoveSessionKeyFromCache(uint32_t userId, int32_t sessionKeyId)
+{
+    std::lock_guard<std::mutex> lock(sessionKeyCacheMutex_);
+    cacheGeneration_++;
+    EraseCacheEntryLocked(sessionKeyCache_.find({userId, sessionKeyId}));
+}
+
+void SessionKeyManager::EraseCacheEntryLocked(std::map<SessionKeyCacheKey, SessionKeyCacheEntry>::iterator iter)
+{
+    if (iter == sessionKeyCache_.end()) {
+        return;
+    }
+    ZeroizeSessionKey(iter->second.sessionKey);
+    sessionKeyLru_.erase(iter->second.lruIter);
+    sessionKeyUserIndex_.erase(iter->first.second);
+    sessionKeyCache_.erase(iter);
+}
+
+void SessionKeyManager::ZeroizeSessionKey(std::vector<uint8_t>& sessionKey)
+{
+    if (!sessionKey.empty()) {
+        (void)memset_s(sessionKey.data(), sessionKey.size(), 0, sessionKey.size());
+    }
+    sessionKey.clear();
+}
+
 void SessionKeyManager::GeneratedSessionKeyId(uint32_t userId, int32_t& sessionKeyId)
 {
     HILOGI("call");
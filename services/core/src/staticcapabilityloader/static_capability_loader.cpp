@@ -43,12 +43,21 @@ int32_t StaticCapabilityLoader::Init()
 int32_t StaticCapabilityLoader::UnInit()
 {
     HILOGI("call!");
+    std::lock_guard<std::mutex> lock(staticTableMutex_);
+    capabilityTable_ = nullptr;
+    infoTable_ = nullptr;
+    capabilityTableLoaded_ = false;
+    infoTableLoaded_ = false;
     return DP_SUCCESS;
 }
 
 int32_t StaticCapabilityLoader::LoadStaticCapability(std::string& staticCapability)
 {
     HILOGD("call!");
+    std::shared_ptr<StaticProfileTable> table = GetStaticTable(StaticTableKind::CAPABILITY);
+    if (table != nullptr) {
+        return GetStaticCapability(*table, staticCapability);
+    }
     std::string fileContent = "";
     int32_t loadJsonResult = LoadJsonFile(STATIC_CAPABILITY_PATH, fileContent);
     if (loadJsonResult != DP_SUCCESS) {
@@ -285,7 +294,6 @@ int32_t StaticCapabilityLoader::GenerateStaticProfiles(const std::string& device
             HILOGW("service: %{public}s does not have static capability", serviceId.c_str());
             continue;
         }
-        HILOGD("service: %{public}s has static capability", serviceId.c_str());
         char* abilityValue = cJSON_Print(abilityValueItem);
         if (abilityValue == NULL) {
             HILOGE("Get abilityValue fail!");
@@ -293,13 +301,20 @@ int32_t StaticCapabilityLoader::GenerateStaticProfiles(const std::string& device
         }
         std::string charValue = abilityValue;
         cJSON_free(abilityValue);
-        CharacteristicProfile characteristicProfile(deviceId, serviceId, STATIC_CHARACTERISTIC_KEY, charValue);
-        charProfiles[ProfileUtils::GenerateCharProfileKey(deviceId, serviceId, STATIC_CHARACTERISTIC_KEY)] =
-            characteristicProfile;
+        AddStaticProfile(deviceId, serviceId, charValue, charProfiles);
     }
     return DP_SUCCESS;
 }
 
+void StaticCapabilityLoader::AddStaticProfile(const std::string& deviceId, const std::string& serviceId,
+    const std::string& charValue, std::unordered_map<std::string, CharacteristicProfile>& charProfiles)
+{
+    HILOGD("service: %{public}s has static capability", serviceId.c_str());
+    CharacteristicProfile characteristicProfile(deviceId, serviceId, STATIC_CHARACTERISTIC_KEY, charValue);
+    charProfiles[ProfileUtils::GenerateCharProfileKey(deviceId, serviceId, STATIC_CHARACTERISTIC_KEY)] =
+        characteristicProfile;
+}
+
 int32_t StaticCapabilityLoader::LoadStaticInfo(const std::string& staticCapability, std::string& staticVersion,
     std::unordered_map<std::string, CharacteristicProfile>& charProfiles)
 {
@@ -308,6 +323,10 @@ int32_t StaticCapabilityLoader::LoadStaticInfo(const std::string& staticCapabili
         HILOGE("staticCapability is invalid!");
         return DP_INVALID_PARAM;
     }
+    std::shared_ptr<StaticProfileTable> table = GetStaticTable(StaticTableKind::INFO);
+    if (table != nullptr) {
+        return GetStaticInfo(*table, staticCapability, staticVersion, charProfiles);
+    }
     std::string fileContent = "";
     int32_t loadJsonResult = LoadJsonFile(STATIC_INFO_PATH, fileContent);
     if (loadJsonResult != DP_SUCCESS) {
@@ -347,6 +366,10 @@ int32_t StaticCapabilityLoader::LoadStaticProfiles(const std::string& deviceId,
         HILOGE("staticVersion is invalid!");
         return DP_INVALID_PARAM;
     }
+    std::shared_ptr<StaticProfileTable> table = GetStaticTable(StaticTableKind::INFO);
+    if (table != nullptr) {
+        return GetStaticInfoByVersion(deviceId, staticCapability, *table, staticVersion, charProfiles);
+    }
     std::string fileContent = "";
     int32_t loadJsonResult = LoadJsonFile(STATIC_INFO_PATH, fileContent);
     if (loadJsonResult != DP_SUCCESS) {
@@ -498,5 +521,120 @@ bool StaticCapabilityLoader::IsValidVersion(const std::string& version)
     return std::regex_match(version, rule);
 }
 
+std::shared_ptr<StaticProfileTable> StaticCapabilityLoader::GetStaticTable(StaticTableKind kind)
+{
+    std::lock_guard<std::mutex> lock(staticTableMutex_);
+    if (kind == StaticTableKind::CAPABILITY) {
+        if (!capabilityTableLoaded_) {
+            capabilityTable_ = StaticProfileTable::Open(STATIC_CAPABILITY_PATH, kind);
+            capabilityTableLoaded_ = true;
+        }
+        return capabilityTable_;
+    }
+    if (!infoTableLoaded_) {
+        infoTable_ = StaticProfileTable::Open(STATIC_INFO_PATH, kind);
+        infoTableLoaded_ = true;
+    }
+    return infoTable_;
+}
+
+int32_t StaticCapabilityLoader::GetStaticCapability(const StaticProfileTable& table, std::string& staticCapability)
+{
+    HILOGD("call!");
+    int32_t capabilityNum = static_cast<int32_t>(table.GetRecordCount());
+    if (capabilityNum == 0 || capabilityNum > MAX_STATIC_CAPABILITY_SIZE) {
+        HILOGE("CapabilityNum is invalid, nums: %{public}d!", capabilityNum);
+        return DP_PARSE_STATIC_CAP_FAIL;
+    }
+    InitStaticCapability(capabilityNum, staticCapability);
+    for (int32_t i = 0; i < capabilityNum; i++) {
+        const StaticCapabilityRecord* record = table.GetCapabilityRecord(static_cast<uint32_t>(i));
+        if (record == nullptr || record->handlerName.length == 0 || record->handlerLoc.length == 0) {
+            HILOGE("Get handler_name or handler_loc fail!");
+            continue;
+        }
+        SetStaticCapabilityFlag(table.GetString(record->handlerName), table.GetString(record->handlerLoc),
+            staticCapability);
+    }
+    HILOGI("success!");
+    return DP_SUCCESS;
+}
+
+int32_t StaticCapabilityLoader::GetStaticInfo(const StaticProfileTable& table, const std::string& staticCapability,
+    std::string& staticVersion, std::unordered_map<std::string, CharacteristicProfile>& charProfiles)
+{
+    HILOGD("call!");
+    int32_t staticInfoNum = static_cast<int32_t>(table.GetRecordCount());
+    if (staticInfoNum == 0 || staticInfoNum > MAX_STATIC_CAPABILITY_SIZE) {
+        HILOGE("staticInfoNum is invalid, nums: %{public}d!", staticInfoNum);
+        return DP_GET_STATIC_INFO_FAIL;
+    }
+    const StaticInfoRecord* lastStaticInfo = table.GetStaticInfoRecord(static_cast<uint32_t>(staticInfoNum - 1));
+    if (lastStaticInfo == nullptr) {
+        HILOGE("lastStaticInfo is nullptr!");
+        return DP_GET_STATIC_INFO_FAIL;
+    }
+    if ((lastStaticInfo->flags & STATIC_INFO_FLAG_HAS_VERSION) != 0) {
+        staticVersion = table.GetString(lastStaticInfo->version);
+    }
+    std::string localDeviceId = ContentSensorManagerUtils::GetInstance().ObtainLocalUdid();
+    GenerateStaticProfiles(localDeviceId, staticCapability, table, *lastStaticInfo, charProfiles);
+    HILOGI("success!");
+    return DP_SUCCESS;
+}
+
+int32_t StaticCapabilityLoader::GetStaticInfoByVersion(const std::string& deviceId,
+    const std::string& staticCapability, const StaticProfileTable& table, const std::string& staticVersion,
+    std::unordered_map<std::string, CharacteristicProfile>& charProfiles)
+{
+    HILOGD("call!");
+    int32_t staticInfoNum = static_cast<int32_t>(table.GetRecordCount());
+    if (staticInfoNum == 0 || staticInfoNum > MAX_STATIC_CAPABILITY_SIZE) {
+        HILOGE("staticInfoNum is invalid, nums: %{public}d!", staticInfoNum);
+        return DP_GET_STATIC_INFO_FAIL;
+    }
+    for (int32_t i = 0; i < staticInfoNum; i++) {
+        const StaticInfoRecord* record = table.GetStaticInfoRecord(static_cast<uint32_t>(i));
+        if (record == nullptr || (record->flags & STATIC_INFO_FLAG_HAS_VERSION) == 0) {
+            continue;
+        }
+        if (StaticVersionCheck(staticVersion, table.GetString(record->version))) {
+            GenerateStaticProfiles(deviceId, staticCapability, table, *record, charProfiles);
+            HILOGI("success!");
+            return DP_SUCCESS;
+        }
+    }
+    HILOGE("staticInfo not found");
+    return DP_GET_STATIC_INFO_FAIL;
+}
+
+int32_t StaticCapabilityLoader::GenerateStaticProfiles(const std::string& deviceId,
+    const std::string& staticCapability, const StaticProfileTable& table, const StaticInfoRecord& staticInfo,
+    std::unordered_map<std::string, CharacteristicProfile>& charProfiles)
+{
+    HILOGD("call!");
+    if (deviceId.empty() || deviceId.size() > MAX_STRING_LEN) {
+        HILOGE("deviceId is invalid!");
+        return DP_INVALID_PARAM;
+    }
+    if ((staticInfo.flags & STATIC_INFO_FLAG_HAS_ABILITIES) == 0) {
+        HILOGE("abilities is not array!");
+        return DP_GET_STATIC_INFO_FAIL;
+    }
+    for (uint32_t i = 0; i < staticInfo.abilityCount; i++) {
+        const StaticAbilityRecord* ability = table.GetAbilityRecord(staticInfo.abilityStart + i);
+        if (ability == nullptr) {
+            continue;
+        }
+        std::string serviceId = table.GetString(ability->abilityKey);
+        if (!HasStaticCapability(serviceId, staticCapability)) {
+            HILOGW("service: %{public}s does not have static capability", serviceId.c_str());
+            continue;
+        }
+        AddStaticProfile(deviceId, serviceId, table.GetString(ability->abilityValue), charProfiles);
+    }
+    return DP_SUCCESS;
+}
+
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "static_profile_table.h"
+
+#include <climits>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "config_policy_utils.h"
+#include "distributed_device_profile_constants.h"
+#include "distributed_device_profile_log.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+namespace {
+    const std::string TAG = "StaticProfileTable";
+    const std::string JSON_SUFFIX = ".json";
+    const std::string BIN_SUFFIX = ".bin";
+    constexpr size_t MAX_STATIC_TABLE_SIZE = 4 * 1024 * 1024;
+    constexpr size_t MAX_STATIC_JSON_SIZE = 4 * 1024 * 1024;
+    constexpr uint32_t TABLE_ALIGNMENT = 4;
+    constexpr uint32_t FNV_OFFSET_BASIS = 0x811c9dc5;
+    constexpr uint32_t FNV_PRIME = 0x01000193;
+    static_assert(sizeof(StaticTableHeader) == 44, "StaticTableHeader must match the compiler layout");
+    static_assert(sizeof(StaticCapabilityRecord) == 16, "StaticCapabilityRecord must match the compiler layout");
+    static_assert(sizeof(StaticInfoRecord) == 20, "StaticInfoRecord must match the compiler layout");
+    static_assert(sizeof(StaticAbilityRecord) == 16, "StaticAbilityRecord must match the compiler layout");
+
+    bool IsRangeValid(uint64_t offset, uint64_t count, uint64_t recordSize, uint64_t totalSize)
+    {
+        return offset % TABLE_ALIGNMENT == 0 && offset <= totalSize && count * recordSize <= totalSize - offset;
+    }
+
+    std::string GetDirName(const std::string& path)
+    {
+        size_t pos = path.find_last_of('/');
+        return pos == std::string::npos ? "" : path.substr(0, pos);
+    }
+
+    uint32_t Fnv1a(const uint8_t* data, size_t size)
+    {
+        uint32_t hash = FNV_OFFSET_BASIS;
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ data[i]) * FNV_PRIME;
+        }
+        return hash;
+    }
+
+    // a same size edit of the json keeps its size, so the table is matched by content
+    bool HashFile(const std::string& path, uint32_t& hash)
+    {
+        int32_t fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat fileStat = {};
+        if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0 ||
+            static_cast<uint64_t>(fileStat.st_size) > MAX_STATIC_JSON_SIZE) {
+            close(fd);
+            return false;
+        }
+        size_t size = static_cast<size_t>(fileStat.st_size);
+        void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (addr == MAP_FAILED) {
+            return false;
+        }
+        hash = Fnv1a(static_cast<const uint8_t*>(addr), size);
+        munmap(addr, size);
+        return true;
+    }
+}
+
+StaticProfileTable::StaticProfileTable(const uint8_t* base, size_t size)
+    : base_(base), size_(size), header_(reinterpret_cast<const StaticTableHeader*>(base))
+{
+}
+
+StaticProfileTable::~StaticProfileTable()
+{
+    if (base_ != nullptr) {
+        munmap(const_cast<uint8_t*>(base_), size_);
+        base_ = nullptr;
+    }
+}
+
+std::shared_ptr<StaticProfileTable> StaticProfileTable::Open(const std::string& jsonCfgPath, StaticTableKind kind)
+{
+    std::string binPath = "";
+    if (!ResolveCfgFile(GetBinPath(jsonCfgPath), binPath)) {
+        HILOGI("no static table for %{public}s", jsonCfgPath.c_str());
+        return nullptr;
+    }
+    std::string jsonPath = "";
+    if (!ResolveCfgFile(jsonCfgPath, jsonPath)) {
+        return OpenFile(binPath, kind, 0);
+    }
+    // a json in a higher priority config layer overrides a table built for a lower one
+    if (GetDirName(jsonPath) != GetDirName(binPath)) {
+        HILOGW("static table is shadowed by %{public}s", jsonPath.c_str());
+        return nullptr;
+    }
+    uint32_t sourceHash = 0;
+    if (!HashFile(jsonPath, sourceHash)) {
+        HILOGE("hash json failed!");
+        return nullptr;
+    }
+    return OpenFile(binPath, kind, sourceHash);
+}
+
+std::shared_ptr<StaticProfileTable> StaticProfileTable::OpenFile(const std::string& binPath, StaticTableKind kind,
+    uint32_t sourceHash)
+{
+    int32_t fd = open(binPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        HILOGE("open static table failed!");
+        return nullptr;
+    }
+    struct stat binStat = {};
+    if (fstat(fd, &binStat) != 0 || binStat.st_size < static_cast<off_t>(sizeof(StaticTableHeader)) ||
+        static_cast<uint64_t>(binStat.st_size) > MAX_STATIC_TABLE_SIZE) {
+        HILOGE("static table size is invalid!");
+        close(fd);
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(binStat.st_size);
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        HILOGE("mmap static table failed!");
+        return nullptr;
+    }
+    std::shared_ptr<StaticProfileTable> table(new StaticProfileTable(static_cast<const uint8_t*>(addr), size));
+    if (!table->Validate(kind, sourceHash)) {
+        HILOGW("static table %{public}s is invalid or stale", binPath.c_str());
+        return nullptr;
+    }
+    HILOGI("static table loaded, records: %{public}u", table->GetRecordCount());
+    return table;
+}
+
+bool StaticProfileTable::Validate(StaticTableKind kind, uint32_t sourceHash) const
+{
+    if (header_->magic != STATIC_TABLE_MAGIC || header_->formatVersion != STATIC_TABLE_FORMAT_VERSION ||
+        header_->kind != static_cast<uint16_t>(kind) || header_->totalSize != size_) {
+        HILOGE("static table header mismatch!");
+        return false;
+    }
+    if (sourceHash != 0 && header_->sourceHash != sourceHash) {
+        HILOGW("static table was built from another json");
+        return false;
+    }
+    if (Fnv1a(base_ + sizeof(StaticTableHeader), size_ - sizeof(StaticTableHeader)) != header_->checksum) {
+        HILOGE("static table checksum mismatch!");
+        return false;
+    }
+    uint64_t primarySize = kind == StaticTableKind::CAPABILITY ? sizeof(StaticCapabilityRecord) :
+        sizeof(StaticInfoRecord);
+    if (!IsRangeValid(header_->primaryOffset, header_->primaryCount, primarySize, size_) ||
+        !IsRangeValid(header_->secondaryOffset, header_->secondaryCount, sizeof(StaticAbilityRecord), size_) ||
+        header_->stringPoolOffset > size_ || header_->stringPoolSize > size_ - header_->stringPoolOffset) {
+        HILOGE("static table section out of range!");
+        return false;
+    }
+    for (uint32_t i = 0; i < header_->primaryCount; i++) {
+        if (kind == StaticTableKind::CAPABILITY) {
+            const StaticCapabilityRecord* record = GetCapabilityRecord(i);
+            if (!IsStringValid(record->handlerName) || !IsStringValid(record->handlerLoc)) {
+                return false;
+            }
+            continue;
+        }
+        const StaticInfoRecord* record = GetStaticInfoRecord(i);
+        if (!IsStringValid(record->version) ||
+            static_cast<uint64_t>(record->abilityStart) + record->abilityCount > header_->secondaryCount) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < header_->secondaryCount; i++) {
+        const StaticAbilityRecord* record = GetAbilityRecord(i);
+        if (!IsStringValid(record->abilityKey) || !IsStringValid(record->abilityValue)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool StaticProfileTable::IsStringValid(const StaticTableString& str) const
+{
+    return str.length <= static_cast<uint32_t>(MAX_STRING_LEN) && str.offset <= header_->stringPoolSize &&
+        str.length <= header_->stringPoolSize - str.offset;
+}
+
+uint32_t StaticProfileTable::GetRecordCount() const
+{
+    return header_->primaryCount;
+}
+
+const StaticCapabilityRecord* StaticProfileTable::GetCapabilityRecord(uint32_t index) const
+{
+    if (header_->kind != static_cast<uint16_t>(StaticTableKind::CAPABILITY) || index >= header_->primaryCount) {
+        return nullptr;
+    }
+    return reinterpret_cast<const StaticCapabilityRecord*>(base_ + header_->primaryOffset) + index;
+}
+
+const StaticInfoRecord* StaticProfileTable::GetStaticInfoRecord(uint32_t index) const
+{
+    if (header_->kind != static_cast<uint16_t>(StaticTableKind::INFO) || index >= header_->primaryCount) {
+        return nullptr;
+    }
+    return reinterpret_cast<const StaticInfoRecord*>(base_ + header_->primaryOffset) + index;
+}
+
+const StaticAbilityRecord* StaticProfileTable::GetAbilityRecord(uint32_t index) const
+{
+    if (index >= header_->secondaryCount) {
+        return nullptr;
+    }
+    return reinterpret_cast<const StaticAbilityRecord*>(base_ + header_->secondaryOffset) + index;
+}
+
+std::string StaticProfileTable::GetString(const StaticTableString& str) const
+{
+    if (str.length == 0) {
+        return "";
+    }
+    return std::string(reinterpret_cast<const char*>(base_ + header_->stringPoolOffset + str.offset), str.length);
+}
+
+std::string StaticProfileTable::GetBinPath(const std::string& jsonCfgPath)
+{
+    if (jsonCfgPath.size() > JSON_SUFFIX.size() &&
+        jsonCfgPath.compare(jsonCfgPath.size() - JSON_SUFFIX.size(), JSON_SUFFIX.size(), JSON_SUFFIX) == 0) {
+        return jsonCfgPath.substr(0, jsonCfgPath.size() - JSON_SUFFIX.size()) + BIN_SUFFIX;
+    }
+    return jsonCfgPath + BIN_SUFFIX;
+}
+
+bool StaticProfileTable::ResolveCfgFile(const std::string& cfgPath, std::string& realPath)
+{
+    char buf[MAX_PATH_LEN] = {0};
+    char targetPath[PATH_MAX + 1] = {0x00};
+    char* srcPath = GetOneCfgFile(cfgPath.c_str(), buf, MAX_PATH_LEN);
+    if (srcPath == nullptr || strlen(srcPath) == 0 || strlen(srcPath) > PATH_MAX ||
+        realpath(srcPath, targetPath) == nullptr) {
+        return false;
+    }
+    realPath = targetPath;
+    return true;
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
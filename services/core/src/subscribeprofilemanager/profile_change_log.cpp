@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "profile_change_log.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+namespace {
+    size_t EstimateRecordBytes(const ProfileChangeRecord& record)
+    {
+        return sizeof(ProfileChangeRecord) + DpMemoryManager::EstimateBytes(record.subscribeKey) +
+            DpMemoryManager::EstimateBytes(record.dbKey) + DpMemoryManager::EstimateBytes(record.dbValue);
+    }
+}
+
+ProfileChangeLog::ProfileChangeLog(size_t capacity, size_t keyCapacity)
+    : capacity_(std::max<size_t>(capacity, 1)), keyCapacity_(std::max<size_t>(keyCapacity, 1))
+{
+}
+
+uint64_t ProfileChangeLog::Append(ProfileType profileType, ChangeType changeType, const std::string& subscribeKey,
+    const std::string& dbKey, const std::string& dbValue)
+{
+    std::lock_guard<std::mutex> lock(logMutex_);
+    TypeLog& typeLog = typeLogs_[profileType];
+    ProfileChangeRecord record;
+    record.seq = ++typeLog.lastSeq;
+    record.profileType = profileType;
+    record.changeType = changeType;
+    record.subscribeKey = subscribeKey;
+    record.dbKey = dbKey;
+    record.dbValue = dbValue;
+    if (typeLog.records.size() >= capacity_) {
+        typeLog.records.pop_front();
+    }
+    typeLog.records.push_back(record);
+    if (lastChanges_.find(subscribeKey) == lastChanges_.end() && lastChanges_.size() >= keyCapacity_) {
+        EvictLastChange();
+    }
+    LastChange& lastChange = lastChanges_[subscribeKey];
+    lastChange.order = ++appendCount_;
+    lastChange.record = std::move(record);
+    return typeLog.lastSeq;
+}
+
+uint64_t ProfileChangeLog::GetLastSeq(ProfileType profileType)
+{
+    std::lock_guard<std::mutex> lock(logMutex_);
+    auto iter = typeLogs_.find(profileType);
+    return iter == typeLogs_.end() ? 0 : iter->second.lastSeq;
+}
+
+bool ProfileChangeLog::GetChanges(ProfileType profileType, uint64_t fromSeq, const std::string& subscribeKey,
+    std::vector<ProfileChangeRecord>& records)
+{
+    std::lock_guard<std::mutex> lock(logMutex_);
+    auto typeIter = typeLogs_.find(profileType);
+    if (typeIter == typeLogs_.end() || fromSeq > typeIter->second.lastSeq) {
+        return true;
+    }
+    const TypeLog& typeLog = typeIter->second;
+    if (!typeLog.records.empty() && typeLog.records.front().seq <= fromSeq) {
+        for (const auto& record : typeLog.records) {
+            if (record.seq >= fromSeq && record.subscribeKey == subscribeKey) {
+                records.push_back(record);
+            }
+        }
+        return true;
+    }
+    auto lastIter = lastChanges_.find(subscribeKey);
+    if (lastIter != lastChanges_.end() && lastIter->second.record.profileType == profileType) {
+        if (lastIter->second.record.seq >= fromSeq) {
+            records.push_back(lastIter->second.record);
+        }
+        return true;
+    }
+    // without a last change the key did not change, unless it was evicted after fromSeq
+    return typeLog.evictedSeq < fromSeq;
+}
+
+void ProfileChangeLog::Clear()
+{
+    std::lock_guard<std::mutex> lock(logMutex_);
+    typeLogs_.clear();
+    lastChanges_.clear();
+}
+
+DpCacheUsage ProfileChangeLog::GetUsage()
+{
+    DpCacheUsage usage;
+    std::lock_guard<std::mutex> lock(logMutex_);
+    for (const auto& [profileType, typeLog] : typeLogs_) {
+        usage.entries += typeLog.records.size();
+        for (const auto& record : typeLog.records) {
+            usage.bytes += EstimateRecordBytes(record);
+        }
+    }
+    for (const auto& [subscribeKey, lastChange] : lastChanges_) {
+        usage.bytes += CACHE_NODE_OVERHEAD_BYTES + sizeof(subscribeKey) + sizeof(lastChange.order) +
+            DpMemoryManager::EstimateBytes(subscribeKey) + EstimateRecordBytes(lastChange.record);
+    }
+    return usage;
+}
+
+void ProfileChangeLog::EvictLastChange()
+{
+    auto oldest = lastChanges_.begin();
+    for (auto iter = lastChanges_.begin(); iter != lastChanges_.end(); ++iter) {
+        if (iter->second.order < oldest->second.order) {
+            oldest = iter;
+        }
+    }
+    if (oldest == lastChanges_.end()) {
+        return;
+    }
+    TypeLog& typeLog = typeLogs_[oldest->second.record.profileType];
+    typeLog.evictedSeq = std::max(typeLog.evictedSeq, oldest->second.record.seq);
+    lastChanges_.erase(oldest);
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
@@ -15,16 +15,126 @@
 
 #include "subscribe_profile_manager.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <set>
+
+#include "cJSON.h"
+#include "ipc_skeleton.h"
+
+#include "device_profile_manager.h"
 #include "distributed_device_profile_errors.h"
+#include "dp_memory_manager.h"
+#include "dp_metrics.h"
 #include "dp_radar_helper.h"
+#include "kv_store_death_recipient.h"
 #include "profile_utils.h"
 #include "profile_cache.h"
+#include "service_info_kv_adapter.h"
+#include "write_behind_kv_adapter.h"
 
 namespace OHOS {
 namespace DistributedDeviceProfile {
 IMPLEMENT_SINGLE_INSTANCE(SubscribeProfileManager);
 namespace {
     const std::string TAG = "SubscribeProfileManager";
+    const std::string MEMORY_CACHE_NAME = "SubscribeProfileManager";
+    const std::string SUBSCRIBE_STORE_ID = "dp_kv_store_subscribe_info";
+    const std::string CHANGE_TYPES = "changeTypes";
+    const std::string TOKEN_ID = "tokenId";
+    const std::string RESTORE_COUNT = "restoreCount";
+    // rounds a replay chases the live changes of the profile type before it hands them to live delivery
+    constexpr int32_t MAX_REPLAY_ROUNDS = 8;
+
+    std::string ToStoreKey(int32_t saId, const std::string& subscribeKey)
+    {
+        return std::to_string(saId) + SEPARATOR + subscribeKey;
+    }
+
+    bool FromStoreKey(const std::string& storeKey, int32_t& saId, std::string& subscribeKey)
+    {
+        size_t pos = storeKey.find(SEPARATOR);
+        if (pos == std::string::npos || pos + SEPARATOR.size() >= storeKey.size() ||
+            !ProfileUtils::IsNumStr(storeKey.substr(0, pos))) {
+            return false;
+        }
+        saId = std::atoi(storeKey.substr(0, pos).c_str());
+        subscribeKey = storeKey.substr(pos + SEPARATOR.size());
+        return true;
+    }
+
+    // the change types sorted, so the same subscription always encodes to the same value
+    std::string EncodeSubscribeValue(const SubscribeInfo& subscribeInfo, uint32_t tokenId)
+    {
+        std::vector<int32_t> changeTypes;
+        for (auto changeType : subscribeInfo.GetProfileChangeTypes()) {
+            changeTypes.push_back(static_cast<int32_t>(changeType));
+        }
+        std::sort(changeTypes.begin(), changeTypes.end());
+        cJSON* json = cJSON_CreateObject();
+        if (json == nullptr) {
+            HILOGE("Create cJSON object failed!");
+            return "";
+        }
+        cJSON* changeTypesJson = cJSON_AddArrayToObject(json, CHANGE_TYPES.c_str());
+        for (int32_t changeType : changeTypes) {
+            cJSON* item = cJSON_CreateNumber(changeType);
+            if (changeTypesJson == nullptr || item == nullptr || !cJSON_AddItemToArray(changeTypesJson, item)) {
+                cJSON_Delete(item);
+                cJSON_Delete(json);
+                return "";
+            }
+        }
+        cJSON_AddNumberToObject(json, TOKEN_ID.c_str(), tokenId);
+        char* jsonStr = cJSON_PrintUnformatted(json);
+        cJSON_Delete(json);
+        if (jsonStr == nullptr) {
+            HILOGE("Convert cJSON to string failed!");
+            return "";
+        }
+        std::string value = jsonStr;
+        cJSON_free(jsonStr);
+        return value;
+    }
+
+    // restoreCount is absent until the subscription was first restored without its caller
+    bool DecodeSubscribeValue(const std::string& value, uint32_t& tokenId, int32_t& restoreCount)
+    {
+        cJSON* json = cJSON_Parse(value.c_str());
+        if (!cJSON_IsObject(json)) {
+            cJSON_Delete(json);
+            return false;
+        }
+        cJSON* tokenIdItem = cJSON_GetObjectItemCaseSensitive(json, TOKEN_ID.c_str());
+        bool isNumber = cJSON_IsNumber(tokenIdItem);
+        if (isNumber) {
+            tokenId = static_cast<uint32_t>(tokenIdItem->valuedouble);
+        }
+        cJSON* restoreCountItem = cJSON_GetObjectItemCaseSensitive(json, RESTORE_COUNT.c_str());
+        restoreCount = cJSON_IsNumber(restoreCountItem) ? restoreCountItem->valueint : 0;
+        cJSON_Delete(json);
+        return isNumber;
+    }
+
+    std::string SetRestoreCount(const std::string& value, int32_t restoreCount)
+    {
+        cJSON* json = cJSON_Parse(value.c_str());
+        if (!cJSON_IsObject(json)) {
+            cJSON_Delete(json);
+            return "";
+        }
+        cJSON_DeleteItemFromObjectCaseSensitive(json, RESTORE_COUNT.c_str());
+        cJSON_AddNumberToObject(json, RESTORE_COUNT.c_str(), restoreCount);
+        char* jsonStr = cJSON_PrintUnformatted(json);
+        cJSON_Delete(json);
+        if (jsonStr == nullptr) {
+            HILOGE("Convert cJSON to string failed!");
+            return "";
+        }
+        std::string newValue = jsonStr;
+        cJSON_free(jsonStr);
+        return newValue;
+    }
 }
 
 int32_t SubscribeProfileManager::Init()
@@ -51,16 +161,55 @@ int32_t SubscribeProfileManager::Init()
         funcsMap_[ProfileType::CHAR_PROFILE * ChangeType::DELETE] =
             &SubscribeProfileManager::NotifyCharProfileDelete;
     }
+    DpMemoryManager::GetInstance().RegisterCache(MEMORY_CACHE_NAME, [this]() {
+        DpCacheUsage usage = changeLog_.GetUsage();
+        std::lock_guard<std::mutex> lockGuard(subscribeMutex_);
+        for (const auto& [subscribeKey, subscribeInfos] : subscribeInfoMap_) {
+            usage.entries += subscribeInfos.size();
+            usage.bytes += CACHE_NODE_OVERHEAD_BYTES + sizeof(subscribeKey) +
+                DpMemoryManager::EstimateBytes(subscribeKey) +
+                subscribeInfos.size() * (CACHE_NODE_OVERHEAD_BYTES + sizeof(SubscribeInfo));
+        }
+        for (const auto& [subscription, missed] : missedChanges_) {
+            usage.bytes += CACHE_NODE_OVERHEAD_BYTES + sizeof(subscription) + sizeof(missed) +
+                DpMemoryManager::EstimateBytes(subscription.second);
+        }
+        for (const auto& [subscription, value] : persistedSubscribes_) {
+            usage.bytes += CACHE_NODE_OVERHEAD_BYTES + sizeof(subscription) + sizeof(value) +
+                DpMemoryManager::EstimateBytes(subscription.second) + DpMemoryManager::EstimateBytes(value);
+        }
+        for (const auto& [subscribeKey, saIds] : restoredSubscribes_) {
+            usage.bytes += CACHE_NODE_OVERHEAD_BYTES + sizeof(subscribeKey) +
+                DpMemoryManager::EstimateBytes(subscribeKey) +
+                saIds.size() * (CACHE_NODE_OVERHEAD_BYTES + sizeof(int32_t) + sizeof(uint32_t));
+        }
+        return usage;
+    });
+    InitSubscribeStore();
     return DP_SUCCESS;
 }
 
 int32_t SubscribeProfileManager::UnInit()
 {
     HILOGI("call!");
+    DpMemoryManager::GetInstance().UnRegisterCache(MEMORY_CACHE_NAME);
+    {
+        std::lock_guard<std::mutex> lockGuard(storeMutex_);
+        if (subscribeStore_ != nullptr) {
+            // flushes the buffered writes first
+            subscribeStore_->UnInit();
+            subscribeStore_ = nullptr;
+        }
+    }
     {
         std::lock_guard<std::mutex> lockGuard(subscribeMutex_);
         subscribeInfoMap_.clear();
+        missedChanges_.clear();
+        replayingSubscribes_.clear();
+        persistedSubscribes_.clear();
+        restoredSubscribes_.clear();
     }
+    changeLog_.Clear();
     {
         std::lock_guard<std::mutex> lockGuard(funcsMutex_);
         funcsMap_.clear();
@@ -71,8 +220,10 @@ int32_t SubscribeProfileManager::UnInit()
 int32_t SubscribeProfileManager::NotifyProfileChange(ProfileType profileType, ChangeType changeType,
     const std::string& dbKey, const std::string& dbValue)
 {
+    DpMetricsScope metricsScope(DpMetricsTimer::NOTIFY_PROFILE_CHANGE);
     int32_t code = static_cast<int32_t>(profileType) * static_cast<int32_t>(changeType);
     DpRadarHelper::GetInstance().ReportNotifyProfileChange(code);
+    AppendChangeLog(profileType, changeType, dbKey, dbValue);
     switch (code) {
         case ProfileType::DEVICE_PROFILE * ChangeType::ADD:
             return SubscribeProfileManager::NotifyDeviceProfileAdd(dbKey, dbValue);
@@ -98,12 +249,65 @@ int32_t SubscribeProfileManager::NotifyProfileChange(ProfileType profileType, Ch
     }
 }
 
+int32_t SubscribeProfileManager::NotifySwitchChange(const std::vector<CharacteristicProfile>& switchProfiles)
+{
+    if (switchProfiles.empty()) {
+        return DP_SUCCESS;
+    }
+    DpMetricsScope metricsScope(DpMetricsTimer::NOTIFY_PROFILE_CHANGE);
+    DpRadarHelper::GetInstance().ReportNotifyProfileChange(ProfileType::CHAR_PROFILE * ChangeType::UPDATE);
+    for (const auto& switchProfile : switchProfiles) {
+        AppendChangeLog(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, ProfileUtils::GetDbKeyByProfile(switchProfile),
+            switchProfile.GetCharacteristicValue());
+    }
+    // indexes of the changed switches per listener, so each subscriber is resolved once
+    std::map<IRemoteObject*, std::pair<sptr<IRemoteObject>, std::vector<size_t>>> listenerChanges;
+    {
+        std::lock_guard<std::mutex> lock(subscribeMutex_);
+        for (size_t i = 0; i < switchProfiles.size(); ++i) {
+            auto iter = subscribeInfoMap_.find(
+                DBKeyToSubcribeKey(ProfileUtils::GetDbKeyByProfile(switchProfiles[i])));
+            if (iter == subscribeInfoMap_.end()) {
+                continue;
+            }
+            for (const auto& subscribeInfo : iter->second) {
+                if (subscribeInfo.GetProfileChangeTypes().count(ProfileChangeType::CHAR_PROFILE_UPDATE) != 0 &&
+                    !IsReplayingLocked(subscribeInfo)) {
+                    sptr<IRemoteObject> listener = subscribeInfo.GetListener();
+                    auto& [listenerObj, indexes] = listenerChanges[listener.GetRefPtr()];
+                    listenerObj = listener;
+                    indexes.push_back(i);
+                }
+            }
+        }
+    }
+    HILOGI("switches: %{public}zu, listeners: %{public}zu", switchProfiles.size(), listenerChanges.size());
+    for (const auto& [listenerPtr, listenerChange] : listenerChanges) {
+        const auto& [listener, indexes] = listenerChange;
+        sptr<IProfileChangeListener> listenerProxy = iface_cast<IProfileChangeListener>(listener);
+        if (listenerProxy == nullptr) {
+            HILOGE("Cast to IProfileChangeListener failed!");
+            continue;
+        }
+        for (size_t index : indexes) {
+            const CharacteristicProfile& newCharProfile = switchProfiles[index];
+            // a switch change is a single bit flip, the old value is the other one
+            CharacteristicProfile oldCharProfile = newCharProfile;
+            oldCharProfile.SetCharacteristicValue(newCharProfile.GetCharacteristicValue() == SWITCH_ON ?
+                SWITCH_OFF : SWITCH_ON);
+            listenerProxy->OnCharacteristicProfileUpdate(oldCharProfile, newCharProfile);
+        }
+    }
+    return DP_SUCCESS;
+}
+
 int32_t SubscribeProfileManager::NotifyTrustDeviceProfileAdd(const TrustDeviceProfile& trustDeviceProfile)
 {
     auto subscriberInfos = GetSubscribeInfos(SUBSCRIBE_TRUST_DEVICE_PROFILE);
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
+    DpMetricsScope metricsScope(DpMetricsTimer::NOTIFY_TRUST_PROFILE_CHANGE);
     HILOGI("%{public}s!", trustDeviceProfile.dump().c_str());
     for (const auto& subscriberInfo : subscriberInfos) {
         sptr<IProfileChangeListener> listenerProxy = iface_cast<IProfileChangeListener>(subscriberInfo.GetListener());
@@ -125,6 +329,7 @@ int32_t SubscribeProfileManager::NotifyTrustDeviceProfileUpdate(const TrustDevic
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
+    DpMetricsScope metricsScope(DpMetricsTimer::NOTIFY_TRUST_PROFILE_CHANGE);
     HILOGI("%{public}s!", newDeviceProfile.dump().c_str());
     for (const auto& subscriberInfo : subscriberInfos) {
         sptr<IProfileChangeListener> listenerProxy = iface_cast<IProfileChangeListener>(subscriberInfo.GetListener());
@@ -145,6 +350,7 @@ int32_t SubscribeProfileManager::NotifyTrustDeviceProfileDelete(const TrustDevic
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
+    DpMetricsScope metricsScope(DpMetricsTimer::NOTIFY_TRUST_PROFILE_CHANGE);
     HILOGI("%{public}s!", trustDeviceProfile.dump().c_str());
     for (const auto& subscriberInfo : subscriberInfos) {
         sptr<IProfileChangeListener> listenerProxy = iface_cast<IProfileChangeListener>(subscriberInfo.GetListener());
@@ -165,6 +371,7 @@ int32_t SubscribeProfileManager::NotifyTrustDeviceProfileActive(const TrustDevic
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
+    DpMetricsScope metricsScope(DpMetricsTimer::NOTIFY_TRUST_PROFILE_CHANGE);
     HILOGI("%{public}s!", trustDeviceProfile.dump().c_str());
     for (const auto& subscriberInfo : subscriberInfos) {
         sptr<IProfileChangeListener> listenerProxy = iface_cast<IProfileChangeListener>(subscriberInfo.GetListener());
@@ -185,6 +392,7 @@ int32_t SubscribeProfileManager::NotifyTrustDeviceProfileInactive(const TrustDev
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
+    DpMetricsScope metricsScope(DpMetricsTimer::NOTIFY_TRUST_PROFILE_CHANGE);
     HILOGI("%{public}s!", trustDeviceProfile.dump().c_str());
     for (const auto& subscriberInfo : subscriberInfos) {
         sptr<IProfileChangeListener> listenerProxy = iface_cast<IProfileChangeListener>(subscriberInfo.GetListener());
@@ -205,6 +413,7 @@ int32_t SubscribeProfileManager::NotifyDeviceAclInactiveByDelete(const TrustDevi
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
+    DpMetricsScope metricsScope(DpMetricsTimer::NOTIFY_TRUST_PROFILE_CHANGE);
     HILOGI("%{public}s!", trustDeviceProfile.dump().c_str());
     for (const auto& subscriberInfo : subscriberInfos) {
         sptr<IProfileChangeListener> listenerProxy = iface_cast<IProfileChangeListener>(subscriberInfo.GetListener());
@@ -225,6 +434,7 @@ int32_t SubscribeProfileManager::NotifyDeviceAclInactiveByUpdate(const TrustDevi
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
+    DpMetricsScope metricsScope(DpMetricsTimer::NOTIFY_TRUST_PROFILE_CHANGE);
     HILOGI("%{public}s!", trustDeviceProfile.dump().c_str());
     for (const auto& subscriberInfo : subscriberInfos) {
         sptr<IProfileChangeListener> listenerProxy = iface_cast<IProfileChangeListener>(subscriberInfo.GetListener());
@@ -245,6 +455,7 @@ int32_t SubscribeProfileManager::NotifyAccountAclDelete(const TrustDeviceProfile
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
+    DpMetricsScope metricsScope(DpMetricsTimer::NOTIFY_TRUST_PROFILE_CHANGE);
     HILOGI("%{public}s!", trustDeviceProfile.dump().c_str());
     for (const auto& subscriberInfo : subscriberInfos) {
         sptr<IProfileChangeListener> listenerProxy = iface_cast<IProfileChangeListener>(subscriberInfo.GetListener());
@@ -265,6 +476,7 @@ int32_t SubscribeProfileManager::NotifyAccountAclInactive(const TrustDeviceProfi
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
+    DpMetricsScope metricsScope(DpMetricsTimer::NOTIFY_TRUST_PROFILE_CHANGE);
     HILOGI("%{public}s!", trustDeviceProfile.dump().c_str());
     for (const auto& subscriberInfo : subscriberInfos) {
         sptr<IProfileChangeListener> listenerProxy = iface_cast<IProfileChangeListener>(subscriberInfo.GetListener());
@@ -285,6 +497,7 @@ int32_t SubscribeProfileManager::NotifyAccountAclAdd(const TrustDeviceProfile& t
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
+    DpMetricsScope metricsScope(DpMetricsTimer::NOTIFY_TRUST_PROFILE_CHANGE);
     HILOGI("%{public}s!", trustDeviceProfile.dump().c_str());
     for (const auto& subscriberInfo : subscriberInfos) {
         sptr<IProfileChangeListener> listenerProxy = iface_cast<IProfileChangeListener>(subscriberInfo.GetListener());
@@ -305,6 +518,7 @@ int32_t SubscribeProfileManager::NotifyAccountAclActive(const TrustDeviceProfile
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
+    DpMetricsScope metricsScope(DpMetricsTimer::NOTIFY_TRUST_PROFILE_CHANGE);
     HILOGI("%{public}s!", trustDeviceProfile.dump().c_str());
     for (const auto& subscriberInfo : subscriberInfos) {
         sptr<IProfileChangeListener> listenerProxy = iface_cast<IProfileChangeListener>(subscriberInfo.GetListener());
@@ -323,6 +537,9 @@ int32_t SubscribeProfileManager::SubscribeDeviceProfile(const SubscribeInfo& sub
 {
     HILOGI("saId: %{public}d!, subscribeKey: %{public}s", subscribeInfo.GetSaId(),
         ProfileUtils::GetDbKeyAnonyString(subscribeInfo.GetSubscribeKey()).c_str());
+    uint32_t tokenId = IPCSkeleton::GetCallingTokenID();
+    std::pair<ProfileType, uint64_t> missed = { ProfileType::PROFILE_TYPE_MIN, 0 };
+    uint64_t replayId = 0;
     {
         std::lock_guard<std::mutex> lock(subscribeMutex_);
         if (subscribeInfoMap_.size() > MAX_LISTENER_SIZE) {
@@ -340,6 +557,32 @@ int32_t SubscribeProfileManager::SubscribeDeviceProfile(const SubscribeInfo& sub
             subscribeInfoMap_[subscribeInfo.GetSubscribeKey()].erase(subscribeInfo);
         }
         subscribeInfoMap_[subscribeInfo.GetSubscribeKey()].emplace(subscribeInfo);
+        bool isOwner = BindRestoredLocked(subscribeInfo, tokenId);
+        auto missedIter = missedChanges_.find({ subscribeInfo.GetSaId(), subscribeInfo.GetSubscribeKey() });
+        if (missedIter != missedChanges_.end()) {
+            // what another caller's subscription missed is not replayed to this one
+            missed = isOwner ? missedIter->second : missed;
+            missedChanges_.erase(missedIter);
+        }
+        std::pair<int32_t, std::string> subscription = { subscribeInfo.GetSaId(), subscribeInfo.GetSubscribeKey() };
+        if (missed.second != 0) {
+            // from here on live changes of the key wait in the log for the replay
+            replayId = ++replayCount_;
+            replayingSubscribes_[subscription] = replayId;
+        } else {
+            // a replay still running for the replaced listener stops
+            replayingSubscribes_.erase(subscription);
+        }
+        std::map<std::string, std::string> values;
+        std::vector<std::string> deleteKeys;
+        std::string value = UpdatePersistedLocked(subscribeInfo, tokenId, deleteKeys);
+        if (!value.empty()) {
+            values[ToStoreKey(subscribeInfo.GetSaId(), subscribeInfo.GetSubscribeKey())] = value;
+        }
+        WriteSubscribeStore(values, deleteKeys);
+    }
+    if (missed.second != 0) {
+        ReplayMissedChanges(subscribeInfo, missed.first, missed.second, replayId);
     }
     return DP_SUCCESS;
 }
@@ -350,6 +593,7 @@ int32_t SubscribeProfileManager::SubscribeDeviceProfile(std::map<std::string, Su
     for (auto item : subscribeInfos) {
         SubscribeDeviceProfile(item.second);
     }
+    DropUnboundRestored(subscribeInfos);
     return DP_SUCCESS;
 }
 
@@ -365,11 +609,24 @@ int32_t SubscribeProfileManager::UnSubscribeDeviceProfile(const SubscribeInfo& s
                 subscribeInfoMap_.erase(subscribeInfo.GetSubscribeKey());
             }
         }
+        missedChanges_.erase({ subscribeInfo.GetSaId(), subscribeInfo.GetSubscribeKey() });
+        replayingSubscribes_.erase({ subscribeInfo.GetSaId(), subscribeInfo.GetSubscribeKey() });
+        auto restoredIter = restoredSubscribes_.find(subscribeInfo.GetSubscribeKey());
+        if (restoredIter != restoredSubscribes_.end()) {
+            restoredIter->second.erase(subscribeInfo.GetSaId());
+            if (restoredIter->second.empty()) {
+                restoredSubscribes_.erase(restoredIter);
+            }
+        }
+        if (persistedSubscribes_.erase({ subscribeInfo.GetSaId(), subscribeInfo.GetSubscribeKey() }) != 0) {
+            WriteSubscribeStore({}, { ToStoreKey(subscribeInfo.GetSaId(), subscribeInfo.GetSubscribeKey()) });
+        }
     }
     return DP_SUCCESS;
 }
 
-int32_t SubscribeProfileManager::NotifyDeviceProfileAdd(const std::string& dbKey, const std::string& dbValue)
+int32_t SubscribeProfileManager::NotifyDeviceProfileAdd(const std::string& dbKey, const std::string& dbValue,
+    const SubscribeInfo* replayTo)
 {
     std::map<std::string, std::string> values;
     values[dbKey] = dbValue;
@@ -378,7 +635,7 @@ int32_t SubscribeProfileManager::NotifyDeviceProfileAdd(const std::string& dbKey
     deviceProfile.SetUserId(ProfileUtils::GetUserIdFromDbKey(dbKey));
     deviceProfile.SetIsMultiUser(deviceProfile.GetUserId() != DEFAULT_USER_ID);
     ProfileUtils::EntriesToDeviceProfile(values, deviceProfile);
-    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey));
+    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey), replayTo);
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
@@ -396,7 +653,8 @@ int32_t SubscribeProfileManager::NotifyDeviceProfileAdd(const std::string& dbKey
     return DP_SUCCESS;
 }
 
-int32_t SubscribeProfileManager::NotifyDeviceProfileUpdate(const std::string& dbKey, const std::string& dbValue)
+int32_t SubscribeProfileManager::NotifyDeviceProfileUpdate(const std::string& dbKey, const std::string& dbValue,
+    const SubscribeInfo* replayTo)
 {
     std::map<std::string, std::string> values;
     values[dbKey] = dbValue;
@@ -407,7 +665,7 @@ int32_t SubscribeProfileManager::NotifyDeviceProfileUpdate(const std::string& db
     ProfileUtils::EntriesToDeviceProfile(values, newDeviceProfile);
     DeviceProfile oldDeviceProfile;
     ProfileCache::GetInstance().GetDeviceProfile(ProfileUtils::GetDeviceIdByDBKey(dbKey), oldDeviceProfile);
-    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey));
+    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey), replayTo);
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
@@ -425,7 +683,8 @@ int32_t SubscribeProfileManager::NotifyDeviceProfileUpdate(const std::string& db
     return DP_SUCCESS;
 }
 
-int32_t SubscribeProfileManager::NotifyDeviceProfileDelete(const std::string& dbKey, const std::string& dbValue)
+int32_t SubscribeProfileManager::NotifyDeviceProfileDelete(const std::string& dbKey, const std::string& dbValue,
+    const SubscribeInfo* replayTo)
 {
     std::map<std::string, std::string> values;
     values[dbKey] = dbValue;
@@ -434,7 +693,7 @@ int32_t SubscribeProfileManager::NotifyDeviceProfileDelete(const std::string& db
     deviceProfile.SetUserId(ProfileUtils::GetUserIdFromDbKey(dbKey));
     deviceProfile.SetIsMultiUser(deviceProfile.GetUserId() != DEFAULT_USER_ID);
     ProfileUtils::EntriesToDeviceProfile(values, deviceProfile);
-    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey));
+    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey), replayTo);
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
@@ -452,7 +711,8 @@ int32_t SubscribeProfileManager::NotifyDeviceProfileDelete(const std::string& db
     return DP_SUCCESS;
 }
 
-int32_t SubscribeProfileManager::NotifyServiceProfileAdd(const std::string& dbKey, const std::string& dbValue)
+int32_t SubscribeProfileManager::NotifyServiceProfileAdd(const std::string& dbKey, const std::string& dbValue,
+    const SubscribeInfo* replayTo)
 {
     std::map<std::string, std::string> values;
     values[dbKey] = dbValue;
@@ -462,7 +722,7 @@ int32_t SubscribeProfileManager::NotifyServiceProfileAdd(const std::string& dbKe
     serviceProfile.SetUserId(ProfileUtils::GetUserIdFromDbKey(dbKey));
     serviceProfile.SetIsMultiUser(serviceProfile.GetUserId() != DEFAULT_USER_ID);
     ProfileUtils::EntriesToServiceProfile(values, serviceProfile);
-    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey));
+    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey), replayTo);
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
@@ -480,7 +740,8 @@ int32_t SubscribeProfileManager::NotifyServiceProfileAdd(const std::string& dbKe
     return DP_SUCCESS;
 }
 
-int32_t SubscribeProfileManager::NotifyServiceProfileUpdate(const std::string& dbKey, const std::string& dbValue)
+int32_t SubscribeProfileManager::NotifyServiceProfileUpdate(const std::string& dbKey, const std::string& dbValue,
+    const SubscribeInfo* replayTo)
 {
     std::map<std::string, std::string> values;
     values[dbKey] = dbValue;
@@ -490,7 +751,7 @@ int32_t SubscribeProfileManager::NotifyServiceProfileUpdate(const std::string& d
     newServiceProfile.SetUserId(ProfileUtils::GetUserIdFromDbKey(dbKey));
     newServiceProfile.SetIsMultiUser(newServiceProfile.GetUserId() != DEFAULT_USER_ID);
     ProfileUtils::EntriesToServiceProfile(values, newServiceProfile);
-    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey));
+    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey), replayTo);
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
@@ -511,7 +772,8 @@ int32_t SubscribeProfileManager::NotifyServiceProfileUpdate(const std::string& d
     return DP_SUCCESS;
 }
 
-int32_t SubscribeProfileManager::NotifyServiceProfileDelete(const std::string& dbKey, const std::string& dbValue)
+int32_t SubscribeProfileManager::NotifyServiceProfileDelete(const std::string& dbKey, const std::string& dbValue,
+    const SubscribeInfo* replayTo)
 {
     std::map<std::string, std::string> values;
     values[dbKey] = dbValue;
@@ -521,7 +783,7 @@ int32_t SubscribeProfileManager::NotifyServiceProfileDelete(const std::string& d
     serviceProfile.SetUserId(ProfileUtils::GetUserIdFromDbKey(dbKey));
     serviceProfile.SetIsMultiUser(serviceProfile.GetUserId() != DEFAULT_USER_ID);
     ProfileUtils::EntriesToServiceProfile(values, serviceProfile);
-    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey));
+    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey), replayTo);
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
@@ -539,7 +801,8 @@ int32_t SubscribeProfileManager::NotifyServiceProfileDelete(const std::string& d
     return DP_SUCCESS;
 }
 
-int32_t SubscribeProfileManager::NotifyCharProfileAdd(const std::string& dbKey, const std::string& dbValue)
+int32_t SubscribeProfileManager::NotifyCharProfileAdd(const std::string& dbKey, const std::string& dbValue,
+    const SubscribeInfo* replayTo)
 {
     std::map<std::string, std::string> values;
     values[dbKey] = dbValue;
@@ -552,7 +815,7 @@ int32_t SubscribeProfileManager::NotifyCharProfileAdd(const std::string& dbKey,
         charProfile.SetIsMultiUser(charProfile.GetUserId() != DEFAULT_USER_ID);
     }
     ProfileUtils::EntriesToCharProfile(values, charProfile);
-    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey));
+    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey), replayTo);
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
@@ -570,7 +833,8 @@ int32_t SubscribeProfileManager::NotifyCharProfileAdd(const std::string& dbKey,
     return DP_SUCCESS;
 }
 
-int32_t SubscribeProfileManager::NotifyCharProfileUpdate(const std::string& dbKey, const std::string& dbValue)
+int32_t SubscribeProfileManager::NotifyCharProfileUpdate(const std::string& dbKey, const std::string& dbValue,
+    const SubscribeInfo* replayTo)
 {
     std::map<std::string, std::string> values;
     values[dbKey] = dbValue;
@@ -583,7 +847,7 @@ int32_t SubscribeProfileManager::NotifyCharProfileUpdate(const std::string& dbKe
         newCharProfile.SetIsMultiUser(newCharProfile.GetUserId() != DEFAULT_USER_ID);
     }
     ProfileUtils::EntriesToCharProfile(values, newCharProfile);
-    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey));
+    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey), replayTo);
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
@@ -604,7 +868,8 @@ int32_t SubscribeProfileManager::NotifyCharProfileUpdate(const std::string& dbKe
     return DP_SUCCESS;
 }
 
-int32_t SubscribeProfileManager::NotifyCharProfileDelete(const std::string& dbKey, const std::string& dbValue)
+int32_t SubscribeProfileManager::NotifyCharProfileDelete(const std::string& dbKey, const std::string& dbValue,
+    const SubscribeInfo* replayTo)
 {
     std::map<std::string, std::string> values;
     values[dbKey] = dbValue;
@@ -617,7 +882,7 @@ int32_t SubscribeProfileManager::NotifyCharProfileDelete(const std::string& dbKe
         charProfile.SetIsMultiUser(charProfile.GetUserId() != DEFAULT_USER_ID);
     }
     ProfileUtils::EntriesToCharProfile(values, charProfile);
-    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey));
+    auto subscriberInfos = GetSubscribeInfos(DBKeyToSubcribeKey(dbKey), replayTo);
     if (subscriberInfos.empty()) {
         return DP_SUCCESS;
     }
@@ -635,15 +900,22 @@ int32_t SubscribeProfileManager::NotifyCharProfileDelete(const std::string& dbKe
     return DP_SUCCESS;
 }
 std::unordered_set<SubscribeInfo, SubscribeHash, SubscribeCompare> SubscribeProfileManager::GetSubscribeInfos(
-    const std::string& dbKey)
+    const std::string& dbKey, const SubscribeInfo* replayTo)
 {
+    if (replayTo != nullptr) {
+        return { *replayTo };
+    }
     {
         std::lock_guard<std::mutex> lock(subscribeMutex_);
         if (subscribeInfoMap_.find(dbKey) == subscribeInfoMap_.end()) {
             HILOGD("This dbKey is not subscribed, dbKey: %{public}s", ProfileUtils::GetDbKeyAnonyString(dbKey).c_str());
             return {};
         }
-        return subscribeInfoMap_[dbKey];
+        auto subscribeInfos = subscribeInfoMap_[dbKey];
+        for (auto iter = subscribeInfos.begin(); !replayingSubscribes_.empty() && iter != subscribeInfos.end();) {
+            iter = IsReplayingLocked(*iter) ? subscribeInfos.erase(iter) : std::next(iter);
+        }
+        return subscribeInfos;
     }
 }
 
@@ -660,5 +932,363 @@ std::string SubscribeProfileManager::DBKeyToSubcribeKey(const std::string& dbkey
     }
     return subscribeKey;
 }
+
+uint64_t SubscribeProfileManager::AppendChangeLog(ProfileType profileType, ChangeType changeType,
+    const std::string& dbKey, const std::string& dbValue)
+{
+    if ((profileType != ProfileType::DEVICE_PROFILE && profileType != ProfileType::SERVICE_PROFILE &&
+        profileType != ProfileType::CHAR_PROFILE) || changeType <= ChangeType::CHANGE_TYPE_MIN ||
+        changeType >= ChangeType::CHANGE_TYPE_MAX) {
+        return 0;
+    }
+    std::string subscribeKey = DBKeyToSubcribeKey(dbKey);
+    uint64_t seq = changeLog_.Append(profileType, changeType, subscribeKey, dbKey, dbValue);
+    std::lock_guard<std::mutex> lock(subscribeMutex_);
+    // the first change missed stays, the subscriber catches up from there when it subscribes again
+    auto iter = subscribeInfoMap_.find(subscribeKey);
+    if (iter != subscribeInfoMap_.end()) {
+        for (const auto& subscribeInfo : iter->second) {
+            sptr<IRemoteObject> listener = subscribeInfo.GetListener();
+            if (listener == nullptr || listener->IsObjectDead()) {
+                missedChanges_.emplace(std::make_pair(subscribeInfo.GetSaId(), subscribeKey),
+                    std::make_pair(profileType, seq));
+            }
+        }
+    }
+    // a restored subscription has no listener until its caller subscribes again
+    auto restoredIter = restoredSubscribes_.find(subscribeKey);
+    if (restoredIter != restoredSubscribes_.end()) {
+        for (const auto& [saId, tokenId] : restoredIter->second) {
+            missedChanges_.emplace(std::make_pair(saId, subscribeKey), std::make_pair(profileType, seq));
+        }
+    }
+    return seq;
+}
+
+void SubscribeProfileManager::ReplayMissedChanges(const SubscribeInfo& subscribeInfo, ProfileType profileType,
+    uint64_t fromSeq, uint64_t replayId)
+{
+    std::pair<int32_t, std::string> subscription = { subscribeInfo.GetSaId(), subscribeInfo.GetSubscribeKey() };
+    uint64_t nextSeq = fromSeq;
+    // set once the replay is released, the changes after it are delivered live
+    uint64_t endSeq = 0;
+    for (int32_t round = 1; ; round++) {
+        uint64_t lastSeq = changeLog_.GetLastSeq(profileType);
+        std::vector<ProfileChangeRecord> records;
+        if (!changeLog_.GetChanges(profileType, nextSeq, subscribeInfo.GetSubscribeKey(), records)) {
+            HILOGW("changes from %{public}" PRIu64 " are no longer known, replay the current value, saId: %{public}d",
+                nextSeq, subscribeInfo.GetSaId());
+            GetCurrentChanges(profileType, subscribeInfo.GetSubscribeKey(), records);
+        }
+        HILOGI("saId: %{public}d, fromSeq: %{public}" PRIu64 ", changes: %{public}zu", subscribeInfo.GetSaId(),
+            nextSeq, records.size());
+        for (const auto& record : records) {
+            if (endSeq != 0 && record.seq > endSeq) {
+                continue;
+            }
+            lastSeq = std::max(lastSeq, record.seq);
+            ReplayChange(record, subscribeInfo);
+        }
+        if (endSeq != 0) {
+            return;
+        }
+        nextSeq = lastSeq + 1;
+        // a live change appended before this check skipped the subscription, the next round replays it
+        std::lock_guard<std::mutex> lock(subscribeMutex_);
+        auto iter = replayingSubscribes_.find(subscription);
+        if (iter == replayingSubscribes_.end() || iter->second != replayId) {
+            HILOGI("replay ended by a new subscribe, saId: %{public}d", subscribeInfo.GetSaId());
+            return;
+        }
+        if (changeLog_.GetLastSeq(profileType) < nextSeq) {
+            replayingSubscribes_.erase(iter);
+            return;
+        }
+        if (round >= MAX_REPLAY_ROUNDS) {
+            // the changes skipped until now get one more round, a change notified live meanwhile may come twice
+            HILOGW("replay does not catch up, release it, saId: %{public}d", subscribeInfo.GetSaId());
+            endSeq = changeLog_.GetLastSeq(profileType);
+            replayingSubscribes_.erase(iter);
+        }
+    }
+}
+
+void SubscribeProfileManager::ReplayChange(const ProfileChangeRecord& record, const SubscribeInfo& subscribeInfo)
+{
+    Func func = nullptr;
+    {
+        std::lock_guard<std::mutex> lockGuard(funcsMutex_);
+        auto iter = funcsMap_.find(static_cast<uint32_t>(record.profileType * record.changeType));
+        if (iter != funcsMap_.end()) {
+            func = iter->second;
+        }
+    }
+    if (func == nullptr) {
+        HILOGE("no notify func, profileType: %{public}d, changeType: %{public}d", record.profileType,
+            record.changeType);
+        return;
+    }
+    (this->*func)(record.dbKey, record.dbValue, &subscribeInfo);
+}
+
+void SubscribeProfileManager::GetCurrentChanges(ProfileType profileType, const std::string& subscribeKey,
+    std::vector<ProfileChangeRecord>& records)
+{
+    // the key may be stored with the _oh suffix that DBKeyToSubcribeKey removed
+    std::vector<std::string> dbKeys = { subscribeKey };
+    std::vector<std::string> res;
+    if (ProfileUtils::SplitString(subscribeKey, SEPARATOR, res) == DP_SUCCESS && res.size() > NUM_2 &&
+        ProfileUtils::IsNeedAddOhSuffix(res[NUM_2], profileType != ProfileType::DEVICE_PROFILE)) {
+        res[NUM_2] = ProfileUtils::CheckAndAddOhSuffix(res[NUM_2], profileType != ProfileType::DEVICE_PROFILE);
+        dbKeys.push_back(ProfileUtils::JoinString(res, SEPARATOR));
+    }
+    std::vector<DistributedKv::Entry> entries = DeviceProfileManager::GetInstance().GetEntriesByKeys(dbKeys);
+    ProfileChangeRecord record;
+    record.profileType = profileType;
+    record.subscribeKey = subscribeKey;
+    if (entries.empty()) {
+        // the key changed but is gone now
+        record.changeType = ChangeType::DELETE;
+        record.dbKey = subscribeKey;
+        records.push_back(record);
+        return;
+    }
+    record.changeType = ChangeType::UPDATE;
+    for (const auto& entry : entries) {
+        record.dbKey = entry.key.ToString();
+        record.dbValue = entry.value.ToString();
+        records.push_back(record);
+    }
+}
+
+bool SubscribeProfileManager::IsReplayingLocked(const SubscribeInfo& subscribeInfo)
+{
+    return replayingSubscribes_.find({ subscribeInfo.GetSaId(), subscribeInfo.GetSubscribeKey() }) !=
+        replayingSubscribes_.end();
+}
+
+int32_t SubscribeProfileManager::ReInit()
+{
+    HILOGI("call!");
+    std::shared_ptr<IKVAdapter> subscribeStore = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(storeMutex_);
+        subscribeStore = subscribeStore_;
+        subscribeStore_ = nullptr;
+    }
+    if (subscribeStore != nullptr) {
+        // what it may still buffer is lost with the dead store, the subscriptions are written again below
+        subscribeStore->UnInit();
+    }
+    int32_t ret = OpenSubscribeStore();
+    if (ret != DP_SUCCESS) {
+        return ret;
+    }
+    // the subscriptions in memory stay as they are, the store is brought in line with them
+    std::lock_guard<std::mutex> lock(subscribeMutex_);
+    std::map<std::string, std::string> storedValues;
+    {
+        std::lock_guard<std::mutex> storeLock(storeMutex_);
+        if (subscribeStore_ != nullptr) {
+            subscribeStore_->GetByPrefix("", storedValues);
+        }
+    }
+    std::map<std::string, std::string> values;
+    for (const auto& [subscription, value] : persistedSubscribes_) {
+        values[ToStoreKey(subscription.first, subscription.second)] = value;
+    }
+    std::vector<std::string> deleteKeys;
+    for (const auto& [storeKey, value] : storedValues) {
+        if (values.find(storeKey) == values.end()) {
+            deleteKeys.push_back(storeKey);
+        }
+    }
+    HILOGI("persisted: %{public}zu, stale: %{public}zu", values.size(), deleteKeys.size());
+    WriteSubscribeStore(values, deleteKeys);
+    return DP_SUCCESS;
+}
+
+void SubscribeProfileManager::InitSubscribeStore()
+{
+    if (OpenSubscribeStore() != DP_SUCCESS) {
+        // subscriptions still work, they are only not kept over a restart
+        return;
+    }
+    LoadSubscribeInfos();
+}
+
+int32_t SubscribeProfileManager::OpenSubscribeStore()
+{
+    auto kvAdapter = std::make_shared<ServiceInfoKvAdapter>(std::make_shared<KvDeathRecipient>(SUBSCRIBE_STORE_ID),
+        DistributedKv::TYPE_DYNAMICAL, SUBSCRIBE_STORE_ID);
+#ifdef DP_KV_WRITE_BEHIND_ENABLE
+    std::shared_ptr<IKVAdapter> subscribeStore = std::make_shared<WriteBehindKvAdapter>(SUBSCRIBE_STORE_ID,
+        kvAdapter);
+#else
+    std::shared_ptr<IKVAdapter> subscribeStore = kvAdapter;
+#endif
+    int32_t ret = subscribeStore->Init();
+    if (ret != DP_SUCCESS) {
+        HILOGE("subscribeStore init failed, ret: %{public}d", ret);
+        return ret;
+    }
+    std::lock_guard<std::mutex> lock(storeMutex_);
+    subscribeStore_ = subscribeStore;
+    return DP_SUCCESS;
+}
+
+void SubscribeProfileManager::LoadSubscribeInfos()
+{
+    std::map<std::string, std::string> values;
+    {
+        std::lock_guard<std::mutex> lock(storeMutex_);
+        if (subscribeStore_ == nullptr) {
+            return;
+        }
+        int32_t ret = subscribeStore_->GetByPrefix("", values);
+        if (ret != DP_SUCCESS && ret != DP_NOT_FIND_DATA) {
+            HILOGE("load subscribe infos failed, ret: %{public}d", ret);
+            return;
+        }
+    }
+    // every restart a restored subscription is kept for is counted in the store, until its caller is back
+    std::map<std::string, std::string> restoredValues;
+    std::vector<std::string> expiredKeys;
+    std::lock_guard<std::mutex> lock(subscribeMutex_);
+    for (const auto& [storeKey, value] : values) {
+        int32_t saId = 0;
+        std::string subscribeKey;
+        uint32_t tokenId = 0;
+        int32_t restoreCount = 0;
+        if (!FromStoreKey(storeKey, saId, subscribeKey) || !DecodeSubscribeValue(value, tokenId, restoreCount)) {
+            expiredKeys.push_back(storeKey);
+            continue;
+        }
+        // a caller that subscribed again before the load already has its listener bound
+        auto iter = subscribeInfoMap_.find(subscribeKey);
+        if (iter != subscribeInfoMap_.end() && std::any_of(iter->second.begin(), iter->second.end(),
+            [saId](const SubscribeInfo& subscribeInfo) { return subscribeInfo.GetSaId() == saId; })) {
+            continue;
+        }
+        std::string restoredValue = SetRestoreCount(value, restoreCount + 1);
+        if (restoreCount >= MAX_SUBSCRIBE_RESTORE_COUNT || restoredValue.empty() ||
+            persistedSubscribes_.size() >= static_cast<size_t>(MAX_SUBSCRIBE_INFO_SIZE)) {
+            expiredKeys.push_back(storeKey);
+            continue;
+        }
+        persistedSubscribes_[std::make_pair(saId, subscribeKey)] = restoredValue;
+        restoredSubscribes_[subscribeKey][saId] = tokenId;
+        restoredValues[storeKey] = restoredValue;
+    }
+    HILOGI("persisted: %{public}zu, restored: %{public}zu, expired: %{public}zu", values.size(),
+        restoredValues.size(), expiredKeys.size());
+    WriteSubscribeStore(restoredValues, expiredKeys);
+}
+
+bool SubscribeProfileManager::BindRestoredLocked(const SubscribeInfo& subscribeInfo, uint32_t tokenId)
+{
+    auto iter = restoredSubscribes_.find(subscribeInfo.GetSubscribeKey());
+    if (iter == restoredSubscribes_.end()) {
+        return true;
+    }
+    auto saIter = iter->second.find(subscribeInfo.GetSaId());
+    if (saIter == iter->second.end()) {
+        return true;
+    }
+    bool isOwner = saIter->second == tokenId;
+    if (!isOwner) {
+        HILOGW("restored subscription of another caller, saId: %{public}d", subscribeInfo.GetSaId());
+    }
+    iter->second.erase(saIter);
+    if (iter->second.empty()) {
+        restoredSubscribes_.erase(iter);
+    }
+    return isOwner;
+}
+
+std::string SubscribeProfileManager::UpdatePersistedLocked(const SubscribeInfo& subscribeInfo, uint32_t tokenId,
+    std::vector<std::string>& deleteKeys)
+{
+    std::pair<int32_t, std::string> subscription = { subscribeInfo.GetSaId(), subscribeInfo.GetSubscribeKey() };
+    auto iter = persistedSubscribes_.find(subscription);
+    if (iter == persistedSubscribes_.end() &&
+        persistedSubscribes_.size() >= static_cast<size_t>(MAX_SUBSCRIBE_INFO_SIZE) &&
+        !EvictRestoredLocked(deleteKeys)) {
+        HILOGE("persisted subscribe infos exceed %{public}d, not kept over a restart, saId: %{public}d",
+            MAX_SUBSCRIBE_INFO_SIZE, subscribeInfo.GetSaId());
+        return "";
+    }
+    std::string value = EncodeSubscribeValue(subscribeInfo, tokenId);
+    if (value.empty() || (iter != persistedSubscribes_.end() && iter->second == value)) {
+        return "";
+    }
+    persistedSubscribes_[subscription] = value;
+    return value;
+}
+
+bool SubscribeProfileManager::EvictRestoredLocked(std::vector<std::string>& deleteKeys)
+{
+    // a live subscription takes the place of a restored one whose caller may never come back
+    auto iter = restoredSubscribes_.begin();
+    if (iter == restoredSubscribes_.end() || iter->second.empty()) {
+        return false;
+    }
+    int32_t saId = iter->second.begin()->first;
+    HILOGW("evict restored subscription, saId: %{public}d", saId);
+    deleteKeys.push_back(ToStoreKey(saId, iter->first));
+    persistedSubscribes_.erase({ saId, iter->first });
+    missedChanges_.erase({ saId, iter->first });
+    iter->second.erase(iter->second.begin());
+    if (iter->second.empty()) {
+        restoredSubscribes_.erase(iter);
+    }
+    return true;
+}
+
+void SubscribeProfileManager::DropUnboundRestored(const std::map<std::string, SubscribeInfo>& subscribeInfos)
+{
+    // a caller sends all of its subscriptions at once, a restored one of its saIds it did not send is gone;
+    // the restored ones of another caller's token stay
+    uint32_t tokenId = IPCSkeleton::GetCallingTokenID();
+    std::set<int32_t> saIds;
+    for (const auto& [subscribeTag, subscribeInfo] : subscribeInfos) {
+        saIds.insert(subscribeInfo.GetSaId());
+    }
+    std::vector<std::string> storeKeys;
+    std::lock_guard<std::mutex> lock(subscribeMutex_);
+    for (auto iter = restoredSubscribes_.begin(); iter != restoredSubscribes_.end();) {
+        for (auto saIter = iter->second.begin(); saIter != iter->second.end();) {
+            if (saIds.count(saIter->first) == 0 || saIter->second != tokenId) {
+                ++saIter;
+                continue;
+            }
+            storeKeys.push_back(ToStoreKey(saIter->first, iter->first));
+            persistedSubscribes_.erase({ saIter->first, iter->first });
+            missedChanges_.erase({ saIter->first, iter->first });
+            saIter = iter->second.erase(saIter);
+        }
+        iter = iter->second.empty() ? restoredSubscribes_.erase(iter) : std::next(iter);
+    }
+    if (storeKeys.empty()) {
+        return;
+    }
+    HILOGI("drop %{public}zu restored subscribe infos", storeKeys.size());
+    WriteSubscribeStore({}, storeKeys);
+}
+
+void SubscribeProfileManager::WriteSubscribeStore(const std::map<std::string, std::string>& values,
+    const std::vector<std::string>& deleteKeys)
+{
+    std::lock_guard<std::mutex> lock(storeMutex_);
+    if (subscribeStore_ == nullptr) {
+        return;
+    }
+    if (!deleteKeys.empty() && subscribeStore_->DeleteBatch(deleteKeys) != DP_SUCCESS) {
+        HILOGE("delete subscribe infos failed, size: %{public}zu", deleteKeys.size());
+    }
+    if (!values.empty() && subscribeStore_->PutBatch(values) != DP_SUCCESS) {
+        HILOGE("persist subscribe infos failed, size: %{public}zu", values.size());
+    }
+}
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
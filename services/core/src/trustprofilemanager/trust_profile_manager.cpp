@@ -657,6 +657,32 @@ int32_t TrustProfileManager::GetAccessControlProfile(const std::map<std::string,
     std::vector<AccessControlProfile>& profile)
 {
     std::lock_guard<std::mutex> lock(aclMutex_);
+    return GetAccessControlProfileByParams(params, profile);
+}
+
+int32_t TrustProfileManager::GetAccessControlProfileBatch(
+    const std::vector<std::map<std::string, std::string>>& paramsList,
+    std::vector<std::vector<AccessControlProfile>>& profilesList, std::vector<int32_t>& results)
+{
+    profilesList.clear();
+    results.clear();
+    std::lock_guard<std::mutex> lock(aclMutex_);
+    for (const auto& params : paramsList) {
+        std::vector<AccessControlProfile> profile;
+        int32_t ret = GetAccessControlProfileByParams(params, profile);
+        if (ret != DP_SUCCESS) {
+            profile.clear();
+        }
+        results.emplace_back(ret);
+        profilesList.emplace_back(std::move(profile));
+    }
+    HILOGI("end, size: %{public}zu", paramsList.size());
+    return DP_SUCCESS;
+}
+
+int32_t TrustProfileManager::GetAccessControlProfileByParams(const std::map<std::string, std::string>& params,
+    std::vector<AccessControlProfile>& profile)
+{
     if (params.find(TRUST_DEVICE_ID) != params.end() &&
         ProfileUtils::IsPropertyValid(params, STATUS, INT32_MIN, INT32_MAX)) {
         if (ProfileUtils::IsPropertyValid(params, USERID, INT32_MIN, INT32_MAX) &&
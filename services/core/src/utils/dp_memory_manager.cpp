@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dp_memory_manager.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "distributed_device_profile_log.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+IMPLEMENT_SINGLE_INSTANCE(DpMemoryManager);
+
+namespace {
+    const std::string TAG = "DpMemoryManager";
+    constexpr size_t PERCENT_ALL = 100;
+}
+
+void DpMemoryManager::RegisterCache(const std::string& name, UsageFunc usageFunc, TrimFunc trimFunc,
+    uint32_t rebuildCost)
+{
+    if (name.empty() || usageFunc == nullptr) {
+        HILOGE("params is invalid!");
+        return;
+    }
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    caches_[name] = { usageFunc, trimFunc, rebuildCost };
+}
+
+void DpMemoryManager::UnRegisterCache(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    caches_.erase(name);
+}
+
+void DpMemoryManager::SetBudget(size_t budgetBytes)
+{
+    HILOGI("budget: %{public}zu", budgetBytes);
+    budgetBytes_.store(budgetBytes, std::memory_order_relaxed);
+}
+
+size_t DpMemoryManager::GetBudget() const
+{
+    return budgetBytes_.load(std::memory_order_relaxed);
+}
+
+DpCacheUsage DpMemoryManager::GetTotalUsage()
+{
+    DpCacheUsage total;
+    for (const auto& [name, cache] : GetCaches()) {
+        DpCacheUsage usage = cache.usageFunc();
+        total.entries += usage.entries;
+        total.bytes += usage.bytes;
+    }
+    return total;
+}
+
+size_t DpMemoryManager::CheckBudget()
+{
+    grownBytes_.store(0, std::memory_order_relaxed);
+    size_t budgetBytes = GetBudget();
+    if (GetTotalUsage().bytes <= budgetBytes) {
+        return 0;
+    }
+    return TrimTo(budgetBytes / PERCENT_ALL * CACHE_TRIM_TARGET_PERCENT);
+}
+
+size_t DpMemoryManager::OnCacheGrown(size_t bytes)
+{
+    size_t stepBytes = std::max<size_t>(GetBudget() / PERCENT_ALL * CACHE_CHECK_STEP_PERCENT, 1);
+    if (grownBytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes < stepBytes) {
+        return 0;
+    }
+    return CheckBudget();
+}
+
+size_t DpMemoryManager::TrimAll()
+{
+    return TrimTo(0);
+}
+
+void DpMemoryManager::Dump(std::string& result)
+{
+    DpCacheUsage total;
+    result.append("Caches:\n");
+    for (const auto& [name, cache] : GetCaches()) {
+        DpCacheUsage usage = cache.usageFunc();
+        total.entries += usage.entries;
+        total.bytes += usage.bytes;
+        result.append("  ").append(name).append(": entries=").append(std::to_string(usage.entries))
+            .append(", bytes=").append(std::to_string(usage.bytes))
+            .append(cache.trimFunc == nullptr ? "\n" : ", trimmable\n");
+    }
+    result.append("  total: entries=").append(std::to_string(total.entries))
+        .append(", bytes=").append(std::to_string(total.bytes))
+        .append(", budget=").append(std::to_string(GetBudget())).append("\n");
+}
+
+size_t DpMemoryManager::EstimateBytes(const std::string& str)
+{
+    // short strings live inside the std::string object, which the caller already counts
+    static const size_t inlineCapacity = std::string().capacity();
+    return str.size() > inlineCapacity ? str.size() + 1 : 0;
+}
+
+DpCacheUsage DpMemoryManager::EstimateUsage(const std::map<std::string, std::string>& entries)
+{
+    DpCacheUsage usage;
+    usage.entries = entries.size();
+    for (const auto& [key, value] : entries) {
+        usage.bytes += CACHE_NODE_OVERHEAD_BYTES + sizeof(key) + sizeof(value) + EstimateBytes(key) +
+            EstimateBytes(value);
+    }
+    return usage;
+}
+
+size_t DpMemoryManager::TrimTo(size_t targetBytes)
+{
+    std::lock_guard<std::mutex> trimLock(trimMutex_);
+    struct Candidate {
+        std::string name;
+        TrimFunc trimFunc;
+        uint32_t rebuildCost;
+        size_t bytes;
+    };
+    std::vector<Candidate> candidates;
+    size_t totalBytes = 0;
+    for (const auto& [name, cache] : GetCaches()) {
+        size_t bytes = cache.usageFunc().bytes;
+        totalBytes += bytes;
+        if (cache.trimFunc != nullptr && bytes > 0) {
+            candidates.push_back({ name, cache.trimFunc, cache.rebuildCost, bytes });
+        }
+    }
+    // cheapest to rebuild first, the biggest first among equally cheap ones
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& lhs, const Candidate& rhs) {
+        return lhs.rebuildCost != rhs.rebuildCost ? lhs.rebuildCost < rhs.rebuildCost : lhs.bytes > rhs.bytes;
+    });
+    size_t freedBytes = 0;
+    for (const auto& candidate : candidates) {
+        if (totalBytes - freedBytes <= targetBytes) {
+            break;
+        }
+        size_t freed = candidate.trimFunc(totalBytes - freedBytes - targetBytes);
+        HILOGI("trim %{public}s, freed: %{public}zu", candidate.name.c_str(), freed);
+        freedBytes += std::min(freed, totalBytes - freedBytes);
+    }
+    HILOGI("caches: %{public}zu bytes, target: %{public}zu, freed: %{public}zu", totalBytes, targetBytes,
+        freedBytes);
+    return freedBytes;
+}
+
+std::map<std::string, DpMemoryManager::CacheEntry> DpMemoryManager::GetCaches()
+{
+    // the callbacks take the caches' own locks, so they run on a copy and never under cacheMutex_
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    return caches_;
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
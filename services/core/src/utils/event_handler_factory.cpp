@@ -18,6 +18,7 @@
 #include "distributed_device_profile_errors.h"
 #include "distributed_device_profile_constants.h"
 #include "distributed_device_profile_log.h"
+#include "dp_metrics.h"
 
 namespace OHOS {
 namespace DistributedDeviceProfile {
@@ -56,5 +57,28 @@ std::shared_ptr<AppExecFwk::EventHandler> EventHandlerFactory::GetEventHandler()
     std::lock_guard<std::mutex> lock(eventHandlerMutex_);
     return eventHandler_;
 }
+
+bool EventHandlerFactory::PostTask(const AppExecFwk::EventHandler::Callback& task)
+{
+    auto handler = GetEventHandler();
+    if (handler == nullptr) {
+        HILOGE("eventHandler is nullptr");
+        DpMetrics::GetInstance().IncreaseCounter(DpMetricsCounter::EVENT_TASK_POST_FAILED);
+        return false;
+    }
+    int64_t postTimeUs = DpMetrics::GetNowUs();
+    auto metricsTask = [task, postTimeUs]() {
+        DpMetrics::GetInstance().OnTaskStart(postTimeUs);
+        int64_t startTimeUs = DpMetrics::GetNowUs();
+        task();
+        DpMetrics::GetInstance().OnTaskEnd(startTimeUs);
+    };
+    DpMetrics::GetInstance().OnTaskPosted();
+    if (!handler->PostTask(metricsTask)) {
+        DpMetrics::GetInstance().OnTaskDropped();
+        return false;
+    }
+    return true;
+}
 } // namespace DeviceProfile
 } // namespace OHOS
@@ -26,11 +26,12 @@
 #include "distributed_device_profile_errors.h"
 #include "device_profile_manager.h"
 #include "dm_adapter.h"
+#include "dp_metrics.h"
+#include "dp_string_pool.h"
 #include "multi_user_manager.h"
 #include "profile_utils.h"
 #include "static_profile_manager.h"
 #include "switch_profile_manager.h"
-#include "sync_subscriber_death_recipient.h"
 
 namespace OHOS {
 namespace DistributedDeviceProfile {
@@ -38,6 +39,68 @@ IMPLEMENT_SINGLE_INSTANCE(ProfileCache);
 
 namespace {
     const std::string TAG = "ProfileCache";
+    const std::string MEMORY_CACHE_NAME = "ProfileCache";
+    // reloaded from the kv stores on a miss
+    constexpr uint32_t PROFILE_CACHE_REBUILD_COST = 1;
+
+    size_t EstimateProfileBytes(const DeviceProfile& profile)
+    {
+        return sizeof(DeviceProfile) + DpMemoryManager::EstimateBytes(profile.GetDeviceId()) +
+            DpMemoryManager::EstimateBytes(profile.GetDeviceName()) +
+            DpMemoryManager::EstimateBytes(profile.GetOsSysCap()) +
+            DpMemoryManager::EstimateBytes(profile.GetOsVersion()) +
+            DpMemoryManager::EstimateBytes(profile.GetProductName());
+    }
+
+    // the interned strings are counted once, with the pool
+    size_t EstimateProfileBytes(const ServiceProfile& profile)
+    {
+        return sizeof(profile);
+    }
+
+    size_t EstimateProfileBytes(const CharacteristicProfile& profile)
+    {
+        return sizeof(CharacteristicProfile) + DpMemoryManager::EstimateBytes(profile.GetCharacteristicValue());
+    }
+
+    size_t EstimateProfileBytes(const TrustedDeviceInfo& deviceInfo)
+    {
+        return sizeof(TrustedDeviceInfo) + DpMemoryManager::EstimateBytes(deviceInfo.GetNetworkId()) +
+            DpMemoryManager::EstimateBytes(deviceInfo.GetOsVersion()) +
+            DpMemoryManager::EstimateBytes(deviceInfo.GetUdid()) +
+            DpMemoryManager::EstimateBytes(deviceInfo.GetUuid());
+    }
+
+    template <typename Profile>
+    size_t EstimateEntryBytes(const std::string& key, const Profile& profile)
+    {
+        return CACHE_NODE_OVERHEAD_BYTES + sizeof(key) + DpMemoryManager::EstimateBytes(key) +
+            EstimateProfileBytes(profile);
+    }
+
+    template <typename Profile>
+    void AddProfileMapUsage(std::mutex& mutex, const std::unordered_map<std::string, Profile>& profileMap,
+        DpCacheUsage& usage)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        usage.entries += profileMap.size();
+        for (const auto& [key, profile] : profileMap) {
+            usage.bytes += EstimateEntryBytes(key, profile);
+        }
+    }
+
+    template <typename Profile>
+    size_t TrimProfileMap(std::mutex& mutex, std::unordered_map<std::string, Profile>& profileMap,
+        size_t bytesToFree)
+    {
+        size_t freedBytes = 0;
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto iter = profileMap.begin(); iter != profileMap.end() && freedBytes < bytesToFree;) {
+            freedBytes += EstimateEntryBytes(iter->first, iter->second);
+            iter = profileMap.erase(iter);
+        }
+        return freedBytes;
+    }
 }
 
 int32_t ProfileCache::Init()
@@ -48,13 +111,16 @@ int32_t ProfileCache::Init()
 #ifndef DEVICE_PROFILE_SWITCH_DISABLE
     SwitchProfileManager::GetInstance().RefreshLocalSwitchProfile();
 #endif
-    syncListenerDeathRecipient_ = sptr<IRemoteObject::DeathRecipient>(new SyncSubscriberDeathRecipient);
+    DpMemoryManager::GetInstance().RegisterCache(MEMORY_CACHE_NAME, [this]() { return GetUsage(); },
+        [this](size_t bytesToFree) { return Trim(bytesToFree); }, PROFILE_CACHE_REBUILD_COST);
+    DpMemoryManager::GetInstance().CheckBudget();
     return DP_SUCCESS;
 }
 
 int32_t ProfileCache::UnInit()
 {
     HILOGI("UnInit");
+    DpMemoryManager::GetInstance().UnRegisterCache(MEMORY_CACHE_NAME);
     {
         std::lock_guard<std::mutex> lock(onlineDeviceLock_);
         onlineDevMap_.clear();
@@ -76,9 +142,10 @@ int32_t ProfileCache::UnInit()
         staticCharProfileMap_.clear();
     }
     {
-        std::lock_guard<std::mutex> lock(syncListenerMutex_);
-        syncListenerMap_.clear();
+        std::lock_guard<std::mutex> lock(remoteSwitchMutex_);
+        remoteSwitchMap_.clear();
     }
+    DpStringPool::GetInstance().Purge();
     return DP_SUCCESS;
 }
 
@@ -97,6 +164,7 @@ int32_t ProfileCache::AddDeviceProfile(const DeviceProfile& deviceProfile)
         }
         deviceProfileMap_[deviceProfileKey] = deviceProfile;
     }
+    DpMemoryManager::GetInstance().OnCacheGrown(EstimateEntryBytes(deviceProfileKey, deviceProfile));
     return DP_SUCCESS;
 }
 
@@ -109,14 +177,17 @@ int32_t ProfileCache::AddServiceProfile(const ServiceProfile& serviceProfile)
     }
     std::string serviceProfileKey = ProfileUtils::GenerateServiceProfileKey(serviceProfile.GetDeviceId(),
         serviceProfile.GetServiceName());
+    ServiceProfile cachedProfile = serviceProfile;
+    cachedProfile.InternStrings();
     {
         std::lock_guard<std::mutex> lock(serviceProfileMutex_);
         if (serviceProfileMap_.size() > MAX_SERVICE_SIZE) {
             HILOGE("ServiceProfileMap size is invalid!size: %{public}zu!", serviceProfileMap_.size());
             return DP_EXCEED_MAX_SIZE_FAIL;
         }
-        serviceProfileMap_[serviceProfileKey] = serviceProfile;
+        serviceProfileMap_[serviceProfileKey] = cachedProfile;
     }
+    DpMemoryManager::GetInstance().OnCacheGrown(EstimateEntryBytes(serviceProfileKey, cachedProfile));
     return DP_SUCCESS;
 }
 
@@ -130,14 +201,17 @@ int32_t ProfileCache::AddCharProfile(const CharacteristicProfile& charProfile)
     }
     std::string charProfileKey = ProfileUtils::GenerateCharProfileKey(charProfile.GetDeviceId(),
         charProfile.GetServiceName(), charProfile.GetCharacteristicKey());
+    CharacteristicProfile cachedProfile = charProfile;
+    cachedProfile.InternStrings();
     {
         std::lock_guard<std::mutex> lock(charProfileMutex_);
         if (charProfileMap_.size() > MAX_CHAR_SIZE) {
             HILOGE("CharProfileMap size is invalid!size: %{public}zu!", charProfileMap_.size());
             return DP_EXCEED_MAX_SIZE_FAIL;
         }
-        charProfileMap_[charProfileKey] = charProfile;
+        charProfileMap_[charProfileKey] = cachedProfile;
     }
+    DpMemoryManager::GetInstance().OnCacheGrown(EstimateEntryBytes(charProfileKey, cachedProfile));
     return DP_SUCCESS;
 }
 
@@ -151,14 +225,17 @@ int32_t ProfileCache::AddStaticCharProfile(const CharacteristicProfile& charProf
     }
     std::string charProfileKey = ProfileUtils::GenerateCharProfileKey(charProfile.GetDeviceId(),
         charProfile.GetServiceName(), charProfile.GetCharacteristicKey());
+    CharacteristicProfile cachedProfile = charProfile;
+    cachedProfile.InternStrings();
     {
         std::lock_guard<std::mutex> lock(staticCharProfileMutex_);
         if (staticCharProfileMap_.size() > MAX_CHAR_SIZE) {
             HILOGE("CharProfileMap size is invalid!size: %{public}zu!", staticCharProfileMap_.size());
             return DP_EXCEED_MAX_SIZE_FAIL;
         }
-        staticCharProfileMap_[charProfileKey] = charProfile;
+        staticCharProfileMap_[charProfileKey] = cachedProfile;
     }
+    DpMemoryManager::GetInstance().OnCacheGrown(EstimateEntryBytes(charProfileKey, cachedProfile));
     return DP_SUCCESS;
 }
 
@@ -187,8 +264,10 @@ int32_t ProfileCache::GetDeviceProfile(const std::string& deviceId, DeviceProfil
         std::string deviceProfileKey = ProfileUtils::GenerateDeviceProfileKey(deviceId);
         if (deviceProfileMap_.find(deviceProfileKey) == deviceProfileMap_.end()) {
             HILOGI("ProfileKey is not found in deviceProfileMap!");
+            DpMetrics::GetInstance().IncreaseCounter(DpMetricsCounter::PROFILE_CACHE_MISS);
             return DP_NOT_FOUND_FAIL;
         }
+        DpMetrics::GetInstance().IncreaseCounter(DpMetricsCounter::PROFILE_CACHE_HIT);
         deviceProfile = deviceProfileMap_[deviceProfileKey];
     }
     return DP_SUCCESS;
@@ -206,8 +285,10 @@ int32_t ProfileCache::GetServiceProfile(const std::string& deviceId, const std::
         std::string serviceProfileKey = ProfileUtils::GenerateServiceProfileKey(deviceId, serviceName);
         if (serviceProfileMap_.find(serviceProfileKey) == serviceProfileMap_.end()) {
             HILOGI("ProfileKey is not found in serviceProfileMap!");
+            DpMetrics::GetInstance().IncreaseCounter(DpMetricsCounter::PROFILE_CACHE_MISS);
             return DP_NOT_FOUND_FAIL;
         }
+        DpMetrics::GetInstance().IncreaseCounter(DpMetricsCounter::PROFILE_CACHE_HIT);
         serviceProfile = serviceProfileMap_[serviceProfileKey];
     }
     return DP_SUCCESS;
@@ -226,8 +307,10 @@ int32_t ProfileCache::GetCharacteristicProfile(const std::string& deviceId, cons
         std::string charProfileKey = ProfileUtils::GenerateCharProfileKey(deviceId, serviceName, charKey);
         if (charProfileMap_.find(charProfileKey) == charProfileMap_.end()) {
             HILOGD("ProfileKey is not found in charProfileMap!");
+            DpMetrics::GetInstance().IncreaseCounter(DpMetricsCounter::PROFILE_CACHE_MISS);
             return DP_NOT_FOUND_FAIL;
         }
+        DpMetrics::GetInstance().IncreaseCounter(DpMetricsCounter::PROFILE_CACHE_HIT);
         charProfile = charProfileMap_[charProfileKey];
     }
     return DP_SUCCESS;
@@ -246,8 +329,10 @@ int32_t ProfileCache::GetStaticCharacteristicProfile(const std::string& deviceId
         std::string charProfileKey = ProfileUtils::GenerateCharProfileKey(deviceId, serviceName, charKey);
         if (staticCharProfileMap_.find(charProfileKey) == staticCharProfileMap_.end()) {
             HILOGI("ProfileKey is not found in charProfileMap!");
+            DpMetrics::GetInstance().IncreaseCounter(DpMetricsCounter::PROFILE_CACHE_MISS);
             return DP_NOT_FOUND_FAIL;
         }
+        DpMetrics::GetInstance().IncreaseCounter(DpMetricsCounter::PROFILE_CACHE_HIT);
         charProfile = staticCharProfileMap_[charProfileKey];
     }
     return DP_SUCCESS;
@@ -391,9 +476,13 @@ int32_t ProfileCache::RefreshCharProfileCache(const std::vector<CharacteristicPr
         for (const auto& charProfile : characteristicProfiles) {
             std::string profileKey = ProfileUtils::GenerateCharProfileKey(charProfile.GetDeviceId(),
                 charProfile.GetServiceName(), charProfile.GetCharacteristicKey());
-            charProfileMap_[profileKey] = charProfile;
+            CharacteristicProfile& cachedProfile = charProfileMap_[profileKey];
+            cachedProfile = charProfile;
+            cachedProfile.InternStrings();
         }
     }
+    // a refresh replaces the whole map, check it against the budget at once
+    DpMemoryManager::GetInstance().CheckBudget();
     return DP_SUCCESS;
 }
 
@@ -409,111 +498,12 @@ int32_t ProfileCache::RefreshStaticProfileCache(const std::unordered_map<std::st
         charProfileMap_.clear();
         for (const auto& staticProfileItem : staticProfiles) {
             HILOGD("profile: %{public}s!", staticProfileItem.second.dump().c_str());
-            charProfileMap_[staticProfileItem.first] = staticProfileItem.second;
+            CharacteristicProfile& cachedProfile = charProfileMap_[staticProfileItem.first];
+            cachedProfile = staticProfileItem.second;
+            cachedProfile.InternStrings();
         }
     }
-    return DP_SUCCESS;
-}
-
-int32_t ProfileCache::AddSyncListener(const std::string& caller, sptr<IRemoteObject> syncListener)
-{
-    if (caller.empty() || caller.size() > MAX_STRING_LEN || syncListener == nullptr) {
-        HILOGE("params is invalid!");
-        return DP_INVALID_PARAMS;
-    }
-    {
-        std::lock_guard<std::mutex> lock(syncListenerMutex_);
-        if (syncListenerMap_.size() > MAX_LISTENER_SIZE) {
-            HILOGE("syncListenerMap is exceed max listenerSize!");
-            return DP_EXCEED_MAX_SIZE_FAIL;
-        }
-        HILOGI("caller %{public}s!", caller.c_str());
-        syncListener->AddDeathRecipient(syncListenerDeathRecipient_);
-        syncListenerMap_[caller] = syncListener;
-    }
-    return DP_SUCCESS;
-}
-
-int32_t ProfileCache::GetSyncListeners(std::map<std::string, sptr<IRemoteObject>>& syncListeners)
-{
-    HILOGD("call!");
-    {
-        std::lock_guard<std::mutex> lock(syncListenerMutex_);
-        for (const auto& item : syncListenerMap_) {
-            syncListeners[item.first] = item.second;
-        }
-    }
-    return DP_SUCCESS;
-}
-
-int32_t ProfileCache::RemoveSyncListeners(std::map<std::string, sptr<IRemoteObject>> syncListeners)
-{
-    HILOGD("call!");
-    {
-        std::lock_guard<std::mutex> lock(syncListenerMutex_);
-        auto iter = syncListenerMap_.begin();
-        while (iter!= syncListenerMap_.end()) {
-            if (syncListeners.count(iter->first) != 0) {
-                if (iter->second != nullptr) {
-                    iter->second->RemoveDeathRecipient(syncListenerDeathRecipient_);
-                }
-                HILOGI("caller %{public}s!", iter->first.c_str());
-                iter = syncListenerMap_.erase(iter);
-            } else {
-                iter++;
-            }
-        }
-    }
-    return DP_SUCCESS;
-}
-
-int32_t ProfileCache::RemoveSyncListener(const std::string& caller)
-{
-    HILOGD("call!");
-    if (caller.empty() || caller.size() > MAX_STRING_LEN) {
-        HILOGE("descriptor is invalid!");
-        return DP_INVALID_PARAMS;
-    }
-    {
-        std::lock_guard<std::mutex> lock(syncListenerMutex_);
-        if (syncListenerMap_.count(caller) == 0) {
-            HILOGE("Can not find this listener!");
-            return DP_NOT_FOUND_FAIL;
-        }
-        HILOGI("caller %{public}s!", caller.c_str());
-        if (syncListenerMap_[caller] == nullptr) {
-            HILOGE("this caller syncListener is nullptr, caller : %{public}s", caller.c_str());
-            return DP_NULLPTR;
-        }
-        syncListenerMap_[caller]->RemoveDeathRecipient(syncListenerDeathRecipient_);
-        syncListenerMap_.erase(caller);
-    }
-    return DP_SUCCESS;
-}
-
-int32_t ProfileCache::RemoveSyncListener(sptr<IRemoteObject> syncListener)
-{
-    HILOGD("call!");
-    if (syncListener == nullptr) {
-        HILOGE("syncListener is nullptr!");
-        return DP_INVALID_PARAMS;
-    }
-    {
-        std::lock_guard<std::mutex> lock(syncListenerMutex_);
-        auto iter = std::find_if(syncListenerMap_.begin(), syncListenerMap_.end(), [=](
-            const std::pair<std::string, sptr<IRemoteObject>>& item)->bool {
-            return item.second == syncListener;
-        });
-        if (iter == syncListenerMap_.end()) {
-            HILOGE("syncListener is not exist!");
-            return DP_NOT_FOUND_FAIL;
-        }
-        HILOGI("remote procName = %{public}s", iter->first.c_str());
-        if (iter->second != nullptr) {
-            iter->second->RemoveDeathRecipient(syncListenerDeathRecipient_);
-        }
-        syncListenerMap_.erase(iter);
-    }
+    DpMemoryManager::GetInstance().CheckBudget();
     return DP_SUCCESS;
 }
 
@@ -655,6 +645,31 @@ void ProfileCache::SetCurSwitch(uint32_t newSwitch)
     return;
 }
 
+void ProfileCache::SetRemoteSwitch(const std::string& netWorkId, uint32_t switchValue)
+{
+    if (netWorkId.empty()) {
+        HILOGE("netWorkId is empty");
+        return;
+    }
+    std::lock_guard<std::mutex> lock(remoteSwitchMutex_);
+    if (remoteSwitchMap_.size() >= MAX_TRUSTED_DEVICE_SIZE && remoteSwitchMap_.count(netWorkId) == 0) {
+        HILOGE("remoteSwitchMap_.size greater than %{public}u", MAX_TRUSTED_DEVICE_SIZE);
+        return;
+    }
+    remoteSwitchMap_[netWorkId] = switchValue;
+}
+
+int32_t ProfileCache::GetRemoteSwitch(const std::string& netWorkId, uint32_t& switchValue)
+{
+    std::lock_guard<std::mutex> lock(remoteSwitchMutex_);
+    auto iter = remoteSwitchMap_.find(netWorkId);
+    if (iter == remoteSwitchMap_.end()) {
+        return DP_NOT_FOUND_FAIL;
+    }
+    switchValue = iter->second;
+    return DP_SUCCESS;
+}
+
 void ProfileCache::OnNodeOnline(const TrustedDeviceInfo& trustedDevice)
 {
     HILOGD("trustedDevice=%{public}s", trustedDevice.dump().c_str());
@@ -688,6 +703,10 @@ void ProfileCache::OnNodeOffline(const std::string& peerNetworkId)
             ++it;
         }
     }
+    {
+        std::lock_guard<std::mutex> lock(remoteSwitchMutex_);
+        remoteSwitchMap_.erase(peerNetworkId);
+    }
 }
 
 int32_t ProfileCache::GetNetWorkIdByUdid(const std::string& udid, std::string& networkId)
@@ -889,5 +908,40 @@ bool ProfileCache::IsDeviceOnline()
     std::lock_guard<std::mutex> lock(onlineDeviceLock_);
     return !onlineDevMap_.empty();
 }
+
+DpCacheUsage ProfileCache::GetUsage()
+{
+    DpCacheUsage usage;
+    AddProfileMapUsage(deviceProfileMutex_, deviceProfileMap_, usage);
+    AddProfileMapUsage(serviceProfileMutex_, serviceProfileMap_, usage);
+    AddProfileMapUsage(charProfileMutex_, charProfileMap_, usage);
+    AddProfileMapUsage(staticCharProfileMutex_, staticCharProfileMap_, usage);
+    AddProfileMapUsage(onlineDeviceLock_, onlineDevMap_, usage);
+    std::lock_guard<std::mutex> lock(remoteSwitchMutex_);
+    usage.entries += remoteSwitchMap_.size();
+    for (const auto& [netWorkId, switchValue] : remoteSwitchMap_) {
+        usage.bytes += CACHE_NODE_OVERHEAD_BYTES + sizeof(netWorkId) + sizeof(switchValue) +
+            DpMemoryManager::EstimateBytes(netWorkId);
+    }
+    usage.bytes += DpStringPool::GetInstance().GetBytes();
+    return usage;
+}
+
+size_t ProfileCache::Trim(size_t bytesToFree)
+{
+    // charProfileMap_ and onlineDevMap_ are the only copy of switch and online state, they are never trimmed
+    size_t freedBytes = TrimProfileMap(staticCharProfileMutex_, staticCharProfileMap_, bytesToFree);
+    if (freedBytes < bytesToFree) {
+        freedBytes += TrimProfileMap(serviceProfileMutex_, serviceProfileMap_, bytesToFree - freedBytes);
+    }
+    if (freedBytes < bytesToFree) {
+        freedBytes += TrimProfileMap(deviceProfileMutex_, deviceProfileMap_, bytesToFree - freedBytes);
+    }
+    // the strings only the evicted profiles held
+    size_t poolBytes = DpStringPool::GetInstance().GetBytes();
+    DpStringPool::GetInstance().Purge();
+    freedBytes += poolBytes - std::min(poolBytes, DpStringPool::GetInstance().GetBytes());
+    return freedBytes;
+}
 } // namespace DeviceProfile
 } // namespace OHOS
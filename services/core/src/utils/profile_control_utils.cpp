@@ -233,9 +233,9 @@ int32_t ProfileControlUtils::GetDeviceProfile(std::shared_ptr<IKVAdapter> kvStor
         HILOGE("the profile is invalid!");
         return DP_INVALID_PARAMS;
     }
-    HILOGI("GetDeviceProfile, deviceId: %{public}s!", ProfileUtils::GetAnonyString(deviceId).c_str());
+    HILOGI_LIMIT("GetDeviceProfile, deviceId: %{public}s!", ProfileUtils::GetAnonyString(deviceId).c_str());
     if (ProfileCache::GetInstance().GetDeviceProfile(deviceId, deviceProfile) == DP_SUCCESS) {
-        HILOGI("GetDeviceProfile in cache!");
+        HILOGD("GetDeviceProfile in cache!");
         return DP_SUCCESS;
     }
     std::string dbKeyPrefix = ProfileUtils::GenerateDeviceProfileKey(deviceId);
@@ -265,10 +265,10 @@ int32_t ProfileControlUtils::GetServiceProfile(std::shared_ptr<IKVAdapter> kvSto
         HILOGE("the profile is invalid!");
         return DP_INVALID_PARAMS;
     }
-    HILOGI("deviceId: %{public}s, serviceName: %{public}s!",
+    HILOGI_LIMIT("deviceId: %{public}s, serviceName: %{public}s!",
         ProfileUtils::GetAnonyString(deviceId).c_str(), serviceName.c_str());
     if (ProfileCache::GetInstance().GetServiceProfile(deviceId, serviceName, serviceProfile) == DP_SUCCESS) {
-        HILOGI("GetServiceProfile in cache!");
+        HILOGD("GetServiceProfile in cache!");
         return DP_SUCCESS;
     }
     std::string dbKeyPrefix = ProfileUtils::GenerateServiceProfileKey(deviceId, serviceName);
@@ -289,7 +289,7 @@ int32_t ProfileControlUtils::GetServiceProfile(std::shared_ptr<IKVAdapter> kvSto
 int32_t ProfileControlUtils::GetCharacteristicProfile(std::shared_ptr<IKVAdapter> kvStore, const std::string& deviceId,
     const std::string& serviceName, const std::string& characteristicKey, CharacteristicProfile& charProfile)
 {
-    HILOGI("deviceId: %{public}s, serviceName: %{public}s, charKey: %{public}s!",
+    HILOGI_LIMIT("deviceId: %{public}s, serviceName: %{public}s, charKey: %{public}s!",
         ProfileUtils::GetAnonyString(deviceId).c_str(), serviceName.c_str(), characteristicKey.c_str());
     if (kvStore == nullptr) {
         HILOGE("kvStore is nullptr! devId: %{public}s, svrName: %{public}s, charKey: %{public}s!",
@@ -305,7 +305,7 @@ int32_t ProfileControlUtils::GetCharacteristicProfile(std::shared_ptr<IKVAdapter
     if (characteristicKey == STATIC_CHARACTERISTIC_KEY || characteristicKey == SWITCH_STATUS) {
         if (ProfileCache::GetInstance().GetCharacteristicProfile(deviceId, serviceName, characteristicKey, charProfile)
             == DP_SUCCESS) {
-            HILOGI("GetCharProfile in cache! devId: %{public}s, svrName: %{public}s, charKey: %{public}s!",
+            HILOGD("GetCharProfile in cache! devId: %{public}s, svrName: %{public}s, charKey: %{public}s!",
                 ProfileUtils::GetAnonyString(deviceId).c_str(), serviceName.c_str(), characteristicKey.c_str());
             return DP_SUCCESS;
         }
@@ -380,11 +380,11 @@ int32_t ProfileControlUtils::GetSwitchCharacteristicProfile(const std::string& a
         HILOGE("params are invalid!");
         return DP_INVALID_PARAMS;
     }
-    HILOGI("deviceId: %{public}s, serviceName: %{public}s, charKey: %{public}s!",
+    HILOGI_LIMIT("deviceId: %{public}s, serviceName: %{public}s, charKey: %{public}s!",
         ProfileUtils::GetAnonyString(deviceId).c_str(), serviceName.c_str(), characteristicKey.c_str());
     if (ProfileCache::GetInstance().GetCharacteristicProfile(deviceId, serviceName, characteristicKey, charProfile)
         == DP_SUCCESS) {
-        HILOGI("GetCharProfile in cache: %{public}s!", charProfile.dump().c_str());
+        HILOGD("GetCharProfile in cache: %{public}s!", charProfile.dump().c_str());
         return DP_SUCCESS;
     }
     const CharacteristicProfile profile(deviceId, serviceName, characteristicKey, "");
@@ -398,14 +398,21 @@ int32_t ProfileControlUtils::GetSwitchCharacteristicProfile(const std::string& a
         HILOGE("GetNetWorkIdByUdid failed, res: %{public}d", res);
         return DP_GET_KV_DB_FAIL;
     }
-    uint32_t switchValue;
-    uint32_t switchLength;
-    res = SwitchAdapter::GetInstance().GetSwitch(appId, netWorkId, switchValue, switchLength);
-    if (res != DP_SUCCESS) {
-        HILOGE("GetSwitch failed, res: %{public}d", res);
-        return DP_GET_KV_DB_FAIL;
+    uint32_t switchValue = 0;
+    bool isRemote = deviceId != ProfileCache::GetInstance().GetLocalUdid();
+    // one fetch of the switch word serves every switch service of the peer
+    if (!isRemote || ProfileCache::GetInstance().GetRemoteSwitch(netWorkId, switchValue) != DP_SUCCESS) {
+        uint32_t switchLength;
+        res = SwitchAdapter::GetInstance().GetSwitch(appId, netWorkId, switchValue, switchLength);
+        if (res != DP_SUCCESS) {
+            HILOGE("GetSwitch failed, res: %{public}d", res);
+            return DP_GET_KV_DB_FAIL;
+        }
+        HILOGD("GetSwitch success, switchValue: %{public}d", switchValue);
+        if (isRemote) {
+            ProfileCache::GetInstance().SetRemoteSwitch(netWorkId, switchValue);
+        }
     }
-    HILOGD("GetSwitch success, switchValue: %{public}d", switchValue);
     charProfile.SetDeviceId(deviceId);
     charProfile.SetServiceName(serviceName);
     charProfile.SetCharacteristicKey(characteristicKey);
@@ -414,7 +421,7 @@ int32_t ProfileControlUtils::GetSwitchCharacteristicProfile(const std::string& a
         HILOGE("SetSwitchProfile failed, res: %{public}d", res);
         return DP_GET_KV_DB_FAIL;
     }
-    HILOGI("success : %{public}s!", charProfile.dump().c_str());
+    HILOGD("success : %{public}s!", charProfile.dump().c_str());
     ProfileCache::GetInstance().AddCharProfile(charProfile);
     return DP_SUCCESS;
 }
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "service_info_codec.h"
+
+#include <type_traits>
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+namespace {
+    constexpr size_t HEADER_SIZE = 2;
+    constexpr size_t BITS_PER_BYTE = 8;
+
+    template <typename T>
+    void WriteNumber(std::string& out, T value)
+    {
+        auto bits = static_cast<std::make_unsigned_t<T>>(value);
+        for (size_t i = 0; i < sizeof(T); i++) {
+            out.push_back(static_cast<char>(static_cast<uint8_t>(bits >> (i * BITS_PER_BYTE))));
+        }
+    }
+
+    void WriteString(std::string& out, const std::string& value)
+    {
+        WriteNumber(out, static_cast<uint32_t>(value.size()));
+        out.append(value);
+    }
+
+    size_t EncodedSize(const std::string& value)
+    {
+        return sizeof(uint32_t) + value.size();
+    }
+
+    class Reader {
+    public:
+        explicit Reader(std::string_view data) : data_(data) {}
+
+        template <typename T>
+        bool ReadNumber(T& value)
+        {
+            if (data_.size() - pos_ < sizeof(T)) {
+                return false;
+            }
+            std::make_unsigned_t<T> bits = 0;
+            for (size_t i = 0; i < sizeof(T); i++) {
+                bits |= static_cast<std::make_unsigned_t<T>>(static_cast<uint8_t>(data_[pos_ + i])) <<
+                    (i * BITS_PER_BYTE);
+            }
+            pos_ += sizeof(T);
+            value = static_cast<T>(bits);
+            return true;
+        }
+
+        bool ReadString(std::string_view& value)
+        {
+            uint32_t size = 0;
+            if (!ReadNumber(size) || data_.size() - pos_ < size) {
+                return false;
+            }
+            value = data_.substr(pos_, size);
+            pos_ += size;
+            return true;
+        }
+
+    private:
+        std::string_view data_;
+        size_t pos_ = HEADER_SIZE;
+    };
+}
+
+bool ServiceInfoCodec::IsBinary(std::string_view value)
+{
+    return value.size() >= HEADER_SIZE && static_cast<uint8_t>(value[0]) == SERVICE_INFO_CODEC_MAGIC;
+}
+
+std::string ServiceInfoCodec::Encode(const ServiceInfo& serviceInfo)
+{
+    std::string out;
+    out.reserve(HEADER_SIZE + sizeof(int32_t) * 3 + sizeof(int64_t) * 3 + sizeof(int8_t) + sizeof(uint32_t) +
+        EncodedSize(serviceInfo.GetUdid()) + EncodedSize(serviceInfo.GetServiceOwnerPkgName()) +
+        EncodedSize(serviceInfo.GetServiceType()) + EncodedSize(serviceInfo.GetServiceName()) +
+        EncodedSize(serviceInfo.GetServiceDisplayName()) + EncodedSize(serviceInfo.GetCustomData()) +
+        EncodedSize(serviceInfo.GetServiceCode()) + EncodedSize(serviceInfo.GetExtraData()) +
+        EncodedSize(serviceInfo.GetVersion()) + EncodedSize(serviceInfo.GetDescription()));
+    out.push_back(static_cast<char>(SERVICE_INFO_CODEC_MAGIC));
+    out.push_back(static_cast<char>(SERVICE_INFO_CODEC_VERSION));
+    WriteNumber(out, serviceInfo.GetUserId());
+    WriteNumber(out, serviceInfo.GetDisplayId());
+    WriteNumber(out, serviceInfo.GetServiceOwnerTokenId());
+    WriteNumber(out, serviceInfo.GetServiceRegisterTokenId());
+    WriteNumber(out, serviceInfo.GetServiceId());
+    WriteNumber(out, serviceInfo.GetTimeStamp());
+    WriteNumber(out, serviceInfo.GetPublishState());
+    WriteNumber(out, serviceInfo.GetDataLen());
+    WriteString(out, serviceInfo.GetUdid());
+    WriteString(out, serviceInfo.GetServiceOwnerPkgName());
+    WriteString(out, serviceInfo.GetServiceType());
+    WriteString(out, serviceInfo.GetServiceName());
+    WriteString(out, serviceInfo.GetServiceDisplayName());
+    WriteString(out, serviceInfo.GetCustomData());
+    WriteString(out, serviceInfo.GetServiceCode());
+    WriteString(out, serviceInfo.GetExtraData());
+    WriteString(out, serviceInfo.GetVersion());
+    WriteString(out, serviceInfo.GetDescription());
+    return out;
+}
+
+bool ServiceInfoView::Parse(std::string_view value)
+{
+    if (!ServiceInfoCodec::IsBinary(value) || static_cast<uint8_t>(value[1]) < SERVICE_INFO_CODEC_VERSION) {
+        return false;
+    }
+    Reader reader(value);
+    return reader.ReadNumber(userId_) && reader.ReadNumber(displayId_) &&
+        reader.ReadNumber(serviceOwnerTokenId_) && reader.ReadNumber(serviceRegisterTokenId_) &&
+        reader.ReadNumber(serviceId_) && reader.ReadNumber(timeStamp_) && reader.ReadNumber(publishState_) &&
+        reader.ReadNumber(dataLen_) && reader.ReadString(udid_) && reader.ReadString(serviceOwnerPkgName_) &&
+        reader.ReadString(serviceType_) && reader.ReadString(serviceName_) &&
+        reader.ReadString(serviceDisplayName_) && reader.ReadString(customData_) &&
+        reader.ReadString(serviceCode_) && reader.ReadString(extraData_) && reader.ReadString(version_) &&
+        reader.ReadString(description_);
+}
+
+void ServiceInfoView::ToServiceInfo(ServiceInfo& serviceInfo) const
+{
+    serviceInfo.SetUdid(std::string(udid_));
+    serviceInfo.SetUserId(userId_);
+    serviceInfo.SetDisplayId(displayId_);
+    serviceInfo.SetServiceOwnerTokenId(serviceOwnerTokenId_);
+    serviceInfo.SetServiceOwnerPkgName(std::string(serviceOwnerPkgName_));
+    serviceInfo.SetServiceRegisterTokenId(serviceRegisterTokenId_);
+    serviceInfo.SetServiceId(serviceId_);
+    serviceInfo.SetTimeStamp(timeStamp_);
+    serviceInfo.SetPublishState(publishState_);
+    serviceInfo.SetServiceType(std::string(serviceType_));
+    serviceInfo.SetServiceName(std::string(serviceName_));
+    serviceInfo.SetServiceDisplayName(std::string(serviceDisplayName_));
+    serviceInfo.SetCustomData(std::string(customData_));
+    serviceInfo.SetServiceCode(std::string(serviceCode_));
+    serviceInfo.SetDataLen(dataLen_);
+    serviceInfo.SetExtraData(std::string(extraData_));
+    serviceInfo.SetVersion(std::string(version_));
+    serviceInfo.SetDescription(std::string(description_));
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
@@ -25,6 +25,8 @@
 #include "business_callback_stub.h"
 #include "distributed_device_profile_client.h"
 #include "business_event_manager.h"
+#include "event_handler_factory.h"
+#include "write_behind_kv_adapter.h"
 
 using namespace testing::ext;
 namespace OHOS {
@@ -32,7 +34,60 @@ namespace DistributedDeviceProfile {
 using namespace std;
 namespace {
     const std::string TAG = "BusinessEventManagerTest";
+    const std::string REJECT_KEY = "business_id_cast+_reject_event";
+    constexpr int64_t LONG_WINDOW_MS = 10000;
 }
+
+// Stands in for the business event store, only counts what reaches it.
+class CountingKvStore : public IKVAdapter {
+public:
+    int32_t Init() override { return DP_SUCCESS; }
+    int32_t UnInit() override { return DP_SUCCESS; }
+    int32_t Put(const std::string& key, const std::string& value) override
+    {
+        if (putResult != DP_SUCCESS) {
+            return putResult;
+        }
+        entries[key] = value;
+        return DP_SUCCESS;
+    }
+    int32_t PutBatch(const std::map<std::string, std::string>& values) override
+    {
+        putBatchCount++;
+        for (const auto& [key, value] : values) {
+            entries[key] = value;
+        }
+        return DP_SUCCESS;
+    }
+    int32_t Delete(const std::string& key) override { return DP_SUCCESS; }
+    int32_t DeleteByPrefix(const std::string& keyPrefix) override { return DP_SUCCESS; }
+    int32_t Get(const std::string& key, std::string& value) override
+    {
+        getCount++;
+        auto iter = entries.find(key);
+        if (iter == entries.end()) {
+            return DP_GET_KV_DB_FAIL;
+        }
+        value = iter->second;
+        return DP_SUCCESS;
+    }
+    int32_t GetByPrefix(const std::string& keyPrefix, std::map<std::string, std::string>& values) override
+    {
+        return DP_SUCCESS;
+    }
+    int32_t Sync(const std::vector<std::string>& deviceList, SyncMode syncMode) override { return DP_SUCCESS; }
+    int32_t GetDeviceEntries(const std::string& udid, std::map<std::string, std::string>& values) override
+    {
+        return DP_SUCCESS;
+    }
+    int32_t DeleteBatch(const std::vector<std::string>& keys) override { return DP_SUCCESS; }
+    int32_t RemoveDeviceData(const std::string& uuid) override { return DP_SUCCESS; }
+
+    std::map<std::string, std::string> entries;
+    int32_t putResult = DP_SUCCESS;
+    int32_t putBatchCount = 0;
+    int32_t getCount = 0;
+};
 class BusinessEventManagerTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -42,10 +97,14 @@ public:
 };
 
 void BusinessEventManagerTest::SetUpTestCase()
-{}
+{
+    EventHandlerFactory::GetInstance().Init();
+}
 
 void BusinessEventManagerTest::TearDownTestCase()
-{}
+{
+    EventHandlerFactory::GetInstance().UnInit();
+}
 
 void BusinessEventManagerTest::SetUp()
 {}
@@ -183,6 +242,80 @@ HWTEST_F(BusinessEventManagerTest, GetBusinessEvent003, TestSize.Level1)
     EXPECT_EQ(result, DP_SUCCESS);
 }
 
+/*
+* @tc.name: PutBusinessEvent006
+* @tc.desc: repeated puts are served from memory and reach the store once, with the last value
+* @tc.type: FUNC
+* @tc.require:
+*/
+HWTEST_F(BusinessEventManagerTest, PutBusinessEvent006, TestSize.Level1)
+{
+    BusinessEventManager& manager = BusinessEventManager::GetInstance();
+    auto oldAdapter = manager.businessEventAdapter_;
+    auto store = std::make_shared<CountingKvStore>();
+    store->entries[REJECT_KEY] = "loaded";
+    auto adapter = std::make_shared<WriteBehindKvAdapter>("business_event_test", store, LONG_WINDOW_MS);
+    manager.businessEventAdapter_ = adapter;
+    manager.LoadBusinessEvents();
+    int32_t loadGetCount = store->getCount;
+
+    BusinessEvent businessEvent;
+    businessEvent.SetBusinessKey(REJECT_KEY);
+    EXPECT_EQ(manager.GetBusinessEvent(businessEvent), DP_SUCCESS);
+    EXPECT_EQ(businessEvent.GetBusinessValue(), "loaded");
+    for (int32_t i = 0; i < 10; i++) {
+        businessEvent.SetBusinessValue("value" + std::to_string(i % 2));
+        EXPECT_EQ(manager.PutBusinessEvent(businessEvent), DP_SUCCESS);
+    }
+    EXPECT_EQ(adapter->GetPendingCount(), 1);
+    BusinessEvent outEvent;
+    outEvent.SetBusinessKey(REJECT_KEY);
+    EXPECT_EQ(manager.GetBusinessEvent(outEvent), DP_SUCCESS);
+    EXPECT_EQ(outEvent.GetBusinessValue(), "value1");
+    EXPECT_EQ(store->getCount, loadGetCount);
+    EXPECT_EQ(adapter->Flush(), DP_SUCCESS);
+    EXPECT_EQ(store->putBatchCount, 1);
+    EXPECT_EQ(store->entries[REJECT_KEY], "value1");
+
+    manager.businessEventAdapter_ = oldAdapter;
+    manager.LoadBusinessEvents();
+}
+
+/*
+* @tc.name: PutBusinessEvent007
+* @tc.desc: a value the store rejected is not served from memory afterwards
+* @tc.type: FUNC
+* @tc.require:
+*/
+HWTEST_F(BusinessEventManagerTest, PutBusinessEvent007, TestSize.Level1)
+{
+    BusinessEventManager& manager = BusinessEventManager::GetInstance();
+    auto oldAdapter = manager.businessEventAdapter_;
+    auto store = std::make_shared<CountingKvStore>();
+    store->entries[REJECT_KEY] = "loaded";
+    manager.businessEventAdapter_ = store;
+    manager.LoadBusinessEvents();
+
+    BusinessEvent businessEvent;
+    businessEvent.SetBusinessKey(REJECT_KEY);
+    businessEvent.SetBusinessValue("rejected");
+    store->putResult = DP_PUT_KV_DB_FAIL;
+    EXPECT_EQ(manager.PutBusinessEvent(businessEvent), DP_PUT_BUSINESS_EVENT_FAIL);
+    BusinessEvent outEvent;
+    outEvent.SetBusinessKey(REJECT_KEY);
+    EXPECT_EQ(manager.GetBusinessEvent(outEvent), DP_SUCCESS);
+    EXPECT_EQ(outEvent.GetBusinessValue(), "loaded");
+
+    store->putResult = DP_SUCCESS;
+    EXPECT_EQ(manager.PutBusinessEvent(businessEvent), DP_SUCCESS);
+    EXPECT_EQ(manager.GetBusinessEvent(outEvent), DP_SUCCESS);
+    EXPECT_EQ(outEvent.GetBusinessValue(), "rejected");
+    EXPECT_EQ(store->entries[REJECT_KEY], "rejected");
+
+    manager.businessEventAdapter_ = oldAdapter;
+    manager.LoadBusinessEvents();
+}
+
 /*
 * @tc.name: UnInit001
 * @tc.desc: Init
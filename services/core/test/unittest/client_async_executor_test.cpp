@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+
+#include "client_async_executor.h"
+#include "distributed_device_profile_errors.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace DistributedDeviceProfile {
+using namespace std;
+namespace {
+    const std::string EXECUTOR_NAME = "client_async_executor_test";
+    constexpr int64_t LONG_TIMEOUT_MS = 2000;
+    constexpr int64_t SHORT_TIMEOUT_MS = 50;
+    constexpr int32_t WAIT_TIMEOUT_S = 2;
+}
+
+// Blocks the work thread until released, standing in for a slow binder call.
+class Gate {
+public:
+    void Wait()
+    {
+        unique_lock<mutex> lock(mutex_);
+        condVar_.wait(lock, [this]() { return opened_; });
+    }
+
+    void Open()
+    {
+        lock_guard<mutex> lock(mutex_);
+        opened_ = true;
+        condVar_.notify_all();
+    }
+
+private:
+    mutex mutex_;
+    condition_variable condVar_;
+    bool opened_ = false;
+};
+
+class ClientAsyncExecutorTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: Submit001
+ * @tc.desc: invalid requests are rejected without a request id
+ * @tc.type: FUNC
+ */
+HWTEST_F(ClientAsyncExecutorTest, Submit001, TestSize.Level1)
+{
+    auto executor = make_shared<ClientAsyncExecutor>(EXECUTOR_NAME);
+    uint64_t requestId = 0;
+    EXPECT_EQ(executor->Submit(nullptr, [](int32_t) {}, LONG_TIMEOUT_MS, requestId), DP_INVALID_PARAMS);
+    EXPECT_EQ(executor->Submit([]() { return DP_SUCCESS; }, nullptr, LONG_TIMEOUT_MS, requestId),
+        DP_INVALID_PARAMS);
+    EXPECT_EQ(executor->Submit([]() { return DP_SUCCESS; }, [](int32_t) {}, 0, requestId), DP_INVALID_PARAMS);
+    EXPECT_EQ(requestId, 0);
+}
+
+/**
+ * @tc.name: Submit002
+ * @tc.desc: the work runs off the caller thread and its result completes the request
+ * @tc.type: FUNC
+ */
+HWTEST_F(ClientAsyncExecutorTest, Submit002, TestSize.Level1)
+{
+    auto executor = make_shared<ClientAsyncExecutor>(EXECUTOR_NAME);
+    auto callerThread = this_thread::get_id();
+    atomic<bool> offCaller {false};
+    promise<int32_t> done;
+    uint64_t requestId = 0;
+    int32_t ret = executor->Submit([&offCaller, callerThread]() {
+            offCaller = this_thread::get_id() != callerThread;
+            return DP_NOT_FOUND_FAIL;
+        }, [&done](int32_t errCode) { done.set_value(errCode); }, LONG_TIMEOUT_MS, requestId);
+    EXPECT_EQ(ret, DP_SUCCESS);
+    EXPECT_NE(requestId, 0);
+    auto result = done.get_future();
+    ASSERT_EQ(result.wait_for(chrono::seconds(WAIT_TIMEOUT_S)), future_status::ready);
+    EXPECT_EQ(result.get(), DP_NOT_FOUND_FAIL);
+    EXPECT_TRUE(offCaller);
+    EXPECT_EQ(executor->GetPendingCount(), 0);
+}
+
+/**
+ * @tc.name: Timeout001
+ * @tc.desc: a stuck call completes with a timeout once and its late result is dropped
+ * @tc.type: FUNC
+ */
+HWTEST_F(ClientAsyncExecutorTest, Timeout001, TestSize.Level1)
+{
+    auto executor = make_shared<ClientAsyncExecutor>(EXECUTOR_NAME);
+    Gate gate;
+    atomic<int32_t> completeCount {0};
+    promise<int32_t> done;
+    uint64_t requestId = 0;
+    EXPECT_EQ(executor->Submit([&gate]() {
+            gate.Wait();
+            return DP_SUCCESS;
+        }, [&done, &completeCount](int32_t errCode) {
+            if (completeCount++ == 0) {
+                done.set_value(errCode);
+            }
+        }, SHORT_TIMEOUT_MS, requestId), DP_SUCCESS);
+    auto result = done.get_future();
+    ASSERT_EQ(result.wait_for(chrono::seconds(WAIT_TIMEOUT_S)), future_status::ready);
+    EXPECT_EQ(result.get(), DP_ASYNC_REQUEST_TIMEOUT);
+    gate.Open();
+    this_thread::sleep_for(chrono::milliseconds(SHORT_TIMEOUT_MS));
+    EXPECT_EQ(completeCount, 1);
+    EXPECT_EQ(executor->Cancel(requestId), DP_NOT_FOUND_FAIL);
+}
+
+/**
+ * @tc.name: Cancel001
+ * @tc.desc: a cancelled request completes on the caller and its queued work never runs
+ * @tc.type: FUNC
+ */
+HWTEST_F(ClientAsyncExecutorTest, Cancel001, TestSize.Level1)
+{
+    auto executor = make_shared<ClientAsyncExecutor>(EXECUTOR_NAME);
+    Gate gate;
+    promise<int32_t> firstDone;
+    uint64_t firstId = 0;
+    EXPECT_EQ(executor->Submit([&gate]() {
+            gate.Wait();
+            return DP_SUCCESS;
+        }, [&firstDone](int32_t errCode) { firstDone.set_value(errCode); }, LONG_TIMEOUT_MS, firstId), DP_SUCCESS);
+    atomic<bool> secondRan {false};
+    int32_t secondErrCode = DP_SUCCESS;
+    uint64_t secondId = 0;
+    EXPECT_EQ(executor->Submit([&secondRan]() {
+            secondRan = true;
+            return DP_SUCCESS;
+        }, [&secondErrCode](int32_t errCode) { secondErrCode = errCode; }, LONG_TIMEOUT_MS, secondId), DP_SUCCESS);
+    EXPECT_EQ(executor->Cancel(secondId), DP_SUCCESS);
+    EXPECT_EQ(secondErrCode, DP_ASYNC_REQUEST_CANCELED);
+    EXPECT_EQ(executor->GetPendingCount(), 1);
+    gate.Open();
+    auto result = firstDone.get_future();
+    ASSERT_EQ(result.wait_for(chrono::seconds(WAIT_TIMEOUT_S)), future_status::ready);
+    EXPECT_EQ(result.get(), DP_SUCCESS);
+    EXPECT_FALSE(secondRan);
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "distributed_device_profile_constants.h"
+#include "distributed_device_profile_errors.h"
+#include "dp_services_constants.h"
+
+#include "device_icon_info_dao.h"
+#include "product_info_dao.h"
+#include "profile_data_rdb_adapter.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace DistributedDeviceProfile {
+using namespace std;
+namespace {
+    const std::string PRODUCT_ID = "iconDaoTestProduct";
+    const std::string SUB_PRODUCT_ID = "subProduct";
+    const std::string IMAGE_TYPE = "imageType";
+    const std::string INTERNAL_MODEL = "internalModel";
+}
+
+class DeviceIconInfoDaoTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+
+    static DeviceIconInfo MakeIconInfo(const std::string& specName, const std::vector<uint8_t>& icon)
+    {
+        DeviceIconInfo deviceIconInfo;
+        deviceIconInfo.SetProductId(PRODUCT_ID);
+        deviceIconInfo.SetSubProductId(SUB_PRODUCT_ID);
+        deviceIconInfo.SetInternalModel(INTERNAL_MODEL);
+        deviceIconInfo.SetImageType(IMAGE_TYPE);
+        deviceIconInfo.SetSpecName(specName);
+        deviceIconInfo.SetIcon(icon);
+        return deviceIconInfo;
+    }
+
+    static int32_t GetIcon(const std::string& specName, std::vector<uint8_t>& icon)
+    {
+        DeviceIconInfoFilterOptions filterOptions;
+        filterOptions.SetProductIds({ PRODUCT_ID });
+        filterOptions.SetSubProductId(SUB_PRODUCT_ID);
+        filterOptions.SetInternalModel(INTERNAL_MODEL);
+        filterOptions.SetImageType(IMAGE_TYPE);
+        filterOptions.SetSpecName(specName);
+        std::vector<DeviceIconInfo> deviceIconInfos;
+        int32_t ret = DeviceIconInfoDao::GetInstance().GetDeviceIconInfos(filterOptions, deviceIconInfos);
+        if (ret == DP_SUCCESS) {
+            icon = deviceIconInfos.front().GetIcon();
+        }
+        return ret;
+    }
+
+    static void Delete(const std::string& specName)
+    {
+        DeviceIconInfo meta;
+        if (DeviceIconInfoDao::GetInstance().GetDeviceIconInfoMeta(MakeIconInfo(specName, {}), meta) == DP_SUCCESS) {
+            DeviceIconInfoDao::GetInstance().DeleteDeviceIconInfo(meta);
+        }
+    }
+};
+
+void DeviceIconInfoDaoTest::SetUpTestCase()
+{
+    ProductInfoDao::GetInstance().Init();
+    DeviceIconInfoDao::GetInstance().Init();
+}
+
+void DeviceIconInfoDaoTest::TearDownTestCase()
+{
+    DeviceIconInfoDao::GetInstance().UnInit();
+}
+
+void DeviceIconInfoDaoTest::SetUp()
+{}
+
+void DeviceIconInfoDaoTest::TearDown()
+{}
+
+/*
+ * @tc.name: PutDeviceIconInfo001
+ * @tc.desc: two rows with the same icon share one blob, it is dropped with the last of them
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DeviceIconInfoDaoTest, PutDeviceIconInfo001, TestSize.Level1)
+{
+    std::vector<uint8_t> icon = { 1, 2, 3, 4 };
+    std::string iconHash = DeviceIconInfoDao::GetIconHash(icon);
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().PutDeviceIconInfo(MakeIconInfo("spec1", icon)), DP_SUCCESS);
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().PutDeviceIconInfo(MakeIconInfo("spec2", icon)), DP_SUCCESS);
+    std::vector<uint8_t> storedIcon;
+    EXPECT_EQ(GetIcon("spec2", storedIcon), DP_SUCCESS);
+    EXPECT_EQ(storedIcon, icon);
+    int32_t refCount = 0;
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().GetIconBlobRefCount(iconHash, refCount), DP_SUCCESS);
+    EXPECT_EQ(refCount, 2);
+
+    Delete("spec1");
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().GetIconBlobRefCount(iconHash, refCount), DP_SUCCESS);
+    EXPECT_EQ(refCount, 1);
+    Delete("spec2");
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().GetIconBlobRefCount(iconHash, refCount), DP_NOT_FIND_DATA);
+}
+
+/*
+ * @tc.name: PutDeviceIconInfo002
+ * @tc.desc: an icon whose hash is taken by other bytes gets a row of its own and reads back its own bytes
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DeviceIconInfoDaoTest, PutDeviceIconInfo002, TestSize.Level1)
+{
+    std::vector<uint8_t> icon = { 5, 6, 7, 8 };
+    std::vector<uint8_t> otherIcon = { 8, 7, 6, 5 };
+    std::string iconHash = DeviceIconInfoDao::GetIconHash(icon);
+    // stands in for a colliding icon stored before
+    ValuesBucket values;
+    values.PutString(DEVICE_ICON_HASH, iconHash);
+    values.PutBlob(DEVICE_ICON, otherIcon);
+    values.PutInt(DEVICE_ICON_REF_COUNT, 1);
+    int64_t rowId = 0;
+    ASSERT_EQ(ProfileDataRdbAdapter::GetInstance().Put(rowId, DEVICE_ICON_BLOB_TABLE, values), DP_SUCCESS);
+
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().PutDeviceIconInfo(MakeIconInfo("spec3", icon)), DP_SUCCESS);
+    std::vector<uint8_t> storedIcon;
+    EXPECT_EQ(GetIcon("spec3", storedIcon), DP_SUCCESS);
+    EXPECT_EQ(storedIcon, icon);
+    int32_t refCount = 0;
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().GetIconBlobRefCount(iconHash, refCount), DP_SUCCESS);
+    EXPECT_EQ(refCount, 1);
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().GetIconBlobRefCount(iconHash + "#1", refCount), DP_SUCCESS);
+    EXPECT_EQ(refCount, 1);
+
+    Delete("spec3");
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().GetIconBlobRefCount(iconHash + "#1", refCount), DP_NOT_FIND_DATA);
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().ReleaseIconBlob(iconHash), DP_SUCCESS);
+}
+
+/*
+ * @tc.name: UpdateDeviceIconInfo001
+ * @tc.desc: a new icon moves the row to another blob, a failed put leaves the blobs as they were
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DeviceIconInfoDaoTest, UpdateDeviceIconInfo001, TestSize.Level1)
+{
+    std::vector<uint8_t> oldIcon = { 9, 9, 9 };
+    std::vector<uint8_t> newIcon = { 10, 10, 10 };
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().PutDeviceIconInfo(MakeIconInfo("spec4", oldIcon)), DP_SUCCESS);
+    DeviceIconInfo meta;
+    ASSERT_EQ(DeviceIconInfoDao::GetInstance().GetDeviceIconInfoMeta(MakeIconInfo("spec4", {}), meta), DP_SUCCESS);
+
+    DeviceIconInfo update = MakeIconInfo("spec4", newIcon);
+    update.SetId(meta.GetId());
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().UpdateDeviceIconInfo(update), DP_SUCCESS);
+    std::vector<uint8_t> storedIcon;
+    EXPECT_EQ(GetIcon("spec4", storedIcon), DP_SUCCESS);
+    EXPECT_EQ(storedIcon, newIcon);
+    int32_t refCount = 0;
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().GetIconBlobRefCount(DeviceIconInfoDao::GetIconHash(oldIcon),
+        refCount), DP_NOT_FIND_DATA);
+
+    // a second row with the same unique key fails, the blob it took is rolled back with it
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().PutDeviceIconInfo(MakeIconInfo("spec4", oldIcon)),
+        DP_PUT_DEVICE_ICON_INFO_FAIL);
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().GetIconBlobRefCount(DeviceIconInfoDao::GetIconHash(oldIcon),
+        refCount), DP_NOT_FIND_DATA);
+    EXPECT_EQ(DeviceIconInfoDao::GetInstance().GetIconBlobRefCount(DeviceIconInfoDao::GetIconHash(newIcon),
+        refCount), DP_SUCCESS);
+    EXPECT_EQ(refCount, 1);
+    Delete("spec4");
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
@@ -50,6 +50,8 @@ class MockDistributedDeviceProfileStubNew : public DistributedDeviceProfileStubN
     int32_t GetAllTrustDeviceProfile(std::vector<TrustDeviceProfile>& trustDeviceProfiles) override;
     int32_t GetAccessControlProfile(std::map<std::string, std::string> queryParams,
         std::vector<AccessControlProfile>& accessControlProfiles) override;
+    int32_t GetAccessControlProfileBatch(const std::vector<std::map<std::string, std::string>>& queryParamsList,
+        std::vector<std::vector<AccessControlProfile>>& aclProfilesList, std::vector<int32_t>& results) override;
     int32_t GetAllAccessControlProfile(std::vector<AccessControlProfile>& accessControlProfiles) override;
     int32_t GetAllAclIncludeLnnAcl(std::vector<AccessControlProfile>& accessControlProfiles) override;
     int32_t DeleteAccessControlProfile(int32_t accessControlId) override;
@@ -68,6 +70,8 @@ class MockDistributedDeviceProfileStubNew : public DistributedDeviceProfileStubN
         ServiceProfile& serviceProfile) override;
     int32_t GetCharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
         const std::string& characteristicId, CharacteristicProfile& charProfile) override;
+    int32_t GetCharacteristicProfileBatch(const std::vector<CharacteristicProfile>& queries,
+        std::vector<CharacteristicProfile>& charProfiles, std::vector<int32_t>& results) override;
     int32_t DeleteServiceProfile(const std::string& deviceId, const std::string& serviceName, bool isMultiUser = false,
         int32_t userId = DEFAULT_USER_ID) override;
     int32_t DeleteCharacteristicProfile(const std::string& deviceId, const std::string& serviceName,
@@ -181,6 +185,15 @@ int32_t MockDistributedDeviceProfileStubNew::GetAccessControlProfile(std::map<st
     (void)accessControlProfiles;
     return 0;
 }
+int32_t MockDistributedDeviceProfileStubNew::GetAccessControlProfileBatch(
+    const std::vector<std::map<std::string, std::string>>& queryParamsList,
+    std::vector<std::vector<AccessControlProfile>>& aclProfilesList, std::vector<int32_t>& results)
+{
+    (void)queryParamsList;
+    (void)aclProfilesList;
+    (void)results;
+    return 0;
+}
 int32_t MockDistributedDeviceProfileStubNew::GetAllAccessControlProfile(
     std::vector<AccessControlProfile>& accessControlProfiles)
 {
@@ -279,6 +292,15 @@ int32_t MockDistributedDeviceProfileStubNew::GetCharacteristicProfile(const std:
     (void)charProfile;
     return 0;
 }
+int32_t MockDistributedDeviceProfileStubNew::GetCharacteristicProfileBatch(
+    const std::vector<CharacteristicProfile>& queries, std::vector<CharacteristicProfile>& charProfiles,
+    std::vector<int32_t>& results)
+{
+    (void)queries;
+    (void)charProfiles;
+    (void)results;
+    return 0;
+}
 int32_t MockDistributedDeviceProfileStubNew::DeleteServiceProfile(const std::string& deviceId,
     const std::string& serviceName, bool isMultiUser, int32_t userId)
 {
@@ -633,6 +655,20 @@ HWTEST_F(DistributedDeviceProfileStubNewTest, GetAccessControlProfileInner_001,
     EXPECT_EQ(DP_READ_PARCEL_FAIL, ret);
 }
 
+/**
+ * @tc.name: GetAccessControlProfileBatchInner001
+ * @tc.desc: GetAccessControlProfileBatchInner
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DistributedDeviceProfileStubNewTest, GetAccessControlProfileBatchInner_001, TestSize.Level1)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    int32_t ret = ProfileStub_->GetAccessControlProfileBatchInner(data, reply);
+    EXPECT_EQ(DP_READ_PARCEL_FAIL, ret);
+}
+
 /**
  * @tc.name: GetAllAccessControlProfileInner001
  * @tc.desc: GetAllAccessControlProfileInner
@@ -745,6 +781,20 @@ HWTEST_F(DistributedDeviceProfileStubNewTest, GetCharacteristicProfileInner_001,
     EXPECT_EQ(ERR_FLATTEN_OBJECT, ret);
 }
 
+/**
+ * @tc.name: GetCharacteristicProfileBatchInner001
+ * @tc.desc: GetCharacteristicProfileBatchInner
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DistributedDeviceProfileStubNewTest, GetCharacteristicProfileBatchInner_001, TestSize.Level1)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    int32_t ret = ProfileStub_->GetCharacteristicProfileBatchInner(data, reply);
+    EXPECT_EQ(DP_READ_PARCEL_FAIL, ret);
+}
+
 /**
  * @tc.name: DeleteServiceProfileInner001
  * @tc.desc: DeleteServiceProfileInner
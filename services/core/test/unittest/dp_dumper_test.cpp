@@ -17,6 +17,7 @@
 #define protected public
 #include "gtest/gtest.h"
 #include "device_profile_dumper.h"
+#include "dp_metrics.h"
 #undef private
 #undef protected
 
@@ -85,5 +86,62 @@ HWTEST_F(DpDumperTest, Dump_004, TestSize.Level1)
     bool ret = dumper->Dump(args, result);
     EXPECT_EQ(false, ret);
 }
+
+HWTEST_F(DpDumperTest, Dump_005, TestSize.Level1)
+{
+    setuid(1212);
+    DpMetrics::GetInstance().Reset();
+    DpMetrics::GetInstance().RecordIpc(static_cast<uint32_t>(DpIpcInterfaceCode::GET_DEVICE_PROFILE_NEW), 300);
+    DpMetrics::GetInstance().RecordTimer(DpMetricsTimer::KV_GET, 2000);
+    std::string result;
+    std::vector<std::string> args;
+    args.emplace_back("-metrics");
+    auto dumper = std::make_shared<DeviceProfileDumper>();
+    bool ret = dumper->Dump(args, result);
+    EXPECT_EQ(true, ret);
+    EXPECT_NE(result.find("KvGet: count=1"), std::string::npos);
+
+    args.clear();
+    args.emplace_back("-reset-metrics");
+    ret = dumper->Dump(args, result);
+    EXPECT_EQ(true, ret);
+    DpMetrics::GetInstance().Dump(result);
+    EXPECT_EQ(result.find("KvGet"), std::string::npos);
+}
+
+HWTEST_F(DpDumperTest, LatencyHistogram_001, TestSize.Level1)
+{
+    LatencyHistogram histogram;
+    for (int32_t i = 0; i < 99; i++) {
+        histogram.Record(50);
+    }
+    histogram.Record(2000000);
+    EXPECT_EQ(histogram.GetCount(), 100);
+    EXPECT_EQ(histogram.GetPercentileUs(100, 50), 100);
+    EXPECT_EQ(histogram.GetPercentileUs(100, 99), 100);
+    EXPECT_EQ(histogram.GetPercentileUs(100, 100), 2000000);
+    histogram.Reset();
+    EXPECT_EQ(histogram.GetCount(), 0);
+}
+
+HWTEST_F(DpDumperTest, DpMetrics_001, TestSize.Level1)
+{
+    auto& metrics = DpMetrics::GetInstance();
+    metrics.Reset();
+    int64_t depth = metrics.GetQueueDepth();
+    metrics.OnTaskPosted();
+    metrics.OnTaskPosted();
+    EXPECT_EQ(metrics.GetQueueDepth(), depth + 2);
+    metrics.OnTaskStart(DpMetrics::GetNowUs());
+    metrics.OnTaskDropped();
+    EXPECT_EQ(metrics.GetQueueDepth(), depth);
+    EXPECT_EQ(metrics.GetCounter(DpMetricsCounter::EVENT_TASK_POST_FAILED), 1);
+    metrics.IncreaseCounter(DpMetricsCounter::PROFILE_CACHE_HIT);
+    metrics.IncreaseCounter(DpMetricsCounter::PROFILE_CACHE_MISS);
+    std::string result;
+    metrics.Dump(result);
+    EXPECT_NE(result.find("ProfileCacheHitRate=50%"), std::string::npos);
+    EXPECT_NE(result.find("EventTaskWait: count=1"), std::string::npos);
+}
 }
 }
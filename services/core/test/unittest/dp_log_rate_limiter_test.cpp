@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+#include "distributed_device_profile_log.h"
+#include "dp_log_rate_limiter.h"
+#include "profile_utils.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace DistributedDeviceProfile {
+using namespace std;
+namespace {
+    const std::string TAG = "DpLogRateLimiterTest";
+    const std::string TEST_DEVICE_ID = "4f3a9b1c2d7e8f6a5b4c3d2e1f0a9b8c7d6e5f4a3b2c1d0e9f8a7b6c5d4e3f2a";
+    constexpr int32_t BENCH_CALLS = 100000;
+    constexpr int64_t NS_PER_SECOND = 1000000000;
+}
+
+class DpLogRateLimiterTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+static int64_t GetCallsPerSecond(int64_t costNs)
+{
+    return costNs <= 0 ? BENCH_CALLS * NS_PER_SECOND : BENCH_CALLS * NS_PER_SECOND / costNs;
+}
+
+static int32_t evaluatedCount = 0;
+static const char* CountEvaluation()
+{
+    evaluatedCount++;
+    return "";
+}
+
+/**
+ * @tc.name: TryAcquire001
+ * @tc.desc: a burst gets through, the rest is counted and reported by the next line of the next window
+ * @tc.type: FUNC
+ */
+HWTEST_F(DpLogRateLimiterTest, TryAcquire001, TestSize.Level1)
+{
+    DpLogRateLimiter limiter;
+    uint32_t suppressed = 0;
+    for (uint32_t i = 0; i < DP_LOG_LIMIT_BURST; i++) {
+        EXPECT_TRUE(limiter.TryAcquire(suppressed));
+        EXPECT_EQ(suppressed, 0);
+    }
+    constexpr uint32_t dropped = 5;
+    for (uint32_t i = 0; i < dropped; i++) {
+        EXPECT_FALSE(limiter.TryAcquire(suppressed));
+    }
+    this_thread::sleep_for(chrono::milliseconds(DP_LOG_LIMIT_WINDOW_MS + 10));
+    EXPECT_TRUE(limiter.TryAcquire(suppressed));
+    EXPECT_EQ(suppressed, dropped);
+    EXPECT_TRUE(limiter.TryAcquire(suppressed));
+    EXPECT_EQ(suppressed, 0);
+}
+
+/**
+ * @tc.name: HILOGD001
+ * @tc.desc: DEBUG arguments are never evaluated when debug logs are compiled out
+ * @tc.type: FUNC
+ */
+HWTEST_F(DpLogRateLimiterTest, HILOGD001, TestSize.Level1)
+{
+    evaluatedCount = 0;
+    for (uint32_t i = 0; i < DP_LOG_LIMIT_BURST; i++) {
+        HILOGD("arg: %{public}s", CountEvaluation());
+    }
+    if (!DP_DEBUG_LOG_ENABLED) {
+        EXPECT_EQ(evaluatedCount, 0);
+    }
+}
+
+/**
+ * @tc.name: Benchmark001
+ * @tc.desc: calls per second of a per-IPC INFO line, written every time vs rate limited vs compiled out
+ * @tc.type: PERF
+ */
+HWTEST_F(DpLogRateLimiterTest, Benchmark001, TestSize.Level1)
+{
+    auto start = chrono::steady_clock::now();
+    for (int32_t i = 0; i < BENCH_CALLS; i++) {
+        HILOGI("deviceId: %{public}s", ProfileUtils::GetAnonyString(TEST_DEVICE_ID).c_str());
+    }
+    int64_t alwaysNs = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+    start = chrono::steady_clock::now();
+    for (int32_t i = 0; i < BENCH_CALLS; i++) {
+        HILOGI_LIMIT("deviceId: %{public}s", ProfileUtils::GetAnonyString(TEST_DEVICE_ID).c_str());
+    }
+    int64_t limitedNs = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+    start = chrono::steady_clock::now();
+    for (int32_t i = 0; i < BENCH_CALLS; i++) {
+        HILOGD("deviceId: %{public}s", ProfileUtils::GetAnonyString(TEST_DEVICE_ID).c_str());
+    }
+    int64_t debugNs = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+    HILOGW("calls/s, always: %{public}" PRId64 ", limited: %{public}" PRId64 ", debug: %{public}" PRId64,
+        GetCallsPerSecond(alwaysNs), GetCallsPerSecond(limitedNs), GetCallsPerSecond(debugNs));
+    EXPECT_GT(GetCallsPerSecond(alwaysNs), 0);
+    EXPECT_GT(GetCallsPerSecond(limitedNs), 0);
+    EXPECT_GT(GetCallsPerSecond(debugNs), 0);
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
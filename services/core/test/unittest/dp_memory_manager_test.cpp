@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "dp_memory_manager.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace DistributedDeviceProfile {
+using namespace std;
+namespace {
+    const std::string CHEAP_CACHE = "test.cheap";
+    const std::string COSTLY_CACHE = "test.costly";
+    const std::string REPORT_ONLY_CACHE = "test.reportOnly";
+    constexpr size_t TEST_BUDGET_BYTES = 1000;
+    constexpr uint32_t CHEAP_REBUILD_COST = 1;
+    constexpr uint32_t COSTLY_REBUILD_COST = 2;
+}
+
+// A cache that only counts bytes, trimming frees whatever is asked for up to what it holds.
+struct FakeCache {
+    DpCacheUsage GetUsage()
+    {
+        DpCacheUsage usage;
+        usage.entries = bytes == 0 ? 0 : 1;
+        usage.bytes = bytes;
+        return usage;
+    }
+    size_t Trim(size_t bytesToFree)
+    {
+        trimCount++;
+        size_t freed = bytesToFree < bytes ? bytesToFree : bytes;
+        bytes -= freed;
+        return freed;
+    }
+
+    size_t bytes = 0;
+    int32_t trimCount = 0;
+};
+
+class DpMemoryManagerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp()
+    {
+        DpMemoryManager::GetInstance().SetBudget(TEST_BUDGET_BYTES);
+    }
+    void TearDown()
+    {
+        DpMemoryManager::GetInstance().UnRegisterCache(CHEAP_CACHE);
+        DpMemoryManager::GetInstance().UnRegisterCache(COSTLY_CACHE);
+        DpMemoryManager::GetInstance().UnRegisterCache(REPORT_ONLY_CACHE);
+        DpMemoryManager::GetInstance().SetBudget(DEFAULT_CACHE_BUDGET_BYTES);
+    }
+
+    void Register(FakeCache& cache, const std::string& name, uint32_t rebuildCost)
+    {
+        DpMemoryManager::GetInstance().RegisterCache(name, [&cache]() { return cache.GetUsage(); },
+            [&cache](size_t bytesToFree) { return cache.Trim(bytesToFree); }, rebuildCost);
+    }
+};
+
+/**
+ * @tc.name: CheckBudget001
+ * @tc.desc: within the budget nothing is trimmed, over it the cheapest cache is trimmed first
+ * @tc.type: FUNC
+ */
+HWTEST_F(DpMemoryManagerTest, CheckBudget001, TestSize.Level1)
+{
+    FakeCache cheap;
+    FakeCache costly;
+    Register(cheap, CHEAP_CACHE, CHEAP_REBUILD_COST);
+    Register(costly, COSTLY_CACHE, COSTLY_REBUILD_COST);
+    cheap.bytes = 400;
+    costly.bytes = 500;
+    EXPECT_EQ(DpMemoryManager::GetInstance().CheckBudget(), 0);
+    EXPECT_EQ(cheap.trimCount, 0);
+
+    cheap.bytes = 600;
+    // 1100 bytes held, trimmed down to 80 percent of the budget
+    EXPECT_EQ(DpMemoryManager::GetInstance().CheckBudget(), 300);
+    EXPECT_EQ(cheap.bytes, 300);
+    EXPECT_EQ(costly.trimCount, 0);
+
+    cheap.bytes = 100;
+    costly.bytes = 1000;
+    EXPECT_EQ(DpMemoryManager::GetInstance().CheckBudget(), 300);
+    EXPECT_EQ(cheap.bytes, 0);
+    EXPECT_EQ(costly.bytes, 800);
+    EXPECT_EQ(DpMemoryManager::GetInstance().GetTotalUsage().bytes, 800);
+}
+
+/**
+ * @tc.name: OnCacheGrown001
+ * @tc.desc: the budget is checked once the reported growth reaches its step, not on every insert
+ * @tc.type: FUNC
+ */
+HWTEST_F(DpMemoryManagerTest, OnCacheGrown001, TestSize.Level1)
+{
+    FakeCache cheap;
+    Register(cheap, CHEAP_CACHE, CHEAP_REBUILD_COST);
+    DpMemoryManager::GetInstance().CheckBudget();
+    // the step is 50 bytes of the 1000 byte budget
+    cheap.bytes = 1020;
+    EXPECT_EQ(DpMemoryManager::GetInstance().OnCacheGrown(20), 0);
+    EXPECT_EQ(cheap.trimCount, 0);
+    cheap.bytes = 1050;
+    EXPECT_EQ(DpMemoryManager::GetInstance().OnCacheGrown(30), 250);
+    EXPECT_EQ(cheap.bytes, 800);
+    // the check restarts the count
+    cheap.bytes = 1200;
+    EXPECT_EQ(DpMemoryManager::GetInstance().OnCacheGrown(400), 400);
+    cheap.bytes = 1010;
+    EXPECT_EQ(DpMemoryManager::GetInstance().OnCacheGrown(10), 0);
+}
+
+/**
+ * @tc.name: TrimAll001
+ * @tc.desc: memory pressure empties every trimmable cache, report only caches keep their entries
+ * @tc.type: FUNC
+ */
+HWTEST_F(DpMemoryManagerTest, TrimAll001, TestSize.Level1)
+{
+    FakeCache cheap;
+    FakeCache costly;
+    FakeCache reportOnly;
+    Register(cheap, CHEAP_CACHE, CHEAP_REBUILD_COST);
+    Register(costly, COSTLY_CACHE, COSTLY_REBUILD_COST);
+    DpMemoryManager::GetInstance().RegisterCache(REPORT_ONLY_CACHE,
+        [&reportOnly]() { return reportOnly.GetUsage(); });
+    cheap.bytes = 100;
+    costly.bytes = 200;
+    reportOnly.bytes = 2000;
+    EXPECT_EQ(DpMemoryManager::GetInstance().TrimAll(), 300);
+    EXPECT_EQ(cheap.bytes, 0);
+    EXPECT_EQ(costly.bytes, 0);
+    EXPECT_EQ(reportOnly.bytes, 2000);
+    EXPECT_EQ(DpMemoryManager::GetInstance().CheckBudget(), 0);
+    EXPECT_EQ(DpMemoryManager::GetInstance().GetTotalUsage().bytes, 2000);
+
+    DpMemoryManager::GetInstance().UnRegisterCache(REPORT_ONLY_CACHE);
+    EXPECT_EQ(DpMemoryManager::GetInstance().GetTotalUsage().bytes, 0);
+    DpMemoryManager::GetInstance().RegisterCache("", [&reportOnly]() { return reportOnly.GetUsage(); });
+    DpMemoryManager::GetInstance().RegisterCache(REPORT_ONLY_CACHE, nullptr);
+    EXPECT_EQ(DpMemoryManager::GetInstance().GetTotalUsage().bytes, 0);
+}
+
+/**
+ * @tc.name: Dump001
+ * @tc.desc: the dump lists every cache with its usage and the total against the budget
+ * @tc.type: FUNC
+ */
+HWTEST_F(DpMemoryManagerTest, Dump001, TestSize.Level1)
+{
+    FakeCache cheap;
+    FakeCache reportOnly;
+    Register(cheap, CHEAP_CACHE, CHEAP_REBUILD_COST);
+    DpMemoryManager::GetInstance().RegisterCache(REPORT_ONLY_CACHE,
+        [&reportOnly]() { return reportOnly.GetUsage(); });
+    cheap.bytes = 10;
+    reportOnly.bytes = 20;
+    string result;
+    DpMemoryManager::GetInstance().Dump(result);
+    EXPECT_NE(result.find(CHEAP_CACHE + ": entries=1, bytes=10, trimmable\n"), string::npos);
+    EXPECT_NE(result.find(REPORT_ONLY_CACHE + ": entries=1, bytes=20\n"), string::npos);
+    EXPECT_NE(result.find("total: entries=2, bytes=30, budget=1000\n"), string::npos);
+}
+
+/**
+ * @tc.name: EstimateUsage001
+ * @tc.desc: strings count their heap buffer only when they do not fit inline
+ * @tc.type: FUNC
+ */
+HWTEST_F(DpMemoryManagerTest, EstimateUsage001, TestSize.Level1)
+{
+    EXPECT_EQ(DpMemoryManager::EstimateBytes(""), 0);
+    string longStr(std::string().capacity() + 1, 'a');
+    EXPECT_EQ(DpMemoryManager::EstimateBytes(longStr), longStr.size() + 1);
+    map<string, string> entries = { { "key", longStr } };
+    DpCacheUsage usage = DpMemoryManager::EstimateUsage(entries);
+    EXPECT_EQ(usage.entries, 1);
+    EXPECT_EQ(usage.bytes, CACHE_NODE_OVERHEAD_BYTES + 2 * sizeof(string) + longStr.size() + 1);
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
@@ -202,5 +202,74 @@ HWTEST_F(IpcUtilsTest, Marshalling_007, TestSize.Level1)
     ret = IpcUtils::UnMarshalling(parcel, changeTypes);
     EXPECT_EQ(ret, true);
 }
+
+/*
+ * @tc.name: Marshalling_008
+ * @tc.desc: batch queries and per-item acl lists survive a round trip, empty items included
+ * @tc.type: FUNC
+ */
+HWTEST_F(IpcUtilsTest, Marshalling_008, TestSize.Level1)
+{
+    OHOS::MessageParcel parcel;
+    std::vector<std::map<std::string, std::string>> paramsList;
+    EXPECT_FALSE(IpcUtils::Marshalling(parcel, paramsList));
+    paramsList.push_back({{"userId", "100"}});
+    paramsList.push_back({{"trustDeviceId", "deviceId"}, {"status", "1"}});
+    EXPECT_TRUE(IpcUtils::Marshalling(parcel, paramsList));
+    std::vector<std::map<std::string, std::string>> outParamsList;
+    EXPECT_TRUE(IpcUtils::UnMarshalling(parcel, outParamsList));
+    EXPECT_EQ(outParamsList, paramsList);
+
+    std::vector<std::vector<AccessControlProfile>> aclProfilesList(paramsList.size());
+    AccessControlProfile aclProfile;
+    aclProfile.SetAccessControlId(1);
+    aclProfilesList[1].push_back(aclProfile);
+    EXPECT_TRUE(IpcUtils::Marshalling(parcel, aclProfilesList));
+    std::vector<std::vector<AccessControlProfile>> outAclProfilesList;
+    EXPECT_TRUE(IpcUtils::UnMarshalling(parcel, outAclProfilesList));
+    ASSERT_EQ(outAclProfilesList.size(), aclProfilesList.size());
+    EXPECT_TRUE(outAclProfilesList[0].empty());
+    ASSERT_EQ(outAclProfilesList[1].size(), 1);
+    EXPECT_EQ(outAclProfilesList[1][0].GetAccessControlId(), 1);
+
+    std::vector<std::map<std::string, std::string>> tooManyParams(MAX_BATCH_QUERY_SIZE + 1, {{"userId", "100"}});
+    EXPECT_FALSE(IpcUtils::Marshalling(parcel, tooManyParams));
+}
+
+/*
+ * @tc.name: Marshalling_009
+ * @tc.desc: icon infos sharing icons survive a round trip and each distinct icon is sent once
+ * @tc.type: FUNC
+ */
+HWTEST_F(IpcUtilsTest, Marshalling_009, TestSize.Level1)
+{
+    constexpr size_t infoCount = 30;
+    constexpr size_t distinctIconCount = 3;
+    constexpr size_t iconSize = 4096;
+    std::vector<DeviceIconInfo> deviceIconInfos;
+    size_t naiveIconBytes = 0;
+    for (size_t i = 0; i < infoCount; i++) {
+        DeviceIconInfo deviceIconInfo;
+        deviceIconInfo.SetProductId("productId" + std::to_string(i));
+        deviceIconInfo.SetImageType("imageType");
+        // every tenth info has no icon
+        if (i % 10 != 0) {
+            deviceIconInfo.SetIcon(std::vector<uint8_t>(iconSize, static_cast<uint8_t>(i % distinctIconCount)));
+            naiveIconBytes += iconSize;
+        }
+        deviceIconInfos.emplace_back(deviceIconInfo);
+    }
+    OHOS::MessageParcel parcel;
+    EXPECT_TRUE(IpcUtils::Marshalling(parcel, deviceIconInfos));
+    std::cout << "icon bytes: " << naiveIconBytes << ", parcel bytes: " << parcel.GetDataSize() << std::endl;
+    constexpr size_t maxMetaBytes = 256;
+    EXPECT_LT(parcel.GetDataSize(), distinctIconCount * iconSize + infoCount * maxMetaBytes);
+    std::vector<DeviceIconInfo> outDeviceIconInfos;
+    EXPECT_TRUE(IpcUtils::UnMarshalling(parcel, outDeviceIconInfos));
+    ASSERT_EQ(outDeviceIconInfos.size(), deviceIconInfos.size());
+    for (size_t i = 0; i < infoCount; i++) {
+        EXPECT_FALSE(outDeviceIconInfos[i] != deviceIconInfos[i]);
+    }
+}
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
@@ -561,5 +561,47 @@ HWTEST_F(LocalServiceInfoManagerTest, PutLocalServiceInfo009, TestSize.Level1)
     int32_t result = LocalServiceInfoManager::GetInstance().PutLocalServiceInfo(localServiceInfo);
     EXPECT_NE(result, DP_CACHE_EXIST);
 }
+
+/*
+ * @tc.name: GetLocalServiceInfoByBundleAndPinType006
+ * @tc.desc: lookups are cached, misses included, and writes keep the cache coherent
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(LocalServiceInfoManagerTest, GetLocalServiceInfoByBundleAndPinType006, TestSize.Level1)
+{
+    LocalServiceInfoManager& manager = LocalServiceInfoManager::GetInstance();
+    manager.Init();
+    std::string bundleName = "cache.test.bundle";
+    int32_t pinExchangeType = 1;
+    manager.DeleteLocalServiceInfo(bundleName, pinExchangeType);
+    LocalServiceInfo resultInfo;
+    EXPECT_EQ(manager.GetLocalServiceInfoByBundleAndPinType(bundleName, pinExchangeType, resultInfo),
+        DP_NOT_FIND_DATA);
+    auto iter = manager.cache_.find({bundleName, pinExchangeType});
+    ASSERT_NE(iter, manager.cache_.end());
+    EXPECT_FALSE(iter->second.isExist);
+
+    LocalServiceInfo localServiceInfo;
+    localServiceInfo.SetBundleName(bundleName);
+    localServiceInfo.SetPinExchangeType(pinExchangeType);
+    localServiceInfo.SetDescription("first");
+    EXPECT_EQ(manager.PutLocalServiceInfo(localServiceInfo), DP_SUCCESS);
+    EXPECT_EQ(manager.GetLocalServiceInfoByBundleAndPinType(bundleName, pinExchangeType, resultInfo), DP_SUCCESS);
+    EXPECT_EQ(resultInfo.GetDescription(), "first");
+    localServiceInfo.SetDescription("second");
+    EXPECT_EQ(manager.UpdateLocalServiceInfo(localServiceInfo), DP_SUCCESS);
+    EXPECT_EQ(manager.GetLocalServiceInfoByBundleAndPinType(bundleName, pinExchangeType, resultInfo), DP_SUCCESS);
+    EXPECT_EQ(resultInfo.GetDescription(), "second");
+    EXPECT_EQ(manager.DeleteLocalServiceInfo(bundleName, pinExchangeType), DP_SUCCESS);
+    EXPECT_EQ(manager.GetLocalServiceInfoByBundleAndPinType(bundleName, pinExchangeType, resultInfo),
+        DP_NOT_FIND_DATA);
+
+    for (int32_t i = 0; i < 100; i++) {
+        manager.GetLocalServiceInfoByBundleAndPinType("missing.bundle" + std::to_string(i), 1, resultInfo);
+    }
+    EXPECT_LE(manager.cache_.size(), 64);
+    EXPECT_EQ(manager.cache_.size(), manager.cacheLru_.size());
+}
 }  // namespace DistributedDeviceProfile
 }  // namespace OHOS
\ No newline at end of file
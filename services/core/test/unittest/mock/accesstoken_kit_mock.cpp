@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accesstoken_kit_mock.h"
+
+namespace OHOS {
+namespace Security {
+namespace AccessToken {
+using OHOS::DistributedDeviceProfile::AccessTokenKitMock;
+
+ATokenTypeEnum AccessTokenKit::GetTokenTypeFlag(AccessTokenID tokenID)
+{
+    AccessTokenKitMock::GetInstance().getTokenTypeCount++;
+    return AccessTokenKitMock::GetInstance().tokenType;
+}
+
+int AccessTokenKit::VerifyAccessToken(AccessTokenID tokenID, const std::string& permissionName)
+{
+    AccessTokenKitMock::GetInstance().verifyCount++;
+    return AccessTokenKitMock::GetInstance().permissionState;
+}
+
+int AccessTokenKit::GetNativeTokenInfo(AccessTokenID tokenID, NativeTokenInfo& nativeTokenInfoRes)
+{
+    AccessTokenKitMock::GetInstance().getNativeTokenInfoCount++;
+    if (AccessTokenKitMock::GetInstance().nativeTokenInfoRet != RET_SUCCESS) {
+        return AccessTokenKitMock::GetInstance().nativeTokenInfoRet;
+    }
+    nativeTokenInfoRes.processName = AccessTokenKitMock::GetInstance().processName;
+    return RET_SUCCESS;
+}
+
+int32_t AccessTokenKit::RegisterPermStateChangeCallback(
+    const std::shared_ptr<PermStateChangeCallbackCustomize>& callback)
+{
+    AccessTokenKitMock::GetInstance().permStateCallback = callback;
+    return RET_SUCCESS;
+}
+
+int32_t AccessTokenKit::UnRegisterPermStateChangeCallback(
+    const std::shared_ptr<PermStateChangeCallbackCustomize>& callback)
+{
+    AccessTokenKitMock::GetInstance().permStateCallback = nullptr;
+    return RET_SUCCESS;
+}
+} // namespace AccessToken
+} // namespace Security
+} // namespace OHOS
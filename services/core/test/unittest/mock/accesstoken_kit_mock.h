@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_UTTEST_ACCESSTOKEN_KIT_MOCK_H
+#define OHOS_UTTEST_ACCESSTOKEN_KIT_MOCK_H
+
+#include <memory>
+#include <string>
+#include "accesstoken_kit.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+// Replaces the AccessTokenKit entries PermissionManager uses and counts the calls that reach them.
+struct AccessTokenKitMock {
+    static AccessTokenKitMock& GetInstance()
+    {
+        static AccessTokenKitMock instance;
+        return instance;
+    }
+
+    void Reset()
+    {
+        tokenType = Security::AccessToken::ATokenTypeEnum::TOKEN_NATIVE;
+        permissionState = Security::AccessToken::PermissionState::PERMISSION_GRANTED;
+        processName = "deviceprofile_test";
+        nativeTokenInfoRet = Security::AccessToken::RET_SUCCESS;
+        getTokenTypeCount = 0;
+        verifyCount = 0;
+        getNativeTokenInfoCount = 0;
+    }
+
+    Security::AccessToken::ATokenTypeEnum tokenType = Security::AccessToken::ATokenTypeEnum::TOKEN_NATIVE;
+    int32_t permissionState = Security::AccessToken::PermissionState::PERMISSION_GRANTED;
+    std::string processName = "deviceprofile_test";
+    int nativeTokenInfoRet = Security::AccessToken::RET_SUCCESS;
+    int32_t getTokenTypeCount = 0;
+    int32_t verifyCount = 0;
+    int32_t getNativeTokenInfoCount = 0;
+    std::shared_ptr<Security::AccessToken::PermStateChangeCallbackCustomize> permStateCallback = nullptr;
+};
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
+#endif // OHOS_UTTEST_ACCESSTOKEN_KIT_MOCK_H
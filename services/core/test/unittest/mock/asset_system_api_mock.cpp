@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "asset_system_api_mock.h"
+
+#include "securec.h"
+
+using OHOS::DistributedDeviceProfile::AssetSystemApiMock;
+
+namespace {
+bool GetQueryKey(const AssetAttr* attrs, uint32_t attrCnt, std::pair<uint32_t, int32_t>& key)
+{
+    bool hasAlias = false;
+    bool hasUserId = false;
+    for (uint32_t i = 0; i < attrCnt; i++) {
+        if (attrs[i].tag == SEC_ASSET_TAG_ALIAS && attrs[i].value.blob.size == sizeof(int32_t)) {
+            (void)memcpy_s(&key.second, sizeof(int32_t), attrs[i].value.blob.data, sizeof(int32_t));
+            hasAlias = true;
+        }
+        if (attrs[i].tag == SEC_ASSET_TAG_USER_ID) {
+            key.first = attrs[i].value.u32;
+            hasUserId = true;
+        }
+    }
+    return hasAlias && hasUserId;
+}
+
+const AssetAttr* FindAttr(const AssetAttr* attrs, uint32_t attrCnt, uint32_t tag)
+{
+    for (uint32_t i = 0; i < attrCnt; i++) {
+        if (attrs[i].tag == tag) {
+            return &attrs[i];
+        }
+    }
+    return nullptr;
+}
+
+std::vector<uint8_t> ToVector(const AssetBlob& blob)
+{
+    return std::vector<uint8_t>(blob.data, blob.data + blob.size);
+}
+}
+
+int32_t AssetAdd(const AssetAttr* attributes, uint32_t attrCnt)
+{
+    auto& mock = AssetSystemApiMock::GetInstance();
+    mock.addCount++;
+    std::pair<uint32_t, int32_t> key;
+    const AssetAttr* secret = FindAttr(attributes, attrCnt, SEC_ASSET_TAG_SECRET);
+    if (!GetQueryKey(attributes, attrCnt, key) || secret == nullptr) {
+        return SEC_ASSET_INVALID_ARGUMENT;
+    }
+    if (mock.secrets.count(key) != 0) {
+        return SEC_ASSET_DUPLICATED;
+    }
+    mock.secrets[key] = ToVector(secret->value.blob);
+    return SEC_ASSET_SUCCESS;
+}
+
+int32_t AssetUpdate(const AssetAttr* query, uint32_t queryCnt, const AssetAttr* attributesToUpdate,
+    uint32_t updateCnt)
+{
+    auto& mock = AssetSystemApiMock::GetInstance();
+    mock.updateCount++;
+    std::pair<uint32_t, int32_t> key;
+    const AssetAttr* secret = FindAttr(attributesToUpdate, updateCnt, SEC_ASSET_TAG_SECRET);
+    if (!GetQueryKey(query, queryCnt, key) || secret == nullptr) {
+        return SEC_ASSET_INVALID_ARGUMENT;
+    }
+    if (mock.secrets.count(key) == 0) {
+        return SEC_ASSET_NOT_FOUND;
+    }
+    mock.secrets[key] = ToVector(secret->value.blob);
+    return SEC_ASSET_SUCCESS;
+}
+
+int32_t AssetQuery(const AssetAttr* query, uint32_t queryCnt, AssetResultSet* resultSet)
+{
+    auto& mock = AssetSystemApiMock::GetInstance();
+    mock.queryCount++;
+    std::pair<uint32_t, int32_t> key;
+    if (!GetQueryKey(query, queryCnt, key) || resultSet == nullptr) {
+        return SEC_ASSET_INVALID_ARGUMENT;
+    }
+    auto iter = mock.secrets.find(key);
+    if (iter == mock.secrets.end()) {
+        return SEC_ASSET_NOT_FOUND;
+    }
+    uint8_t* data = new uint8_t[iter->second.size()];
+    (void)memcpy_s(data, iter->second.size(), iter->second.data(), iter->second.size());
+    AssetAttr* attrs = new AssetAttr[1];
+    attrs[0].tag = SEC_ASSET_TAG_SECRET;
+    attrs[0].value.blob = { static_cast<uint32_t>(iter->second.size()), data };
+    resultSet->count = 1;
+    resultSet->results = new AssetResult[1];
+    resultSet->results[0].count = 1;
+    resultSet->results[0].attrs = attrs;
+    return SEC_ASSET_SUCCESS;
+}
+
+int32_t AssetRemove(const AssetAttr* query, uint32_t queryCnt)
+{
+    auto& mock = AssetSystemApiMock::GetInstance();
+    mock.removeCount++;
+    std::pair<uint32_t, int32_t> key;
+    if (!GetQueryKey(query, queryCnt, key) || mock.secrets.erase(key) == 0) {
+        return SEC_ASSET_NOT_FOUND;
+    }
+    return SEC_ASSET_SUCCESS;
+}
+
+AssetAttr* AssetParseAttr(const AssetResult* result, AssetTag tag)
+{
+    if (result == nullptr) {
+        return nullptr;
+    }
+    for (uint32_t i = 0; i < result->count; i++) {
+        if (result->attrs[i].tag == static_cast<uint32_t>(tag)) {
+            return &result->attrs[i];
+        }
+    }
+    return nullptr;
+}
+
+void AssetFreeResultSet(AssetResultSet* resultSet)
+{
+    if (resultSet == nullptr || resultSet->results == nullptr) {
+        return;
+    }
+    for (uint32_t i = 0; i < resultSet->count; i++) {
+        for (uint32_t j = 0; j < resultSet->results[i].count; j++) {
+            delete[] resultSet->results[i].attrs[j].value.blob.data;
+        }
+        delete[] resultSet->results[i].attrs;
+    }
+    delete[] resultSet->results;
+    resultSet->results = nullptr;
+    resultSet->count = 0;
+}
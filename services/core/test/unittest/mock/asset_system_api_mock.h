@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_UTTEST_ASSET_SYSTEM_API_MOCK_H
+#define OHOS_UTTEST_ASSET_SYSTEM_API_MOCK_H
+
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+#include "asset_system_api.h"
+#include "asset_system_type.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+// Replaces the asset entries AssetAdapter uses with an in-memory store and counts the calls that reach it.
+struct AssetSystemApiMock {
+    static AssetSystemApiMock& GetInstance()
+    {
+        static AssetSystemApiMock instance;
+        return instance;
+    }
+
+    void Reset()
+    {
+        secrets.clear();
+        addCount = 0;
+        updateCount = 0;
+        queryCount = 0;
+        removeCount = 0;
+    }
+
+    // (userId, sessionKeyId) -> secret
+    std::map<std::pair<uint32_t, int32_t>, std::vector<uint8_t>> secrets;
+    int32_t addCount = 0;
+    int32_t updateCount = 0;
+    int32_t queryCount = 0;
+    int32_t removeCount = 0;
+};
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
+#endif // OHOS_UTTEST_ASSET_SYSTEM_API_MOCK_H
@@ -44,6 +44,8 @@ public:
     MOCK_METHOD(int32_t, GetAllTrustDeviceProfile, (std::vector<TrustDeviceProfile>&), (override));
     MOCK_METHOD(int32_t, GetAccessControlProfile,
         ((std::map<std::string, std::string>), (std::vector<AccessControlProfile>&)), (override));
+    MOCK_METHOD(int32_t, GetAccessControlProfileBatch, ((const std::vector<std::map<std::string, std::string>>&),
+        (std::vector<std::vector<AccessControlProfile>>&), std::vector<int32_t>&), (override));
     MOCK_METHOD(int32_t, GetAllAccessControlProfile, (std::vector<AccessControlProfile>&), (override));
     MOCK_METHOD(int32_t, GetAllAclIncludeLnnAcl, (std::vector<AccessControlProfile>&), (override));
     MOCK_METHOD(int32_t, DeleteAccessControlProfile, (int32_t), (override));
@@ -70,6 +72,8 @@ public:
         (const std::string&, const std::string&, ServiceProfile&), (override));
     MOCK_METHOD(int32_t, GetCharacteristicProfile,
         (const std::string&, const std::string&, const std::string&, CharacteristicProfile&), (override));
+    MOCK_METHOD(int32_t, GetCharacteristicProfileBatch, (const std::vector<CharacteristicProfile>&,
+        std::vector<CharacteristicProfile>&, std::vector<int32_t>&), (override));
     MOCK_METHOD(int32_t, DeleteServiceProfile,
         (const std::string&, const std::string&, bool, int32_t), (override));
     MOCK_METHOD(int32_t, DeleteCharacteristicProfile,
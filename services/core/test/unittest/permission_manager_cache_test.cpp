@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "nativetoken_kit.h"
+#include "token_setproc.h"
+
+#include "distributed_device_profile_constants.h"
+#include "distributed_device_profile_errors.h"
+#include "mock/accesstoken_kit_mock.h"
+#include "permission_manager.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+using namespace testing::ext;
+using namespace OHOS::Security::AccessToken;
+using namespace std;
+namespace {
+    const std::string TEST_PROC_NAME = "deviceprofile_test";
+    const int32_t CALL_TIMES = 10;
+}
+class PermissionManagerCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void PermissionManagerCacheTest::SetUpTestCase()
+{
+    NativeTokenInfoParams infoInstance = {
+        .dcapsNum = 0,
+        .permsNum = 0,
+        .aclsNum = 0,
+        .dcaps = nullptr,
+        .perms = nullptr,
+        .acls = nullptr,
+        .processName = "deviceprofile_test",
+        .aplStr = "system_core",
+    };
+    SetSelfTokenID(GetAccessTokenId(&infoInstance));
+}
+
+void PermissionManagerCacheTest::TearDownTestCase()
+{
+}
+
+void PermissionManagerCacheTest::SetUp()
+{
+    AccessTokenKitMock::GetInstance().Reset();
+    PermissionManager::GetInstance().ClearCallerCache();
+    PermissionManager::GetInstance().permissionMap_[GET_CHARACTERISTIC_PROFILE] = { TEST_PROC_NAME };
+}
+
+void PermissionManagerCacheTest::TearDown()
+{
+    PermissionManager::GetInstance().UnInit();
+}
+
+/*
+ * @tc.name: IsCallerTrust_001
+ * @tc.desc: repeated checks of one interface reach AccessTokenKit once
+ * @tc.type: FUNC
+ */
+HWTEST_F(PermissionManagerCacheTest, IsCallerTrust_001, TestSize.Level1)
+{
+    for (int32_t i = 0; i < CALL_TIMES; i++) {
+        EXPECT_TRUE(PermissionManager::GetInstance().IsCallerTrust(GET_CHARACTERISTIC_PROFILE));
+    }
+    EXPECT_EQ(AccessTokenKitMock::GetInstance().getTokenTypeCount, 1);
+    EXPECT_EQ(AccessTokenKitMock::GetInstance().getNativeTokenInfoCount, 1);
+}
+
+/*
+ * @tc.name: IsCallerTrust_002
+ * @tc.desc: denials are cached per interface and do not leak to other interfaces
+ * @tc.type: FUNC
+ */
+HWTEST_F(PermissionManagerCacheTest, IsCallerTrust_002, TestSize.Level1)
+{
+    for (int32_t i = 0; i < CALL_TIMES; i++) {
+        EXPECT_FALSE(PermissionManager::GetInstance().IsCallerTrust(PUT_CHARACTERISTIC_PROFILE));
+    }
+    EXPECT_TRUE(PermissionManager::GetInstance().IsCallerTrust(GET_CHARACTERISTIC_PROFILE));
+    EXPECT_EQ(AccessTokenKitMock::GetInstance().getTokenTypeCount, 2);
+}
+
+/*
+ * @tc.name: IsCallerTrust_003
+ * @tc.desc: a deny caused by a failed token lookup is not cached
+ * @tc.type: FUNC
+ */
+HWTEST_F(PermissionManagerCacheTest, IsCallerTrust_003, TestSize.Level1)
+{
+    AccessTokenKitMock::GetInstance().nativeTokenInfoRet = RET_FAILED;
+    EXPECT_FALSE(PermissionManager::GetInstance().IsCallerTrust(GET_CHARACTERISTIC_PROFILE));
+    AccessTokenKitMock::GetInstance().nativeTokenInfoRet = RET_SUCCESS;
+    EXPECT_TRUE(PermissionManager::GetInstance().IsCallerTrust(GET_CHARACTERISTIC_PROFILE));
+    EXPECT_TRUE(PermissionManager::GetInstance().IsCallerTrust(GET_CHARACTERISTIC_PROFILE));
+    EXPECT_EQ(AccessTokenKitMock::GetInstance().getNativeTokenInfoCount, 2);
+
+    AccessTokenKitMock::GetInstance().tokenType = ATokenTypeEnum::TOKEN_INVALID;
+    EXPECT_FALSE(PermissionManager::GetInstance().IsCallerTrust(PUT_CHARACTERISTIC_PROFILE));
+    AccessTokenKitMock::GetInstance().tokenType = ATokenTypeEnum::TOKEN_NATIVE;
+    EXPECT_FALSE(PermissionManager::GetInstance().IsCallerTrust(PUT_CHARACTERISTIC_PROFILE));
+    EXPECT_FALSE(PermissionManager::GetInstance().IsCallerTrust(PUT_CHARACTERISTIC_PROFILE));
+    EXPECT_EQ(AccessTokenKitMock::GetInstance().getTokenTypeCount, 4);
+}
+
+/*
+ * @tc.name: CheckCallerPermission_001
+ * @tc.desc: access and sync permission decisions are cached separately
+ * @tc.type: FUNC
+ */
+HWTEST_F(PermissionManagerCacheTest, CheckCallerPermission_001, TestSize.Level1)
+{
+    for (int32_t i = 0; i < CALL_TIMES; i++) {
+        EXPECT_TRUE(PermissionManager::GetInstance().CheckCallerPermission());
+        EXPECT_TRUE(PermissionManager::GetInstance().CheckCallerSyncPermission());
+    }
+    EXPECT_EQ(AccessTokenKitMock::GetInstance().verifyCount, 2);
+    EXPECT_EQ(AccessTokenKitMock::GetInstance().getNativeTokenInfoCount, 1);
+}
+
+/*
+ * @tc.name: CheckCallerPermission_002
+ * @tc.desc: a permission change of the caller drops its cached decisions
+ * @tc.type: FUNC
+ */
+HWTEST_F(PermissionManagerCacheTest, CheckCallerPermission_002, TestSize.Level1)
+{
+    EXPECT_TRUE(PermissionManager::GetInstance().CheckCallerPermission());
+    AccessTokenKitMock::GetInstance().permissionState = PermissionState::PERMISSION_DENIED;
+    EXPECT_TRUE(PermissionManager::GetInstance().CheckCallerPermission());
+
+    PermStateChangeInfo changeInfo;
+    changeInfo.tokenID = static_cast<AccessTokenID>(GetSelfTokenID());
+    PermissionManager::GetInstance().RegisterPermStateChangeCallback();
+    ASSERT_NE(AccessTokenKitMock::GetInstance().permStateCallback, nullptr);
+    AccessTokenKitMock::GetInstance().permStateCallback->PermStateChangeCallback(changeInfo);
+    EXPECT_FALSE(PermissionManager::GetInstance().CheckCallerPermission());
+    EXPECT_EQ(AccessTokenKitMock::GetInstance().verifyCount, 2);
+}
+
+/*
+ * @tc.name: CheckCallerPermission_003
+ * @tc.desc: expired decisions are verified again
+ * @tc.type: FUNC
+ */
+HWTEST_F(PermissionManagerCacheTest, CheckCallerPermission_003, TestSize.Level1)
+{
+    EXPECT_TRUE(PermissionManager::GetInstance().CheckCallerPermission());
+    for (auto& item : PermissionManager::GetInstance().decisionCache_) {
+        item.second.expireTimeMs = 0;
+    }
+    EXPECT_TRUE(PermissionManager::GetInstance().CheckCallerPermission());
+    EXPECT_EQ(AccessTokenKitMock::GetInstance().verifyCount, 2);
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
@@ -16,11 +16,11 @@
 #define private   public
 #define protected public
 #include "content_sensor_manager_utils.h"
+#include "dp_string_pool.h"
 #include "gtest/gtest.h"
 #include "profile_cache.h"
 #include "profile_utils.h"
 #include "i_sync_completed_callback.h"
-#include "sync_completed_callback_stub.h"
 #include "trusted_device_info.h"
 #undef private
 #undef protected
@@ -30,6 +30,9 @@ namespace DistributedDeviceProfile {
 using namespace testing;
 using namespace testing::ext;
 using namespace std;
+namespace {
+    const std::string TAG = "ProfileCacheTest";
+}
 
 class ProfileCacheTest : public testing::Test {
 public:
@@ -51,12 +54,6 @@ void ProfileCacheTest::SetUp() {
 void ProfileCacheTest::TearDown() {
 }
 
-class SyncCallback : public SyncCompletedCallbackStub {
-public:
-    void OnSyncCompleted(const map<string, SyncStatus>& syncResults) {
-    }
-};
-
 HWTEST_F(ProfileCacheTest, AddDeviceProfile_001, TestSize.Level2)
 {
     DeviceProfile deviceProfile;
@@ -416,152 +413,6 @@ HWTEST_F(ProfileCacheTest, RefreshCharProfileCache_001, TestSize.Level2)
     EXPECT_EQ(DP_SUCCESS, ret);
 }
 
-/**
- * @tc.name: AddSyncListener001
- * @tc.desc: AddSyncListener all.
- * @tc.type: FUNC
- * @tc.require:
- */
-HWTEST_F(ProfileCacheTest, AddSyncListener001, TestSize.Level1)
-{
-    ProfileCache::GetInstance().UnInit();
-    ProfileCache::GetInstance().Init();
-    string caller = "caller";
-    OHOS::sptr<OHOS::IRemoteObject> syncListener = OHOS::sptr<SyncCompletedCallbackStub>(new SyncCallback());
-
-    int32_t ret1 = ProfileCache::GetInstance().AddSyncListener(caller, syncListener);
-    EXPECT_EQ(DP_SUCCESS, ret1);
-
-    for (int32_t i = 0; i < MAX_LISTENER_SIZE + 5; i++) {
-        string caller = "caller" + std::to_string(i);
-        OHOS::sptr<OHOS::IRemoteObject> syncListener1 = OHOS::sptr<SyncCompletedCallbackStub>(new SyncCallback());
-        ProfileCache::GetInstance().syncListenerMap_[caller] = syncListener1;
-    }
-    int32_t ret2 = ProfileCache::GetInstance().AddSyncListener(caller, syncListener);
-    EXPECT_EQ(DP_EXCEED_MAX_SIZE_FAIL, ret2);
-
-    syncListener = nullptr;
-    int32_t ret3 = ProfileCache::GetInstance().AddSyncListener(caller, syncListener);
-    EXPECT_EQ(DP_INVALID_PARAMS, ret3);
-
-    for (int32_t i = 0; i < MAX_STRING_LEN + 5; i++) {
-        caller += 'a';
-    }
-    int32_t ret4 = ProfileCache::GetInstance().AddSyncListener(caller, syncListener);
-    EXPECT_EQ(DP_INVALID_PARAMS, ret4);
-
-    caller = "";
-    int32_t ret5 = ProfileCache::GetInstance().AddSyncListener(caller, syncListener);
-    EXPECT_EQ(DP_INVALID_PARAMS, ret5);
-
-    ProfileCache::GetInstance().UnInit();
-    ProfileCache::GetInstance().Init();
-}
-
-/**
- * @tc.name: RemoveSyncListeners001
- * @tc.desc: RemoveSyncListeners all.
- * @tc.type: FUNC
- * @tc.require:
- */
-HWTEST_F(ProfileCacheTest, RemoveSyncListeners001, TestSize.Level1)
-{
-    ProfileCache::GetInstance().UnInit();
-    ProfileCache::GetInstance().Init();
-    ProfileCache::GetInstance().syncListenerMap_.clear();
-
-    string caller = "caller";
-    OHOS::sptr<OHOS::IRemoteObject> syncListener = OHOS::sptr<SyncCompletedCallbackStub>(new SyncCallback());
-
-    int32_t ret1 = ProfileCache::GetInstance().AddSyncListener(caller, syncListener);
-    EXPECT_EQ(DP_SUCCESS, ret1);
-
-    map<string, sptr<IRemoteObject>> syncListeners;
-    syncListeners[caller] = syncListener;
-    int32_t ret2 = ProfileCache::GetInstance().RemoveSyncListeners(syncListeners);
-    EXPECT_EQ(DP_SUCCESS, ret2);
-
-    ProfileCache::GetInstance().AddSyncListener(caller, syncListener);
-    auto iter = ProfileCache::GetInstance().syncListenerMap_.begin();
-    iter->second = nullptr;
-    ProfileCache::GetInstance().RemoveSyncListeners(syncListeners);
-    bool ret3 = ProfileCache::GetInstance().syncListenerMap_.count(caller);
-    EXPECT_EQ(false, ret3);
-
-    ProfileCache::GetInstance().UnInit();
-    ProfileCache::GetInstance().Init();
-}
-
-/**
- * @tc.name: RemoveSyncListener001
- * @tc.desc: RemoveSyncListener overload1.
- * @tc.type: FUNC
- * @tc.require:
- */
-HWTEST_F(ProfileCacheTest, RemoveSyncListener001, TestSize.Level1)
-{
-    ProfileCache::GetInstance().UnInit();
-    ProfileCache::GetInstance().Init();
-    ProfileCache::GetInstance().syncListenerMap_.clear();
-
-    string caller = "caller";
-    OHOS::sptr<OHOS::IRemoteObject> syncListener = OHOS::sptr<SyncCompletedCallbackStub>(new SyncCallback());
-
-    int32_t ret1 = ProfileCache::GetInstance().AddSyncListener(caller, syncListener);
-    EXPECT_EQ(DP_SUCCESS, ret1);
-
-    int32_t ret2 = ProfileCache::GetInstance().RemoveSyncListener(caller);
-    EXPECT_EQ(DP_SUCCESS, ret2);
-
-    int32_t ret3 = ProfileCache::GetInstance().RemoveSyncListener(caller);
-    EXPECT_EQ(DP_NOT_FOUND_FAIL, ret3);
-
-    for (int32_t i = 0; i < MAX_STRING_LEN + 5; i++) {
-        caller += 'a';
-    }
-    int32_t ret4 = ProfileCache::GetInstance().RemoveSyncListener(caller);
-    EXPECT_EQ(DP_INVALID_PARAMS, ret4);
-
-    caller = "";
-    int32_t ret5 = ProfileCache::GetInstance().RemoveSyncListener(caller);
-    EXPECT_EQ(DP_INVALID_PARAMS, ret5);
-
-    ProfileCache::GetInstance().UnInit();
-    ProfileCache::GetInstance().Init();
-}
-
-/**
- * @tc.name: RemoveSyncListener002
- * @tc.desc: RemoveSyncListener overload2.
- * @tc.type: FUNC
- * @tc.require:
- */
-HWTEST_F(ProfileCacheTest, RemoveSyncListener002, TestSize.Level1)
-{
-    ProfileCache::GetInstance().UnInit();
-    ProfileCache::GetInstance().Init();
-    ProfileCache::GetInstance().syncListenerMap_.clear();
-
-    string caller = "caller";
-    OHOS::sptr<OHOS::IRemoteObject> syncListener = OHOS::sptr<SyncCompletedCallbackStub>(new SyncCallback());
-
-    int32_t ret1 = ProfileCache::GetInstance().AddSyncListener(caller, syncListener);
-    EXPECT_EQ(DP_SUCCESS, ret1);
-
-    int32_t ret2 = ProfileCache::GetInstance().RemoveSyncListener(syncListener);
-    EXPECT_EQ(DP_SUCCESS, ret2);
-
-    int32_t ret4 = ProfileCache::GetInstance().RemoveSyncListener(syncListener);
-    EXPECT_EQ(DP_NOT_FOUND_FAIL, ret4);
-
-    syncListener = nullptr;
-    int32_t ret5 = ProfileCache::GetInstance().RemoveSyncListener(syncListener);
-    EXPECT_EQ(DP_INVALID_PARAMS, ret5);
-
-    ProfileCache::GetInstance().UnInit();
-    ProfileCache::GetInstance().Init();
-}
-
 /**
  * @tc.name: OnNodeOnline001
  * @tc.desc: OnNodeOnline001
@@ -601,6 +452,103 @@ HWTEST_F(ProfileCacheTest, OnNodeOffline001, TestSize.Level1)
     EXPECT_EQ(true, ProfileCache::GetInstance().onlineDevMap_.empty());
 }
 
+/**
+ * @tc.name: RemoteSwitch001
+ * @tc.desc: the switch word of a peer is cached until the peer goes offline
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ProfileCacheTest, RemoteSwitch001, TestSize.Level1)
+{
+    std::string peerNetworkId = "NetworkId";
+    uint32_t switchValue = 0;
+    EXPECT_EQ(DP_NOT_FOUND_FAIL, ProfileCache::GetInstance().GetRemoteSwitch(peerNetworkId, switchValue));
+    ProfileCache::GetInstance().SetRemoteSwitch("", 1);
+    EXPECT_EQ(true, ProfileCache::GetInstance().remoteSwitchMap_.empty());
+    ProfileCache::GetInstance().SetRemoteSwitch(peerNetworkId, 1);
+    ProfileCache::GetInstance().SetRemoteSwitch(peerNetworkId, 5);
+    EXPECT_EQ(DP_SUCCESS, ProfileCache::GetInstance().GetRemoteSwitch(peerNetworkId, switchValue));
+    EXPECT_EQ(5, switchValue);
+    ProfileCache::GetInstance().OnNodeOffline(peerNetworkId);
+    EXPECT_EQ(DP_NOT_FOUND_FAIL, ProfileCache::GetInstance().GetRemoteSwitch(peerNetworkId, switchValue));
+}
+
+/**
+ * @tc.name: InternStrings001
+ * @tc.desc: cached profiles of the same device and service share one copy of their identity strings
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ProfileCacheTest, InternStrings001, TestSize.Level1)
+{
+    const int32_t deviceCount = 5;
+    const int32_t keyCount = MAX_CHAR_SIZE / deviceCount;
+    const std::string serviceName = "distributed_static_capability_service";
+    ProfileCache::GetInstance().staticCharProfileMap_.clear();
+    DpStringPool::GetInstance().Purge();
+    size_t poolBytes = DpStringPool::GetInstance().GetBytes();
+    size_t unpooledBytes = 0;
+    for (int32_t i = 0; i < deviceCount; i++) {
+        std::string deviceId = std::string(64, 'a' + i);
+        for (int32_t j = 0; j < keyCount; j++) {
+            CharacteristicProfile charProfile(deviceId, serviceName, "static_capability_key_" + std::to_string(j),
+                "value");
+            EXPECT_EQ(DP_SUCCESS, ProfileCache::GetInstance().AddStaticCharProfile(charProfile));
+            // what the three identity strings cost as plain std::string members
+            unpooledBytes += 3 * sizeof(std::string) + DpMemoryManager::EstimateBytes(deviceId) +
+                DpMemoryManager::EstimateBytes(serviceName) +
+                DpMemoryManager::EstimateBytes(charProfile.GetCharacteristicKey());
+        }
+    }
+    size_t pooledBytes = 3 * sizeof(DpSharedString) * deviceCount * keyCount +
+        DpStringPool::GetInstance().GetBytes() - poolBytes;
+    HILOGW("profiles: %{public}d, identity strings unpooled: %{public}zu bytes, pooled: %{public}zu bytes",
+        deviceCount * keyCount, unpooledBytes, pooledBytes);
+    EXPECT_LT(pooledBytes, unpooledBytes);
+
+    const auto& staticCharProfileMap = ProfileCache::GetInstance().staticCharProfileMap_;
+    ASSERT_EQ(staticCharProfileMap.size(), static_cast<size_t>(deviceCount * keyCount));
+    const CharacteristicProfile* first = nullptr;
+    for (const auto& [key, charProfile] : staticCharProfileMap) {
+        if (first == nullptr) {
+            first = &charProfile;
+        } else if (charProfile.GetDeviceId() == first->GetDeviceId()) {
+            EXPECT_EQ(charProfile.GetDeviceId().data(), first->GetDeviceId().data());
+            EXPECT_EQ(charProfile.GetServiceName().data(), first->GetServiceName().data());
+        }
+    }
+    ProfileCache::GetInstance().staticCharProfileMap_.clear();
+    EXPECT_EQ(DpStringPool::GetInstance().Purge(), static_cast<size_t>(deviceCount + 1 + keyCount));
+}
+
+/**
+ * @tc.name: CheckBudget001
+ * @tc.desc: inserts past the budget trim the cache without a caller checking the budget
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ProfileCacheTest, CheckBudget001, TestSize.Level1)
+{
+    const int32_t profileCount = 200;
+    const std::string cacheName = "ProfileCacheTest";
+    ProfileCache::GetInstance().staticCharProfileMap_.clear();
+    DpMemoryManager::GetInstance().RegisterCache(cacheName, []() { return ProfileCache::GetInstance().GetUsage(); },
+        [](size_t bytesToFree) { return ProfileCache::GetInstance().Trim(bytesToFree); });
+    size_t budgetBytes = DpMemoryManager::GetInstance().GetTotalUsage().bytes +
+        profileCount / 2 * sizeof(CharacteristicProfile);
+    DpMemoryManager::GetInstance().SetBudget(budgetBytes);
+    for (int32_t i = 0; i < profileCount; i++) {
+        CharacteristicProfile charProfile("deviceId", "serviceName", "key" + std::to_string(i), "value");
+        EXPECT_EQ(DP_SUCCESS, ProfileCache::GetInstance().AddStaticCharProfile(charProfile));
+    }
+    EXPECT_LT(ProfileCache::GetInstance().staticCharProfileMap_.size(), static_cast<size_t>(profileCount));
+    EXPECT_LE(DpMemoryManager::GetInstance().GetTotalUsage().bytes,
+        budgetBytes + budgetBytes / 100 * CACHE_CHECK_STEP_PERCENT);
+    DpMemoryManager::GetInstance().UnRegisterCache(cacheName);
+    DpMemoryManager::GetInstance().SetBudget(DEFAULT_CACHE_BUDGET_BYTES);
+    ProfileCache::GetInstance().staticCharProfileMap_.clear();
+}
+
 /**
  * @tc.name: FilterAndGroupOnlineDevices001
  * @tc.desc: FilterAndGroupOnlineDevices failed, deviceList.size() == 0.
@@ -1136,19 +1084,6 @@ HWTEST_F(ProfileCacheTest, GetUdidByNetWorkId002, TestSize.Level1)
     EXPECT_NE(ret, DP_CACHE_NOT_EXIST);
 }
 
-/**
- * @tc.name: GetSyncListeners001
- * @tc.desc: Test GetSyncListeners method
- * @tc.type: FUNC
- * @tc.require:
- */
-HWTEST_F(ProfileCacheTest, GetSyncListeners001, TestSize.Level1)
-{
-    std::map<std::string, sptr<IRemoteObject>> syncListeners;
-    int32_t ret = ProfileCache::GetInstance().GetSyncListeners(syncListeners);
-    EXPECT_EQ(ret, DP_SUCCESS);
-}
-
 /**
  * @tc.name: SetSwitchByProfile001
  * @tc.desc: Test SetSwitchByProfile with valid profile
@@ -1553,24 +1488,6 @@ HWTEST_F(ProfileCacheTest, SetSwitchByProfile003, TestSize.Level1)
     int32_t ret = ProfileCache::GetInstance().SetSwitchByProfile(charProfile, switchServiceMap, outSwitch);
     EXPECT_NE(ret, DP_CACHE_NOT_EXIST);
 }
-
-/**
- * @tc.name: GetSyncListeners002
- * @tc.desc: Test GetSyncListeners after adding listener
- * @tc.type: FUNC
- * @tc.require:
- */
-HWTEST_F(ProfileCacheTest, GetSyncListeners002, TestSize.Level1)
-{
-    std::map<std::string, sptr<IRemoteObject>> syncListeners;
-    std::string caller = "testCaller";
-    OHOS::sptr<OHOS::IRemoteObject> syncListener = OHOS::sptr<SyncCompletedCallbackStub>(new SyncCallback());
-    ProfileCache::GetInstance().AddSyncListener(caller, syncListener);
-    int32_t ret = ProfileCache::GetInstance().GetSyncListeners(syncListeners);
-    EXPECT_EQ(ret, DP_SUCCESS);
-    EXPECT_FALSE(syncListeners.empty());
-    ProfileCache::GetInstance().RemoveSyncListener(caller);
-}
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
 
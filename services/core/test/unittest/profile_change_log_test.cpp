@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "profile_change_log.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace DistributedDeviceProfile {
+using namespace std;
+namespace {
+    const std::string KEY_A = "char#udid#service#keyA#characteristicValue";
+    const std::string KEY_B = "char#udid#service#keyB#characteristicValue";
+    const std::string DEVICE_KEY = "dev#udid#osVersion";
+}
+
+class ProfileChangeLogTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: Append001
+ * @tc.desc: every profile type numbers its changes on its own, a subscriber gets the ones of its key only
+ * @tc.type: FUNC
+ */
+HWTEST_F(ProfileChangeLogTest, Append001, TestSize.Level1)
+{
+    ProfileChangeLog changeLog;
+    EXPECT_EQ(changeLog.Append(ProfileType::CHAR_PROFILE, ChangeType::ADD, KEY_A, KEY_A, "0"), 1);
+    EXPECT_EQ(changeLog.Append(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, KEY_B, KEY_B, "0"), 2);
+    EXPECT_EQ(changeLog.Append(ProfileType::DEVICE_PROFILE, ChangeType::UPDATE, DEVICE_KEY, DEVICE_KEY, "5.0"), 1);
+    EXPECT_EQ(changeLog.Append(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, KEY_A, KEY_A, "1"), 3);
+    EXPECT_EQ(changeLog.GetLastSeq(ProfileType::CHAR_PROFILE), 3);
+    EXPECT_EQ(changeLog.GetLastSeq(ProfileType::SERVICE_PROFILE), 0);
+
+    vector<ProfileChangeRecord> records;
+    EXPECT_TRUE(changeLog.GetChanges(ProfileType::CHAR_PROFILE, 1, KEY_A, records));
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0].changeType, ChangeType::ADD);
+    EXPECT_EQ(records[1].seq, 3);
+    EXPECT_EQ(records[1].dbValue, "1");
+    records.clear();
+    EXPECT_TRUE(changeLog.GetChanges(ProfileType::CHAR_PROFILE, 4, KEY_A, records));
+    EXPECT_TRUE(records.empty());
+    EXPECT_GT(changeLog.GetUsage().bytes, 0);
+
+    changeLog.Clear();
+    EXPECT_EQ(changeLog.GetLastSeq(ProfileType::CHAR_PROFILE), 0);
+    EXPECT_EQ(changeLog.GetUsage().bytes, 0);
+}
+
+/**
+ * @tc.name: GetChanges001
+ * @tc.desc: once the log no longer reaches back, the last change of the key stands in for the missed ones
+ * @tc.type: FUNC
+ */
+HWTEST_F(ProfileChangeLogTest, GetChanges001, TestSize.Level1)
+{
+    ProfileChangeLog changeLog(2);
+    changeLog.Append(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, KEY_A, KEY_A, "0");
+    changeLog.Append(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, KEY_A, KEY_A, "1");
+    changeLog.Append(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, KEY_B, KEY_B, "0");
+    changeLog.Append(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, KEY_B, KEY_B, "1");
+
+    vector<ProfileChangeRecord> records;
+    EXPECT_TRUE(changeLog.GetChanges(ProfileType::CHAR_PROFILE, 1, KEY_A, records));
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[0].seq, 2);
+    EXPECT_EQ(records[0].dbValue, "1");
+    records.clear();
+    // KEY_A did not change after seq 2
+    EXPECT_TRUE(changeLog.GetChanges(ProfileType::CHAR_PROFILE, 3, KEY_A, records));
+    EXPECT_TRUE(records.empty());
+}
+
+/**
+ * @tc.name: GetChanges002
+ * @tc.desc: with the last change of a key evicted after the subscriber fell behind, the changes are unknown
+ * @tc.type: FUNC
+ */
+HWTEST_F(ProfileChangeLogTest, GetChanges002, TestSize.Level1)
+{
+    ProfileChangeLog changeLog(1, 1);
+    changeLog.Append(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, KEY_A, KEY_A, "0");
+    changeLog.Append(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, KEY_A, KEY_A, "1");
+    changeLog.Append(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, KEY_B, KEY_B, "0");
+
+    vector<ProfileChangeRecord> records;
+    EXPECT_FALSE(changeLog.GetChanges(ProfileType::CHAR_PROFILE, 1, KEY_A, records));
+    EXPECT_TRUE(records.empty());
+    // KEY_B still has its last change
+    EXPECT_TRUE(changeLog.GetChanges(ProfileType::CHAR_PROFILE, 1, KEY_B, records));
+    EXPECT_EQ(records.size(), 1);
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "common_event_support.h"
+#include "distributed_device_profile_client.h"
+#include "distributed_device_profile_errors.h"
+#include "mock/distributed_device_profile_mock.h"
+#include "profile_client_cache.h"
+
+namespace OHOS {
+namespace DistributedDeviceProfile {
+using namespace testing;
+using namespace testing::ext;
+using namespace std;
+
+namespace {
+    const int32_t TEST_SAID = 4801;
+    const std::string TEST_DEVICE_ID = "deviceId";
+    const std::string TEST_SERVICE_NAME = "serviceName";
+    const std::string TEST_CHAR_KEY = "charKey";
+}
+
+class CountChangeListener : public ProfileChangeListenerStub {
+public:
+    int32_t OnTrustDeviceProfileAdd(const TrustDeviceProfile& profile) override { return 0; }
+    int32_t OnTrustDeviceProfileDelete(const TrustDeviceProfile& profile) override { return 0; }
+    int32_t OnTrustDeviceProfileUpdate(const TrustDeviceProfile& oldProfile,
+        const TrustDeviceProfile& newProfile) override { return 0; }
+    int32_t OnDeviceProfileAdd(const DeviceProfile& profile) override { return 0; }
+    int32_t OnDeviceProfileDelete(const DeviceProfile& profile) override { return 0; }
+    int32_t OnDeviceProfileUpdate(const DeviceProfile& oldProfile, const DeviceProfile& newProfile) override
+    {
+        return 0;
+    }
+    int32_t OnServiceProfileAdd(const ServiceProfile& profile) override { return 0; }
+    int32_t OnServiceProfileDelete(const ServiceProfile& profile) override { return 0; }
+    int32_t OnServiceProfileUpdate(const ServiceProfile& oldProfile, const ServiceProfile& newProfile) override
+    {
+        return 0;
+    }
+    int32_t OnCharacteristicProfileAdd(const CharacteristicProfile& profile) override { return 0; }
+    int32_t OnCharacteristicProfileDelete(const CharacteristicProfile& profile) override { return 0; }
+    int32_t OnCharacteristicProfileUpdate(const CharacteristicProfile& oldProfile,
+        const CharacteristicProfile& newProfile) override
+    {
+        updateCount_++;
+        return 0;
+    }
+
+    int32_t updateCount_ = 0;
+};
+
+class ProfileClientCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override
+    {
+        mockService_ = sptr<IDistributedDeviceProfileMock>(new IDistributedDeviceProfileMock());
+        EXPECT_CALL(*mockService_, SubscribeDeviceProfile(_)).WillRepeatedly(Return(DP_SUCCESS));
+        EXPECT_CALL(*mockService_, UnSubscribeDeviceProfile(_)).WillRepeatedly(Return(DP_SUCCESS));
+        DistributedDeviceProfileClient::GetInstance().dpProxy_ = mockService_;
+    }
+    void TearDown() override
+    {
+        ProfileClientCache::GetInstance().Disable(mockService_);
+        ProfileClientCache::GetInstance().ResetStats();
+        DistributedDeviceProfileClient::GetInstance().dpProxy_ = nullptr;
+        mockService_ = nullptr;
+    }
+
+    sptr<IDistributedDeviceProfileMock> mockService_ = nullptr;
+};
+
+/**
+ * @tc.name: GetCharacteristicProfile001
+ * @tc.desc: repeated reads are served by the cache after the first backend call
+ * @tc.type: FUNC
+ */
+HWTEST_F(ProfileClientCacheTest, GetCharacteristicProfile001, TestSize.Level1)
+{
+    auto& client = DistributedDeviceProfileClient::GetInstance();
+    EXPECT_EQ(client.EnableProfileCache(TEST_SAID), DP_SUCCESS);
+    EXPECT_CALL(*mockService_, GetCharacteristicProfile(_, _, _, _))
+        .Times(1)
+        .WillOnce(DoAll(Invoke([](const std::string&, const std::string&, const std::string&,
+            CharacteristicProfile& charProfile) { charProfile.SetCharacteristicValue("value"); }),
+            Return(DP_SUCCESS)));
+    for (int32_t i = 0; i < 5; i++) {
+        CharacteristicProfile charProfile;
+        EXPECT_EQ(client.GetCharacteristicProfile(TEST_DEVICE_ID, TEST_SERVICE_NAME, TEST_CHAR_KEY, charProfile),
+            DP_SUCCESS);
+        EXPECT_EQ(charProfile.GetCharacteristicValue(), "value");
+    }
+    ProfileClientCacheStats stats = client.GetProfileCacheStats();
+    EXPECT_EQ(stats.hitCount, 4);
+    EXPECT_EQ(stats.missCount, 1);
+    EXPECT_EQ(stats.entryCount, 1);
+}
+
+/**
+ * @tc.name: GetCharacteristicProfile002
+ * @tc.desc: a change notification drops the entry and the next read goes to the backend
+ * @tc.type: FUNC
+ */
+HWTEST_F(ProfileClientCacheTest, GetCharacteristicProfile002, TestSize.Level1)
+{
+    auto& client = DistributedDeviceProfileClient::GetInstance();
+    EXPECT_EQ(client.EnableProfileCache(TEST_SAID), DP_SUCCESS);
+    EXPECT_CALL(*mockService_, GetCharacteristicProfile(_, _, _, _)).Times(2).WillRepeatedly(Return(DP_SUCCESS));
+    CharacteristicProfile charProfile;
+    client.GetCharacteristicProfile(TEST_DEVICE_ID, TEST_SERVICE_NAME, TEST_CHAR_KEY, charProfile);
+    client.GetCharacteristicProfile(TEST_DEVICE_ID, TEST_SERVICE_NAME, TEST_CHAR_KEY, charProfile);
+
+    CharacteristicProfile changed;
+    changed.SetDeviceId(TEST_DEVICE_ID);
+    changed.SetServiceName(TEST_SERVICE_NAME);
+    changed.SetCharacteristicKey(TEST_CHAR_KEY);
+    ProfileClientCache::GetInstance().listener_->OnCharacteristicProfileUpdate(changed, changed);
+    client.GetCharacteristicProfile(TEST_DEVICE_ID, TEST_SERVICE_NAME, TEST_CHAR_KEY, charProfile);
+
+    ProfileClientCacheStats stats = client.GetProfileCacheStats();
+    EXPECT_EQ(stats.invalidateCount, 1);
+    EXPECT_EQ(stats.hitCount, 1);
+}
+
+/**
+ * @tc.name: PutCharacteristicProfile001
+ * @tc.desc: a fill whose read raced with a change is discarded
+ * @tc.type: FUNC
+ */
+HWTEST_F(ProfileClientCacheTest, PutCharacteristicProfile001, TestSize.Level1)
+{
+    auto& cache = ProfileClientCache::GetInstance();
+    EXPECT_EQ(cache.Enable(TEST_SAID, DEFAULT_PROFILE_CACHE_SIZE, DEFAULT_PROFILE_CACHE_MAX_AGE_MS), DP_SUCCESS);
+    EXPECT_TRUE(cache.PrepareCharacteristicProfile(mockService_, TEST_DEVICE_ID, TEST_SERVICE_NAME, TEST_CHAR_KEY));
+    uint64_t version = cache.GetVersion();
+    cache.InvalidateCharacteristicProfile(TEST_DEVICE_ID, TEST_SERVICE_NAME, TEST_CHAR_KEY);
+    CharacteristicProfile charProfile;
+    cache.PutCharacteristicProfile(mockService_, version, TEST_DEVICE_ID, TEST_SERVICE_NAME, TEST_CHAR_KEY,
+        charProfile);
+    EXPECT_EQ(cache.GetCharacteristicProfile(TEST_DEVICE_ID, TEST_SERVICE_NAME, TEST_CHAR_KEY, charProfile),
+        DP_NOT_FOUND_FAIL);
+    EXPECT_EQ(cache.GetStats().staleFillCount, 1);
+}
+
+/**
+ * @tc.name: PutCharacteristicProfile002
+ * @tc.desc: the least recently used entry is evicted and unsubscribed when full
+ * @tc.type: FUNC
+ */
+HWTEST_F(ProfileClientCacheTest, PutCharacteristicProfile002, TestSize.Level1)
+{
+    auto& cache = ProfileClientCache::GetInstance();
+    EXPECT_EQ(cache.Enable(TEST_SAID, 1, DEFAULT_PROFILE_CACHE_MAX_AGE_MS), DP_SUCCESS);
+    CharacteristicProfile charProfile;
+    for (const std::string& charKey : { "charKey1", "charKey2" }) {
+        EXPECT_TRUE(cache.PrepareCharacteristicProfile(mockService_, TEST_DEVICE_ID, TEST_SERVICE_NAME, charKey));
+        cache.PutCharacteristicProfile(mockService_, cache.GetVersion(), TEST_DEVICE_ID, TEST_SERVICE_NAME,
+            charKey, charProfile);
+    }
+    EXPECT_EQ(cache.GetCharacteristicProfile(TEST_DEVICE_ID, TEST_SERVICE_NAME, "charKey1", charProfile),
+        DP_NOT_FOUND_FAIL);
+    EXPECT_EQ(cache.GetCharacteristicProfile(TEST_DEVICE_ID, TEST_SERVICE_NAME, "charKey2", charProfile),
+        DP_SUCCESS);
+    ProfileClientCacheStats stats = cache.GetStats();
+    EXPECT_EQ(stats.evictCount, 1);
+    EXPECT_EQ(stats.entryCount, 1);
+}
+
+/**
+ * @tc.name: GetCharacteristicProfileBatch001
+ * @tc.desc: multi-user queries are neither served from nor filled into the cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(ProfileClientCacheTest, GetCharacteristicProfileBatch001, TestSize.Level1)
+{
+    auto& client = DistributedDeviceProfileClient::GetInstance();
+    EXPECT_EQ(client.EnableProfileCache(TEST_SAID), DP_SUCCESS);
+    CharacteristicProfile query;
+    query.SetDeviceId(TEST_DEVICE_ID);
+    query.SetServiceName(TEST_SERVICE_NAME);
+    query.SetCharacteristicKey(TEST_CHAR_KEY);
+    query.SetIsMultiUser(true);
+    query.SetUserId(100);
+    EXPECT_CALL(*mockService_, GetCharacteristicProfileBatch(_, _, _))
+        .Times(2)
+        .WillRepeatedly(DoAll(Invoke([](const std::vector<CharacteristicProfile>& queries,
+            std::vector<CharacteristicProfile>& charProfiles, std::vector<int32_t>& results) {
+            charProfiles = queries;
+            results.assign(queries.size(), DP_SUCCESS);
+        }), Return(DP_SUCCESS)));
+    for (int32_t i = 0; i < 2; i++) {
+        std::vector<CharacteristicProfile> charProfiles;
+        std::vector<int32_t> results;
+        EXPECT_EQ(client.GetCharacteristicProfileBatch({ query }, charProfiles, results), DP_SUCCESS);
+    }
+    ProfileClientCacheStats stats = client.GetProfileCacheStats();
+    EXPECT_EQ(stats.hitCount, 0);
+    EXPECT_EQ(stats.entryCount, 0);
+}
+
+/**
+ * @tc.name: GetAccessControlProfile001
+ * @tc.desc: acl results are cached per query and dropped on any trust change
+ * @tc.type: FUNC
+ */
+HWTEST_F(ProfileClientCacheTest, GetAccessControlProfile001, TestSize.Level1)
+{
+    auto& client = DistributedDeviceProfileClient::GetInstance();
+    EXPECT_EQ(client.EnableProfileCache(TEST_SAID), DP_SUCCESS);
+    ProfileClientCache::GetInstance().userSwitchSubscribed_ = true;
+    EXPECT_CALL(*mockService_, GetAccessControlProfile(_, _)).Times(2).WillRepeatedly(Return(DP_SUCCESS));
+    std::map<std::string, std::string> params = { { "trustDeviceId", TEST_DEVICE_ID } };
+    std::vector<AccessControlProfile> aclProfiles;
+    client.GetAccessControlProfile(params, aclProfiles);
+    client.GetAccessControlProfile(params, aclProfiles);
+    TrustDeviceProfile trustProfile;
+    ProfileClientCache::GetInstance().listener_->OnTrustDeviceProfileAdd(trustProfile);
+    client.GetAccessControlProfile(params, aclProfiles);
+    EXPECT_EQ(client.GetProfileCacheStats().hitCount, 1);
+}
+
+/**
+ * @tc.name: GetAccessControlProfile002
+ * @tc.desc: a user switch drops the acl results, they depend on the foreground user
+ * @tc.type: FUNC
+ */
+HWTEST_F(ProfileClientCacheTest, GetAccessControlProfile002, TestSize.Level1)
+{
+    auto& client = DistributedDeviceProfileClient::GetInstance();
+    EXPECT_EQ(client.EnableProfileCache(TEST_SAID), DP_SUCCESS);
+    auto& cache = ProfileClientCache::GetInstance();
+    cache.userSwitchSubscribed_ = true;
+    EXPECT_CALL(*mockService_, GetAccessControlProfile(_, _)).Times(2).WillRepeatedly(Return(DP_SUCCESS));
+    std::map<std::string, std::string> params = { { "trustDeviceId", TEST_DEVICE_ID } };
+    std::vector<AccessControlProfile> aclProfiles;
+    client.GetAccessControlProfile(params, aclProfiles);
+    client.GetAccessControlProfile(params, aclProfiles);
+    if (cache.userSwitchSubscriber_ != nullptr) {
+        AAFwk::Want want;
+        want.SetAction(EventFwk::CommonEventSupport::COMMON_EVENT_USER_SWITCHED);
+        EventFwk::CommonEventData data(want);
+        cache.userSwitchSubscriber_->OnReceiveEvent(data);
+    } else {
+        cache.InvalidateAccessControlProfile();
+    }
+    client.GetAccessControlProfile(params, aclProfiles);
+    EXPECT_EQ(client.GetProfileCacheStats().hitCount, 1);
+
+    cache.userSwitchSubscribed_ = false;
+    EXPECT_FALSE(cache.PrepareAccessControlProfile(mockService_));
+}
+
+/**
+ * @tc.name: SubscribeForApp001
+ * @tc.desc: a key the app and the cache both subscribe is served by one listener and handed back on release
+ * @tc.type: FUNC
+ */
+HWTEST_F(ProfileClientCacheTest, SubscribeForApp001, TestSize.Level1)
+{
+    auto& cache = ProfileClientCache::GetInstance();
+    EXPECT_EQ(cache.Enable(TEST_SAID, DEFAULT_PROFILE_CACHE_SIZE, DEFAULT_PROFILE_CACHE_MAX_AGE_MS), DP_SUCCESS);
+    sptr<CountChangeListener> appListener = sptr<CountChangeListener>(new CountChangeListener());
+    SubscribeInfo appInfo(TEST_SAID, "", { ProfileChangeType::CHAR_PROFILE_UPDATE }, appListener);
+    appInfo.SetSubscribeKey(TEST_DEVICE_ID, TEST_SERVICE_NAME, TEST_CHAR_KEY, CHARACTERISTIC_VALUE);
+    std::vector<SubscribeInfo> sent;
+    EXPECT_CALL(*mockService_, SubscribeDeviceProfile(_)).WillRepeatedly(DoAll(Invoke(
+        [&sent](const SubscribeInfo& subscribeInfo) { sent.emplace_back(subscribeInfo); }), Return(DP_SUCCESS)));
+    EXPECT_CALL(*mockService_, UnSubscribeDeviceProfile(_)).Times(1).WillOnce(Return(DP_SUCCESS));
+    EXPECT_EQ(cache.SubscribeForApp(mockService_, appInfo), DP_SUCCESS);
+    EXPECT_TRUE(cache.PrepareCharacteristicProfile(mockService_, TEST_DEVICE_ID, TEST_SERVICE_NAME, TEST_CHAR_KEY));
+    ASSERT_EQ(sent.size(), 2);
+    EXPECT_EQ(sent[1].GetSubscribeKey(), appInfo.GetSubscribeKey());
+    EXPECT_NE(sent[1].GetListener(), appInfo.GetListener());
+    EXPECT_EQ(sent[1].GetProfileChangeTypes().size(), 3);
+
+    CharacteristicProfile changed;
+    changed.SetDeviceId(TEST_DEVICE_ID);
+    changed.SetServiceName(TEST_SERVICE_NAME);
+    changed.SetCharacteristicKey(TEST_CHAR_KEY);
+    sptr<IProfileChangeListener> sharedListener = iface_cast<IProfileChangeListener>(sent[1].GetListener());
+    sharedListener->OnCharacteristicProfileUpdate(changed, changed);
+    sharedListener->OnCharacteristicProfileAdd(changed);
+    EXPECT_EQ(appListener->updateCount_, 1);
+    EXPECT_EQ(cache.GetStats().invalidateCount, 0);
+
+    // releasing the cache's part subscribes the app's own listener again
+    cache.Disable(mockService_);
+    ASSERT_EQ(sent.size(), 3);
+    EXPECT_EQ(sent[2].GetListener(), appInfo.GetListener());
+    EXPECT_EQ(cache.UnSubscribeForApp(mockService_, appInfo), DP_SUCCESS);
+}
+
+/**
+ * @tc.name: EnableProfileCache001
+ * @tc.desc: invalid params are rejected and reads pass through when disabled
+ * @tc.type: FUNC
+ */
+HWTEST_F(ProfileClientCacheTest, EnableProfileCache001, TestSize.Level1)
+{
+    auto& client = DistributedDeviceProfileClient::GetInstance();
+    EXPECT_EQ(client.EnableProfileCache(0), DP_INVALID_PARAMS);
+    EXPECT_EQ(client.EnableProfileCache(TEST_SAID, 0), DP_INVALID_PARAMS);
+    EXPECT_EQ(client.EnableProfileCache(TEST_SAID, DEFAULT_PROFILE_CACHE_SIZE, 0), DP_INVALID_PARAMS);
+    EXPECT_CALL(*mockService_, GetServiceProfile(_, _, _)).Times(2).WillRepeatedly(Return(DP_SUCCESS));
+    ServiceProfile serviceProfile;
+    client.GetServiceProfile(TEST_DEVICE_ID, TEST_SERVICE_NAME, serviceProfile);
+    client.GetServiceProfile(TEST_DEVICE_ID, TEST_SERVICE_NAME, serviceProfile);
+    EXPECT_EQ(client.GetProfileCacheStats().hitCount, 0);
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
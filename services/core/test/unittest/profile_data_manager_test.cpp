@@ -351,6 +351,26 @@ HWTEST_F(ProfileDataManagerTest, GetDeviceIconInfos_006, TestSize.Level1)
     EXPECT_EQ(result, DP_GET_RESULTSET_FAIL);
 }
 
+/*
+ * @tc.name: GetDeviceIconInfos_007
+ * @tc.desc: GetDeviceIconInfos with the version the caller holds
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ProfileDataManagerTest, GetDeviceIconInfos_007, TestSize.Level1)
+{
+    DeviceIconInfoFilterOptions filterOptions;
+    filterOptions.SetProductIds({"productId"});
+    filterOptions.SetSubProductId("subId");
+    filterOptions.SetImageType("imageType");
+    filterOptions.SetSpecName("specName");
+    filterOptions.SetKnownVersion("version");
+    std::vector<DeviceIconInfo> deviceIconInfos;
+    int32_t result = ProfileDataManager::GetInstance().GetDeviceIconInfos(filterOptions, deviceIconInfos);
+    EXPECT_EQ(result, DP_GET_RESULTSET_FAIL);
+    EXPECT_TRUE(deviceIconInfos.empty());
+}
+
 /*
  * @tc.name: PutDeviceIconInfoBatch_001
  * @tc.desc: PutDeviceIconInfoBatch
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "service_availability.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace DistributedDeviceProfile {
+using namespace std;
+namespace {
+    constexpr int64_t TEST_LOAD_TIMEOUT_MS = 200;
+    constexpr uint32_t TEST_FAILURE_THRESHOLD = 2;
+    constexpr int64_t TEST_OPEN_MS = 50;
+    constexpr int32_t WAITER_COUNT = 8;
+    constexpr uint32_t TEST_RETRY_ATTEMPTS = 8;
+}
+
+// Stands in for samgr: counts LoadSystemAbility calls and answers them from another thread.
+class FakeSamgr {
+public:
+    explicit FakeSamgr(ServiceAvailability& availability) : availability_(availability) {}
+    ~FakeSamgr()
+    {
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    int32_t LoadSystemAbility()
+    {
+        loadCount++;
+        if (loadRet != 0 || !answer) {
+            return loadRet;
+        }
+        bool success = loadSuccess;
+        int64_t delayMs = answerDelayMs;
+        threads_.emplace_back([this, success, delayMs]() {
+            this_thread::sleep_for(chrono::milliseconds(delayMs));
+            availability_.OnLoadFinished(success);
+        });
+        return 0;
+    }
+
+    ServiceAvailability::LoadFunc GetLoadFunc()
+    {
+        return [this]() { return LoadSystemAbility(); };
+    }
+
+    atomic<int32_t> loadCount {0};
+    int32_t loadRet = 0;
+    bool answer = true;
+    bool loadSuccess = true;
+    int64_t answerDelayMs = 20;
+
+private:
+    ServiceAvailability& availability_;
+    vector<thread> threads_;
+};
+
+class ServiceAvailabilityTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: WaitLoad001
+ * @tc.desc: threads that need the sa while it loads share a single samgr load
+ * @tc.type: FUNC
+ */
+HWTEST_F(ServiceAvailabilityTest, WaitLoad001, TestSize.Level1)
+{
+    ServiceAvailability availability(TEST_LOAD_TIMEOUT_MS, TEST_FAILURE_THRESHOLD, TEST_OPEN_MS);
+    FakeSamgr samgr(availability);
+    samgr.answerDelayMs = 50;
+    atomic<int32_t> successCount {0};
+    vector<thread> waiters;
+    for (int32_t i = 0; i < WAITER_COUNT; i++) {
+        waiters.emplace_back([&availability, &samgr, &successCount]() {
+            if (availability.WaitLoad(samgr.GetLoadFunc())) {
+                successCount++;
+            }
+        });
+    }
+    for (auto& waiter : waiters) {
+        waiter.join();
+    }
+    EXPECT_EQ(samgr.loadCount.load(), 1);
+    EXPECT_EQ(successCount.load(), WAITER_COUNT);
+    EXPECT_EQ(availability.GetState(), ServiceState::AVAILABLE);
+}
+
+/**
+ * @tc.name: WaitLoad002
+ * @tc.desc: a load samgr never answers times out, a rejected load fails right away
+ * @tc.type: FUNC
+ */
+HWTEST_F(ServiceAvailabilityTest, WaitLoad002, TestSize.Level1)
+{
+    ServiceAvailability availability(TEST_LOAD_TIMEOUT_MS, WAITER_COUNT, TEST_OPEN_MS);
+    FakeSamgr samgr(availability);
+    samgr.answer = false;
+    EXPECT_FALSE(availability.WaitLoad(samgr.GetLoadFunc()));
+    samgr.loadRet = -1;
+    EXPECT_FALSE(availability.WaitLoad(samgr.GetLoadFunc()));
+    EXPECT_EQ(samgr.loadCount.load(), 2);
+    EXPECT_EQ(availability.GetState(), ServiceState::UNKNOWN);
+    EXPECT_FALSE(availability.WaitLoad(nullptr));
+}
+
+/**
+ * @tc.name: CircuitBreaker001
+ * @tc.desc: repeated load failures open the circuit, callers then fail fast without touching samgr
+ * @tc.type: FUNC
+ */
+HWTEST_F(ServiceAvailabilityTest, CircuitBreaker001, TestSize.Level1)
+{
+    ServiceAvailability availability(TEST_LOAD_TIMEOUT_MS, TEST_FAILURE_THRESHOLD, TEST_OPEN_MS);
+    FakeSamgr samgr(availability);
+    samgr.loadSuccess = false;
+    EXPECT_FALSE(availability.WaitLoad(samgr.GetLoadFunc()));
+    EXPECT_FALSE(availability.IsCircuitOpen());
+    EXPECT_FALSE(availability.WaitLoad(samgr.GetLoadFunc()));
+    EXPECT_TRUE(availability.IsCircuitOpen());
+    EXPECT_EQ(availability.GetState(), ServiceState::DOWN);
+    EXPECT_FALSE(availability.WaitLoad(samgr.GetLoadFunc()));
+    EXPECT_EQ(samgr.loadCount.load(), 2);
+}
+
+/**
+ * @tc.name: CircuitBreaker002
+ * @tc.desc: after the open window a probe reaches samgr, a successful probe closes the circuit
+ * @tc.type: FUNC
+ */
+HWTEST_F(ServiceAvailabilityTest, CircuitBreaker002, TestSize.Level1)
+{
+    ServiceAvailability availability(TEST_LOAD_TIMEOUT_MS, 1, TEST_OPEN_MS);
+    FakeSamgr samgr(availability);
+    samgr.loadSuccess = false;
+    EXPECT_FALSE(availability.WaitLoad(samgr.GetLoadFunc()));
+    EXPECT_TRUE(availability.IsCircuitOpen());
+    this_thread::sleep_for(chrono::milliseconds(TEST_OPEN_MS * 2));
+    EXPECT_FALSE(availability.IsCircuitOpen());
+    samgr.loadSuccess = true;
+    EXPECT_TRUE(availability.WaitLoad(samgr.GetLoadFunc()));
+    EXPECT_EQ(samgr.loadCount.load(), 2);
+    EXPECT_FALSE(availability.IsCircuitOpen());
+    EXPECT_EQ(availability.GetState(), ServiceState::AVAILABLE);
+}
+
+/**
+ * @tc.name: CircuitBreaker003
+ * @tc.desc: the sa coming up closes the circuit, a late successful answer is not lost
+ * @tc.type: FUNC
+ */
+HWTEST_F(ServiceAvailabilityTest, CircuitBreaker003, TestSize.Level1)
+{
+    ServiceAvailability availability(TEST_LOAD_TIMEOUT_MS, 1, TEST_OPEN_MS);
+    FakeSamgr samgr(availability);
+    samgr.loadSuccess = false;
+    EXPECT_FALSE(availability.WaitLoad(samgr.GetLoadFunc()));
+    EXPECT_TRUE(availability.IsCircuitOpen());
+    availability.OnServiceAvailable();
+    EXPECT_FALSE(availability.IsCircuitOpen());
+    availability.OnServiceDied();
+    EXPECT_EQ(availability.GetState(), ServiceState::UNKNOWN);
+    availability.OnLoadFinished(true);
+    EXPECT_EQ(availability.GetState(), ServiceState::AVAILABLE);
+}
+
+/**
+ * @tc.name: GetRetryDelayMs001
+ * @tc.desc: retry delays grow exponentially with jitter and stay under the cap
+ * @tc.type: FUNC
+ */
+HWTEST_F(ServiceAvailabilityTest, GetRetryDelayMs001, TestSize.Level1)
+{
+    ServiceAvailability availability;
+    for (uint32_t attempt = 0; attempt < TEST_RETRY_ATTEMPTS; attempt++) {
+        int64_t ceilingMs = min(DEFAULT_RETRY_BASE_DELAY_MS << attempt, MAX_RETRY_DELAY_MS);
+        int64_t delayMs = availability.GetRetryDelayMs(attempt);
+        EXPECT_GE(delayMs, ceilingMs / 2);
+        EXPECT_LE(delayMs, ceilingMs);
+    }
+    EXPECT_LE(availability.GetRetryDelayMs(UINT32_MAX), MAX_RETRY_DELAY_MS);
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
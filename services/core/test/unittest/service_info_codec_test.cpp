@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "distributed_device_profile_errors.h"
+#include "distributed_device_profile_log.h"
+#include "profile_utils.h"
+#include "service_info_codec.h"
+#include "service_info_manager.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace DistributedDeviceProfile {
+using namespace std;
+namespace {
+    const std::string TAG = "ServiceInfoCodecTest";
+    const std::string TEST_UDID = "4f3a9b1c2d7e8f6a5b4c3d2e1f0a9b8c7d6e5f4a3b2c1d0e9f8a7b6c5d4e3f2a";
+    constexpr int32_t BENCH_ENTRIES = 5000;
+}
+
+class ServiceInfoCodecTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+static ServiceInfo CreateServiceInfo(int64_t serviceId)
+{
+    ServiceInfo serviceInfo;
+    serviceInfo.SetUdid(TEST_UDID);
+    serviceInfo.SetUserId(100);
+    serviceInfo.SetDisplayId(-1);
+    serviceInfo.SetServiceOwnerTokenId(537000000);
+    serviceInfo.SetServiceOwnerPkgName("com.example.service");
+    serviceInfo.SetServiceRegisterTokenId(537000001);
+    serviceInfo.SetServiceId(serviceId);
+    serviceInfo.SetTimeStamp(1760000000000);
+    serviceInfo.SetPublishState(1);
+    serviceInfo.SetServiceType("castPlus");
+    serviceInfo.SetServiceName("screenCast");
+    serviceInfo.SetServiceDisplayName("Screen cast");
+    serviceInfo.SetCustomData("{\"resolution\":\"1080p\"}");
+    serviceInfo.SetServiceCode("1001");
+    serviceInfo.SetDataLen(22);
+    serviceInfo.SetExtraData("");
+    serviceInfo.SetVersion("1.0.0");
+    serviceInfo.SetDescription("cast the screen to a nearby device");
+    return serviceInfo;
+}
+
+static void ExpectEqual(const ServiceInfo& lhs, const ServiceInfo& rhs)
+{
+    EXPECT_EQ(lhs.GetUdid(), rhs.GetUdid());
+    EXPECT_EQ(lhs.GetUserId(), rhs.GetUserId());
+    EXPECT_EQ(lhs.GetDisplayId(), rhs.GetDisplayId());
+    EXPECT_EQ(lhs.GetServiceOwnerTokenId(), rhs.GetServiceOwnerTokenId());
+    EXPECT_EQ(lhs.GetServiceOwnerPkgName(), rhs.GetServiceOwnerPkgName());
+    EXPECT_EQ(lhs.GetServiceRegisterTokenId(), rhs.GetServiceRegisterTokenId());
+    EXPECT_EQ(lhs.GetServiceId(), rhs.GetServiceId());
+    EXPECT_EQ(lhs.GetTimeStamp(), rhs.GetTimeStamp());
+    EXPECT_EQ(lhs.GetPublishState(), rhs.GetPublishState());
+    EXPECT_EQ(lhs.GetServiceType(), rhs.GetServiceType());
+    EXPECT_EQ(lhs.GetServiceName(), rhs.GetServiceName());
+    EXPECT_EQ(lhs.GetServiceDisplayName(), rhs.GetServiceDisplayName());
+    EXPECT_EQ(lhs.GetCustomData(), rhs.GetCustomData());
+    EXPECT_EQ(lhs.GetServiceCode(), rhs.GetServiceCode());
+    EXPECT_EQ(lhs.GetDataLen(), rhs.GetDataLen());
+    EXPECT_EQ(lhs.GetExtraData(), rhs.GetExtraData());
+    EXPECT_EQ(lhs.GetVersion(), rhs.GetVersion());
+    EXPECT_EQ(lhs.GetDescription(), rhs.GetDescription());
+}
+
+/**
+ * @tc.name: Encode001
+ * @tc.desc: a binary value reads back every field, the view exposes the filter fields without copying
+ * @tc.type: FUNC
+ */
+HWTEST_F(ServiceInfoCodecTest, Encode001, TestSize.Level1)
+{
+    ServiceInfo serviceInfo = CreateServiceInfo(INT64_MAX);
+    serviceInfo.SetExtraData(string("a\0b", 3));
+    string value = ServiceInfoCodec::Encode(serviceInfo);
+    EXPECT_TRUE(ServiceInfoCodec::IsBinary(value));
+
+    ServiceInfoView view;
+    ASSERT_TRUE(view.Parse(value));
+    EXPECT_EQ(view.GetUdid(), TEST_UDID);
+    EXPECT_EQ(view.GetUserId(), 100);
+    EXPECT_EQ(view.GetServiceId(), INT64_MAX);
+    EXPECT_GE(view.GetUdid().data(), value.data());
+    EXPECT_LT(view.GetUdid().data(), value.data() + value.size());
+    ServiceInfo result;
+    view.ToServiceInfo(result);
+    ExpectEqual(result, serviceInfo);
+}
+
+/**
+ * @tc.name: Decode001
+ * @tc.desc: json and binary values of one service info decode to the same fields
+ * @tc.type: FUNC
+ */
+HWTEST_F(ServiceInfoCodecTest, Decode001, TestSize.Level1)
+{
+    ServiceInfo serviceInfo = CreateServiceInfo(1);
+    map<string, string> entries;
+    ProfileUtils::ServiceInfoToEntries(serviceInfo, entries);
+    ASSERT_EQ(entries.size(), 1);
+    const string& key = entries.begin()->first;
+    const string& json = entries.begin()->second;
+    EXPECT_FALSE(ServiceInfoCodec::IsBinary(json));
+
+    ServiceInfo fromJson;
+    EXPECT_EQ(ServiceInfoManager::GetInstance().DecodeServiceInfo(key, json, fromJson), DP_SUCCESS);
+    ExpectEqual(fromJson, serviceInfo);
+    ServiceInfo fromBinary;
+    EXPECT_EQ(ServiceInfoManager::GetInstance().DecodeServiceInfo(key, ServiceInfoCodec::Encode(serviceInfo),
+        fromBinary), DP_SUCCESS);
+    ExpectEqual(fromBinary, serviceInfo);
+    ServiceInfo invalid;
+    EXPECT_EQ(ServiceInfoManager::GetInstance().DecodeServiceInfo(key, "not json", invalid),
+        DP_LOAD_JSON_FILE_FAIL);
+}
+
+/**
+ * @tc.name: Decode002
+ * @tc.desc: a truncated value, a string longer than the value and an unknown version are rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(ServiceInfoCodecTest, Decode002, TestSize.Level1)
+{
+    string value = ServiceInfoCodec::Encode(CreateServiceInfo(1));
+    ServiceInfoView view;
+    for (size_t size = 0; size < value.size(); size++) {
+        EXPECT_FALSE(view.Parse(string_view(value.data(), size)));
+    }
+    string badVersion = value;
+    badVersion[1] = 0;
+    EXPECT_FALSE(view.Parse(badVersion));
+    // the length of the udid, the first string, follows the numbers
+    string badLength = value;
+    size_t udidLengthPos = 2 + sizeof(int32_t) * 3 + sizeof(int64_t) * 3 + sizeof(int8_t) + sizeof(uint32_t);
+    badLength[udidLengthPos + sizeof(uint32_t) - 1] = static_cast<char>(0xFF);
+    EXPECT_FALSE(view.Parse(badLength));
+    ServiceInfo serviceInfo;
+    EXPECT_EQ(ServiceInfoManager::GetInstance().DecodeServiceInfo("key", badLength, serviceInfo),
+        DP_INVALID_PARAMS);
+    // a later version appends fields, this one still reads its own
+    string newer = value;
+    newer[1] = SERVICE_INFO_CODEC_VERSION + 1;
+    newer.append("appended");
+    EXPECT_TRUE(view.Parse(newer));
+}
+
+/**
+ * @tc.name: Benchmark001
+ * @tc.desc: decode 5000 json values and their binary encoding, the binary values are smaller
+ * @tc.type: FUNC
+ */
+HWTEST_F(ServiceInfoCodecTest, Benchmark001, TestSize.Level1)
+{
+    vector<string> jsonValues;
+    vector<string> binaryValues;
+    size_t jsonBytes = 0;
+    size_t binaryBytes = 0;
+    for (int32_t i = 0; i < BENCH_ENTRIES; i++) {
+        ServiceInfo serviceInfo = CreateServiceInfo(i);
+        map<string, string> entries;
+        ProfileUtils::ServiceInfoToEntries(serviceInfo, entries);
+        jsonValues.push_back(entries.begin()->second);
+        binaryValues.push_back(ServiceInfoCodec::Encode(serviceInfo));
+        jsonBytes += jsonValues.back().size();
+        binaryBytes += binaryValues.back().size();
+    }
+    int32_t decoded = 0;
+    auto start = chrono::steady_clock::now();
+    for (const auto& value : jsonValues) {
+        ServiceInfo serviceInfo;
+        decoded += ServiceInfoManager::GetInstance().DecodeServiceInfo("key", value, serviceInfo) == DP_SUCCESS;
+    }
+    int64_t jsonNs = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+    start = chrono::steady_clock::now();
+    for (const auto& value : binaryValues) {
+        ServiceInfo serviceInfo;
+        decoded += ServiceInfoManager::GetInstance().DecodeServiceInfo("key", value, serviceInfo) == DP_SUCCESS;
+    }
+    int64_t binaryNs = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+    HILOGW("entries: %{public}d, json: %{public}zu bytes %{public}" PRId64 " ns, binary: %{public}zu bytes "
+        "%{public}" PRId64 " ns", BENCH_ENTRIES, jsonBytes, jsonNs, binaryBytes, binaryNs);
+    EXPECT_EQ(decoded, 2 * BENCH_ENTRIES);
+    EXPECT_LT(binaryBytes, jsonBytes);
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "distributed_device_profile_constants.h"
+#include "distributed_device_profile_errors.h"
+#include "mock/asset_system_api_mock.h"
+
+#define private public
+#include "session_key_manager.h"
+#undef private
+
+using namespace testing::ext;
+namespace OHOS {
+namespace DistributedDeviceProfile {
+using namespace std;
+namespace {
+    constexpr uint32_t USER_ID = 100;
+    constexpr uint32_t OTHER_USER_ID = 101;
+    constexpr int32_t SESSION_KEY_ID = 1001;
+    const std::vector<uint8_t> SESSION_KEY = {1, 2, 3, 4, 5};
+    const std::vector<uint8_t> NEW_SESSION_KEY = {6, 7, 8};
+}
+
+class SessionKeyManagerCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp()
+    {
+        AssetSystemApiMock::GetInstance().Reset();
+        SessionKeyManager::GetInstance().ClearSessionKeyCache();
+    }
+    void TearDown()
+    {
+        SessionKeyManager::GetInstance().ClearSessionKeyCache();
+    }
+};
+
+/**
+ * @tc.name: GetSessionKey001
+ * @tc.desc: repeated reads of a stored key are answered without querying the asset store
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionKeyManagerCacheTest, GetSessionKey001, TestSize.Level1)
+{
+    AssetSystemApiMock::GetInstance().secrets[{USER_ID, SESSION_KEY_ID}] = SESSION_KEY;
+    std::vector<uint8_t> sessionKey;
+    EXPECT_EQ(SessionKeyManager::GetInstance().GetSessionKey(USER_ID, SESSION_KEY_ID, sessionKey), DP_SUCCESS);
+    EXPECT_EQ(sessionKey, SESSION_KEY);
+    for (int32_t i = 0; i < 10; i++) {
+        sessionKey.clear();
+        EXPECT_EQ(SessionKeyManager::GetInstance().GetSessionKey(USER_ID, SESSION_KEY_ID, sessionKey), DP_SUCCESS);
+        EXPECT_EQ(sessionKey, SESSION_KEY);
+    }
+    sessionKey.clear();
+    EXPECT_EQ(SessionKeyManager::GetInstance().GetSessionKey(SESSION_KEY_ID, sessionKey), DP_SUCCESS);
+    EXPECT_EQ(sessionKey, SESSION_KEY);
+    EXPECT_EQ(AssetSystemApiMock::GetInstance().queryCount, 1);
+}
+
+/**
+ * @tc.name: GetSessionKey002
+ * @tc.desc: a key cached for one user is not returned for another one
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionKeyManagerCacheTest, GetSessionKey002, TestSize.Level1)
+{
+    AssetSystemApiMock::GetInstance().secrets[{USER_ID, SESSION_KEY_ID}] = SESSION_KEY;
+    std::vector<uint8_t> sessionKey;
+    EXPECT_EQ(SessionKeyManager::GetInstance().GetSessionKey(USER_ID, SESSION_KEY_ID, sessionKey), DP_SUCCESS);
+    EXPECT_NE(SessionKeyManager::GetInstance().GetSessionKey(OTHER_USER_ID, SESSION_KEY_ID, sessionKey), DP_SUCCESS);
+    EXPECT_EQ(AssetSystemApiMock::GetInstance().queryCount, 2);
+}
+
+/**
+ * @tc.name: UpdateSessionKey001
+ * @tc.desc: update writes through, delete evicts
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionKeyManagerCacheTest, UpdateSessionKey001, TestSize.Level1)
+{
+    AssetSystemApiMock::GetInstance().secrets[{USER_ID, SESSION_KEY_ID}] = SESSION_KEY;
+    std::vector<uint8_t> sessionKey;
+    EXPECT_EQ(SessionKeyManager::GetInstance().GetSessionKey(USER_ID, SESSION_KEY_ID, sessionKey), DP_SUCCESS);
+    EXPECT_EQ(SessionKeyManager::GetInstance().UpdateSessionKey(USER_ID, SESSION_KEY_ID, NEW_SESSION_KEY),
+        DP_SUCCESS);
+    EXPECT_EQ(SessionKeyManager::GetInstance().GetSessionKey(USER_ID, SESSION_KEY_ID, sessionKey), DP_SUCCESS);
+    EXPECT_EQ(sessionKey, NEW_SESSION_KEY);
+    EXPECT_EQ(AssetSystemApiMock::GetInstance().queryCount, 1);
+
+    EXPECT_EQ(SessionKeyManager::GetInstance().DeleteSessionKey(USER_ID, SESSION_KEY_ID), DP_SUCCESS);
+    EXPECT_NE(SessionKeyManager::GetInstance().GetSessionKey(USER_ID, SESSION_KEY_ID, sessionKey), DP_SUCCESS);
+    EXPECT_EQ(AssetSystemApiMock::GetInstance().queryCount, 2);
+    EXPECT_TRUE(SessionKeyManager::GetInstance().sessionKeyUserIndex_.empty());
+}
+
+/**
+ * @tc.name: ClearSessionKeyCache001
+ * @tc.desc: clearing the cache sends the next read back to the asset store
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionKeyManagerCacheTest, ClearSessionKeyCache001, TestSize.Level1)
+{
+    AssetSystemApiMock::GetInstance().secrets[{USER_ID, SESSION_KEY_ID}] = SESSION_KEY;
+    std::vector<uint8_t> sessionKey;
+    EXPECT_EQ(SessionKeyManager::GetInstance().GetSessionKey(USER_ID, SESSION_KEY_ID, sessionKey), DP_SUCCESS);
+    SessionKeyManager::GetInstance().ClearSessionKeyCache();
+    EXPECT_TRUE(SessionKeyManager::GetInstance().sessionKeyCache_.empty());
+    EXPECT_EQ(SessionKeyManager::GetInstance().GetSessionKey(USER_ID, SESSION_KEY_ID, sessionKey), DP_SUCCESS);
+    EXPECT_EQ(AssetSystemApiMock::GetInstance().queryCount, 2);
+}
+
+/**
+ * @tc.name: PutSessionKeyToCache001
+ * @tc.desc: the cache stays bounded and evicts the least recently used key
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionKeyManagerCacheTest, PutSessionKeyToCache001, TestSize.Level1)
+{
+    constexpr int32_t keyCount = 100;
+    for (int32_t sessionKeyId = 0; sessionKeyId < keyCount; sessionKeyId++) {
+        SessionKeyManager::GetInstance().PutSessionKeyToCache(USER_ID, sessionKeyId, SESSION_KEY);
+    }
+    size_t cacheSize = SessionKeyManager::GetInstance().sessionKeyCache_.size();
+    EXPECT_LT(cacheSize, static_cast<size_t>(keyCount));
+    EXPECT_EQ(SessionKeyManager::GetInstance().sessionKeyUserIndex_.size(), cacheSize);
+    std::vector<uint8_t> sessionKey;
+    uint64_t generation = 0;
+    EXPECT_FALSE(SessionKeyManager::GetInstance().GetSessionKeyFromCache(USER_ID, 0, sessionKey, generation));
+    EXPECT_TRUE(SessionKeyManager::GetInstance().GetSessionKeyFromCache(USER_ID, keyCount - 1, sessionKey,
+        generation));
+}
+
+/**
+ * @tc.name: FillSessionKeyCache001
+ * @tc.desc: a key read before a delete is not cached after it
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionKeyManagerCacheTest, FillSessionKeyCache001, TestSize.Level1)
+{
+    AssetSystemApiMock::GetInstance().secrets[{USER_ID, SESSION_KEY_ID}] = SESSION_KEY;
+    std::vector<uint8_t> sessionKey;
+    uint64_t generation = 0;
+    EXPECT_FALSE(SessionKeyManager::GetInstance().GetSessionKeyFromCache(USER_ID, SESSION_KEY_ID, sessionKey,
+        generation));
+    // the delete runs between the asset read of a get and its cache fill
+    EXPECT_EQ(SessionKeyManager::GetInstance().DeleteSessionKey(USER_ID, SESSION_KEY_ID), DP_SUCCESS);
+    SessionKeyManager::GetInstance().FillSessionKeyCache(USER_ID, SESSION_KEY_ID, SESSION_KEY, generation);
+    EXPECT_TRUE(SessionKeyManager::GetInstance().sessionKeyCache_.empty());
+    EXPECT_NE(SessionKeyManager::GetInstance().GetSessionKey(USER_ID, SESSION_KEY_ID, sessionKey), DP_SUCCESS);
+
+    EXPECT_FALSE(SessionKeyManager::GetInstance().GetSessionKeyFromCache(USER_ID, SESSION_KEY_ID, sessionKey,
+        generation));
+    SessionKeyManager::GetInstance().FillSessionKeyCache(USER_ID, SESSION_KEY_ID, SESSION_KEY, generation);
+    EXPECT_EQ(SessionKeyManager::GetInstance().sessionKeyCache_.size(), 1);
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "distributed_device_profile_errors.h"
+#include "dp_metrics.h"
+
+#define private public
+#include "settings_data_manager.h"
+#undef private
+
+using namespace testing::ext;
+namespace OHOS {
+namespace DistributedDeviceProfile {
+using namespace std;
+namespace {
+    const std::string GLOBAL_PROXY_URI =
+        "datashare:///com.ohos.settingsdata/entry/settingsdata/SETTINGSDATA?Proxy=true";
+    const std::string SECURE_PROXY_URI =
+        "datashare:///com.ohos.settingsdata/entry/settingsdata/USER_SETTINGSDATA_SECURE_100?Proxy=true";
+    const std::string DEVICE_NAME_KEY = "settings.general.device_name";
+    const std::string DISPLAY_NAME_KEY = "settings.general.display_device_name";
+}
+
+class SettingsDataManagerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp()
+    {
+        SettingsDataManager::GetInstance().ReleaseIdleHelpers(true);
+    }
+    void TearDown()
+    {
+        SettingsDataManager::GetInstance().ReleaseIdleHelpers(true);
+    }
+};
+
+/**
+ * @tc.name: GetCachedValue001
+ * @tc.desc: a settings change drops only the value behind the changed uri
+ * @tc.type: FUNC
+ */
+HWTEST_F(SettingsDataManagerTest, GetCachedValue001, TestSize.Level1)
+{
+    SettingsDataManager& manager = SettingsDataManager::GetInstance();
+    std::string globalKey = manager.MakeUri(GLOBAL_PROXY_URI, DEVICE_NAME_KEY).ToString();
+    std::string secureKey = manager.MakeUri(SECURE_PROXY_URI, DISPLAY_NAME_KEY).ToString();
+    manager.PutCachedValue(globalKey, "phone", manager.GetCacheVersion());
+    manager.PutCachedValue(secureKey, "my phone", manager.GetCacheVersion());
+    std::string value;
+    EXPECT_TRUE(manager.GetCachedValue(globalKey, value));
+    EXPECT_EQ(value, "phone");
+
+    sptr<SettingsDataObserver> observer = sptr<SettingsDataObserver>(new SettingsDataObserver(globalKey));
+    observer->OnChange();
+    EXPECT_FALSE(manager.GetCachedValue(globalKey, value));
+    EXPECT_TRUE(manager.GetCachedValue(secureKey, value));
+    EXPECT_EQ(value, "my phone");
+}
+
+/**
+ * @tc.name: PutCachedValue001
+ * @tc.desc: a value read before a change is not cached after it
+ * @tc.type: FUNC
+ */
+HWTEST_F(SettingsDataManagerTest, PutCachedValue001, TestSize.Level1)
+{
+    SettingsDataManager& manager = SettingsDataManager::GetInstance();
+    std::string cacheKey = manager.MakeUri(GLOBAL_PROXY_URI, DEVICE_NAME_KEY).ToString();
+    uint64_t cacheVersion = manager.GetCacheVersion();
+    manager.OnSettingsDataChange(cacheKey);
+    manager.PutCachedValue(cacheKey, "stale", cacheVersion);
+    std::string value;
+    EXPECT_FALSE(manager.GetCachedValue(cacheKey, value));
+}
+
+/**
+ * @tc.name: ReleaseIdleHelpers001
+ * @tc.desc: releasing the pooled helpers also drops the values they guard
+ * @tc.type: FUNC
+ */
+HWTEST_F(SettingsDataManagerTest, ReleaseIdleHelpers001, TestSize.Level1)
+{
+    SettingsDataManager& manager = SettingsDataManager::GetInstance();
+    std::string cacheKey = manager.MakeUri(SECURE_PROXY_URI, DISPLAY_NAME_KEY).ToString();
+    manager.helperPool_[SECURE_PROXY_URI].lastUsedMs = 0;
+    manager.PutCachedValue(cacheKey, "my phone", manager.GetCacheVersion());
+    manager.ReleaseIdleHelpers(false);
+    EXPECT_TRUE(manager.helperPool_.empty());
+    std::string value;
+    EXPECT_FALSE(manager.GetCachedValue(cacheKey, value));
+}
+
+/**
+ * @tc.name: GetDeviceName001
+ * @tc.desc: repeated device name reads open at most one datashare connection
+ * @tc.type: FUNC
+ */
+HWTEST_F(SettingsDataManagerTest, GetDeviceName001, TestSize.Level1)
+{
+    uint64_t created = DpMetrics::GetInstance().GetCounter(DpMetricsCounter::DATASHARE_HELPER_CREATED);
+    std::string deviceName;
+    for (int32_t i = 0; i < 5; i++) {
+        SettingsDataManager::GetInstance().GetDeviceName(deviceName);
+    }
+    uint64_t createdDelta = DpMetrics::GetInstance().GetCounter(DpMetricsCounter::DATASHARE_HELPER_CREATED) - created;
+    EXPECT_LE(createdDelta, 1u);
+    EXPECT_LE(SettingsDataManager::GetInstance().helperPool_.size(), 1u);
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
@@ -18,6 +18,7 @@
 #include <fstream>
 
 #include "static_capability_loader.h"
+#include "static_profile_table.h"
 #include "config_policy_utils.h"
 #include "content_sensor_manager_utils.h"
 #include "distributed_device_profile_constants.h"
@@ -32,6 +33,52 @@ using namespace testing::ext;
 using namespace std;
 namespace {
     const std::string TAG = "StaticCapabilityLoaderTest";
+    const std::string STATIC_TABLE_TEST_PATH = "/data/local/tmp/dp_static_info_test.bin";
+    const std::string TEST_STATIC_VERSION = "1.0";
+    const std::string TEST_SERVICE_ID = "dmsfwk_svr_id";
+    const std::string TEST_ABILITY_VALUE = "{\n\t\"k\":\t1\n}";
+    constexpr uint32_t TEST_SOURCE_HASH = 0x5a5a5a5a;
+
+    void AppendBytes(std::string& buffer, const void* data, size_t size)
+    {
+        buffer.append(static_cast<const char*>(data), size);
+    }
+
+    // one static info version with a single ability, as dp_static_profile_compiler.py would emit it
+    void WriteStaticInfoTable(const std::string& path, bool corrupt)
+    {
+        std::string pool = TEST_STATIC_VERSION + TEST_SERVICE_ID + TEST_ABILITY_VALUE;
+        while ((sizeof(StaticTableHeader) + sizeof(StaticInfoRecord) + sizeof(StaticAbilityRecord) +
+            pool.size()) % sizeof(uint32_t) != 0) {
+            pool.push_back('\0');
+        }
+        uint32_t versionLen = static_cast<uint32_t>(TEST_STATIC_VERSION.size());
+        uint32_t serviceLen = static_cast<uint32_t>(TEST_SERVICE_ID.size());
+        uint32_t valueLen = static_cast<uint32_t>(TEST_ABILITY_VALUE.size());
+        StaticInfoRecord info = { { 0, versionLen }, STATIC_INFO_FLAG_IS_OBJECT |
+            STATIC_INFO_FLAG_HAS_VERSION | STATIC_INFO_FLAG_HAS_ABILITIES, 0, 1 };
+        StaticAbilityRecord ability = { { versionLen, serviceLen }, { versionLen + serviceLen, valueLen } };
+        std::string body;
+        AppendBytes(body, &info, sizeof(info));
+        AppendBytes(body, &ability, sizeof(ability));
+        body.append(pool);
+        uint32_t checksum = 0x811c9dc5;
+        for (unsigned char byte : body) {
+            checksum = (checksum ^ byte) * 0x01000193;
+        }
+        uint32_t secondaryOffset = sizeof(StaticTableHeader) + sizeof(StaticInfoRecord);
+        StaticTableHeader header = { STATIC_TABLE_MAGIC, STATIC_TABLE_FORMAT_VERSION,
+            static_cast<uint16_t>(StaticTableKind::INFO), TEST_SOURCE_HASH,
+            static_cast<uint32_t>(sizeof(StaticTableHeader) + body.size()), checksum,
+            sizeof(StaticTableHeader), 1, secondaryOffset, 1,
+            secondaryOffset + static_cast<uint32_t>(sizeof(StaticAbilityRecord)), static_cast<uint32_t>(pool.size()) };
+        if (corrupt) {
+            body[body.size() - 1] ^= 0x1;
+        }
+        std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+        ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        ofs.write(body.data(), body.size());
+    }
 }
 
 class StaticCapabilityLoaderTest : public testing::Test {
@@ -852,5 +899,57 @@ HWTEST_F(StaticCapabilityLoaderTest, UnInit_001, TestSize.Level1)
         StaticCapabilityLoader::GetInstance().UnInit();
     EXPECT_EQ(ret, DP_SUCCESS);
 }
+
+/*
+ * @tc.name: StaticProfileTable_001
+ * @tc.desc: profiles generated from the binary table match the json path
+ * @tc.type: FUNC
+ */
+HWTEST_F(StaticCapabilityLoaderTest, StaticProfileTable_001, TestSize.Level1)
+{
+    WriteStaticInfoTable(STATIC_TABLE_TEST_PATH, false);
+    std::shared_ptr<StaticProfileTable> table =
+        StaticProfileTable::OpenFile(STATIC_TABLE_TEST_PATH, StaticTableKind::INFO, TEST_SOURCE_HASH);
+    ASSERT_NE(table, nullptr);
+    EXPECT_EQ(table->GetRecordCount(), 1);
+    EXPECT_EQ(table->GetCapabilityRecord(0), nullptr);
+
+    std::string deviceId = "deviceId";
+    std::string staticCapability = "1000";
+    std::unordered_map<std::string, CharacteristicProfile> charProfiles;
+    int32_t ret = StaticCapabilityLoader::GetInstance().GetStaticInfoByVersion(deviceId, staticCapability,
+        *table, TEST_STATIC_VERSION, charProfiles);
+    EXPECT_EQ(ret, DP_SUCCESS);
+    ASSERT_EQ(charProfiles.size(), 1);
+    EXPECT_EQ(charProfiles.begin()->second.GetServiceName(), TEST_SERVICE_ID);
+    EXPECT_EQ(charProfiles.begin()->second.GetCharacteristicValue(), TEST_ABILITY_VALUE);
+
+    charProfiles.clear();
+    std::string staticVersion = "";
+    ret = StaticCapabilityLoader::GetInstance().GetStaticInfo(*table, "0000", staticVersion, charProfiles);
+    EXPECT_EQ(ret, DP_SUCCESS);
+    EXPECT_EQ(staticVersion, TEST_STATIC_VERSION);
+    EXPECT_TRUE(charProfiles.empty());
+    remove(STATIC_TABLE_TEST_PATH.c_str());
+}
+
+/*
+ * @tc.name: StaticProfileTable_002
+ * @tc.desc: stale or corrupt tables are rejected so the loader falls back to json
+ * @tc.type: FUNC
+ */
+HWTEST_F(StaticCapabilityLoaderTest, StaticProfileTable_002, TestSize.Level1)
+{
+    WriteStaticInfoTable(STATIC_TABLE_TEST_PATH, false);
+    EXPECT_EQ(StaticProfileTable::OpenFile(STATIC_TABLE_TEST_PATH, StaticTableKind::INFO, TEST_SOURCE_HASH + 1),
+        nullptr);
+    EXPECT_EQ(StaticProfileTable::OpenFile(STATIC_TABLE_TEST_PATH, StaticTableKind::CAPABILITY, 0), nullptr);
+    EXPECT_NE(StaticProfileTable::OpenFile(STATIC_TABLE_TEST_PATH, StaticTableKind::INFO, 0), nullptr);
+    WriteStaticInfoTable(STATIC_TABLE_TEST_PATH, true);
+    EXPECT_EQ(StaticProfileTable::OpenFile(STATIC_TABLE_TEST_PATH, StaticTableKind::INFO, TEST_SOURCE_HASH),
+        nullptr);
+    remove(STATIC_TABLE_TEST_PATH.c_str());
+    EXPECT_EQ(StaticProfileTable::OpenFile(STATIC_TABLE_TEST_PATH, StaticTableKind::INFO, 0), nullptr);
+}
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
@@ -25,7 +25,6 @@
 #include "i_sync_completed_callback.h"
 #include "profile_cache.h"
 #include "static_profile_manager.h"
-#include "sync_completed_callback_stub.h"
 using namespace testing::ext;
 namespace OHOS {
 namespace DistributedDeviceProfile {
@@ -57,12 +56,6 @@ void StaticProfileManagerTest::TearDown()
 {
 }
 
-class SyncCallback : public SyncCompletedCallbackStub {
-public:
-    void OnSyncCompleted(const map<string, SyncStatus>& syncResults) {
-    }
-};
-
 /*
  * @tc.name: Init_001
  * @tc.desc: Init
@@ -301,41 +294,69 @@ HWTEST_F(StaticProfileManagerTest, GenerateStaticInfoProfile_005, TestSize.Level
     EXPECT_EQ(result, DP_PARSE_STATIC_CAP_FAIL);
 }
 
-/**
- * @tc.name: AddSyncListener001
- * @tc.desc: AddSyncListener all.
+/*
+ * @tc.name: GetStaticInfoIndex_001
+ * @tc.desc: an invalid static capability is rejected and leaves no index behind
+ * @tc.type: FUNC
+ */
+HWTEST_F(StaticProfileManagerTest, GetStaticInfoIndex_001, TestSize.Level1)
+{
+    StaticProfileManager::GetInstance().ClearStaticInfoIndex();
+    CharacteristicProfile staticCapabilityProfile("deviceId_index", STATIC_CAPABILITY_SVR_ID,
+        STATIC_CAPABILITY_CHAR_ID, "invalid_json");
+    std::shared_ptr<const StaticProfileManager::StaticInfoIndex> index = nullptr;
+    int32_t ret = StaticProfileManager::GetInstance().GetStaticInfoIndex(staticCapabilityProfile, index);
+    EXPECT_EQ(ret, DP_PARSE_STATIC_CAP_FAIL);
+    EXPECT_EQ(index, nullptr);
+    EXPECT_TRUE(StaticProfileManager::GetInstance().deviceStaticInfos_.empty());
+}
+
+/*
+ * @tc.name: GetStaticInfoIndex_002
+ * @tc.desc: peers with the same static capability share one index, a changed capability is reparsed
+ * @tc.type: FUNC
+ */
+HWTEST_F(StaticProfileManagerTest, GetStaticInfoIndex_002, TestSize.Level1)
+{
+    StaticProfileManager& manager = StaticProfileManager::GetInstance();
+    manager.ClearStaticInfoIndex();
+    auto seeded = std::make_shared<StaticProfileManager::StaticInfoIndex>();
+    seeded->charValues["serviceName_index"] = "charValue_index";
+    manager.staticInfoIndexes_["1.0#cap_index"] = seeded;
+    std::string charValue = R"({"staticCapabilityVersion":"1.0","staticCapabilityValue":"cap_index"})";
+    CharacteristicProfile first("deviceId_first", STATIC_CAPABILITY_SVR_ID, STATIC_CAPABILITY_CHAR_ID, charValue);
+    CharacteristicProfile second("deviceId_second", STATIC_CAPABILITY_SVR_ID, STATIC_CAPABILITY_CHAR_ID, charValue);
+    std::shared_ptr<const StaticProfileManager::StaticInfoIndex> firstIndex = nullptr;
+    std::shared_ptr<const StaticProfileManager::StaticInfoIndex> secondIndex = nullptr;
+    EXPECT_EQ(manager.GetStaticInfoIndex(first, firstIndex), DP_SUCCESS);
+    EXPECT_EQ(manager.GetStaticInfoIndex(second, secondIndex), DP_SUCCESS);
+    EXPECT_EQ(firstIndex, seeded);
+    EXPECT_EQ(secondIndex, seeded);
+    EXPECT_EQ(manager.deviceStaticInfos_.size(), 2);
+
+    CharacteristicProfile changed("deviceId_first", STATIC_CAPABILITY_SVR_ID, STATIC_CAPABILITY_CHAR_ID,
+        "invalid_json");
+    std::shared_ptr<const StaticProfileManager::StaticInfoIndex> changedIndex = nullptr;
+    EXPECT_EQ(manager.GetStaticInfoIndex(changed, changedIndex), DP_PARSE_STATIC_CAP_FAIL);
+    manager.ClearStaticInfoIndex();
+    EXPECT_TRUE(manager.staticInfoIndexes_.empty());
+}
+/*
+ * @tc.name: GetStaticInfoIndex_003
+ * @tc.desc: a failed load returns its error and caches no index
  * @tc.type: FUNC
- * @tc.require:
  */
-HWTEST_F(StaticProfileManagerTest, AddSyncListener001, TestSize.Level1)
+HWTEST_F(StaticProfileManagerTest, GetStaticInfoIndex_003, TestSize.Level1)
 {
-    string caller = "caller";
-    OHOS::sptr<OHOS::IRemoteObject> syncListener = OHOS::sptr<SyncCompletedCallbackStub>(new SyncCallback());
-
-    int32_t ret1 = StaticProfileManager::GetInstance().AddSyncListener(caller, syncListener);
-    EXPECT_EQ(DP_SUCCESS, ret1);
-
-    for (int32_t i = 0; i < MAX_LISTENER_SIZE + 5; i++) {
-        string caller = "caller" + std::to_string(i);
-        OHOS::sptr<OHOS::IRemoteObject> syncListener1 = OHOS::sptr<SyncCompletedCallbackStub>(new SyncCallback());
-        StaticProfileManager::GetInstance().syncListenerMap_[caller] = syncListener1;
-    }
-    int32_t ret2 = StaticProfileManager::GetInstance().AddSyncListener(caller, syncListener);
-    EXPECT_EQ(DP_EXCEED_MAX_SIZE_FAIL, ret2);
-
-    syncListener = nullptr;
-    int32_t ret3 = StaticProfileManager::GetInstance().AddSyncListener(caller, syncListener);
-    EXPECT_EQ(DP_INVALID_PARAMS, ret3);
-
-    for (int32_t i = 0; i < MAX_STRING_LEN + 5; i++) {
-        caller += 'a';
-    }
-    int32_t ret4 = StaticProfileManager::GetInstance().AddSyncListener(caller, syncListener);
-    EXPECT_EQ(DP_INVALID_PARAMS, ret4);
-
-    caller = "";
-    int32_t ret5 = StaticProfileManager::GetInstance().AddSyncListener(caller, syncListener);
-    EXPECT_EQ(DP_INVALID_PARAMS, ret5);
+    StaticProfileManager& manager = StaticProfileManager::GetInstance();
+    manager.ClearStaticInfoIndex();
+    std::string charValue = R"({"staticCapabilityVersion":"","staticCapabilityValue":"cap_index"})";
+    CharacteristicProfile profile("deviceId_load", STATIC_CAPABILITY_SVR_ID, STATIC_CAPABILITY_CHAR_ID, charValue);
+    std::shared_ptr<const StaticProfileManager::StaticInfoIndex> index = nullptr;
+    EXPECT_EQ(manager.GetStaticInfoIndex(profile, index), DP_INVALID_PARAM);
+    EXPECT_EQ(index, nullptr);
+    EXPECT_TRUE(manager.staticInfoIndexes_.empty());
+    EXPECT_TRUE(manager.deviceStaticInfos_.empty());
 }
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
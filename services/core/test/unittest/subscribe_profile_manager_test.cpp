@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <functional>
 #include <gtest/gtest.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -20,6 +21,8 @@
 #include <vector>
 #include <iostream>
 
+#include "ipc_skeleton.h"
+
 #define private public
 #define protected public
 #include "distributed_device_profile_constants.h"
@@ -1320,5 +1323,443 @@ HWTEST_F(SubscribeProfileManagerTest, NotifyAccountAclActive_003, TestSize.Level
     errCode = SubscribeProfileManager::GetInstance().NotifyAccountAclActive(profile);
     EXPECT_EQ(errCode, DP_SUCCESS);
 }
+
+class CountDPChangeListener : public SubscribeDPChangeListener {
+public:
+    int32_t OnCharacteristicProfileUpdate(const CharacteristicProfile &oldProfile,
+        const CharacteristicProfile &newProfile)
+    {
+        updateCount++;
+        return 0;
+    }
+    int32_t updateCount = 0;
+};
+
+/*
+ * @tc.name: ReplayMissedChanges_001
+ * @tc.desc: a subscriber that missed changes gets them once when it subscribes again
+ * @tc.type: FUNC
+ */
+HWTEST_F(SubscribeProfileManagerTest, ReplayMissedChanges_001, TestSize.Level1)
+{
+    string dbKey = "char#deviceId#serviceName#characteristicKey#characteristicValue";
+    int32_t saId = 4801;
+    unordered_set<ProfileChangeType> subscribeTypes = {
+        ProfileChangeType::CHAR_PROFILE_UPDATE,
+    };
+    OHOS::sptr<CountDPChangeListener> listener = OHOS::sptr<CountDPChangeListener>(new CountDPChangeListener);
+    SubscribeInfo subscribeInfo(saId, dbKey, subscribeTypes, listener);
+    SubscribeProfileManager& manager = SubscribeProfileManager::GetInstance();
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    EXPECT_EQ(manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "0"), DP_SUCCESS);
+    EXPECT_EQ(listener->updateCount, 1);
+
+    // as if the listener died before the next two changes
+    uint64_t fromSeq = manager.changeLog_.GetLastSeq(ProfileType::CHAR_PROFILE) + 1;
+    manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "1");
+    manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "0");
+    EXPECT_EQ(listener->updateCount, 3);
+    {
+        std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+        manager.missedChanges_[{ saId, dbKey }] = { ProfileType::CHAR_PROFILE, fromSeq };
+    }
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    EXPECT_EQ(listener->updateCount, 5);
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    EXPECT_EQ(listener->updateCount, 5);
+    EXPECT_EQ(manager.UnSubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+}
+
+// A listener whose death the test decides. It records the values it gets and can make a change of its own
+// while it gets one, the way a live change racing a replay would.
+class RecordDPChangeListener : public SubscribeDPChangeListener {
+public:
+    bool IsObjectDead() const override
+    {
+        return isDead;
+    }
+    int32_t OnCharacteristicProfileUpdate(const CharacteristicProfile &oldProfile,
+        const CharacteristicProfile &newProfile)
+    {
+        values.push_back(newProfile.GetCharacteristicValue());
+        if (onUpdate != nullptr) {
+            auto func = std::move(onUpdate);
+            onUpdate = nullptr;
+            func();
+        }
+        return 0;
+    }
+    int32_t OnCharacteristicProfileDelete(const CharacteristicProfile &profile)
+    {
+        deleteCount++;
+        return 0;
+    }
+    bool isDead = false;
+    vector<string> values;
+    int32_t deleteCount = 0;
+    std::function<void()> onUpdate = nullptr;
+};
+
+/*
+ * @tc.name: ReplayMissedChanges_002
+ * @tc.desc: the changes made while the listener was dead are replayed from the first one it missed
+ * @tc.type: FUNC
+ */
+HWTEST_F(SubscribeProfileManagerTest, ReplayMissedChanges_002, TestSize.Level1)
+{
+    string dbKey = "char#deviceId#serviceName#deadKey#characteristicValue";
+    int32_t saId = 4801;
+    unordered_set<ProfileChangeType> subscribeTypes = {
+        ProfileChangeType::CHAR_PROFILE_UPDATE,
+    };
+    OHOS::sptr<RecordDPChangeListener> listener = OHOS::sptr<RecordDPChangeListener>(new RecordDPChangeListener);
+    SubscribeInfo subscribeInfo(saId, dbKey, subscribeTypes, listener);
+    SubscribeProfileManager& manager = SubscribeProfileManager::GetInstance();
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "0");
+    {
+        std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+        EXPECT_EQ(manager.missedChanges_.count({ saId, dbKey }), 0);
+    }
+
+    listener->isDead = true;
+    uint64_t firstMissedSeq = manager.changeLog_.GetLastSeq(ProfileType::CHAR_PROFILE) + 1;
+    manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "1");
+    manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "2");
+    {
+        std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+        auto iter = manager.missedChanges_.find({ saId, dbKey });
+        ASSERT_NE(iter, manager.missedChanges_.end());
+        EXPECT_EQ(iter->second.first, ProfileType::CHAR_PROFILE);
+        EXPECT_EQ(iter->second.second, firstMissedSeq);
+    }
+
+    listener->isDead = false;
+    listener->values.clear();
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    EXPECT_EQ(listener->values, vector<string>({ "1", "2" }));
+    EXPECT_EQ(manager.UnSubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+}
+
+/*
+ * @tc.name: ReplayMissedChanges_003
+ * @tc.desc: a live change made during the replay reaches the subscriber after the replayed ones
+ * @tc.type: FUNC
+ */
+HWTEST_F(SubscribeProfileManagerTest, ReplayMissedChanges_003, TestSize.Level1)
+{
+    string dbKey = "char#deviceId#serviceName#raceKey#characteristicValue";
+    int32_t saId = 4801;
+    unordered_set<ProfileChangeType> subscribeTypes = {
+        ProfileChangeType::CHAR_PROFILE_UPDATE,
+    };
+    OHOS::sptr<RecordDPChangeListener> listener = OHOS::sptr<RecordDPChangeListener>(new RecordDPChangeListener);
+    SubscribeInfo subscribeInfo(saId, dbKey, subscribeTypes, listener);
+    SubscribeProfileManager& manager = SubscribeProfileManager::GetInstance();
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    listener->isDead = true;
+    manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "1");
+    manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "2");
+
+    listener->isDead = false;
+    listener->values.clear();
+    listener->onUpdate = [&manager, &dbKey]() {
+        manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "3");
+    };
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    EXPECT_EQ(listener->values, vector<string>({ "1", "2", "3" }));
+    {
+        std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+        EXPECT_TRUE(manager.replayingSubscribes_.empty());
+    }
+    // caught up, the next change is live again
+    manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "4");
+    EXPECT_EQ(listener->values.back(), "4");
+    EXPECT_EQ(manager.UnSubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+}
+
+/*
+ * @tc.name: ReplayMissedChanges_004
+ * @tc.desc: when the log lost the missed changes the current value of the key is delivered instead
+ * @tc.type: FUNC
+ */
+HWTEST_F(SubscribeProfileManagerTest, ReplayMissedChanges_004, TestSize.Level1)
+{
+    string dbKey = "char#deviceId#serviceName#lostKey#characteristicValue";
+    int32_t saId = 4801;
+    unordered_set<ProfileChangeType> subscribeTypes = {
+        ProfileChangeType::CHAR_PROFILE_UPDATE,
+        ProfileChangeType::CHAR_PROFILE_DELETE,
+    };
+    OHOS::sptr<RecordDPChangeListener> listener = OHOS::sptr<RecordDPChangeListener>(new RecordDPChangeListener);
+    SubscribeInfo subscribeInfo(saId, dbKey, subscribeTypes, listener);
+    SubscribeProfileManager& manager = SubscribeProfileManager::GetInstance();
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    listener->isDead = true;
+    manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "1");
+    {
+        // as if the key's changes were pushed out of the log
+        std::lock_guard<std::mutex> lock(manager.changeLog_.logMutex_);
+        auto& typeLog = manager.changeLog_.typeLogs_[ProfileType::CHAR_PROFILE];
+        typeLog.records.clear();
+        typeLog.evictedSeq = typeLog.lastSeq;
+        manager.changeLog_.lastChanges_.erase(dbKey);
+    }
+
+    listener->isDead = false;
+    listener->values.clear();
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    // the key is not in the store, so it is delivered as deleted
+    EXPECT_TRUE(listener->values.empty());
+    EXPECT_EQ(listener->deleteCount, 1);
+    EXPECT_EQ(manager.UnSubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+}
+
+/*
+ * @tc.name: ReplayMissedChanges_005
+ * @tc.desc: a replay that never catches up is released to live delivery after a bounded number of rounds
+ * @tc.type: FUNC
+ */
+HWTEST_F(SubscribeProfileManagerTest, ReplayMissedChanges_005, TestSize.Level1)
+{
+    string dbKey = "char#deviceId#serviceName#busyKey#characteristicValue";
+    int32_t saId = 4801;
+    unordered_set<ProfileChangeType> subscribeTypes = {
+        ProfileChangeType::CHAR_PROFILE_UPDATE,
+    };
+    OHOS::sptr<RecordDPChangeListener> listener = OHOS::sptr<RecordDPChangeListener>(new RecordDPChangeListener);
+    SubscribeInfo subscribeInfo(saId, dbKey, subscribeTypes, listener);
+    SubscribeProfileManager& manager = SubscribeProfileManager::GetInstance();
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    listener->isDead = true;
+    manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "0");
+
+    // every change delivered makes another one, more than the replay has rounds
+    constexpr int32_t changeCount = 20;
+    int32_t made = 0;
+    int32_t liveCount = 0;
+    std::function<void()> makeChange = [&]() {
+        {
+            std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+            liveCount += manager.replayingSubscribes_.empty() ? 1 : 0;
+        }
+        if (++made < changeCount) {
+            listener->onUpdate = makeChange;
+        }
+        manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, std::to_string(made));
+    };
+    listener->isDead = false;
+    listener->values.clear();
+    listener->onUpdate = makeChange;
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    EXPECT_GT(liveCount, 0);
+    EXPECT_EQ(listener->values.back(), std::to_string(changeCount));
+    {
+        std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+        EXPECT_TRUE(manager.replayingSubscribes_.empty());
+    }
+    EXPECT_EQ(manager.UnSubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+}
+
+/*
+ * @tc.name: RestoreSubscribe_001
+ * @tc.desc: a restored subscription gets the changes made before its caller subscribed again
+ * @tc.type: FUNC
+ */
+HWTEST_F(SubscribeProfileManagerTest, RestoreSubscribe_001, TestSize.Level1)
+{
+    string dbKey = "char#deviceId#serviceName#restoreKey#characteristicValue";
+    string staleKey = "char#deviceId#serviceName#staleKey#characteristicValue";
+    string otherKey = "char#deviceId#serviceName#otherTokenKey#characteristicValue";
+    int32_t saId = 4801;
+    SubscribeProfileManager& manager = SubscribeProfileManager::GetInstance();
+    {
+        std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+        manager.restoredSubscribes_[dbKey][saId] = IPCSkeleton::GetCallingTokenID();
+        manager.restoredSubscribes_[staleKey][saId] = IPCSkeleton::GetCallingTokenID();
+        manager.restoredSubscribes_[otherKey][saId] = IPCSkeleton::GetCallingTokenID() + 1;
+    }
+    manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "1");
+
+    unordered_set<ProfileChangeType> subscribeTypes = {
+        ProfileChangeType::CHAR_PROFILE_UPDATE,
+    };
+    OHOS::sptr<CountDPChangeListener> listener = OHOS::sptr<CountDPChangeListener>(new CountDPChangeListener);
+    SubscribeInfo subscribeInfo(saId, dbKey, subscribeTypes, listener);
+    map<string, SubscribeInfo> subscribeInfos = { { dbKey + SEPARATOR + to_string(saId), subscribeInfo } };
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfos), DP_SUCCESS);
+    EXPECT_EQ(listener->updateCount, 1);
+    {
+        // the caller did not send staleKey again, it no longer subscribes to it
+        std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+        EXPECT_EQ(manager.restoredSubscribes_.count(dbKey), 0);
+        EXPECT_EQ(manager.restoredSubscribes_.count(staleKey), 0);
+        // the same saId of another caller's token is not this caller's to drop
+        EXPECT_EQ(manager.restoredSubscribes_.count(otherKey), 1);
+        manager.restoredSubscribes_.erase(otherKey);
+        EXPECT_EQ(manager.persistedSubscribes_.count({ saId, staleKey }), 0);
+        EXPECT_EQ(manager.persistedSubscribes_.count({ saId, dbKey }), 1);
+    }
+    EXPECT_EQ(manager.UnSubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+    EXPECT_EQ(manager.persistedSubscribes_.count({ saId, dbKey }), 0);
+}
+
+/*
+ * @tc.name: RestoreSubscribe_002
+ * @tc.desc: what a restored subscription of another caller missed is not replayed
+ * @tc.type: FUNC
+ */
+HWTEST_F(SubscribeProfileManagerTest, RestoreSubscribe_002, TestSize.Level1)
+{
+    string dbKey = "char#deviceId#serviceName#restoreKey#characteristicValue";
+    int32_t saId = 4801;
+    SubscribeProfileManager& manager = SubscribeProfileManager::GetInstance();
+    {
+        std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+        manager.restoredSubscribes_[dbKey][saId] = IPCSkeleton::GetCallingTokenID() + 1;
+    }
+    manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "1");
+
+    unordered_set<ProfileChangeType> subscribeTypes = {
+        ProfileChangeType::CHAR_PROFILE_UPDATE,
+    };
+    OHOS::sptr<CountDPChangeListener> listener = OHOS::sptr<CountDPChangeListener>(new CountDPChangeListener);
+    SubscribeInfo subscribeInfo(saId, dbKey, subscribeTypes, listener);
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    EXPECT_EQ(listener->updateCount, 0);
+    EXPECT_EQ(manager.UnSubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+}
+
+/*
+ * @tc.name: RestoreSubscribe_003
+ * @tc.desc: a subscription is restored from the store after a restart and replayed once its caller is back
+ * @tc.type: FUNC
+ */
+HWTEST_F(SubscribeProfileManagerTest, RestoreSubscribe_003, TestSize.Level1)
+{
+    string dbKey = "char#deviceId#serviceName#roundTripKey#characteristicValue";
+    int32_t saId = 4802;
+    string storeKey = to_string(saId) + SEPARATOR + dbKey;
+    SubscribeProfileManager& manager = SubscribeProfileManager::GetInstance();
+    ASSERT_NE(manager.subscribeStore_, nullptr);
+    unordered_set<ProfileChangeType> subscribeTypes = {
+        ProfileChangeType::CHAR_PROFILE_UPDATE,
+    };
+    OHOS::sptr<RecordDPChangeListener> listener = OHOS::sptr<RecordDPChangeListener>(new RecordDPChangeListener);
+    SubscribeInfo subscribeInfo(saId, dbKey, subscribeTypes, listener);
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+
+    // as if the service restarted
+    EXPECT_EQ(manager.UnInit(), DP_SUCCESS);
+    EXPECT_EQ(manager.Init(), DP_SUCCESS);
+    ASSERT_NE(manager.subscribeStore_, nullptr);
+    {
+        std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+        auto iter = manager.restoredSubscribes_.find(dbKey);
+        ASSERT_NE(iter, manager.restoredSubscribes_.end());
+        ASSERT_EQ(iter->second.count(saId), 1);
+        EXPECT_EQ(iter->second[saId], IPCSkeleton::GetCallingTokenID());
+        EXPECT_EQ(manager.persistedSubscribes_.count({ saId, dbKey }), 1);
+    }
+    manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "1");
+    manager.NotifyProfileChange(ProfileType::CHAR_PROFILE, ChangeType::UPDATE, dbKey, "2");
+    EXPECT_TRUE(listener->values.empty());
+
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    EXPECT_EQ(listener->values, vector<string>({ "1", "2" }));
+    {
+        std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+        EXPECT_EQ(manager.restoredSubscribes_.count(dbKey), 0);
+    }
+    EXPECT_EQ(manager.UnSubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    string value;
+    EXPECT_NE(manager.subscribeStore_->Get(storeKey, value), DP_SUCCESS);
+}
+
+/*
+ * @tc.name: RestoreSubscribe_004
+ * @tc.desc: a restored subscription whose caller does not come back is dropped after a few restarts
+ * @tc.type: FUNC
+ */
+HWTEST_F(SubscribeProfileManagerTest, RestoreSubscribe_004, TestSize.Level1)
+{
+    string dbKey = "char#deviceId#serviceName#expireKey#characteristicValue";
+    int32_t saId = 4802;
+    string storeKey = to_string(saId) + SEPARATOR + dbKey;
+    SubscribeProfileManager& manager = SubscribeProfileManager::GetInstance();
+    ASSERT_NE(manager.subscribeStore_, nullptr);
+    unordered_set<ProfileChangeType> subscribeTypes = {
+        ProfileChangeType::CHAR_PROFILE_UPDATE,
+    };
+    OHOS::sptr<CountDPChangeListener> listener = OHOS::sptr<CountDPChangeListener>(new CountDPChangeListener);
+    SubscribeInfo subscribeInfo(saId, dbKey, subscribeTypes, listener);
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+
+    for (int32_t i = 0; i < MAX_SUBSCRIBE_RESTORE_COUNT; i++) {
+        EXPECT_EQ(manager.UnInit(), DP_SUCCESS);
+        EXPECT_EQ(manager.Init(), DP_SUCCESS);
+        std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+        EXPECT_EQ(manager.restoredSubscribes_.count(dbKey), 1);
+    }
+    EXPECT_EQ(manager.UnInit(), DP_SUCCESS);
+    EXPECT_EQ(manager.Init(), DP_SUCCESS);
+    {
+        std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+        EXPECT_EQ(manager.restoredSubscribes_.count(dbKey), 0);
+        EXPECT_EQ(manager.persistedSubscribes_.count({ saId, dbKey }), 0);
+    }
+    ASSERT_NE(manager.subscribeStore_, nullptr);
+    string value;
+    EXPECT_NE(manager.subscribeStore_->Get(storeKey, value), DP_SUCCESS);
+}
+
+/*
+ * @tc.name: RestoreSubscribe_005
+ * @tc.desc: with the persisted subscriptions full, a new one takes the place of a restored one
+ * @tc.type: FUNC
+ */
+HWTEST_F(SubscribeProfileManagerTest, RestoreSubscribe_005, TestSize.Level1)
+{
+    string dbKey = "char#deviceId#serviceName#fullKey#characteristicValue";
+    string restoredKey = "char#deviceId#serviceName#evictKey#characteristicValue";
+    string fillKey = "char#deviceId#serviceName#fillKey";
+    int32_t saId = 4803;
+    SubscribeProfileManager& manager = SubscribeProfileManager::GetInstance();
+    size_t restoredSize = 0;
+    {
+        std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+        manager.restoredSubscribes_[restoredKey][saId] = IPCSkeleton::GetCallingTokenID();
+        manager.persistedSubscribes_[{ saId, restoredKey }] = "{}";
+        for (int32_t i = 0; manager.persistedSubscribes_.size() < static_cast<size_t>(MAX_SUBSCRIBE_INFO_SIZE); i++) {
+            manager.persistedSubscribes_[{ saId, fillKey + to_string(i) }] = "{}";
+        }
+        for (const auto& [subscribeKey, saIds] : manager.restoredSubscribes_) {
+            restoredSize += saIds.size();
+        }
+    }
+    unordered_set<ProfileChangeType> subscribeTypes = {
+        ProfileChangeType::CHAR_PROFILE_UPDATE,
+    };
+    OHOS::sptr<CountDPChangeListener> listener = OHOS::sptr<CountDPChangeListener>(new CountDPChangeListener);
+    SubscribeInfo subscribeInfo(saId, dbKey, subscribeTypes, listener);
+    EXPECT_EQ(manager.SubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+    {
+        std::lock_guard<std::mutex> lock(manager.subscribeMutex_);
+        EXPECT_EQ(manager.persistedSubscribes_.size(), static_cast<size_t>(MAX_SUBSCRIBE_INFO_SIZE));
+        EXPECT_EQ(manager.persistedSubscribes_.count({ saId, dbKey }), 1);
+        size_t newRestoredSize = 0;
+        for (const auto& [subscribeKey, saIds] : manager.restoredSubscribes_) {
+            newRestoredSize += saIds.size();
+        }
+        EXPECT_EQ(newRestoredSize + 1, restoredSize);
+        for (auto iter = manager.persistedSubscribes_.begin(); iter != manager.persistedSubscribes_.end();) {
+            iter = iter->first.second.find(fillKey) == 0 ? manager.persistedSubscribes_.erase(iter) : std::next(iter);
+        }
+        manager.restoredSubscribes_.erase(restoredKey);
+        manager.persistedSubscribes_.erase({ saId, restoredKey });
+    }
+    EXPECT_EQ(manager.UnSubscribeDeviceProfile(subscribeInfo), DP_SUCCESS);
+}
 }
 }
\ No newline at end of file
@@ -169,5 +169,30 @@ HWTEST_F(SwitchProfileManagerTest, HandleSwitchUpdateChange_001, TestSize.Level1
     SwitchUpdater::GetInstance().EraseSwitchCacheMap(netWorkId);
     EXPECT_EQ(0, SwitchUpdater::GetInstance().switchCacheMap_.count(netWorkId));
 }
+
+/*
+ * @tc.name: ExchangeLastSwitch_001
+ * @tc.desc: only the bits flipped since the last switch of a device are reported as changed
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(SwitchProfileManagerTest, ExchangeLastSwitch_001, TestSize.Level1)
+{
+    std::string udid = "exchangeLastSwitchUdid";
+    bool isFirstSwitch = false;
+    uint32_t changedBits = SwitchUpdater::GetInstance().ExchangeLastSwitch(udid, 0b00101, isFirstSwitch);
+    EXPECT_TRUE(isFirstSwitch);
+    EXPECT_EQ(changedBits, 0b11111);
+    changedBits = SwitchUpdater::GetInstance().ExchangeLastSwitch(udid, 0b00110, isFirstSwitch);
+    EXPECT_FALSE(isFirstSwitch);
+    EXPECT_EQ(changedBits, 0b00011);
+    changedBits = SwitchUpdater::GetInstance().ExchangeLastSwitch(udid, 0b100110, isFirstSwitch);
+    EXPECT_EQ(changedBits, 0);
+    SwitchUpdater::GetInstance().HandleSwitchUpdateChange(udid, 0b01110);
+    EXPECT_EQ(SwitchUpdater::GetInstance().lastSwitchMap_[udid], 0b01110);
+    SwitchUpdater::GetInstance().HandleSwitchUpdateChange("", 0b00000);
+    EXPECT_EQ(SwitchUpdater::GetInstance().lastSwitchMap_.count(""), 0);
+    SwitchUpdater::GetInstance().lastSwitchMap_.erase(udid);
+}
 } // namespace DistributedDeviceProfile
 } // namespace OHOS
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "distributed_device_profile_errors.h"
+#include "sync_completed_callback_stub.h"
+#include "sync_scheduler.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace DistributedDeviceProfile {
+using namespace std;
+namespace {
+    const std::string DEVICE_A = "networkId_a";
+    const std::string DEVICE_B = "networkId_b";
+    const std::string DEVICE_C = "networkId_c";
+    const std::string DEVICE_D = "networkId_d";
+}
+
+// Stands in for the kv store: records every sync call and answers with a preset result.
+class FakeKvSync {
+public:
+    int32_t Sync(const std::vector<std::string>& deviceIds, SyncMode syncMode)
+    {
+        calls.emplace_back(deviceIds, syncMode);
+        return result;
+    }
+
+    std::vector<std::pair<std::vector<std::string>, SyncMode>> calls;
+    int32_t result = DP_SUCCESS;
+};
+
+class CountingSyncCallback : public SyncCompletedCallbackStub {
+public:
+    void OnSyncCompleted(const map<string, SyncStatus>& syncResults)
+    {
+        callCount++;
+        lastResults = syncResults;
+    }
+
+    int32_t callCount = 0;
+    map<string, SyncStatus> lastResults;
+};
+
+class SyncSchedulerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+
+    std::shared_ptr<SyncScheduler> CreateScheduler(FakeKvSync& fakeKv, uint32_t maxInFlight)
+    {
+        auto syncFunc = [&fakeKv](const std::vector<std::string>& deviceIds, SyncMode syncMode) {
+            return fakeKv.Sync(deviceIds, syncMode);
+        };
+        return std::make_shared<SyncScheduler>("sync_scheduler_test", syncFunc, maxInFlight);
+    }
+};
+
+/**
+ * @tc.name: Schedule001
+ * @tc.desc: invalid params are rejected without touching the kv store
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, Schedule001, TestSize.Level1)
+{
+    FakeKvSync fakeKv;
+    auto scheduler = CreateScheduler(fakeKv, 1);
+    EXPECT_EQ(scheduler->Schedule({}, SyncMode::PUSH, nullptr), DP_INVALID_PARAMS);
+    EXPECT_EQ(scheduler->Schedule({DEVICE_A}, SyncMode::MAX, nullptr), DP_INVALID_PARAMS);
+    EXPECT_TRUE(fakeKv.calls.empty());
+}
+
+/**
+ * @tc.name: Schedule002
+ * @tc.desc: requests for a syncing peer collapse into one follow-up sync and every caller is answered
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, Schedule002, TestSize.Level1)
+{
+    FakeKvSync fakeKv;
+    auto scheduler = CreateScheduler(fakeKv, 1);
+    sptr<CountingSyncCallback> first = sptr<CountingSyncCallback>(new CountingSyncCallback());
+    sptr<CountingSyncCallback> second = sptr<CountingSyncCallback>(new CountingSyncCallback());
+    sptr<CountingSyncCallback> third = sptr<CountingSyncCallback>(new CountingSyncCallback());
+    EXPECT_EQ(scheduler->Schedule({DEVICE_A}, SyncMode::PUSH, first), DP_SUCCESS);
+    EXPECT_EQ(scheduler->Schedule({DEVICE_A}, SyncMode::PUSH, second), DP_SUCCESS);
+    EXPECT_EQ(scheduler->Schedule({DEVICE_A}, SyncMode::PULL, third), DP_SUCCESS);
+    ASSERT_EQ(fakeKv.calls.size(), 1);
+    EXPECT_EQ(scheduler->GetInFlightCount(), 1);
+    EXPECT_EQ(scheduler->GetQueuedCount(), 1);
+
+    scheduler->OnSyncCompleted({{DEVICE_A, SyncStatus::SUCCEEDED}});
+    EXPECT_EQ(first->callCount, 1);
+    EXPECT_EQ(second->callCount, 0);
+    ASSERT_EQ(fakeKv.calls.size(), 2);
+    EXPECT_EQ(fakeKv.calls[1].second, SyncMode::PUSH_PULL);
+
+    scheduler->OnSyncCompleted({{DEVICE_A, SyncStatus::SUCCEEDED}});
+    EXPECT_EQ(second->callCount, 1);
+    EXPECT_EQ(third->callCount, 1);
+    EXPECT_EQ(third->lastResults[DEVICE_A], SyncStatus::SUCCEEDED);
+    EXPECT_EQ(fakeKv.calls.size(), 2);
+    EXPECT_EQ(scheduler->GetInFlightCount(), 0);
+}
+
+/**
+ * @tc.name: Schedule003
+ * @tc.desc: no more than maxInFlight peers sync at once, the rest start as slots free up
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, Schedule003, TestSize.Level1)
+{
+    FakeKvSync fakeKv;
+    auto scheduler = CreateScheduler(fakeKv, 2);
+    sptr<CountingSyncCallback> callback = sptr<CountingSyncCallback>(new CountingSyncCallback());
+    EXPECT_EQ(scheduler->Schedule({DEVICE_A, DEVICE_B, DEVICE_C, DEVICE_D}, SyncMode::PUSH_PULL, callback),
+        DP_SUCCESS);
+    ASSERT_EQ(fakeKv.calls.size(), 1);
+    EXPECT_EQ(fakeKv.calls[0].first.size(), 2);
+    EXPECT_EQ(scheduler->GetInFlightCount(), 2);
+    EXPECT_EQ(scheduler->GetQueuedCount(), 2);
+
+    scheduler->OnSyncCompleted({{DEVICE_A, SyncStatus::SUCCEEDED}, {DEVICE_B, SyncStatus::FAILED}});
+    ASSERT_EQ(fakeKv.calls.size(), 2);
+    EXPECT_EQ(scheduler->GetInFlightCount(), 2);
+    EXPECT_EQ(callback->callCount, 0);
+
+    scheduler->OnSyncCompleted({{DEVICE_C, SyncStatus::SUCCEEDED}, {DEVICE_D, SyncStatus::SUCCEEDED}});
+    EXPECT_EQ(callback->callCount, 1);
+    EXPECT_EQ(callback->lastResults.size(), 4);
+    EXPECT_EQ(callback->lastResults[DEVICE_B], SyncStatus::FAILED);
+}
+
+/**
+ * @tc.name: Schedule004
+ * @tc.desc: a kv sync that fails to start is reported as failed right away
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, Schedule004, TestSize.Level1)
+{
+    FakeKvSync fakeKv;
+    fakeKv.result = DP_SYNC_DEVICE_FAIL;
+    auto scheduler = CreateScheduler(fakeKv, 1);
+    sptr<CountingSyncCallback> callback = sptr<CountingSyncCallback>(new CountingSyncCallback());
+    EXPECT_EQ(scheduler->Schedule({DEVICE_A, DEVICE_B}, SyncMode::PUSH, callback), DP_SUCCESS);
+    EXPECT_EQ(fakeKv.calls.size(), 2);
+    EXPECT_EQ(callback->callCount, 1);
+    EXPECT_EQ(callback->lastResults[DEVICE_A], SyncStatus::FAILED);
+    EXPECT_EQ(callback->lastResults[DEVICE_B], SyncStatus::FAILED);
+    EXPECT_EQ(scheduler->GetInFlightCount(), 0);
+}
+
+/**
+ * @tc.name: CheckTimeout001
+ * @tc.desc: syncs without a completion are failed after the timeout, stray completions are ignored
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, CheckTimeout001, TestSize.Level1)
+{
+    FakeKvSync fakeKv;
+    auto syncFunc = [&fakeKv](const std::vector<std::string>& deviceIds, SyncMode syncMode) {
+        return fakeKv.Sync(deviceIds, syncMode);
+    };
+    auto scheduler = std::make_shared<SyncScheduler>("sync_scheduler_test", syncFunc, 1, 0);
+    sptr<CountingSyncCallback> callback = sptr<CountingSyncCallback>(new CountingSyncCallback());
+    EXPECT_EQ(scheduler->Schedule({DEVICE_A}, SyncMode::PUSH, callback), DP_SUCCESS);
+    scheduler->CheckTimeout();
+    EXPECT_EQ(callback->callCount, 1);
+    EXPECT_EQ(callback->lastResults[DEVICE_A], SyncStatus::FAILED);
+    scheduler->OnSyncCompleted({{DEVICE_A, SyncStatus::SUCCEEDED}});
+    EXPECT_EQ(callback->callCount, 1);
+}
+
+/**
+ * @tc.name: Reset001
+ * @tc.desc: reset fails every in flight and queued caller
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, Reset001, TestSize.Level1)
+{
+    FakeKvSync fakeKv;
+    auto scheduler = CreateScheduler(fakeKv, 1);
+    sptr<CountingSyncCallback> first = sptr<CountingSyncCallback>(new CountingSyncCallback());
+    sptr<CountingSyncCallback> second = sptr<CountingSyncCallback>(new CountingSyncCallback());
+    EXPECT_EQ(scheduler->Schedule({DEVICE_A}, SyncMode::PUSH, first), DP_SUCCESS);
+    EXPECT_EQ(scheduler->Schedule({DEVICE_B}, SyncMode::PUSH, second), DP_SUCCESS);
+    scheduler->Reset();
+    EXPECT_EQ(first->callCount, 1);
+    EXPECT_EQ(second->callCount, 1);
+    EXPECT_EQ(second->lastResults[DEVICE_B], SyncStatus::FAILED);
+    EXPECT_EQ(scheduler->GetInFlightCount(), 0);
+    EXPECT_EQ(scheduler->GetQueuedCount(), 0);
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "distributed_device_profile_errors.h"
+#include "event_handler_factory.h"
+#include "write_behind_kv_adapter.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace DistributedDeviceProfile {
+using namespace std;
+namespace {
+    const std::string STORE_NAME = "write_behind_test";
+    const std::string KEY_PREFIX = "dev#udid#";
+    const std::string KEY_A = "dev#udid#a";
+    const std::string KEY_B = "dev#udid#b";
+    const std::string KEY_OTHER = "svr#udid#c";
+    constexpr int64_t LONG_WINDOW_MS = 10000;
+    constexpr int64_t SHORT_WINDOW_MS = 20;
+    constexpr size_t TEST_MAX_PENDING = 4;
+}
+
+// Stands in for the kv store: keeps entries in memory and counts the commits.
+class FakeKvStore : public IKVAdapter {
+public:
+    int32_t Init() override { return DP_SUCCESS; }
+    int32_t UnInit() override
+    {
+        unInitCount++;
+        return DP_SUCCESS;
+    }
+    int32_t Put(const std::string& key, const std::string& value) override
+    {
+        lock_guard<mutex> lock(storeMutex_);
+        putCount++;
+        entries[key] = value;
+        return DP_SUCCESS;
+    }
+    int32_t PutBatch(const std::map<std::string, std::string>& values) override
+    {
+        lock_guard<mutex> lock(storeMutex_);
+        if (putResult != DP_SUCCESS) {
+            return putResult;
+        }
+        if (failPutBatchCount > 0) {
+            failPutBatchCount--;
+            return DP_PUT_KV_DB_FAIL;
+        }
+        putBatchCount++;
+        for (const auto& [key, value] : values) {
+            entries[key] = value;
+        }
+        return DP_SUCCESS;
+    }
+    int32_t Delete(const std::string& key) override
+    {
+        lock_guard<mutex> lock(storeMutex_);
+        entries.erase(key);
+        return DP_SUCCESS;
+    }
+    int32_t DeleteByPrefix(const std::string& keyPrefix) override
+    {
+        lock_guard<mutex> lock(storeMutex_);
+        for (auto iter = entries.begin(); iter != entries.end();) {
+            iter = iter->first.compare(0, keyPrefix.size(), keyPrefix) == 0 ? entries.erase(iter) : ++iter;
+        }
+        return DP_SUCCESS;
+    }
+    int32_t Get(const std::string& key, std::string& value) override
+    {
+        lock_guard<mutex> lock(storeMutex_);
+        auto iter = entries.find(key);
+        if (iter == entries.end()) {
+            return DP_GET_KV_DB_FAIL;
+        }
+        value = iter->second;
+        return DP_SUCCESS;
+    }
+    int32_t GetByPrefix(const std::string& keyPrefix, std::map<std::string, std::string>& values) override
+    {
+        lock_guard<mutex> lock(storeMutex_);
+        for (const auto& [key, value] : entries) {
+            if (key.compare(0, keyPrefix.size(), keyPrefix) == 0) {
+                values[key] = value;
+            }
+        }
+        // same as the kv adapter
+        return values.empty() ? DP_INVALID_PARAMS : DP_SUCCESS;
+    }
+    int32_t Sync(const std::vector<std::string>& deviceList, SyncMode syncMode) override
+    {
+        lock_guard<mutex> lock(storeMutex_);
+        syncSawEntries = entries.size();
+        return DP_SUCCESS;
+    }
+    int32_t GetDeviceEntries(const std::string& udid, std::map<std::string, std::string>& values) override
+    {
+        return DP_SUCCESS;
+    }
+    int32_t DeleteBatch(const std::vector<std::string>& keys) override
+    {
+        lock_guard<mutex> lock(storeMutex_);
+        for (const auto& key : keys) {
+            entries.erase(key);
+        }
+        return DP_SUCCESS;
+    }
+    int32_t RemoveDeviceData(const std::string& uuid) override { return DP_SUCCESS; }
+
+    size_t GetEntryCount()
+    {
+        lock_guard<mutex> lock(storeMutex_);
+        return entries.size();
+    }
+
+    std::map<std::string, std::string> entries;
+    int32_t putCount = 0;
+    int32_t putBatchCount = 0;
+    int32_t unInitCount = 0;
+    int32_t putResult = DP_SUCCESS;
+    // the next PutBatch calls that fail
+    int32_t failPutBatchCount = 0;
+    size_t syncSawEntries = 0;
+
+private:
+    mutex storeMutex_;
+};
+
+class WriteBehindKvAdapterTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        EventHandlerFactory::GetInstance().Init();
+    }
+    static void TearDownTestCase()
+    {
+        EventHandlerFactory::GetInstance().UnInit();
+    }
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: Put001
+ * @tc.desc: puts of the same key within a window are coalesced and written in one group commit
+ * @tc.type: FUNC
+ */
+HWTEST_F(WriteBehindKvAdapterTest, Put001, TestSize.Level1)
+{
+    auto store = make_shared<FakeKvStore>();
+    auto adapter = make_shared<WriteBehindKvAdapter>(STORE_NAME, store, LONG_WINDOW_MS);
+    EXPECT_EQ(adapter->Put(KEY_A, "1"), DP_SUCCESS);
+    EXPECT_EQ(adapter->Put(KEY_A, "2"), DP_SUCCESS);
+    EXPECT_EQ(adapter->PutBatch({ { KEY_A, "3" }, { KEY_B, "1" } }), DP_SUCCESS);
+    EXPECT_EQ(adapter->GetPendingCount(), 2);
+    EXPECT_EQ(store->GetEntryCount(), 0);
+    EXPECT_EQ(adapter->Flush(), DP_SUCCESS);
+    EXPECT_EQ(store->putBatchCount, 1);
+    EXPECT_EQ(store->putCount, 0);
+    EXPECT_EQ(store->entries[KEY_A], "3");
+    EXPECT_EQ(adapter->GetPendingCount(), 0);
+    EXPECT_EQ(adapter->Put("", "1"), DP_INVALID_PARAMS);
+}
+
+/**
+ * @tc.name: Get001
+ * @tc.desc: reads see buffered writes before they reach the store
+ * @tc.type: FUNC
+ */
+HWTEST_F(WriteBehindKvAdapterTest, Get001, TestSize.Level1)
+{
+    auto store = make_shared<FakeKvStore>();
+    store->entries[KEY_A] = "old";
+    store->entries[KEY_OTHER] = "other";
+    auto adapter = make_shared<WriteBehindKvAdapter>(STORE_NAME, store, LONG_WINDOW_MS);
+    EXPECT_EQ(adapter->Put(KEY_A, "new"), DP_SUCCESS);
+    EXPECT_EQ(adapter->Put(KEY_B, "b"), DP_SUCCESS);
+    string value;
+    EXPECT_EQ(adapter->Get(KEY_A, value), DP_SUCCESS);
+    EXPECT_EQ(value, "new");
+    EXPECT_EQ(adapter->Get(KEY_OTHER, value), DP_SUCCESS);
+    EXPECT_EQ(value, "other");
+    map<string, string> values;
+    EXPECT_EQ(adapter->GetByPrefix(KEY_PREFIX, values), DP_SUCCESS);
+    EXPECT_EQ(values.size(), 2);
+    EXPECT_EQ(values[KEY_A], "new");
+    store->entries.clear();
+    values.clear();
+    EXPECT_EQ(adapter->GetByPrefix(KEY_PREFIX, values), DP_SUCCESS);
+    EXPECT_EQ(values.size(), 2);
+}
+
+/**
+ * @tc.name: Delete001
+ * @tc.desc: a delete drops the buffered put, Sync and UnInit see a flushed store
+ * @tc.type: FUNC
+ */
+HWTEST_F(WriteBehindKvAdapterTest, Delete001, TestSize.Level1)
+{
+    auto store = make_shared<FakeKvStore>();
+    auto adapter = make_shared<WriteBehindKvAdapter>(STORE_NAME, store, LONG_WINDOW_MS);
+    EXPECT_EQ(adapter->Put(KEY_A, "a"), DP_SUCCESS);
+    EXPECT_EQ(adapter->Delete(KEY_A), DP_SUCCESS);
+    string value;
+    EXPECT_NE(adapter->Get(KEY_A, value), DP_SUCCESS);
+    EXPECT_EQ(store->putBatchCount, 0);
+    EXPECT_EQ(adapter->Put(KEY_B, "b"), DP_SUCCESS);
+    EXPECT_EQ(adapter->Sync({ "networkId" }, SyncMode::PUSH), DP_SUCCESS);
+    EXPECT_EQ(store->syncSawEntries, 1);
+    EXPECT_EQ(adapter->Put(KEY_OTHER, "c"), DP_SUCCESS);
+    EXPECT_EQ(adapter->UnInit(), DP_SUCCESS);
+    EXPECT_EQ(store->GetEntryCount(), 2);
+    EXPECT_EQ(store->unInitCount, 1);
+}
+
+/**
+ * @tc.name: Flush001
+ * @tc.desc: the window timer and a full buffer both flush, a failed flush keeps newer values
+ * @tc.type: FUNC
+ */
+HWTEST_F(WriteBehindKvAdapterTest, Flush001, TestSize.Level1)
+{
+    auto store = make_shared<FakeKvStore>();
+    auto adapter = make_shared<WriteBehindKvAdapter>(STORE_NAME, store, SHORT_WINDOW_MS, TEST_MAX_PENDING);
+    EXPECT_EQ(adapter->Put(KEY_A, "a"), DP_SUCCESS);
+    this_thread::sleep_for(chrono::milliseconds(SHORT_WINDOW_MS * 10));
+    EXPECT_EQ(store->GetEntryCount(), 1);
+    EXPECT_EQ(adapter->GetPendingCount(), 0);
+
+    auto failAdapter = make_shared<WriteBehindKvAdapter>(STORE_NAME, store, LONG_WINDOW_MS, TEST_MAX_PENDING);
+    store->putResult = DP_PUT_KV_DB_FAIL;
+    EXPECT_EQ(failAdapter->PutBatch({ { "k1", "v" }, { "k2", "v" }, { "k3", "v" } }), DP_SUCCESS);
+    EXPECT_EQ(failAdapter->Put(KEY_A, "b"), DP_PUT_KV_DB_FAIL);
+    EXPECT_EQ(failAdapter->GetPendingCount(), TEST_MAX_PENDING);
+    EXPECT_EQ(failAdapter->Put(KEY_A, "c"), DP_PUT_KV_DB_FAIL);
+    string value;
+    EXPECT_EQ(failAdapter->Get(KEY_A, value), DP_SUCCESS);
+    EXPECT_EQ(value, "c");
+    store->putResult = DP_SUCCESS;
+    EXPECT_EQ(failAdapter->Flush(), DP_SUCCESS);
+    EXPECT_EQ(store->entries[KEY_A], "c");
+    EXPECT_EQ(store->GetEntryCount(), TEST_MAX_PENDING);
+}
+/**
+ * @tc.name: UnInit001
+ * @tc.desc: a failed final flush returns the error and keeps the entries for the next attempt
+ * @tc.type: FUNC
+ */
+HWTEST_F(WriteBehindKvAdapterTest, UnInit001, TestSize.Level1)
+{
+    auto store = make_shared<FakeKvStore>();
+    auto adapter = make_shared<WriteBehindKvAdapter>(STORE_NAME, store, LONG_WINDOW_MS);
+    EXPECT_EQ(adapter->Put(KEY_A, "a"), DP_SUCCESS);
+    store->putResult = DP_PUT_KV_DB_FAIL;
+    EXPECT_EQ(adapter->UnInit(), DP_PUT_KV_DB_FAIL);
+    EXPECT_EQ(adapter->GetPendingCount(), 1);
+    EXPECT_EQ(store->unInitCount, 0);
+    store->putResult = DP_SUCCESS;
+    EXPECT_EQ(adapter->UnInit(), DP_SUCCESS);
+    EXPECT_EQ(store->entries[KEY_A], "a");
+    EXPECT_EQ(store->unInitCount, 1);
+}
+
+/**
+ * @tc.name: PutBatch001
+ * @tc.desc: a large batch written past a failed flush is not overwritten by the older buffered values
+ * @tc.type: FUNC
+ */
+HWTEST_F(WriteBehindKvAdapterTest, PutBatch001, TestSize.Level1)
+{
+    auto store = make_shared<FakeKvStore>();
+    auto adapter = make_shared<WriteBehindKvAdapter>(STORE_NAME, store, LONG_WINDOW_MS, TEST_MAX_PENDING);
+    EXPECT_EQ(adapter->Put(KEY_A, "old"), DP_SUCCESS);
+    EXPECT_EQ(adapter->Put(KEY_B, "b"), DP_SUCCESS);
+    store->failPutBatchCount = 1;
+    EXPECT_EQ(adapter->PutBatch({ { KEY_A, "new" }, { "k1", "v" }, { "k2", "v" }, { "k3", "v" } }), DP_SUCCESS);
+    EXPECT_EQ(adapter->GetPendingCount(), 1);
+    string value;
+    EXPECT_EQ(adapter->Get(KEY_A, value), DP_SUCCESS);
+    EXPECT_EQ(value, "new");
+    EXPECT_EQ(adapter->Flush(), DP_SUCCESS);
+    EXPECT_EQ(store->entries[KEY_A], "new");
+    EXPECT_EQ(store->entries[KEY_B], "b");
+}
+} // namespace DistributedDeviceProfile
+} // namespace OHOS